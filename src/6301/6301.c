@@ -69,6 +69,11 @@ COUNTER_VAR cycles_run = 0;
 unsigned int mouse_x_counter;
 unsigned int mouse_y_counter;
 int crashed = 0;
+struct hd6301_skipped hd6301_skipped;
+
+#ifdef HD6301_STATS
+struct hd6301_stats hd6301_stats;
+#endif
 
 // Debug facilities
 // #if defined(TRACE_6301)
@@ -102,6 +107,14 @@ int crashed = 0;
 #include "optab.c"
 #include "sci.c"
 #include "timer.c"
+#include "predecode.c"
+#if HD6301_BLOCK_CACHE
+#include "bcache.c"
+#endif
+#include "dispatch.c"
+#if HD6301_SNAPSHOT
+#include "snapshot.c"
+#endif
 
 // Interface with Steem
 
@@ -116,6 +129,7 @@ hd6301_destroy() {
 hd6301_reset(int Cold) {
   DPRINTF("6301 emu cpu reset (cold %d)\n", Cold);
   crashed = 0;
+  timer_sync();  // FRC keeps running across a warm reset
   cpu_reset();
   if (Cold) {
     WORD rnd = rand() % 16;
@@ -127,13 +141,27 @@ hd6301_reset(int Cold) {
     mouse_x_counter = _rotl(mouse_x_counter, rnd);
     mouse_y_counter = _rotl(mouse_y_counter, rnd);
     // DPRINTF("Mouse mask %X\n",mouse_x_counter); // 333... 666 999 CCC
+    predecode_rom_build();  // the ROM image is in place by now
+    dispatch_rom_build();
   }
   iram[TRCSR] = 0x20;
+  sci_tx_begin = sci_tx_end = cpu.ncycles;  // nothing being sent
+  sci_rx_next = sci_rx_last = sci_wu_end = cpu.ncycles;
+  if (Cold) {
+    sci_rx_flush();
+    kbd_reset();
+  }
   mem_putw(OCR, 0xFFFF);
+  timer_reload();
+  cpu_int_recheck();
 }
 
 void hd6301_run_clocks(COUNTER_VAR clocks) {
   // Called by Steem to run some cycles (per scanline or to update before IO)
+  hd6301_run_until(clocks, 0, NULL);
+}
+
+int hd6301_run_until(COUNTER_VAR clocks, int events, COUNTER_VAR *ran) {
   int pc;
   COUNTER_VAR starting_cycles = cpu.ncycles;
 
@@ -142,25 +170,46 @@ void hd6301_run_clocks(COUNTER_VAR clocks) {
     DPRINTF("6301 starting cpu\n");
     cpu_start();
   }
-  if (iram[TRCSR] & 1) {
-    DPRINTF("6301 waking up (PC %X cycles %lu)\n", reg_getpc(), cpu.ncycles);
-    iram[TRCSR] &= ~1;
-  }
   pc = reg_getpc();
+  sci_rx_schedule();  // bytes queued since the last run
+  cpu.events = 0;
+  cpu.event_stop = events;
 
-  while (!crashed && ((cpu.ncycles - starting_cycles) < clocks)) {
+#if HD6301_ENGINE != HD6301_ENGINE_REFERENCE
+  dispatch_run(clocks);
+#else
+  while (!crashed && ((cpu.ncycles - starting_cycles) < clocks) &&
+         !(cpu.events & events)) {
     instr_exec();  // execute one instruction
   }
+#endif
+  cpu.event_stop = 0;
+  timer_sync();  // for whoever looks at the registers between runs
+  if (ran) *ran = cpu.ncycles - starting_cycles;
+  return (cpu.events & events) | (crashed ? HD6301_EVENT_CRASH : 0);
 }
 
-hd6301_receive_byte(u_char byte_in) { return sci_in(&byte_in, 1); }
+int hd6301_receive_byte(u_char byte_in) { return sci_rx_put(byte_in); }
 
-void hd6301_tx_empty(int empty) {
-  // Once our serial port TX buffer has space then set the register
-  // to show the CPU another byte can be sent
-  if (empty) {
-    iram[TRCSR] |= TDRE;
-  }
+int hd6301_rx_free() { return sci_rx_free(); }
+
+int hd6301_sci_busy() {
+  return (sci_rx_queued() || (iram[TRCSR] & RDRF)) ? 1 : 0;
+}
+
+int hd6301_sleeping() { return cpu_isasleep(); }
+
+COUNTER_VAR hd6301_cycles() { return cpu.ncycles; }
+
+void hd6301_set_key(int scancode, int down) { kbd_set(scancode, down); }
+
+#ifdef HD6301_STATS
+void hd6301_stats_reset(void) {
+  memset(&hd6301_stats, 0, sizeof(hd6301_stats));
+  memset(&hd6301_skipped, 0, sizeof(hd6301_skipped));
 }
 
-int hd6301_sci_busy() { return (iram[TRCSR] & RDRF) ? 1 : 0; }
+const char* hd6301_opcode_mnemonic(int opcode) {
+  return opcodetab[opcode & 0xFF].op_mnemonic;
+}
+#endif
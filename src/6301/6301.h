@@ -84,9 +84,24 @@ BYTE* hd6301_init();
 int hd6301_destroy();  // like a C++ destructor
 int hd6301_reset(int Cold);
 void hd6301_run_clocks(COUNTER_VAR clocks);
-int hd6301_receive_byte(u_char byte_in);  // just passing through
-void hd6301_tx_empty(int empty);
-int hd6301_sci_busy();
+int hd6301_run_until(COUNTER_VAR clocks, int events, COUNTER_VAR* ran);
+// Received bytes are queued and go into RDR one byte time apart, on the
+// core running the 6301. Both may be called from another core.
+int hd6301_receive_byte(u_char byte_in);  // 0 if the queue is full
+int hd6301_rx_free();                     // room left in the queue
+int hd6301_sci_busy();  // bytes queued or not read from RDR yet
+int hd6301_sleeping();  // stopped by SLP or WAI until an interrupt
+COUNTER_VAR hd6301_cycles();  // cycles run since hd6301_init()
+// Cycles skipped rather than run by dispatch_run(), kept in every build.
+// Plain counters, written on the core running the 6301; the host tools
+// (ikbd_bench, engine_test, sci_test) read them, the firmware doesn't.
+struct hd6301_skipped {
+  COUNTER_VAR idle_cycles;   // fast-forwarded idle loops, HD6301_IDLE_SKIP
+  COUNTER_VAR sleep_cycles;  // stopped by SLP or WAI
+};
+extern struct hd6301_skipped hd6301_skipped;
+// Key in the matrix, held until the ROM has seen it (see ireg.c)
+void hd6301_set_key(int scancode, int down);
 
 #define MOUSE_MASK 0x33333333  // 20bit on real HW?
 
@@ -95,6 +110,60 @@ extern unsigned int mouse_y_counter;
 
 extern int crashed;
 
+// Events ending hd6301_run_until() early, after the instruction that caused
+// them. The status returned has the ones that happened, and always
+// HD6301_EVENT_CRASH when the CPU crashed.
+#define HD6301_EVENT_TX 0x01     // byte passed to serialp_send()
+#define HD6301_EVENT_RX 0x02     // received byte taken from RDR
+#define HD6301_EVENT_SLEEP 0x04  // SLP or WAI executed
+#define HD6301_EVENT_CRASH 0x08  // crashed
+
+// Execution engine used by hd6301_run_clocks()
+#define HD6301_ENGINE_REFERENCE 0  // instr_exec(), one call per instruction
+#define HD6301_ENGINE_THREADED 1   // dispatch_run(), see dispatch.c
+#define HD6301_ENGINE_AOT 2        // dispatch_run() and the ROM in aotrom.c
+#ifndef HD6301_ENGINE
+#define HD6301_ENGINE HD6301_ENGINE_THREADED
+#endif
+// Idle loop fast-forward in the threaded engine, see IDLE_LOOP() in
+// dispatch.c
+#ifndef HD6301_IDLE_SKIP
+#define HD6301_IDLE_SKIP 0
+#endif
+// Runtime block cache for the threaded engine, see bcache.c
+#ifndef HD6301_BLOCK_CACHE
+#define HD6301_BLOCK_CACHE 0
+#endif
+#if HD6301_BLOCK_CACHE
+// On unless cleared, for the host benchmark to measure the engine without
+extern int hd6301_block_cache;
+#endif
+// Whole-core save and restore for the host tools, see snapshot.c
+#ifndef HD6301_SNAPSHOT
+#define HD6301_SNAPSHOT 0
+#endif
+
+#ifdef HD6301_STATS
+// Execution counters, only compiled in for host benchmarking builds
+struct hd6301_stats {
+  COUNTER_VAR instructions;     // instructions executed
+  COUNTER_VAR interrupts;       // hardware interrupts taken
+  COUNTER_VAR rx_overruns;      // received bytes lost, RDR not read in time
+  COUNTER_VAR aot_blocks;       // translated ROM blocks run (dispatch.c)
+  COUNTER_VAR aot_instructions; // instructions run in translated blocks
+  COUNTER_VAR block_lookups;    // block cache lookups (bcache.c)
+  COUNTER_VAR block_fills;      // runs recorded in the block cache
+  COUNTER_VAR block_runs;       // runs executed from the block cache
+  COUNTER_VAR block_instructions; // instructions run with no checks before
+  COUNTER_VAR opcodes[256];     // executions per opcode
+};
+
+extern struct hd6301_stats hd6301_stats;
+
+void hd6301_stats_reset(void);
+const char* hd6301_opcode_mnemonic(int opcode);
+#endif
+
 #define USE_PROTOTYPES
 
 #ifdef __cplusplus
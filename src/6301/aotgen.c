@@ -0,0 +1,384 @@
+/*
+ * aotgen.c - translate the IKBD ROM to C for the AOT engine
+ *
+ * A host program, built by tests/host and not part of the firmware. It
+ * walks the ROM's control flow from the reset and interrupt vectors and
+ * writes aotrom.c: one piece of straight C per basic block, made of the
+ * opcode bodies of dispatch_ops.h with the operands filled in, and a table
+ * from ROM address to block. dispatch.c includes the result when built
+ * with HD6301_ENGINE_AOT.
+ *
+ * Only what can be proved from the image is translated: the code reached
+ * by branches, jumps and subroutine calls to fixed addresses. Computed
+ * jumps (jmp/jsr indexed, rts, rti, interrupts) go back through the
+ * dispatcher, which enters a block if one starts at the new PC and
+ * interprets the instructions otherwise, as it does for code in RAM.
+ *
+ * Cycles are the ones of opcodetab[], accounted for at the same
+ * instruction boundaries as the interpreter whenever they can be observed:
+ * before any access that may reach an I/O handler, at the end of a block,
+ * and wherever a timer event or an interrupt could come in between (see
+ * AOT_BEGIN() in dispatch.c).
+ *
+ * Usage: aotgen [output file], standard output by default
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "defs.h"
+#include "opfunc.h"
+#include "optab.h"
+
+#define ROM_START 0xF000
+#define ROM_SIZE 0x1000
+#define VECTORS 0xFFEE  // trap, SCI, TOF, OCF, ICF, IRQ, SWI, NMI, reset
+
+extern const unsigned char rom_HD6301V1ST_img[];
+
+// Opcode bodies as text, from the same file dispatch.c compiles
+#define OP(code, ...) [0x##code] = #__VA_ARGS__,
+#define TRAP(code) [0x##code] = "INTERRUPT(TRAPVECTOR)",
+static const char* const op_body[256] = {
+#include "dispatch_ops.h"
+};
+#undef OP
+#undef TRAP
+
+// How an instruction ends its block, and what it may do on the way
+enum flow {
+  FLOW_NEXT,    // falls through
+  FLOW_BRANCH,  // bra..ble: target or fall through
+  FLOW_CALL,    // bsr, jsr to a fixed address: target, returns after
+  FLOW_JUMP,    // jmp to a fixed address
+  FLOW_DYNAMIC  // rts, rti, swi, trap, jmp/jsr indexed: PC known at run time
+};
+
+enum effect {
+  EFFECT_NONE,  // registers only, or RAM and ROM at fixed addresses
+  EFFECT_SYNC   // may reach an I/O handler or change the interrupt state
+};
+
+struct insn {
+  unsigned addr, op, len, cycles, opnd;
+  enum flow flow;
+  enum effect effect;
+  unsigned target;  // FLOW_BRANCH, FLOW_CALL, FLOW_JUMP
+};
+
+static uint8_t rom[ROM_SIZE];
+static uint8_t reached[ROM_SIZE];  // an instruction starts here
+static uint8_t leader[ROM_SIZE];   // a block starts here
+static unsigned block_number[ROM_SIZE];
+
+static int in_rom(unsigned addr) { return addr - ROM_START < ROM_SIZE; }
+
+static unsigned rom_byte(unsigned addr) {
+  return in_rom(addr & 0xFFFF) ? rom[(addr & 0xFFFF) - ROM_START] : 0;
+}
+
+static int undefined_op(unsigned op) { return opcodetab[op].op_func == trap; }
+
+// Fixed addresses that never reach an I/O handler: internal RAM, and the
+// ROM when only read
+static int plain_memory(unsigned addr, unsigned width, int write) {
+  unsigned last = addr + width - 1;
+  if (addr >= 0x80 && last <= 0xFF) return 1;
+  return !write && addr >= ROM_START && last <= 0xFFFF;
+}
+
+/*
+ * Memory access of the direct and extended modes: address, width, and
+ * whether it writes. Returns 0 for instructions with no such access.
+ */
+static int fixed_access(const struct insn* in, unsigned* addr, unsigned* width,
+                        int* write) {
+  unsigned op = in->op, low = op & 0x0F;
+  *width = 1;
+  *write = 0;
+  switch (op & 0xF0) {
+    case 0x70:
+      if (op == 0x71 || op == 0x72 || op == 0x75 || op == 0x7b) {
+        *addr = in->opnd & 0xFF;  // aim/oim/eim/tim direct
+        *write = op != 0x7b;
+      } else {
+        *addr = in->opnd;
+        *write = op != 0x7d;  // all but tst read and write
+      }
+      return 1;
+    case 0x90:
+    case 0xD0:
+      *addr = in->opnd >> 8;
+      break;
+    case 0xB0:
+    case 0xF0:
+      *addr = in->opnd;
+      break;
+    default:
+      return 0;
+  }
+  // staa/stab write, the 16-bit loads and compares read two bytes and
+  // the 16-bit stores write two
+  if (low == 0x07) *write = 1;
+  if (low == 0x03 || low == 0x0C || low == 0x0E) *width = 2;
+  if (low == 0x0D || low == 0x0F) *width = 2, *write = 1;
+  return 1;
+}
+
+static void decode(unsigned addr, struct insn* in) {
+  in->addr = addr;
+  in->op = rom_byte(addr);
+  in->len = 1 + opcodetab[in->op].op_n_operands;
+  in->cycles = opcodetab[in->op].op_n_cycles;
+  in->opnd = (rom_byte(addr + 1) << 8) | rom_byte(addr + 2);
+  in->flow = FLOW_NEXT;
+  in->effect = EFFECT_NONE;
+  in->target = 0;
+
+  unsigned op = in->op;
+  if (undefined_op(op)) {
+    in->len = 1;
+    in->flow = FLOW_DYNAMIC;
+    in->effect = EFFECT_SYNC;
+    return;
+  }
+  if ((op & 0xF0) == 0x20) {
+    in->flow = FLOW_BRANCH;
+    in->target = (addr + 2 + (int8_t)(in->opnd >> 8)) & 0xFFFF;
+    return;
+  }
+  switch (op) {
+    case 0x06:  // tap
+    case 0x0e:  // cli
+    case 0x19:  // daa
+    case 0x1a:  // slp
+    case 0x3e:  // wai
+      in->effect = EFFECT_SYNC;
+      return;
+    case 0x32: case 0x33: case 0x36: case 0x37: case 0x38: case 0x3c:
+      in->effect = EFFECT_SYNC;  // stack
+      return;
+    case 0x39:  // rts
+      in->flow = FLOW_DYNAMIC;
+      in->effect = EFFECT_SYNC;
+      return;
+    case 0x3b:  // rti
+    case 0x3f:  // swi
+      in->flow = FLOW_DYNAMIC;
+      in->effect = EFFECT_SYNC;
+      return;
+    case 0x6e:  // jmp indexed
+      in->flow = FLOW_DYNAMIC;
+      return;
+    case 0xad:  // jsr indexed
+      in->flow = FLOW_DYNAMIC;
+      in->effect = EFFECT_SYNC;
+      return;
+    case 0x7e:  // jmp extended
+      in->flow = FLOW_JUMP;
+      in->target = in->opnd;
+      return;
+    case 0x8d:  // bsr
+      in->flow = FLOW_CALL;
+      in->effect = EFFECT_SYNC;
+      in->target = (addr + 2 + (int8_t)(in->opnd >> 8)) & 0xFFFF;
+      return;
+    case 0x9d:  // jsr direct
+      in->flow = FLOW_CALL;
+      in->effect = EFFECT_SYNC;
+      in->target = in->opnd >> 8;
+      return;
+    case 0xbd:  // jsr extended
+      in->flow = FLOW_CALL;
+      in->effect = EFFECT_SYNC;
+      in->target = in->opnd;
+      return;
+  }
+  if ((op & 0xF0) == 0x60 || (op & 0xF0) == 0xA0 || (op & 0xF0) == 0xE0) {
+    in->effect = EFFECT_SYNC;  // indexed
+    return;
+  }
+  unsigned maddr, width;
+  int write;
+  if (fixed_access(in, &maddr, &width, &write) &&
+      !plain_memory(maddr, width, write)) {
+    in->effect = EFFECT_SYNC;
+  }
+}
+
+// Mark the instructions reached from 'root' and the blocks they start
+static void walk(unsigned root) {
+  static unsigned stack[ROM_SIZE];
+  int depth = 0;
+  if (!in_rom(root)) return;
+  leader[root - ROM_START] = 1;
+  stack[depth++] = root;
+  while (depth > 0) {
+    unsigned addr = stack[--depth];
+    for (;;) {
+      struct insn in;
+      if (!in_rom(addr) || reached[addr - ROM_START]) break;
+      decode(addr, &in);
+      if (!in_rom(addr + in.len - 1)) break;
+      reached[addr - ROM_START] = 1;
+      if (in.flow != FLOW_NEXT && in.flow != FLOW_DYNAMIC &&
+          in_rom(in.target)) {
+        leader[in.target - ROM_START] = 1;
+        stack[depth++] = in.target;
+      }
+      if (in.flow == FLOW_JUMP || in.flow == FLOW_DYNAMIC ||
+          (in.flow == FLOW_BRANCH && in.op == 0x20)) {
+        break;
+      }
+      addr = (addr + in.len) & 0xFFFF;
+      if (in.flow != FLOW_NEXT && in_rom(addr)) {
+        leader[addr - ROM_START] = 1;  // branch not taken, return address
+      }
+    }
+  }
+}
+
+static void disassemble(const struct insn* in, char* text, size_t size) {
+  const char* format = opcodetab[in->op].op_mnemonic;
+  unsigned value = in->len == 2 ? in->opnd >> 8 : in->opnd;
+  if (in->op == 0x8d || (in->op & 0xF0) == 0x20) value = in->target;
+  if (undefined_op(in->op)) format = "trap";
+  snprintf(text, size, format, value);
+}
+
+static void emit_goto(unsigned addr) {
+  if (in_rom(addr) && leader[addr - ROM_START]) {
+    printf("  goto aot_%04X;\n", addr);
+  } else {
+    printf("  AOT_EXIT();\n");
+  }
+}
+
+static void emit_block(unsigned start) {
+  static struct insn insns[ROM_SIZE];
+  int count = 0;
+  unsigned total = 0, addr = start;
+
+  // Up to a transfer of control or the next block
+  for (;;) {
+    struct insn* in = &insns[count++];
+    decode(addr, in);
+    total += in->cycles;
+    addr = (addr + in->len) & 0xFFFF;
+    if (in->flow != FLOW_NEXT) break;
+    if (!in_rom(addr) || !reached[addr - ROM_START]) break;
+    if (leader[addr - ROM_START]) break;
+  }
+
+  printf("\naot_%04X: /* %04X-%04X */\n", start, start,
+         (insns[count - 1].addr + insns[count - 1].len - 1) & 0xFFFF);
+  printf("  AOT_BEGIN(%u);\n", total);
+  unsigned pending = 0, rest = total;
+  for (int i = 0; i < count; i++) {
+    const struct insn* in = &insns[i];
+    char text[48];
+    disassemble(in, text, sizeof(text));
+    printf("  /* %04X: %s */\n", in->addr, text);
+    rest -= in->cycles;
+    // The cycle count has to be right wherever it can be looked at
+    if (in->effect != EFFECT_NONE || in->flow != FLOW_NEXT) {
+      if (pending) printf("  AOT_CYCLES(%u);\n", pending);
+      pending = 0;
+    }
+    printf("  AOT_INSN(0x%02X, %u, 0x%04X, 0x%04X);\n", in->op, in->cycles,
+           (in->addr + 1) & 0xFFFF, in->opnd);
+    printf("  %s;\n", op_body[in->op]);
+    if (in->effect == EFFECT_NONE && in->flow == FLOW_NEXT) {
+      pending += in->cycles;
+      continue;
+    }
+    printf("  AOT_CYCLES(%u);\n", in->cycles);
+    if (in->effect == EFFECT_SYNC) printf("  AOT_SYNC(%u);\n", rest);
+  }
+  if (pending) printf("  AOT_CYCLES(%u);\n", pending);
+
+  const struct insn* last = &insns[count - 1];
+  unsigned next = (last->addr + last->len) & 0xFFFF;
+  switch (last->flow) {
+    case FLOW_NEXT:
+      emit_goto(next);
+      break;
+    case FLOW_BRANCH:
+      if (last->op == 0x20) {
+        emit_goto(last->target);
+      } else if (last->op == 0x21) {
+        emit_goto(next);
+      } else {
+        printf("  if (pc == 0x%04X)\n  ", last->target);
+        emit_goto(last->target);
+        emit_goto(next);
+      }
+      break;
+    case FLOW_CALL:
+    case FLOW_JUMP:
+      emit_goto(last->target);
+      break;
+    case FLOW_DYNAMIC:
+      printf("  AOT_EXIT();\n");
+      break;
+  }
+}
+
+static uint32_t rom_hash(void) {
+  uint32_t hash = 2166136261u;  // FNV-1a
+  for (int i = 0; i < ROM_SIZE; i++) hash = (hash ^ rom[i]) * 16777619u;
+  return hash;
+}
+
+int main(int argc, char** argv) {
+  unsigned blocks = 0, insns = 0;
+
+  if (argc > 1 && !freopen(argv[1], "w", stdout)) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  memcpy(rom, rom_HD6301V1ST_img, ROM_SIZE);
+  for (unsigned v = VECTORS; v < 0x10000; v += 2) {
+    walk((rom_byte(v) << 8) | rom_byte(v + 1));
+  }
+  for (unsigned i = 0; i < ROM_SIZE; i++) {
+    if (leader[i]) block_number[i] = ++blocks;
+    insns += reached[i];
+  }
+
+  printf("/*\n");
+  printf(" * aotrom.c - the IKBD ROM translated by aotgen.c, do not edit\n");
+  printf(" *\n");
+  printf(" * %u blocks, %u instructions. Regenerate with the aotrom target\n",
+         blocks, insns);
+  printf(" * of the host build (tests/host) after changing aotgen.c or\n");
+  printf(" * dispatch_ops.h.\n");
+  printf(" */\n");
+  printf("#ifdef AOT_TABLES\n\n");
+  printf("#define AOT_ROM_HASH 0x%08Xu\n\n", rom_hash());
+  printf("/* Block starting at each ROM address, 0 for none */\n");
+  printf("static const u_short aot_index[0x%X] = {", ROM_SIZE);
+  int column = 0;
+  for (unsigned i = 0; i < ROM_SIZE; i++) {
+    if (!block_number[i]) continue;
+    printf("%s[0x%03X] = %u,", column % 6 ? " " : "\n    ", i,
+           block_number[i]);
+    column++;
+  }
+  printf("\n};\n\n#else\n\n");
+
+  printf("aot_enter:\n  switch (aot_block) {\n");
+  for (unsigned i = 0; i < ROM_SIZE; i++) {
+    if (block_number[i]) {
+      printf("    case %u: goto aot_%04X;\n", block_number[i], ROM_START + i);
+    }
+  }
+  printf("    default: goto interp;\n  }\n");
+  for (unsigned i = 0; i < ROM_SIZE; i++) {
+    if (leader[i]) emit_block(ROM_START + i);
+  }
+  printf("\n#endif /* AOT_TABLES */\n");
+  return 0;
+}
@@ -0,0 +1,9028 @@
+/*
+ * aotrom.c - the IKBD ROM translated by aotgen.c, do not edit
+ *
+ * 534 blocks, 1457 instructions. Regenerate with the aotrom target
+ * of the host build (tests/host) after changing aotgen.c or
+ * dispatch_ops.h.
+ */
+#ifdef AOT_TABLES
+
+#define AOT_ROM_HASH 0x7302A7BEu
+
+/* Block starting at each ROM address, 0 for none */
+static const u_short aot_index[0x1000] = {
+    [0x000] = 1, [0x006] = 2, [0x010] = 3, [0x014] = 4, [0x036] = 5, [0x037] = 6,
+    [0x03B] = 7, [0x040] = 8, [0x043] = 9, [0x048] = 10, [0x04C] = 11, [0x04E] = 12,
+    [0x052] = 13, [0x05A] = 14, [0x05E] = 15, [0x062] = 16, [0x068] = 17, [0x06C] = 18,
+    [0x070] = 19, [0x074] = 20, [0x079] = 21, [0x07E] = 22, [0x083] = 23, [0x086] = 24,
+    [0x08C] = 25, [0x099] = 26, [0x0A1] = 27, [0x0A3] = 28, [0x0A9] = 29, [0x0AD] = 30,
+    [0x0B1] = 31, [0x0BA] = 32, [0x0BD] = 33, [0x0C1] = 34, [0x0C5] = 35, [0x0C7] = 36,
+    [0x0CD] = 37, [0x0CF] = 38, [0x0D4] = 39, [0x0DA] = 40, [0x0E8] = 41, [0x0EC] = 42,
+    [0x0EE] = 43, [0x0EF] = 44, [0x0F7] = 45, [0x129] = 46, [0x131] = 47, [0x132] = 48,
+    [0x13A] = 49, [0x13E] = 50, [0x141] = 51, [0x147] = 52, [0x14A] = 53, [0x14D] = 54,
+    [0x150] = 55, [0x154] = 56, [0x157] = 57, [0x15C] = 58, [0x160] = 59, [0x166] = 60,
+    [0x16B] = 61, [0x16E] = 62, [0x171] = 63, [0x177] = 64, [0x17B] = 65, [0x180] = 66,
+    [0x183] = 67, [0x186] = 68, [0x18C] = 69, [0x192] = 70, [0x196] = 71, [0x1A7] = 72,
+    [0x1AB] = 73, [0x1B0] = 74, [0x1B6] = 75, [0x1B7] = 76, [0x1C7] = 77, [0x1CD] = 78,
+    [0x1DC] = 79, [0x1E0] = 80, [0x1E3] = 81, [0x1EB] = 82, [0x20A] = 83, [0x20E] = 84,
+    [0x219] = 85, [0x220] = 86, [0x226] = 87, [0x22F] = 88, [0x237] = 89, [0x23D] = 90,
+    [0x240] = 91, [0x246] = 92, [0x24A] = 93, [0x24D] = 94, [0x24F] = 95, [0x252] = 96,
+    [0x256] = 97, [0x261] = 98, [0x265] = 99, [0x269] = 100, [0x26B] = 101, [0x277] = 102,
+    [0x27F] = 103, [0x286] = 104, [0x28F] = 105, [0x292] = 106, [0x298] = 107, [0x29A] = 108,
+    [0x29E] = 109, [0x2A2] = 110, [0x2A3] = 111, [0x2A6] = 112, [0x2C6] = 113, [0x2CB] = 114,
+    [0x2CF] = 115, [0x2D5] = 116, [0x2DA] = 117, [0x2DF] = 118, [0x2E3] = 119, [0x2E8] = 120,
+    [0x2F7] = 121, [0x300] = 122, [0x309] = 123, [0x30A] = 124, [0x30D] = 125, [0x371] = 126,
+    [0x382] = 127, [0x396] = 128, [0x3A1] = 129, [0x3A5] = 130, [0x3A7] = 131, [0x3AC] = 132,
+    [0x3CB] = 133, [0x3D1] = 134, [0x3D4] = 135, [0x3D7] = 136, [0x3DA] = 137, [0x3DD] = 138,
+    [0x3E0] = 139, [0x3E3] = 140, [0x3EB] = 141, [0x3EF] = 142, [0x3F4] = 143, [0x3F9] = 144,
+    [0x3FD] = 145, [0x400] = 146, [0x405] = 147, [0x409] = 148, [0x411] = 149, [0x413] = 150,
+    [0x417] = 151, [0x41D] = 152, [0x41F] = 153, [0x423] = 154, [0x428] = 155, [0x42D] = 156,
+    [0x42F] = 157, [0x434] = 158, [0x436] = 159, [0x439] = 160, [0x447] = 161, [0x455] = 162,
+    [0x459] = 163, [0x463] = 164, [0x466] = 165, [0x46B] = 166, [0x46D] = 167, [0x471] = 168,
+    [0x473] = 169, [0x477] = 170, [0x484] = 171, [0x485] = 172, [0x488] = 173, [0x48C] = 174,
+    [0x497] = 175, [0x49B] = 176, [0x4A0] = 177, [0x4A2] = 178, [0x4A8] = 179, [0x4B3] = 180,
+    [0x4B4] = 181, [0x4B6] = 182, [0x4B9] = 183, [0x4BA] = 184, [0x4C9] = 185, [0x4CF] = 186,
+    [0x4D3] = 187, [0x4D7] = 188, [0x4DB] = 189, [0x4E0] = 190, [0x4E5] = 191, [0x4E9] = 192,
+    [0x4EE] = 193, [0x4F4] = 194, [0x4F8] = 195, [0x4FF] = 196, [0x50B] = 197, [0x511] = 198,
+    [0x515] = 199, [0x51A] = 200, [0x51E] = 201, [0x523] = 202, [0x528] = 203, [0x52C] = 204,
+    [0x531] = 205, [0x537] = 206, [0x53B] = 207, [0x542] = 208, [0x546] = 209, [0x54A] = 210,
+    [0x54F] = 211, [0x554] = 212, [0x556] = 213, [0x55B] = 214, [0x560] = 215, [0x565] = 216,
+    [0x568] = 217, [0x576] = 218, [0x578] = 219, [0x57E] = 220, [0x581] = 221, [0x58F] = 222,
+    [0x591] = 223, [0x597] = 224, [0x59D] = 225, [0x5A2] = 226, [0x5A5] = 227, [0x5A8] = 228,
+    [0x5B5] = 229, [0x5BB] = 230, [0x5BF] = 231, [0x5C4] = 232, [0x5C8] = 233, [0x5CD] = 234,
+    [0x5D2] = 235, [0x5D6] = 236, [0x5D9] = 237, [0x5DA] = 238, [0x5E0] = 239, [0x5E4] = 240,
+    [0x5EB] = 241, [0x5F7] = 242, [0x5FB] = 243, [0x5FF] = 244, [0x603] = 245, [0x605] = 246,
+    [0x608] = 247, [0x60B] = 248, [0x617] = 249, [0x61B] = 250, [0x61F] = 251, [0x623] = 252,
+    [0x625] = 253, [0x628] = 254, [0x62B] = 255, [0x62F] = 256, [0x633] = 257, [0x636] = 258,
+    [0x63A] = 259, [0x63C] = 260, [0x63F] = 261, [0x645] = 262, [0x64A] = 263, [0x64E] = 264,
+    [0x650] = 265, [0x653] = 266, [0x656] = 267, [0x663] = 268, [0x665] = 269, [0x66A] = 270,
+    [0x66C] = 271, [0x670] = 272, [0x677] = 273, [0x681] = 274, [0x686] = 275, [0x68A] = 276,
+    [0x69B] = 277, [0x69F] = 278, [0x6A4] = 279, [0x6A9] = 280, [0x6AC] = 281, [0x6B2] = 282,
+    [0x6BA] = 283, [0x6BD] = 284, [0x6C0] = 285, [0x6C7] = 286, [0x6CC] = 287, [0x6D1] = 288,
+    [0x6D8] = 289, [0x6E2] = 290, [0x6E7] = 291, [0x6EA] = 292, [0x6F4] = 293, [0x6F7] = 294,
+    [0x6FF] = 295, [0x702] = 296, [0x705] = 297, [0x707] = 298, [0x70C] = 299, [0x715] = 300,
+    [0x71C] = 301, [0x720] = 302, [0x725] = 303, [0x727] = 304, [0x72B] = 305, [0x72D] = 306,
+    [0x72F] = 307, [0x734] = 308, [0x737] = 309, [0x73A] = 310, [0x73E] = 311, [0x741] = 312,
+    [0x747] = 313, [0x74B] = 314, [0x74F] = 315, [0x753] = 316, [0x756] = 317, [0x75A] = 318,
+    [0x765] = 319, [0x766] = 320, [0x76B] = 321, [0x776] = 322, [0x778] = 323, [0x77D] = 324,
+    [0x787] = 325, [0x789] = 326, [0x793] = 327, [0x795] = 328, [0x7A4] = 329, [0x7A6] = 330,
+    [0x7B0] = 331, [0x7B6] = 332, [0x7BC] = 333, [0x7CA] = 334, [0x7CD] = 335, [0x7D1] = 336,
+    [0x7D4] = 337, [0x7DB] = 338, [0x7E3] = 339, [0x7EB] = 340, [0x7EF] = 341, [0x7F3] = 342,
+    [0x7F6] = 343, [0x7FB] = 344, [0x7FF] = 345, [0x803] = 346, [0x805] = 347, [0x809] = 348,
+    [0x80D] = 349, [0x811] = 350, [0x815] = 351, [0x817] = 352, [0x81B] = 353, [0x81F] = 354,
+    [0x823] = 355, [0x825] = 356, [0x82B] = 357, [0x82F] = 358, [0x835] = 359, [0x837] = 360,
+    [0x83B] = 361, [0x844] = 362, [0x848] = 363, [0x85C] = 364, [0x85D] = 365, [0x861] = 366,
+    [0x86F] = 367, [0x872] = 368, [0x875] = 369, [0x87E] = 370, [0x887] = 371, [0x88B] = 372,
+    [0x88F] = 373, [0x893] = 374, [0x897] = 375, [0x89E] = 376, [0x89F] = 377, [0x8A2] = 378,
+    [0x8A7] = 379, [0x8AB] = 380, [0x8AD] = 381, [0x8B0] = 382, [0x8B6] = 383, [0x8BA] = 384,
+    [0x8BB] = 385, [0x8C6] = 386, [0x8CA] = 387, [0x8CF] = 388, [0x8D1] = 389, [0x8D4] = 390,
+    [0x8DC] = 391, [0x8E0] = 392, [0x8E3] = 393, [0x8E7] = 394, [0x8EB] = 395, [0x8F3] = 396,
+    [0x8F7] = 397, [0x8FB] = 398, [0x8FD] = 399, [0x906] = 400, [0x90A] = 401, [0x90F] = 402,
+    [0x914] = 403, [0x916] = 404, [0x929] = 405, [0x990] = 406, [0x998] = 407, [0x99A] = 408,
+    [0x9A0] = 409, [0x9A8] = 410, [0x9AB] = 411, [0xB8E] = 412, [0xBA6] = 413, [0xBAA] = 414,
+    [0xBAC] = 415, [0xCFE] = 416, [0xD07] = 417, [0xD0B] = 418, [0xD0D] = 419, [0xD16] = 420,
+    [0xD1D] = 421, [0xD34] = 422, [0xD39] = 423, [0xD3D] = 424, [0xD4C] = 425, [0xD4D] = 426,
+    [0xD56] = 427, [0xD5C] = 428, [0xD60] = 429, [0xD66] = 430, [0xD67] = 431, [0xD68] = 432,
+    [0xD6E] = 433, [0xD76] = 434, [0xD7A] = 435, [0xD8C] = 436, [0xD8D] = 437, [0xD98] = 438,
+    [0xD9A] = 439, [0xD9C] = 440, [0xD9D] = 441, [0xDA3] = 442, [0xDA6] = 443, [0xDAE] = 444,
+    [0xDAF] = 445, [0xDBA] = 446, [0xDBD] = 447, [0xDC4] = 448, [0xDCE] = 449, [0xDD9] = 450,
+    [0xDDC] = 451, [0xDE4] = 452, [0xDE9] = 453, [0xDED] = 454, [0xDF2] = 455, [0xDF8] = 456,
+    [0xE00] = 457, [0xE06] = 458, [0xE08] = 459, [0xE0C] = 460, [0xE10] = 461, [0xE1E] = 462,
+    [0xE27] = 463, [0xE29] = 464, [0xE2D] = 465, [0xE31] = 466, [0xE3E] = 467, [0xE43] = 468,
+    [0xE4B] = 469, [0xE4E] = 470, [0xE56] = 471, [0xE5A] = 472, [0xE5D] = 473, [0xE5F] = 474,
+    [0xE63] = 475, [0xE67] = 476, [0xE6B] = 477, [0xE6E] = 478, [0xE72] = 479, [0xE75] = 480,
+    [0xE79] = 481, [0xE7D] = 482, [0xE80] = 483, [0xE84] = 484, [0xE8A] = 485, [0xE8C] = 486,
+    [0xE90] = 487, [0xE96] = 488, [0xE99] = 489, [0xE9E] = 490, [0xEA3] = 491, [0xEA8] = 492,
+    [0xEAC] = 493, [0xEB1] = 494, [0xEB5] = 495, [0xEB8] = 496, [0xEBE] = 497, [0xEC1] = 498,
+    [0xEC5] = 499, [0xEC9] = 500, [0xECC] = 501, [0xECF] = 502, [0xEE2] = 503, [0xEE8] = 504,
+    [0xEEC] = 505, [0xEF0] = 506, [0xEF1] = 507, [0xEF3] = 508, [0xEF4] = 509, [0xEF6] = 510,
+    [0xEF7] = 511, [0xEFB] = 512, [0xF00] = 513, [0xF03] = 514, [0xF04] = 515, [0xF0A] = 516,
+    [0xF0D] = 517, [0xF11] = 518, [0xF17] = 519, [0xF26] = 520, [0xF2B] = 521, [0xF2D] = 522,
+    [0xF2F] = 523, [0xF33] = 524, [0xF38] = 525, [0xF3F] = 526, [0xF40] = 527, [0xF47] = 528,
+    [0xF4A] = 529, [0xF4F] = 530, [0xF58] = 531, [0xF5E] = 532, [0xF63] = 533, [0xF69] = 534,
+};
+
+#else
+
+aot_enter:
+  switch (aot_block) {
+    case 1: goto aot_F000;
+    case 2: goto aot_F006;
+    case 3: goto aot_F010;
+    case 4: goto aot_F014;
+    case 5: goto aot_F036;
+    case 6: goto aot_F037;
+    case 7: goto aot_F03B;
+    case 8: goto aot_F040;
+    case 9: goto aot_F043;
+    case 10: goto aot_F048;
+    case 11: goto aot_F04C;
+    case 12: goto aot_F04E;
+    case 13: goto aot_F052;
+    case 14: goto aot_F05A;
+    case 15: goto aot_F05E;
+    case 16: goto aot_F062;
+    case 17: goto aot_F068;
+    case 18: goto aot_F06C;
+    case 19: goto aot_F070;
+    case 20: goto aot_F074;
+    case 21: goto aot_F079;
+    case 22: goto aot_F07E;
+    case 23: goto aot_F083;
+    case 24: goto aot_F086;
+    case 25: goto aot_F08C;
+    case 26: goto aot_F099;
+    case 27: goto aot_F0A1;
+    case 28: goto aot_F0A3;
+    case 29: goto aot_F0A9;
+    case 30: goto aot_F0AD;
+    case 31: goto aot_F0B1;
+    case 32: goto aot_F0BA;
+    case 33: goto aot_F0BD;
+    case 34: goto aot_F0C1;
+    case 35: goto aot_F0C5;
+    case 36: goto aot_F0C7;
+    case 37: goto aot_F0CD;
+    case 38: goto aot_F0CF;
+    case 39: goto aot_F0D4;
+    case 40: goto aot_F0DA;
+    case 41: goto aot_F0E8;
+    case 42: goto aot_F0EC;
+    case 43: goto aot_F0EE;
+    case 44: goto aot_F0EF;
+    case 45: goto aot_F0F7;
+    case 46: goto aot_F129;
+    case 47: goto aot_F131;
+    case 48: goto aot_F132;
+    case 49: goto aot_F13A;
+    case 50: goto aot_F13E;
+    case 51: goto aot_F141;
+    case 52: goto aot_F147;
+    case 53: goto aot_F14A;
+    case 54: goto aot_F14D;
+    case 55: goto aot_F150;
+    case 56: goto aot_F154;
+    case 57: goto aot_F157;
+    case 58: goto aot_F15C;
+    case 59: goto aot_F160;
+    case 60: goto aot_F166;
+    case 61: goto aot_F16B;
+    case 62: goto aot_F16E;
+    case 63: goto aot_F171;
+    case 64: goto aot_F177;
+    case 65: goto aot_F17B;
+    case 66: goto aot_F180;
+    case 67: goto aot_F183;
+    case 68: goto aot_F186;
+    case 69: goto aot_F18C;
+    case 70: goto aot_F192;
+    case 71: goto aot_F196;
+    case 72: goto aot_F1A7;
+    case 73: goto aot_F1AB;
+    case 74: goto aot_F1B0;
+    case 75: goto aot_F1B6;
+    case 76: goto aot_F1B7;
+    case 77: goto aot_F1C7;
+    case 78: goto aot_F1CD;
+    case 79: goto aot_F1DC;
+    case 80: goto aot_F1E0;
+    case 81: goto aot_F1E3;
+    case 82: goto aot_F1EB;
+    case 83: goto aot_F20A;
+    case 84: goto aot_F20E;
+    case 85: goto aot_F219;
+    case 86: goto aot_F220;
+    case 87: goto aot_F226;
+    case 88: goto aot_F22F;
+    case 89: goto aot_F237;
+    case 90: goto aot_F23D;
+    case 91: goto aot_F240;
+    case 92: goto aot_F246;
+    case 93: goto aot_F24A;
+    case 94: goto aot_F24D;
+    case 95: goto aot_F24F;
+    case 96: goto aot_F252;
+    case 97: goto aot_F256;
+    case 98: goto aot_F261;
+    case 99: goto aot_F265;
+    case 100: goto aot_F269;
+    case 101: goto aot_F26B;
+    case 102: goto aot_F277;
+    case 103: goto aot_F27F;
+    case 104: goto aot_F286;
+    case 105: goto aot_F28F;
+    case 106: goto aot_F292;
+    case 107: goto aot_F298;
+    case 108: goto aot_F29A;
+    case 109: goto aot_F29E;
+    case 110: goto aot_F2A2;
+    case 111: goto aot_F2A3;
+    case 112: goto aot_F2A6;
+    case 113: goto aot_F2C6;
+    case 114: goto aot_F2CB;
+    case 115: goto aot_F2CF;
+    case 116: goto aot_F2D5;
+    case 117: goto aot_F2DA;
+    case 118: goto aot_F2DF;
+    case 119: goto aot_F2E3;
+    case 120: goto aot_F2E8;
+    case 121: goto aot_F2F7;
+    case 122: goto aot_F300;
+    case 123: goto aot_F309;
+    case 124: goto aot_F30A;
+    case 125: goto aot_F30D;
+    case 126: goto aot_F371;
+    case 127: goto aot_F382;
+    case 128: goto aot_F396;
+    case 129: goto aot_F3A1;
+    case 130: goto aot_F3A5;
+    case 131: goto aot_F3A7;
+    case 132: goto aot_F3AC;
+    case 133: goto aot_F3CB;
+    case 134: goto aot_F3D1;
+    case 135: goto aot_F3D4;
+    case 136: goto aot_F3D7;
+    case 137: goto aot_F3DA;
+    case 138: goto aot_F3DD;
+    case 139: goto aot_F3E0;
+    case 140: goto aot_F3E3;
+    case 141: goto aot_F3EB;
+    case 142: goto aot_F3EF;
+    case 143: goto aot_F3F4;
+    case 144: goto aot_F3F9;
+    case 145: goto aot_F3FD;
+    case 146: goto aot_F400;
+    case 147: goto aot_F405;
+    case 148: goto aot_F409;
+    case 149: goto aot_F411;
+    case 150: goto aot_F413;
+    case 151: goto aot_F417;
+    case 152: goto aot_F41D;
+    case 153: goto aot_F41F;
+    case 154: goto aot_F423;
+    case 155: goto aot_F428;
+    case 156: goto aot_F42D;
+    case 157: goto aot_F42F;
+    case 158: goto aot_F434;
+    case 159: goto aot_F436;
+    case 160: goto aot_F439;
+    case 161: goto aot_F447;
+    case 162: goto aot_F455;
+    case 163: goto aot_F459;
+    case 164: goto aot_F463;
+    case 165: goto aot_F466;
+    case 166: goto aot_F46B;
+    case 167: goto aot_F46D;
+    case 168: goto aot_F471;
+    case 169: goto aot_F473;
+    case 170: goto aot_F477;
+    case 171: goto aot_F484;
+    case 172: goto aot_F485;
+    case 173: goto aot_F488;
+    case 174: goto aot_F48C;
+    case 175: goto aot_F497;
+    case 176: goto aot_F49B;
+    case 177: goto aot_F4A0;
+    case 178: goto aot_F4A2;
+    case 179: goto aot_F4A8;
+    case 180: goto aot_F4B3;
+    case 181: goto aot_F4B4;
+    case 182: goto aot_F4B6;
+    case 183: goto aot_F4B9;
+    case 184: goto aot_F4BA;
+    case 185: goto aot_F4C9;
+    case 186: goto aot_F4CF;
+    case 187: goto aot_F4D3;
+    case 188: goto aot_F4D7;
+    case 189: goto aot_F4DB;
+    case 190: goto aot_F4E0;
+    case 191: goto aot_F4E5;
+    case 192: goto aot_F4E9;
+    case 193: goto aot_F4EE;
+    case 194: goto aot_F4F4;
+    case 195: goto aot_F4F8;
+    case 196: goto aot_F4FF;
+    case 197: goto aot_F50B;
+    case 198: goto aot_F511;
+    case 199: goto aot_F515;
+    case 200: goto aot_F51A;
+    case 201: goto aot_F51E;
+    case 202: goto aot_F523;
+    case 203: goto aot_F528;
+    case 204: goto aot_F52C;
+    case 205: goto aot_F531;
+    case 206: goto aot_F537;
+    case 207: goto aot_F53B;
+    case 208: goto aot_F542;
+    case 209: goto aot_F546;
+    case 210: goto aot_F54A;
+    case 211: goto aot_F54F;
+    case 212: goto aot_F554;
+    case 213: goto aot_F556;
+    case 214: goto aot_F55B;
+    case 215: goto aot_F560;
+    case 216: goto aot_F565;
+    case 217: goto aot_F568;
+    case 218: goto aot_F576;
+    case 219: goto aot_F578;
+    case 220: goto aot_F57E;
+    case 221: goto aot_F581;
+    case 222: goto aot_F58F;
+    case 223: goto aot_F591;
+    case 224: goto aot_F597;
+    case 225: goto aot_F59D;
+    case 226: goto aot_F5A2;
+    case 227: goto aot_F5A5;
+    case 228: goto aot_F5A8;
+    case 229: goto aot_F5B5;
+    case 230: goto aot_F5BB;
+    case 231: goto aot_F5BF;
+    case 232: goto aot_F5C4;
+    case 233: goto aot_F5C8;
+    case 234: goto aot_F5CD;
+    case 235: goto aot_F5D2;
+    case 236: goto aot_F5D6;
+    case 237: goto aot_F5D9;
+    case 238: goto aot_F5DA;
+    case 239: goto aot_F5E0;
+    case 240: goto aot_F5E4;
+    case 241: goto aot_F5EB;
+    case 242: goto aot_F5F7;
+    case 243: goto aot_F5FB;
+    case 244: goto aot_F5FF;
+    case 245: goto aot_F603;
+    case 246: goto aot_F605;
+    case 247: goto aot_F608;
+    case 248: goto aot_F60B;
+    case 249: goto aot_F617;
+    case 250: goto aot_F61B;
+    case 251: goto aot_F61F;
+    case 252: goto aot_F623;
+    case 253: goto aot_F625;
+    case 254: goto aot_F628;
+    case 255: goto aot_F62B;
+    case 256: goto aot_F62F;
+    case 257: goto aot_F633;
+    case 258: goto aot_F636;
+    case 259: goto aot_F63A;
+    case 260: goto aot_F63C;
+    case 261: goto aot_F63F;
+    case 262: goto aot_F645;
+    case 263: goto aot_F64A;
+    case 264: goto aot_F64E;
+    case 265: goto aot_F650;
+    case 266: goto aot_F653;
+    case 267: goto aot_F656;
+    case 268: goto aot_F663;
+    case 269: goto aot_F665;
+    case 270: goto aot_F66A;
+    case 271: goto aot_F66C;
+    case 272: goto aot_F670;
+    case 273: goto aot_F677;
+    case 274: goto aot_F681;
+    case 275: goto aot_F686;
+    case 276: goto aot_F68A;
+    case 277: goto aot_F69B;
+    case 278: goto aot_F69F;
+    case 279: goto aot_F6A4;
+    case 280: goto aot_F6A9;
+    case 281: goto aot_F6AC;
+    case 282: goto aot_F6B2;
+    case 283: goto aot_F6BA;
+    case 284: goto aot_F6BD;
+    case 285: goto aot_F6C0;
+    case 286: goto aot_F6C7;
+    case 287: goto aot_F6CC;
+    case 288: goto aot_F6D1;
+    case 289: goto aot_F6D8;
+    case 290: goto aot_F6E2;
+    case 291: goto aot_F6E7;
+    case 292: goto aot_F6EA;
+    case 293: goto aot_F6F4;
+    case 294: goto aot_F6F7;
+    case 295: goto aot_F6FF;
+    case 296: goto aot_F702;
+    case 297: goto aot_F705;
+    case 298: goto aot_F707;
+    case 299: goto aot_F70C;
+    case 300: goto aot_F715;
+    case 301: goto aot_F71C;
+    case 302: goto aot_F720;
+    case 303: goto aot_F725;
+    case 304: goto aot_F727;
+    case 305: goto aot_F72B;
+    case 306: goto aot_F72D;
+    case 307: goto aot_F72F;
+    case 308: goto aot_F734;
+    case 309: goto aot_F737;
+    case 310: goto aot_F73A;
+    case 311: goto aot_F73E;
+    case 312: goto aot_F741;
+    case 313: goto aot_F747;
+    case 314: goto aot_F74B;
+    case 315: goto aot_F74F;
+    case 316: goto aot_F753;
+    case 317: goto aot_F756;
+    case 318: goto aot_F75A;
+    case 319: goto aot_F765;
+    case 320: goto aot_F766;
+    case 321: goto aot_F76B;
+    case 322: goto aot_F776;
+    case 323: goto aot_F778;
+    case 324: goto aot_F77D;
+    case 325: goto aot_F787;
+    case 326: goto aot_F789;
+    case 327: goto aot_F793;
+    case 328: goto aot_F795;
+    case 329: goto aot_F7A4;
+    case 330: goto aot_F7A6;
+    case 331: goto aot_F7B0;
+    case 332: goto aot_F7B6;
+    case 333: goto aot_F7BC;
+    case 334: goto aot_F7CA;
+    case 335: goto aot_F7CD;
+    case 336: goto aot_F7D1;
+    case 337: goto aot_F7D4;
+    case 338: goto aot_F7DB;
+    case 339: goto aot_F7E3;
+    case 340: goto aot_F7EB;
+    case 341: goto aot_F7EF;
+    case 342: goto aot_F7F3;
+    case 343: goto aot_F7F6;
+    case 344: goto aot_F7FB;
+    case 345: goto aot_F7FF;
+    case 346: goto aot_F803;
+    case 347: goto aot_F805;
+    case 348: goto aot_F809;
+    case 349: goto aot_F80D;
+    case 350: goto aot_F811;
+    case 351: goto aot_F815;
+    case 352: goto aot_F817;
+    case 353: goto aot_F81B;
+    case 354: goto aot_F81F;
+    case 355: goto aot_F823;
+    case 356: goto aot_F825;
+    case 357: goto aot_F82B;
+    case 358: goto aot_F82F;
+    case 359: goto aot_F835;
+    case 360: goto aot_F837;
+    case 361: goto aot_F83B;
+    case 362: goto aot_F844;
+    case 363: goto aot_F848;
+    case 364: goto aot_F85C;
+    case 365: goto aot_F85D;
+    case 366: goto aot_F861;
+    case 367: goto aot_F86F;
+    case 368: goto aot_F872;
+    case 369: goto aot_F875;
+    case 370: goto aot_F87E;
+    case 371: goto aot_F887;
+    case 372: goto aot_F88B;
+    case 373: goto aot_F88F;
+    case 374: goto aot_F893;
+    case 375: goto aot_F897;
+    case 376: goto aot_F89E;
+    case 377: goto aot_F89F;
+    case 378: goto aot_F8A2;
+    case 379: goto aot_F8A7;
+    case 380: goto aot_F8AB;
+    case 381: goto aot_F8AD;
+    case 382: goto aot_F8B0;
+    case 383: goto aot_F8B6;
+    case 384: goto aot_F8BA;
+    case 385: goto aot_F8BB;
+    case 386: goto aot_F8C6;
+    case 387: goto aot_F8CA;
+    case 388: goto aot_F8CF;
+    case 389: goto aot_F8D1;
+    case 390: goto aot_F8D4;
+    case 391: goto aot_F8DC;
+    case 392: goto aot_F8E0;
+    case 393: goto aot_F8E3;
+    case 394: goto aot_F8E7;
+    case 395: goto aot_F8EB;
+    case 396: goto aot_F8F3;
+    case 397: goto aot_F8F7;
+    case 398: goto aot_F8FB;
+    case 399: goto aot_F8FD;
+    case 400: goto aot_F906;
+    case 401: goto aot_F90A;
+    case 402: goto aot_F90F;
+    case 403: goto aot_F914;
+    case 404: goto aot_F916;
+    case 405: goto aot_F929;
+    case 406: goto aot_F990;
+    case 407: goto aot_F998;
+    case 408: goto aot_F99A;
+    case 409: goto aot_F9A0;
+    case 410: goto aot_F9A8;
+    case 411: goto aot_F9AB;
+    case 412: goto aot_FB8E;
+    case 413: goto aot_FBA6;
+    case 414: goto aot_FBAA;
+    case 415: goto aot_FBAC;
+    case 416: goto aot_FCFE;
+    case 417: goto aot_FD07;
+    case 418: goto aot_FD0B;
+    case 419: goto aot_FD0D;
+    case 420: goto aot_FD16;
+    case 421: goto aot_FD1D;
+    case 422: goto aot_FD34;
+    case 423: goto aot_FD39;
+    case 424: goto aot_FD3D;
+    case 425: goto aot_FD4C;
+    case 426: goto aot_FD4D;
+    case 427: goto aot_FD56;
+    case 428: goto aot_FD5C;
+    case 429: goto aot_FD60;
+    case 430: goto aot_FD66;
+    case 431: goto aot_FD67;
+    case 432: goto aot_FD68;
+    case 433: goto aot_FD6E;
+    case 434: goto aot_FD76;
+    case 435: goto aot_FD7A;
+    case 436: goto aot_FD8C;
+    case 437: goto aot_FD8D;
+    case 438: goto aot_FD98;
+    case 439: goto aot_FD9A;
+    case 440: goto aot_FD9C;
+    case 441: goto aot_FD9D;
+    case 442: goto aot_FDA3;
+    case 443: goto aot_FDA6;
+    case 444: goto aot_FDAE;
+    case 445: goto aot_FDAF;
+    case 446: goto aot_FDBA;
+    case 447: goto aot_FDBD;
+    case 448: goto aot_FDC4;
+    case 449: goto aot_FDCE;
+    case 450: goto aot_FDD9;
+    case 451: goto aot_FDDC;
+    case 452: goto aot_FDE4;
+    case 453: goto aot_FDE9;
+    case 454: goto aot_FDED;
+    case 455: goto aot_FDF2;
+    case 456: goto aot_FDF8;
+    case 457: goto aot_FE00;
+    case 458: goto aot_FE06;
+    case 459: goto aot_FE08;
+    case 460: goto aot_FE0C;
+    case 461: goto aot_FE10;
+    case 462: goto aot_FE1E;
+    case 463: goto aot_FE27;
+    case 464: goto aot_FE29;
+    case 465: goto aot_FE2D;
+    case 466: goto aot_FE31;
+    case 467: goto aot_FE3E;
+    case 468: goto aot_FE43;
+    case 469: goto aot_FE4B;
+    case 470: goto aot_FE4E;
+    case 471: goto aot_FE56;
+    case 472: goto aot_FE5A;
+    case 473: goto aot_FE5D;
+    case 474: goto aot_FE5F;
+    case 475: goto aot_FE63;
+    case 476: goto aot_FE67;
+    case 477: goto aot_FE6B;
+    case 478: goto aot_FE6E;
+    case 479: goto aot_FE72;
+    case 480: goto aot_FE75;
+    case 481: goto aot_FE79;
+    case 482: goto aot_FE7D;
+    case 483: goto aot_FE80;
+    case 484: goto aot_FE84;
+    case 485: goto aot_FE8A;
+    case 486: goto aot_FE8C;
+    case 487: goto aot_FE90;
+    case 488: goto aot_FE96;
+    case 489: goto aot_FE99;
+    case 490: goto aot_FE9E;
+    case 491: goto aot_FEA3;
+    case 492: goto aot_FEA8;
+    case 493: goto aot_FEAC;
+    case 494: goto aot_FEB1;
+    case 495: goto aot_FEB5;
+    case 496: goto aot_FEB8;
+    case 497: goto aot_FEBE;
+    case 498: goto aot_FEC1;
+    case 499: goto aot_FEC5;
+    case 500: goto aot_FEC9;
+    case 501: goto aot_FECC;
+    case 502: goto aot_FECF;
+    case 503: goto aot_FEE2;
+    case 504: goto aot_FEE8;
+    case 505: goto aot_FEEC;
+    case 506: goto aot_FEF0;
+    case 507: goto aot_FEF1;
+    case 508: goto aot_FEF3;
+    case 509: goto aot_FEF4;
+    case 510: goto aot_FEF6;
+    case 511: goto aot_FEF7;
+    case 512: goto aot_FEFB;
+    case 513: goto aot_FF00;
+    case 514: goto aot_FF03;
+    case 515: goto aot_FF04;
+    case 516: goto aot_FF0A;
+    case 517: goto aot_FF0D;
+    case 518: goto aot_FF11;
+    case 519: goto aot_FF17;
+    case 520: goto aot_FF26;
+    case 521: goto aot_FF2B;
+    case 522: goto aot_FF2D;
+    case 523: goto aot_FF2F;
+    case 524: goto aot_FF33;
+    case 525: goto aot_FF38;
+    case 526: goto aot_FF3F;
+    case 527: goto aot_FF40;
+    case 528: goto aot_FF47;
+    case 529: goto aot_FF4A;
+    case 530: goto aot_FF4F;
+    case 531: goto aot_FF58;
+    case 532: goto aot_FF5E;
+    case 533: goto aot_FF63;
+    case 534: goto aot_FF69;
+    default: goto interp;
+  }
+
+aot_F000: /* F000-F005 */
+  AOT_BEGIN(8);
+  /* F000: ldaa 88 */
+  AOT_INSN(0x96, 3, 0xF001, 0x8881);
+  DIR8(t); a = LOGIC8(t);
+  /* F002: cmpa #aa */
+  AOT_INSN(0x81, 2, 0xF003, 0xAA27);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F004: beq  f010 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x27, 3, 0xF005, 0x0ACC);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF010)
+    goto aot_F010;
+  goto aot_F006;
+
+aot_F006: /* F006-F00A */
+  AOT_BEGIN(6);
+  /* F006: ldd  #0080 */
+  AOT_INSN(0xCC, 3, 0xF007, 0x0080);
+  IMM16(w); SETD(LOGIC16(w));
+  /* F009: bra  f014 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xF00A, 0x097B);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F014;
+
+aot_F010: /* F010-F013 */
+  AOT_BEGIN(4);
+  /* F010: sei */
+  AOT_INSN(0x0F, 1, 0xF011, 0xCC00);
+  ccr |= IFLAG;
+  /* F011: ldd  #0089 */
+  AOT_INSN(0xCC, 3, 0xF012, 0x0089);
+  IMM16(w); SETD(LOGIC16(w));
+  AOT_CYCLES(4);
+  goto aot_F014;
+
+aot_F014: /* F014-F035 */
+  AOT_BEGIN(46);
+  /* F014: lds  #00ff */
+  AOT_INSN(0x8E, 3, 0xF015, 0x00FF);
+  IMM16(w); sp = LOGIC16(w);
+  /* F017: clra */
+  AOT_INSN(0x4F, 1, 0xF018, 0x9700);
+  a = CLR8();
+  /* F018: staa 00 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x97, 3, 0xF019, 0x004C);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(39);
+  /* F01A: inca */
+  AOT_INSN(0x4C, 1, 0xF01B, 0x9703);
+  a = INC8(a);
+  /* F01B: staa 03 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x97, 3, 0xF01C, 0x0397);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(35);
+  /* F01D: staa 01 */
+  AOT_INSN(0x97, 3, 0xF01E, 0x01CE);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(32);
+  /* F01F: ldx  #ffff */
+  AOT_INSN(0xCE, 3, 0xF020, 0xFFFF);
+  IMM16(w); x = LOGIC16(w);
+  /* F022: stx  06 */
+  AOT_CYCLES(3);
+  AOT_INSN(0xDF, 4, 0xF023, 0x06DF);
+  EA_DIR(); (void)LOGIC16(x); WRW(ea, x);
+  AOT_CYCLES(4);
+  AOT_SYNC(25);
+  /* F024: stx  04 */
+  AOT_INSN(0xDF, 4, 0xF025, 0x0486);
+  EA_DIR(); (void)LOGIC16(x); WRW(ea, x);
+  AOT_CYCLES(4);
+  AOT_SYNC(21);
+  /* F026: ldaa #05 */
+  AOT_INSN(0x86, 2, 0xF027, 0x0597);
+  IMM8(t); a = LOGIC8(t);
+  /* F028: staa 10 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x97, 3, 0xF029, 0x1086);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(16);
+  /* F02A: ldaa #1a */
+  AOT_INSN(0x86, 2, 0xF02B, 0x1A97);
+  IMM8(t); a = LOGIC8(t);
+  /* F02C: staa 11 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x97, 3, 0xF02D, 0x1196);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(11);
+  /* F02E: ldaa 11 */
+  AOT_INSN(0x96, 3, 0xF02F, 0x1196);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(8);
+  /* F030: ldaa 12 */
+  AOT_INSN(0x96, 3, 0xF031, 0x12C1);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* F032: cmpb #89 */
+  AOT_INSN(0xC1, 2, 0xF033, 0x8927);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F034: beq  f048 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF035, 0x124F);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF048)
+    goto aot_F048;
+  goto aot_F036;
+
+aot_F036: /* F036-F036 */
+  AOT_BEGIN(1);
+  /* F036: clra */
+  AOT_INSN(0x4F, 1, 0xF037, 0x4A01);
+  a = CLR8();
+  AOT_CYCLES(1);
+  goto aot_F037;
+
+aot_F037: /* F037-F03A */
+  AOT_BEGIN(5);
+  /* F037: deca */
+  AOT_INSN(0x4A, 1, 0xF038, 0x0126);
+  a = DEC8(a);
+  /* F038: nop */
+  AOT_INSN(0x01, 1, 0xF039, 0x26FC);
+  ;
+  /* F039: bne  f037 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF03A, 0xFC72);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF037)
+    goto aot_F037;
+  goto aot_F03B;
+
+aot_F03B: /* F03B-F03F */
+  AOT_BEGIN(8);
+  /* F03B: oim 111 */
+  AOT_INSN(0x72, 6, 0xF03C, 0x0111);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(2);
+  /* F03E: ldaa #20 */
+  AOT_INSN(0x86, 2, 0xF03F, 0x204A);
+  IMM8(t); a = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F040;
+
+aot_F040: /* F040-F042 */
+  AOT_BEGIN(4);
+  /* F040: deca */
+  AOT_INSN(0x4A, 1, 0xF041, 0x26FD);
+  a = DEC8(a);
+  /* F041: bne  f040 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xF042, 0xFD7B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF040)
+    goto aot_F040;
+  goto aot_F043;
+
+aot_F043: /* F043-F047 */
+  AOT_BEGIN(7);
+  /* F043: tim 0111 */
+  AOT_INSN(0x7B, 4, 0xF044, 0x0111);
+  IMM_MEM(ea, &, 0);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F046: bne  f043 */
+  AOT_INSN(0x26, 3, 0xF047, 0xFB86);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF043)
+    goto aot_F043;
+  goto aot_F048;
+
+aot_F048: /* F048-F04B */
+  AOT_BEGIN(5);
+  /* F048: ldaa #08 */
+  AOT_INSN(0x86, 2, 0xF049, 0x0897);
+  IMM8(t); a = LOGIC8(t);
+  /* F04A: staa 08 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x97, 3, 0xF04B, 0x0886);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(0);
+  goto aot_F04C;
+
+aot_F04C: /* F04C-F04D */
+  AOT_BEGIN(2);
+  /* F04C: ldaa #5a */
+  AOT_INSN(0x86, 2, 0xF04D, 0x5ACE);
+  IMM8(t); a = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F04E;
+
+aot_F04E: /* F04E-F051 */
+  AOT_BEGIN(4);
+  /* F04E: ldx  #0000 */
+  AOT_INSN(0xCE, 3, 0xF04F, 0x0000);
+  IMM16(w); x = LOGIC16(w);
+  /* F051: abx */
+  AOT_INSN(0x3A, 1, 0xF052, 0xA700);
+  x = (x + b) & 0xFFFF;
+  AOT_CYCLES(4);
+  goto aot_F052;
+
+aot_F052: /* F052-F059 */
+  AOT_BEGIN(11);
+  /* F052: staa 00,x */
+  AOT_INSN(0xA7, 4, 0xF053, 0x0008);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(7);
+  /* F054: inx */
+  AOT_INSN(0x08, 1, 0xF055, 0x8C01);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F055: cpx  #0100 */
+  AOT_INSN(0x8C, 3, 0xF056, 0x0100);
+  IMM16(w); (void)SUB16(x, w);
+  /* F058: bne  f052 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF059, 0xF8CE);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF052)
+    goto aot_F052;
+  goto aot_F05A;
+
+aot_F05A: /* F05A-F05D */
+  AOT_BEGIN(4);
+  /* F05A: ldx  #0000 */
+  AOT_INSN(0xCE, 3, 0xF05B, 0x0000);
+  IMM16(w); x = LOGIC16(w);
+  /* F05D: abx */
+  AOT_INSN(0x3A, 1, 0xF05E, 0xA100);
+  x = (x + b) & 0xFFFF;
+  AOT_CYCLES(4);
+  goto aot_F05E;
+
+aot_F05E: /* F05E-F061 */
+  AOT_BEGIN(7);
+  /* F05E: cmpa 00,x */
+  AOT_INSN(0xA1, 4, 0xF05F, 0x0026);
+  IX8(t); (void)SUB8(a, t, 0);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F060: bne  f04c */
+  AOT_INSN(0x26, 3, 0xF061, 0xEA08);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF04C)
+    goto aot_F04C;
+  goto aot_F062;
+
+aot_F062: /* F062-F067 */
+  AOT_BEGIN(7);
+  /* F062: inx */
+  AOT_INSN(0x08, 1, 0xF063, 0x8C01);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F063: cpx  #0100 */
+  AOT_INSN(0x8C, 3, 0xF064, 0x0100);
+  IMM16(w); (void)SUB16(x, w);
+  /* F066: bne  f05e */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF067, 0xF681);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF05E)
+    goto aot_F05E;
+  goto aot_F068;
+
+aot_F068: /* F068-F06B */
+  AOT_BEGIN(5);
+  /* F068: cmpa #a5 */
+  AOT_INSN(0x81, 2, 0xF069, 0xA527);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F06A: beq  f070 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF06B, 0x0486);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF070)
+    goto aot_F070;
+  goto aot_F06C;
+
+aot_F06C: /* F06C-F06F */
+  AOT_BEGIN(5);
+  /* F06C: ldaa #a5 */
+  AOT_INSN(0x86, 2, 0xF06D, 0xA520);
+  IMM8(t); a = LOGIC8(t);
+  /* F06E: bra  f04e */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF06F, 0xDE4F);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F04E;
+
+aot_F070: /* F070-F073 */
+  AOT_BEGIN(4);
+  /* F070: clra */
+  AOT_INSN(0x4F, 1, 0xF071, 0xCEF0);
+  a = CLR8();
+  /* F071: ldx  #f000 */
+  AOT_INSN(0xCE, 3, 0xF072, 0xF000);
+  IMM16(w); x = LOGIC16(w);
+  AOT_CYCLES(4);
+  goto aot_F074;
+
+aot_F074: /* F074-F078 */
+  AOT_BEGIN(8);
+  /* F074: adca 00,x */
+  AOT_INSN(0xA9, 4, 0xF075, 0x0008);
+  IX8(t); a = ADD8(a, t, CFLAGV);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* F076: inx */
+  AOT_INSN(0x08, 1, 0xF077, 0x270A);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F077: beq  f083 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x27, 3, 0xF078, 0x0A8C);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF083)
+    goto aot_F083;
+  goto aot_F079;
+
+aot_F079: /* F079-F07D */
+  AOT_BEGIN(6);
+  /* F079: cpx  #ff6f */
+  AOT_INSN(0x8C, 3, 0xF07A, 0xFF6F);
+  IMM16(w); (void)SUB16(x, w);
+  /* F07C: bne  f074 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xF07D, 0xF6CE);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF074)
+    goto aot_F074;
+  goto aot_F07E;
+
+aot_F07E: /* F07E-F082 */
+  AOT_BEGIN(6);
+  /* F07E: ldx  #fff0 */
+  AOT_INSN(0xCE, 3, 0xF07F, 0xFFF0);
+  IMM16(w); x = LOGIC16(w);
+  /* F081: bra  f074 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xF082, 0xF143);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F074;
+
+aot_F083: /* F083-F085 */
+  AOT_BEGIN(4);
+  /* F083: coma */
+  AOT_INSN(0x43, 1, 0xF084, 0x26C6);
+  a = COM8(a);
+  /* F084: bne  f04c */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xF085, 0xC6C6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF04C)
+    goto aot_F04C;
+  goto aot_F086;
+
+aot_F086: /* F086-F08B */
+  AOT_BEGIN(7);
+  /* F086: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF087, 0x01D7);
+  IMM8(t); b = LOGIC8(t);
+  /* F088: stab 8a */
+  AOT_INSN(0xD7, 3, 0xF089, 0x8A4F);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F08A: clra */
+  AOT_INSN(0x4F, 1, 0xF08B, 0x5CDD);
+  a = CLR8();
+  /* F08B: incb */
+  AOT_INSN(0x5C, 1, 0xF08C, 0xDD8C);
+  b = INC8(b);
+  AOT_CYCLES(7);
+  goto aot_F08C;
+
+aot_F08C: /* F08C-F098 */
+  AOT_BEGIN(19);
+  /* F08C: std  8c */
+  AOT_INSN(0xDD, 4, 0xF08D, 0x8C43);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  /* F08E: coma */
+  AOT_INSN(0x43, 1, 0xF08F, 0x53D7);
+  a = COM8(a);
+  /* F08F: comb */
+  AOT_INSN(0x53, 1, 0xF090, 0xD706);
+  b = COM8(b);
+  /* F090: stab 06 */
+  AOT_CYCLES(6);
+  AOT_INSN(0xD7, 3, 0xF091, 0x0697);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(3);
+  AOT_SYNC(10);
+  /* F092: staa 07 */
+  AOT_INSN(0x97, 3, 0xF093, 0x0796);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(7);
+  /* F094: ldaa 02 */
+  AOT_INSN(0x96, 3, 0xF095, 0x0243);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(4);
+  /* F096: coma */
+  AOT_INSN(0x43, 1, 0xF097, 0x260A);
+  a = COM8(a);
+  /* F097: bne  f0a3 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xF098, 0x0A7C);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF0A3)
+    goto aot_F0A3;
+  goto aot_F099;
+
+aot_F099: /* F099-F0A0 */
+  AOT_BEGIN(14);
+  /* F099: inc 008a */
+  AOT_INSN(0x7C, 6, 0xF09A, 0x008A);
+  EXT8(t); t = INC8(t); WR(ea, t);
+  /* F09C: ldd  8c */
+  AOT_INSN(0xDC, 4, 0xF09D, 0x8C05);
+  DIR16(w); SETD(LOGIC16(w));
+  /* F09E: asld */
+  AOT_INSN(0x05, 1, 0xF09F, 0x24EB);
+  SETD(SHL16(ACCD));
+  /* F09F: bcc  f08c */
+  AOT_CYCLES(11);
+  AOT_INSN(0x24, 3, 0xF0A0, 0xEB20);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF08C)
+    goto aot_F08C;
+  goto aot_F0A1;
+
+aot_F0A1: /* F0A1-F0A2 */
+  AOT_BEGIN(3);
+  /* F0A1: bra  f0cf */
+  AOT_INSN(0x20, 3, 0xF0A2, 0x2CD6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F0CF;
+
+aot_F0A3: /* F0A3-F0A8 */
+  AOT_BEGIN(8);
+  /* F0A3: ldab 8a */
+  AOT_INSN(0xD6, 3, 0xF0A4, 0x8AC1);
+  DIR8(t); b = LOGIC8(t);
+  /* F0A5: cmpb #05 */
+  AOT_INSN(0xC1, 2, 0xF0A6, 0x0524);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F0A7: bcc  f0ba */
+  AOT_CYCLES(5);
+  AOT_INSN(0x24, 3, 0xF0A8, 0x1185);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF0BA)
+    goto aot_F0BA;
+  goto aot_F0A9;
+
+aot_F0A9: /* F0A9-F0AC */
+  AOT_BEGIN(5);
+  /* F0A9: bita #01 */
+  AOT_INSN(0x85, 2, 0xF0AA, 0x0126);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F0AB: bne  f0ba */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF0AC, 0x0D85);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF0BA)
+    goto aot_F0BA;
+  goto aot_F0AD;
+
+aot_F0AD: /* F0AD-F0B0 */
+  AOT_BEGIN(5);
+  /* F0AD: bita #f0 */
+  AOT_INSN(0x85, 2, 0xF0AE, 0xF027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F0AF: beq  f099 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF0B0, 0xE85A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF099)
+    goto aot_F099;
+  goto aot_F0B1;
+
+aot_F0B1: /* F0B1-F0B9 */
+  AOT_BEGIN(12);
+  /* F0B1: decb */
+  AOT_INSN(0x5A, 1, 0xF0B2, 0xCEF2);
+  b = DEC8(b);
+  /* F0B2: ldx  #f206 */
+  AOT_INSN(0xCE, 3, 0xF0B3, 0xF206);
+  IMM16(w); x = LOGIC16(w);
+  /* F0B5: abx */
+  AOT_INSN(0x3A, 1, 0xF0B6, 0xA600);
+  x = (x + b) & 0xFFFF;
+  /* F0B6: ldaa 00,x */
+  AOT_CYCLES(5);
+  AOT_INSN(0xA6, 4, 0xF0B7, 0x0020);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F0B8: bra  f0c5 */
+  AOT_INSN(0x20, 3, 0xF0B9, 0x0BC6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F0C5;
+
+aot_F0BA: /* F0BA-F0C0 */
+  AOT_BEGIN(10);
+  /* F0BA: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF0BB, 0x016D);
+  IMM8(t); b = LOGIC8(t);
+  /* F0BC: tst 58,x */
+  AOT_CYCLES(2);
+  AOT_INSN(0x6D, 4, 0xF0BD, 0x5844);
+  IX8(t); (void)TEST8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* F0BE: lsra */
+  AOT_INSN(0x44, 1, 0xF0BF, 0x24FC);
+  a = SHR8(a, 0);
+  /* F0BF: bcc  f0bd */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF0C0, 0xFC17);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF0BD)
+    goto aot_F0BD;
+  goto aot_F0C1;
+
+aot_F0BD: /* F0BD-F0C0 */
+  AOT_BEGIN(5);
+  /* F0BD: lslb */
+  AOT_INSN(0x58, 1, 0xF0BE, 0x4424);
+  b = SHL8(b, 0);
+  /* F0BE: lsra */
+  AOT_INSN(0x44, 1, 0xF0BF, 0x24FC);
+  a = SHR8(a, 0);
+  /* F0BF: bcc  f0bd */
+  AOT_CYCLES(2);
+  AOT_INSN(0x24, 3, 0xF0C0, 0xFC17);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF0BD)
+    goto aot_F0BD;
+  goto aot_F0C1;
+
+aot_F0C1: /* F0C1-F0C4 */
+  AOT_BEGIN(7);
+  /* F0C1: tba */
+  AOT_INSN(0x17, 1, 0xF0C2, 0xBDF2);
+  a = LOGIC8(b);
+  /* F0C2: jsr  f2f7 */
+  AOT_CYCLES(1);
+  AOT_INSN(0xBD, 6, 0xF0C3, 0xF2F7);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F2F7;
+
+aot_F0C5: /* F0C5-F0C6 */
+  AOT_BEGIN(2);
+  /* F0C5: oraa #80 */
+  AOT_INSN(0x8A, 2, 0xF0C6, 0x80D6);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_F0C7;
+
+aot_F0C7: /* F0C7-F0CC */
+  AOT_BEGIN(8);
+  /* F0C7: ldab 11 */
+  AOT_INSN(0xD6, 3, 0xF0C8, 0x11C5);
+  DIR8(t); b = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* F0C9: bitb #20 */
+  AOT_INSN(0xC5, 2, 0xF0CA, 0x2027);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F0CB: beq  f0c7 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF0CC, 0xFA97);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF0C7)
+    goto aot_F0C7;
+  goto aot_F0CD;
+
+aot_F0CD: /* F0CD-F0CE */
+  AOT_BEGIN(3);
+  /* F0CD: staa 13 */
+  AOT_INSN(0x97, 3, 0xF0CE, 0x13CC);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(0);
+  goto aot_F0CF;
+
+aot_F0CF: /* F0CF-F0D3 */
+  AOT_BEGIN(7);
+  /* F0CF: ldd  #ffff */
+  AOT_INSN(0xCC, 3, 0xF0D0, 0xFFFF);
+  IMM16(w); SETD(LOGIC16(w));
+  /* F0D2: std  06 */
+  AOT_CYCLES(3);
+  AOT_INSN(0xDD, 4, 0xF0D3, 0x0696);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  AOT_CYCLES(4);
+  AOT_SYNC(0);
+  goto aot_F0D4;
+
+aot_F0D4: /* F0D4-F0D9 */
+  AOT_BEGIN(8);
+  /* F0D4: ldaa 11 */
+  AOT_INSN(0x96, 3, 0xF0D5, 0x1185);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* F0D6: bita #20 */
+  AOT_INSN(0x85, 2, 0xF0D7, 0x2027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F0D8: beq  f0d4 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF0D9, 0xFA86);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF0D4)
+    goto aot_F0D4;
+  goto aot_F0DA;
+
+aot_F0DA: /* F0DA-F0E7 */
+  AOT_BEGIN(17);
+  /* F0DA: ldaa #f1 */
+  AOT_INSN(0x86, 2, 0xF0DB, 0xF197);
+  IMM8(t); a = LOGIC8(t);
+  /* F0DC: staa 13 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x97, 3, 0xF0DD, 0x134F);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(12);
+  /* F0DE: clra */
+  AOT_INSN(0x4F, 1, 0xF0DF, 0xCE00);
+  a = CLR8();
+  /* F0DF: ldx  #0000 */
+  AOT_INSN(0xCE, 3, 0xF0E0, 0x0000);
+  IMM16(w); x = LOGIC16(w);
+  /* F0E2: ldab 82 */
+  AOT_INSN(0xD6, 3, 0xF0E3, 0x82C1);
+  DIR8(t); b = LOGIC8(t);
+  /* F0E4: cmpb #a5 */
+  AOT_INSN(0xC1, 2, 0xF0E5, 0xA526);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F0E6: bne  f0ec */
+  AOT_CYCLES(9);
+  AOT_INSN(0x26, 3, 0xF0E7, 0x04C6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF0EC)
+    goto aot_F0EC;
+  goto aot_F0E8;
+
+aot_F0E8: /* F0E8-F0EB */
+  AOT_BEGIN(5);
+  /* F0E8: ldab #80 */
+  AOT_INSN(0xC6, 2, 0xF0E9, 0x8020);
+  IMM8(t); b = LOGIC8(t);
+  /* F0EA: bra  f0ee */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF0EB, 0x02C6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F0EE;
+
+aot_F0EC: /* F0EC-F0ED */
+  AOT_BEGIN(2);
+  /* F0EC: ldab #89 */
+  AOT_INSN(0xC6, 2, 0xF0ED, 0x893A);
+  IMM8(t); b = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F0EE;
+
+aot_F0EE: /* F0EE-F0EE */
+  AOT_BEGIN(1);
+  /* F0EE: abx */
+  AOT_INSN(0x3A, 1, 0xF0EF, 0xA700);
+  x = (x + b) & 0xFFFF;
+  AOT_CYCLES(1);
+  goto aot_F0EF;
+
+aot_F0EF: /* F0EF-F0F6 */
+  AOT_BEGIN(11);
+  /* F0EF: staa 00,x */
+  AOT_INSN(0xA7, 4, 0xF0F0, 0x0008);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(7);
+  /* F0F1: inx */
+  AOT_INSN(0x08, 1, 0xF0F2, 0x8C01);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F0F2: cpx  #0100 */
+  AOT_INSN(0x8C, 3, 0xF0F3, 0x0100);
+  IMM16(w); (void)SUB16(x, w);
+  /* F0F5: bne  f0ef */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF0F6, 0xF8C6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF0EF)
+    goto aot_F0EF;
+  goto aot_F0F7;
+
+aot_F0F7: /* F0F7-F128 */
+  AOT_BEGIN(68);
+  /* F0F7: ldab #aa */
+  AOT_INSN(0xC6, 2, 0xF0F8, 0xAAD7);
+  IMM8(t); b = LOGIC8(t);
+  /* F0F9: stab 88 */
+  AOT_INSN(0xD7, 3, 0xF0FA, 0x88C6);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F0FB: ldab #80 */
+  AOT_INSN(0xC6, 2, 0xF0FC, 0x80D7);
+  IMM8(t); b = LOGIC8(t);
+  /* F0FD: stab 8b */
+  AOT_INSN(0xD7, 3, 0xF0FE, 0x8BC6);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F0FF: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF100, 0x01D7);
+  IMM8(t); b = LOGIC8(t);
+  /* F101: stab 8a */
+  AOT_INSN(0xD7, 3, 0xF102, 0x8A5C);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F103: incb */
+  AOT_INSN(0x5C, 1, 0xF104, 0xDD8C);
+  b = INC8(b);
+  /* F104: std  8c */
+  AOT_INSN(0xDD, 4, 0xF105, 0x8C4C);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  /* F106: inca */
+  AOT_INSN(0x4C, 1, 0xF107, 0x97B0);
+  a = INC8(a);
+  /* F107: staa b0 */
+  AOT_INSN(0x97, 3, 0xF108, 0xB097);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F109: staa b1 */
+  AOT_INSN(0x97, 3, 0xF10A, 0xB197);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F10B: staa b2 */
+  AOT_INSN(0x97, 3, 0xF10C, 0xB297);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F10D: staa b3 */
+  AOT_INSN(0x97, 3, 0xF10E, 0xB386);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F10F: ldaa #98 */
+  AOT_INSN(0x86, 2, 0xF110, 0x9897);
+  IMM8(t); a = LOGIC8(t);
+  /* F111: staa c9 */
+  AOT_INSN(0x97, 3, 0xF112, 0xC986);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F113: ldaa #28 */
+  AOT_INSN(0x86, 2, 0xF114, 0x2897);
+  IMM8(t); a = LOGIC8(t);
+  /* F115: staa ca */
+  AOT_INSN(0x97, 3, 0xF116, 0xCA86);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F117: ldaa #06 */
+  AOT_INSN(0x86, 2, 0xF118, 0x0697);
+  IMM8(t); a = LOGIC8(t);
+  /* F119: staa 9b */
+  AOT_INSN(0x97, 3, 0xF11A, 0x9B86);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F11B: ldaa #95 */
+  AOT_INSN(0x86, 2, 0xF11C, 0x9597);
+  IMM8(t); a = LOGIC8(t);
+  /* F11D: staa d7 */
+  AOT_INSN(0x97, 3, 0xF11E, 0xD786);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F11F: ldaa #fe */
+  AOT_INSN(0x86, 2, 0xF120, 0xFE97);
+  IMM8(t); a = LOGIC8(t);
+  /* F121: staa 03 */
+  AOT_CYCLES(55);
+  AOT_INSN(0x97, 3, 0xF122, 0x034F);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(10);
+  /* F123: clra */
+  AOT_INSN(0x4F, 1, 0xF124, 0x9705);
+  a = CLR8();
+  /* F124: staa 05 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x97, 3, 0xF125, 0x05BD);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(6);
+  /* F126: jsr  fb8e */
+  AOT_INSN(0xBD, 6, 0xF127, 0xFB8E);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FB8E;
+
+aot_F129: /* F129-F130 */
+  AOT_BEGIN(12);
+  /* F129: ldd  09 */
+  AOT_INSN(0xDC, 4, 0xF12A, 0x09CB);
+  DIR16(w); SETD(LOGIC16(w));
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* F12B: addb #13 */
+  AOT_INSN(0xCB, 2, 0xF12C, 0x13D1);
+  IMM8(t); b = ADD8(b, t, 0);
+  /* F12D: cmpb 0c */
+  AOT_CYCLES(2);
+  AOT_INSN(0xD1, 3, 0xF12E, 0x0C26);
+  DIR8(t); (void)SUB8(b, t, 0);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* F12F: bne  f132 */
+  AOT_INSN(0x26, 3, 0xF130, 0x0101);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF132)
+    goto aot_F132;
+  goto aot_F131;
+
+aot_F131: /* F131-F131 */
+  AOT_BEGIN(1);
+  /* F131: nop */
+  AOT_INSN(0x01, 1, 0xF132, 0xDC09);
+  ;
+  AOT_CYCLES(1);
+  goto aot_F132;
+
+aot_F132: /* F132-F139 */
+  AOT_BEGIN(12);
+  /* F132: ldd  09 */
+  AOT_INSN(0xDC, 4, 0xF133, 0x09C3);
+  DIR16(w); SETD(LOGIC16(w));
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* F134: addd #0010 */
+  AOT_INSN(0xC3, 3, 0xF135, 0x0010);
+  IMM16(w); SETD(ADD16(ACCD, w));
+  /* F137: std  0b */
+  AOT_CYCLES(3);
+  AOT_INSN(0xDD, 4, 0xF138, 0x0B0E);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  AOT_CYCLES(4);
+  AOT_SYNC(1);
+  /* F139: cli */
+  AOT_INSN(0x0E, 1, 0xF13A, 0x96CB);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(0);
+  goto aot_F13A;
+
+aot_F13A: /* F13A-F13D */
+  AOT_BEGIN(6);
+  /* F13A: ldaa cb */
+  AOT_INSN(0x96, 3, 0xF13B, 0xCB2A);
+  DIR8(t); a = LOGIC8(t);
+  /* F13C: bpl  f141 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xF13D, 0x03BD);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF141)
+    goto aot_F141;
+  goto aot_F13E;
+
+aot_F13E: /* F13E-F140 */
+  AOT_BEGIN(6);
+  /* F13E: jsr  f8d4 */
+  AOT_INSN(0xBD, 6, 0xF13F, 0xF8D4);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F8D4;
+
+aot_F141: /* F141-F146 */
+  AOT_BEGIN(8);
+  /* F141: ldab c9 */
+  AOT_INSN(0xD6, 3, 0xF142, 0xC9C5);
+  DIR8(t); b = LOGIC8(t);
+  /* F143: bitb #02 */
+  AOT_INSN(0xC5, 2, 0xF144, 0x0226);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F145: bne  f171 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xF146, 0x2A5D);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF171)
+    goto aot_F171;
+  goto aot_F147;
+
+aot_F147: /* F147-F149 */
+  AOT_BEGIN(4);
+  /* F147: tstb */
+  AOT_INSN(0x5D, 1, 0xF148, 0x2A0D);
+  (void)TEST8(b);
+  /* F148: bpl  f157 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x2A, 3, 0xF149, 0x0DBD);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF157)
+    goto aot_F157;
+  goto aot_F14A;
+
+aot_F14A: /* F14A-F14C */
+  AOT_BEGIN(6);
+  /* F14A: jsr  f186 */
+  AOT_INSN(0xBD, 6, 0xF14B, 0xF186);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F186;
+
+aot_F14D: /* F14D-F14F */
+  AOT_BEGIN(3);
+  /* F14D: jmp f371 */
+  AOT_INSN(0x7E, 3, 0xF14E, 0xF371);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F371;
+
+aot_F150: /* F150-F153 */
+  AOT_BEGIN(6);
+  /* F150: ldaa cb */
+  AOT_INSN(0x96, 3, 0xF151, 0xCB2A);
+  DIR8(t); a = LOGIC8(t);
+  /* F152: bpl  f171 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xF153, 0x1DBD);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF171)
+    goto aot_F171;
+  goto aot_F154;
+
+aot_F154: /* F154-F156 */
+  AOT_BEGIN(6);
+  /* F154: jsr  f8d4 */
+  AOT_INSN(0xBD, 6, 0xF155, 0xF8D4);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F8D4;
+
+aot_F157: /* F157-F15B */
+  AOT_BEGIN(7);
+  /* F157: tim 20ca */
+  AOT_INSN(0x7B, 4, 0xF158, 0x20CA);
+  IMM_MEM(ea, &, 0);
+  /* F15A: beq  f13a */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF15B, 0xDE96);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF13A)
+    goto aot_F13A;
+  goto aot_F15C;
+
+aot_F15C: /* F15C-F15F */
+  AOT_BEGIN(6);
+  /* F15C: ldaa c9 */
+  AOT_INSN(0x96, 3, 0xF15D, 0xC92A);
+  DIR8(t); a = LOGIC8(t);
+  /* F15E: bpl  f16b */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xF15F, 0x0B96);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF16B)
+    goto aot_F16B;
+  goto aot_F160;
+
+aot_F160: /* F160-F165 */
+  AOT_BEGIN(9);
+  /* F160: ldaa 07 */
+  AOT_INSN(0x96, 3, 0xF161, 0x0791);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(6);
+  /* F162: cmpa 07 */
+  AOT_INSN(0x91, 3, 0xF163, 0x0726);
+  DIR8(t); (void)SUB8(a, t, 0);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* F164: bne  f160 */
+  AOT_INSN(0x26, 3, 0xF165, 0xFA84);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF160)
+    goto aot_F160;
+  goto aot_F166;
+
+aot_F166: /* F166-F16A */
+  AOT_BEGIN(5);
+  /* F166: anda #f0 */
+  AOT_INSN(0x84, 2, 0xF167, 0xF07E);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F168: jmp f681 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x7E, 3, 0xF169, 0xF681);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F681;
+
+aot_F16B: /* F16B-F16D */
+  AOT_BEGIN(6);
+  /* F16B: jsr  f186 */
+  AOT_INSN(0xBD, 6, 0xF16C, 0xF186);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F186;
+
+aot_F16E: /* F16E-F170 */
+  AOT_BEGIN(3);
+  /* F16E: jmp f681 */
+  AOT_INSN(0x7E, 3, 0xF16F, 0xF681);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F681;
+
+aot_F171: /* F171-F176 */
+  AOT_BEGIN(8);
+  /* F171: ldaa ca */
+  AOT_INSN(0x96, 3, 0xF172, 0xCA85);
+  DIR8(t); a = LOGIC8(t);
+  /* F173: bita #20 */
+  AOT_INSN(0x85, 2, 0xF174, 0x2027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F175: beq  f13a */
+  AOT_CYCLES(5);
+  AOT_INSN(0x27, 3, 0xF176, 0xC385);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF13A)
+    goto aot_F13A;
+  goto aot_F177;
+
+aot_F177: /* F177-F17A */
+  AOT_BEGIN(5);
+  /* F177: bita #03 */
+  AOT_INSN(0x85, 2, 0xF178, 0x0327);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F179: beq  f16b */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF17A, 0xF07B);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF16B)
+    goto aot_F16B;
+  goto aot_F17B;
+
+aot_F17B: /* F17B-F17F */
+  AOT_BEGIN(7);
+  /* F17B: tim 08cb */
+  AOT_INSN(0x7B, 4, 0xF17C, 0x08CB);
+  IMM_MEM(ea, &, 0);
+  /* F17E: bne  f13a */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF17F, 0xBA44);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF13A)
+    goto aot_F13A;
+  goto aot_F180;
+
+aot_F180: /* F180-F182 */
+  AOT_BEGIN(4);
+  /* F180: lsra */
+  AOT_INSN(0x44, 1, 0xF181, 0x24E8);
+  a = SHR8(a, 0);
+  /* F181: bcc  f16b */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF182, 0xE87E);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF16B)
+    goto aot_F16B;
+  goto aot_F183;
+
+aot_F183: /* F183-F185 */
+  AOT_BEGIN(3);
+  /* F183: jmp f8a2 */
+  AOT_INSN(0x7E, 3, 0xF184, 0xF8A2);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F8A2;
+
+aot_F186: /* F186-F18B */
+  AOT_BEGIN(9);
+  /* F186: ldaa 03 */
+  AOT_INSN(0x96, 3, 0xF187, 0x0391);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(6);
+  /* F188: cmpa 03 */
+  AOT_INSN(0x91, 3, 0xF189, 0x0326);
+  DIR8(t); (void)SUB8(a, t, 0);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* F18A: bne  f186 */
+  AOT_INSN(0x26, 3, 0xF18B, 0xFA84);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF186)
+    goto aot_F186;
+  goto aot_F18C;
+
+aot_F18C: /* F18C-F191 */
+  AOT_BEGIN(8);
+  /* F18C: anda #06 */
+  AOT_INSN(0x84, 2, 0xF18D, 0x06D6);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F18E: ldab 9d */
+  AOT_INSN(0xD6, 3, 0xF18F, 0x9D27);
+  DIR8(t); b = LOGIC8(t);
+  /* F190: beq  f1a7 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x27, 3, 0xF191, 0x15C1);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF1A7)
+    goto aot_F1A7;
+  goto aot_F192;
+
+aot_F192: /* F192-F195 */
+  AOT_BEGIN(5);
+  /* F192: cmpb #0a */
+  AOT_INSN(0xC1, 2, 0xF193, 0x0A25);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F194: bcs  f1b0 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xF195, 0x1A5F);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF1B0)
+    goto aot_F1B0;
+  goto aot_F196;
+
+aot_F196: /* F196-F1A6 */
+  AOT_BEGIN(24);
+  /* F196: clrb */
+  AOT_INSN(0x5F, 1, 0xF197, 0xD79D);
+  b = CLR8();
+  /* F197: stab 9d */
+  AOT_INSN(0xD7, 3, 0xF198, 0x9D97);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F199: staa c5 */
+  AOT_INSN(0x97, 3, 0xF19A, 0xC516);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F19B: tab */
+  AOT_INSN(0x16, 1, 0xF19C, 0x989C);
+  b = LOGIC8(a);
+  /* F19C: eora 9c */
+  AOT_INSN(0x98, 3, 0xF19D, 0x9C94);
+  DIR8(t); a = LOGIC8(a ^ t);
+  /* F19E: anda 9b */
+  AOT_INSN(0x94, 3, 0xF19F, 0x9BD4);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F1A0: anda 9c */
+  AOT_INSN(0xD4, 3, 0xF1A1, 0x9C1B);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F1A2: aba */
+  AOT_INSN(0x1B, 1, 0xF1A3, 0x979B);
+  a = ADD8(a, b, 0);
+  /* F1A3: staa 9b */
+  AOT_INSN(0x97, 3, 0xF1A4, 0x9B96);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F1A5: ldaa c5 */
+  AOT_INSN(0x96, 3, 0xF1A6, 0xC591);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(24);
+  goto aot_F1A7;
+
+aot_F1A7: /* F1A7-F1AA */
+  AOT_BEGIN(6);
+  /* F1A7: cmpa 9b */
+  AOT_INSN(0x91, 3, 0xF1A8, 0x9B27);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F1A9: beq  f1b0 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF1AA, 0x0597);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF1B0)
+    goto aot_F1B0;
+  goto aot_F1AB;
+
+aot_F1AB: /* F1AB-F1AF */
+  AOT_BEGIN(9);
+  /* F1AB: staa 9c */
+  AOT_INSN(0x97, 3, 0xF1AC, 0x9C7C);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F1AD: inc 009d */
+  AOT_INSN(0x7C, 6, 0xF1AE, 0x009D);
+  EXT8(t); t = INC8(t); WR(ea, t);
+  AOT_CYCLES(9);
+  goto aot_F1B0;
+
+aot_F1B0: /* F1B0-F1B5 */
+  AOT_BEGIN(9);
+  /* F1B0: ldaa 07 */
+  AOT_INSN(0x96, 3, 0xF1B1, 0x0791);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(6);
+  /* F1B2: cmpa 07 */
+  AOT_INSN(0x91, 3, 0xF1B3, 0x0726);
+  DIR8(t); (void)SUB8(a, t, 0);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* F1B4: bne  f1b0 */
+  AOT_INSN(0x26, 3, 0xF1B5, 0xFA39);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF1B0)
+    goto aot_F1B0;
+  goto aot_F1B6;
+
+aot_F1B6: /* F1B6-F1B6 */
+  AOT_BEGIN(5);
+  /* F1B6: rts */
+  AOT_INSN(0x39, 5, 0xF1B7, 0x8601);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F1B7: /* F1B7-F1C6 */
+  AOT_BEGIN(22);
+  /* F1B7: ldaa #01 */
+  AOT_INSN(0x86, 2, 0xF1B8, 0x0197);
+  IMM8(t); a = LOGIC8(t);
+  /* F1B9: staa 03 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x97, 3, 0xF1BA, 0x03DC);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(17);
+  /* F1BB: ldd  8c */
+  AOT_INSN(0xDC, 4, 0xF1BC, 0x8C43);
+  DIR16(w); SETD(LOGIC16(w));
+  /* F1BD: coma */
+  AOT_INSN(0x43, 1, 0xF1BE, 0x53D7);
+  a = COM8(a);
+  /* F1BE: comb */
+  AOT_INSN(0x53, 1, 0xF1BF, 0xD706);
+  b = COM8(b);
+  /* F1BF: stab 06 */
+  AOT_CYCLES(6);
+  AOT_INSN(0xD7, 3, 0xF1C0, 0x06C6);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(3);
+  AOT_SYNC(8);
+  /* F1C1: ldab #ff */
+  AOT_INSN(0xC6, 2, 0xF1C2, 0xFFD7);
+  IMM8(t); b = LOGIC8(t);
+  /* F1C3: stab 05 */
+  AOT_CYCLES(2);
+  AOT_INSN(0xD7, 3, 0xF1C4, 0x0597);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* F1C5: staa 07 */
+  AOT_INSN(0x97, 3, 0xF1C6, 0x0796);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(0);
+  goto aot_F1C7;
+
+aot_F1C7: /* F1C7-F1CC */
+  AOT_BEGIN(9);
+  /* F1C7: ldaa 02 */
+  AOT_INSN(0x96, 3, 0xF1C8, 0x0291);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(6);
+  /* F1C9: cmpa 02 */
+  AOT_INSN(0x91, 3, 0xF1CA, 0x0226);
+  DIR8(t); (void)SUB8(a, t, 0);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* F1CB: bne  f1c7 */
+  AOT_INSN(0x26, 3, 0xF1CC, 0xFACE);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF1C7)
+    goto aot_F1C7;
+  goto aot_F1CD;
+
+aot_F1CD: /* F1CD-F1DB */
+  AOT_BEGIN(20);
+  /* F1CD: ldx  #ffff */
+  AOT_INSN(0xCE, 3, 0xF1CE, 0xFFFF);
+  IMM16(w); x = LOGIC16(w);
+  /* F1D0: stx  06 */
+  AOT_CYCLES(3);
+  AOT_INSN(0xDF, 4, 0xF1D1, 0x06C6);
+  EA_DIR(); (void)LOGIC16(x); WRW(ea, x);
+  AOT_CYCLES(4);
+  AOT_SYNC(13);
+  /* F1D2: ldab #fe */
+  AOT_INSN(0xC6, 2, 0xF1D3, 0xFED7);
+  IMM8(t); b = LOGIC8(t);
+  /* F1D4: stab 03 */
+  AOT_CYCLES(2);
+  AOT_INSN(0xD7, 3, 0xF1D5, 0x035F);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(3);
+  AOT_SYNC(8);
+  /* F1D6: clrb */
+  AOT_INSN(0x5F, 1, 0xF1D7, 0xD705);
+  b = CLR8();
+  /* F1D7: stab 05 */
+  AOT_CYCLES(1);
+  AOT_INSN(0xD7, 3, 0xF1D8, 0x0543);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(3);
+  AOT_SYNC(4);
+  /* F1D9: coma */
+  AOT_INSN(0x43, 1, 0xF1DA, 0x2607);
+  a = COM8(a);
+  /* F1DA: bne  f1e3 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xF1DB, 0x07D6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF1E3)
+    goto aot_F1E3;
+  goto aot_F1DC;
+
+aot_F1DC: /* F1DC-F1DF */
+  AOT_BEGIN(6);
+  /* F1DC: ldab 89 */
+  AOT_INSN(0xD6, 3, 0xF1DD, 0x8926);
+  DIR8(t); b = LOGIC8(t);
+  /* F1DE: bne  f1e3 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xF1DF, 0x037E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF1E3)
+    goto aot_F1E3;
+  goto aot_F1E0;
+
+aot_F1E0: /* F1E0-F1E2 */
+  AOT_BEGIN(3);
+  /* F1E0: jmp f2d5 */
+  AOT_INSN(0x7E, 3, 0xF1E1, 0xF2D5);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F2D5;
+
+aot_F1E3: /* F1E3-F1EA */
+  AOT_BEGIN(11);
+  /* F1E3: staa 8e */
+  AOT_INSN(0x97, 3, 0xF1E4, 0x8ED6);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F1E5: ldab 8a */
+  AOT_INSN(0xD6, 3, 0xF1E6, 0x8AC1);
+  DIR8(t); b = LOGIC8(t);
+  /* F1E7: cmpb #05 */
+  AOT_INSN(0xC1, 2, 0xF1E8, 0x0524);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F1E9: bcc  f240 */
+  AOT_CYCLES(8);
+  AOT_INSN(0x24, 3, 0xF1EA, 0x555A);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF240)
+    goto aot_F240;
+  goto aot_F1EB;
+
+aot_F1EB: /* F1EB-F1FD */
+  AOT_BEGIN(27);
+  /* F1EB: decb */
+  AOT_INSN(0x5A, 1, 0xF1EC, 0xCEF1);
+  b = DEC8(b);
+  /* F1EC: ldx  #f1fe */
+  AOT_INSN(0xCE, 3, 0xF1ED, 0xF1FE);
+  IMM16(w); x = LOGIC16(w);
+  /* F1EF: abx */
+  AOT_INSN(0x3A, 1, 0xF1F0, 0xA600);
+  x = (x + b) & 0xFFFF;
+  /* F1F0: ldaa 00,x */
+  AOT_CYCLES(5);
+  AOT_INSN(0xA6, 4, 0xF1F1, 0x0097);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(18);
+  /* F1F2: staa 93 */
+  AOT_INSN(0x97, 3, 0xF1F3, 0x93C6);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F1F4: ldab #04 */
+  AOT_INSN(0xC6, 2, 0xF1F5, 0x043A);
+  IMM8(t); b = LOGIC8(t);
+  /* F1F6: abx */
+  AOT_INSN(0x3A, 1, 0xF1F7, 0xA600);
+  x = (x + b) & 0xFFFF;
+  /* F1F7: ldaa 00,x */
+  AOT_CYCLES(6);
+  AOT_INSN(0xA6, 4, 0xF1F8, 0x003A);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* F1F9: abx */
+  AOT_INSN(0x3A, 1, 0xF1FA, 0xE600);
+  x = (x + b) & 0xFFFF;
+  /* F1FA: ldab 00,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xE6, 4, 0xF1FB, 0x0020);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F1FC: bra  f20a */
+  AOT_INSN(0x20, 3, 0xF1FD, 0x0C04);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F20A;
+
+aot_F20A: /* F20A-F20D */
+  AOT_BEGIN(6);
+  /* F20A: bita 8e */
+  AOT_INSN(0x95, 3, 0xF20B, 0x8E27);
+  DIR8(t); (void)LOGIC8(a & t);
+  /* F20C: beq  f220 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF20D, 0x1243);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF220)
+    goto aot_F220;
+  goto aot_F20E;
+
+aot_F20E: /* F20E-F218 */
+  AOT_BEGIN(16);
+  /* F20E: coma */
+  AOT_INSN(0x43, 1, 0xF20F, 0x948E);
+  a = COM8(a);
+  /* F20F: anda 8e */
+  AOT_INSN(0x94, 3, 0xF210, 0x8E97);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F211: staa 8e */
+  AOT_INSN(0x97, 3, 0xF212, 0x8E96);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F213: ldaa 93 */
+  AOT_INSN(0x96, 3, 0xF214, 0x9395);
+  DIR8(t); a = LOGIC8(t);
+  /* F215: bita 89 */
+  AOT_INSN(0x95, 3, 0xF216, 0x8926);
+  DIR8(t); (void)LOGIC8(a & t);
+  /* F217: bne  f237 */
+  AOT_CYCLES(13);
+  AOT_INSN(0x26, 3, 0xF218, 0x1E9A);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF237)
+    goto aot_F237;
+  goto aot_F219;
+
+aot_F219: /* F219-F21F */
+  AOT_BEGIN(10);
+  /* F219: oraa 89 */
+  AOT_INSN(0x9A, 3, 0xF21A, 0x8997);
+  DIR8(t); a = LOGIC8(a | t);
+  /* F21B: staa 89 */
+  AOT_INSN(0x97, 3, 0xF21C, 0x894F);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F21D: clra */
+  AOT_INSN(0x4F, 1, 0xF21E, 0x200F);
+  a = CLR8();
+  /* F21E: bra  f22f */
+  AOT_CYCLES(7);
+  AOT_INSN(0x20, 3, 0xF21F, 0x0F96);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F22F;
+
+aot_F220: /* F220-F225 */
+  AOT_BEGIN(9);
+  /* F220: ldaa 89 */
+  AOT_INSN(0x96, 3, 0xF221, 0x8995);
+  DIR8(t); a = LOGIC8(t);
+  /* F222: bita 93 */
+  AOT_INSN(0x95, 3, 0xF223, 0x9327);
+  DIR8(t); (void)LOGIC8(a & t);
+  /* F224: beq  f237 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x27, 3, 0xF225, 0x1196);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF237)
+    goto aot_F237;
+  goto aot_F226;
+
+aot_F226: /* F226-F22E */
+  AOT_BEGIN(12);
+  /* F226: ldaa 93 */
+  AOT_INSN(0x96, 3, 0xF227, 0x9343);
+  DIR8(t); a = LOGIC8(t);
+  /* F228: coma */
+  AOT_INSN(0x43, 1, 0xF229, 0x9489);
+  a = COM8(a);
+  /* F229: anda 89 */
+  AOT_INSN(0x94, 3, 0xF22A, 0x8997);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F22B: staa 89 */
+  AOT_INSN(0x97, 3, 0xF22C, 0x8986);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F22D: ldaa #80 */
+  AOT_INSN(0x86, 2, 0xF22E, 0x80D7);
+  IMM8(t); a = LOGIC8(t);
+  AOT_CYCLES(12);
+  goto aot_F22F;
+
+aot_F22F: /* F22F-F236 */
+  AOT_BEGIN(13);
+  /* F22F: stab 93 */
+  AOT_INSN(0xD7, 3, 0xF230, 0x939A);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F231: oraa 93 */
+  AOT_INSN(0x9A, 3, 0xF232, 0x935F);
+  DIR8(t); a = LOGIC8(a | t);
+  /* F233: clrb */
+  AOT_INSN(0x5F, 1, 0xF234, 0xBDFD);
+  b = CLR8();
+  /* F234: jsr  fd34 */
+  AOT_CYCLES(7);
+  AOT_INSN(0xBD, 6, 0xF235, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F237: /* F237-F23C */
+  AOT_BEGIN(8);
+  /* F237: ldaa 8a */
+  AOT_INSN(0x96, 3, 0xF238, 0x8A81);
+  DIR8(t); a = LOGIC8(t);
+  /* F239: cmpa #01 */
+  AOT_INSN(0x81, 2, 0xF23A, 0x0126);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F23B: bne  f240 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xF23C, 0x037E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF240)
+    goto aot_F240;
+  goto aot_F23D;
+
+aot_F23D: /* F23D-F23F */
+  AOT_BEGIN(3);
+  /* F23D: jmp f2d5 */
+  AOT_INSN(0x7E, 3, 0xF23E, 0xF2D5);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F2D5;
+
+aot_F240: /* F240-F245 */
+  AOT_BEGIN(8);
+  /* F240: ldaa 11 */
+  AOT_INSN(0x96, 3, 0xF241, 0x1185);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* F242: bita #c0 */
+  AOT_INSN(0x85, 2, 0xF243, 0xC027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F244: beq  f252 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF245, 0x0C85);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF252)
+    goto aot_F252;
+  goto aot_F246;
+
+aot_F246: /* F246-F249 */
+  AOT_BEGIN(5);
+  /* F246: bita #40 */
+  AOT_INSN(0x85, 2, 0xF247, 0x4027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F248: beq  f24f */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF249, 0x05BD);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF24F)
+    goto aot_F24F;
+  goto aot_F24A;
+
+aot_F24A: /* F24A-F24C */
+  AOT_BEGIN(6);
+  /* F24A: jsr  ff40 */
+  AOT_INSN(0xBD, 6, 0xF24B, 0xFF40);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FF40;
+
+aot_F24D: /* F24D-F24E */
+  AOT_BEGIN(3);
+  /* F24D: bra  f252 */
+  AOT_INSN(0x20, 3, 0xF24E, 0x03BD);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F252;
+
+aot_F24F: /* F24F-F251 */
+  AOT_BEGIN(6);
+  /* F24F: jsr  ff04 */
+  AOT_INSN(0xBD, 6, 0xF250, 0xFF04);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FF04;
+
+aot_F252: /* F252-F255 */
+  AOT_BEGIN(6);
+  /* F252: ldab 8b */
+  AOT_INSN(0xD6, 3, 0xF253, 0x8B2B);
+  DIR8(t); b = LOGIC8(t);
+  /* F254: bmi  f29a */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2B, 3, 0xF255, 0x4486);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF29A)
+    goto aot_F29A;
+  goto aot_F256;
+
+aot_F256: /* F256-F260 */
+  AOT_BEGIN(13);
+  /* F256: ldaa #01 */
+  AOT_INSN(0x86, 2, 0xF257, 0x01D6);
+  IMM8(t); a = LOGIC8(t);
+  /* F258: ldab 89 */
+  AOT_INSN(0xD6, 3, 0xF259, 0x89C4);
+  DIR8(t); b = LOGIC8(t);
+  /* F25A: andb #03 */
+  AOT_INSN(0xC4, 2, 0xF25B, 0x035A);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F25C: decb */
+  AOT_INSN(0x5A, 1, 0xF25D, 0xC102);
+  b = DEC8(b);
+  /* F25D: cmpb #02 */
+  AOT_INSN(0xC1, 2, 0xF25E, 0x0226);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F25F: bne  f26b */
+  AOT_CYCLES(10);
+  AOT_INSN(0x26, 3, 0xF260, 0x0A4F);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF26B)
+    goto aot_F26B;
+  goto aot_F261;
+
+aot_F261: /* F261-F264 */
+  AOT_BEGIN(5);
+  /* F261: clra */
+  AOT_INSN(0x4F, 1, 0xF262, 0x5F20);
+  a = CLR8();
+  /* F262: clrb */
+  AOT_INSN(0x5F, 1, 0xF263, 0x2006);
+  b = CLR8();
+  /* F263: bra  f26b */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF264, 0x06D6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F26B;
+
+aot_F265: /* F265-F268 */
+  AOT_BEGIN(6);
+  /* F265: ldab 93 */
+  AOT_INSN(0xD6, 3, 0xF266, 0x9326);
+  DIR8(t); b = LOGIC8(t);
+  /* F267: bne  f2cf */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xF268, 0x665C);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF2CF)
+    goto aot_F2CF;
+  goto aot_F269;
+
+aot_F269: /* F269-F26A */
+  AOT_BEGIN(2);
+  /* F269: incb */
+  AOT_INSN(0x5C, 1, 0xF26A, 0x1797);
+  b = INC8(b);
+  /* F26A: tba */
+  AOT_INSN(0x17, 1, 0xF26B, 0x9793);
+  a = LOGIC8(b);
+  AOT_CYCLES(2);
+  goto aot_F26B;
+
+aot_F26B: /* F26B-F276 */
+  AOT_BEGIN(17);
+  /* F26B: staa 93 */
+  AOT_INSN(0x97, 3, 0xF26C, 0x93CE);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F26D: ldx  #0091 */
+  AOT_INSN(0xCE, 3, 0xF26E, 0x0091);
+  IMM16(w); x = LOGIC16(w);
+  /* F270: abx */
+  AOT_INSN(0x3A, 1, 0xF271, 0xA600);
+  x = (x + b) & 0xFFFF;
+  /* F271: ldaa 00,x */
+  AOT_CYCLES(7);
+  AOT_INSN(0xA6, 4, 0xF272, 0x0091);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(6);
+  /* F273: cmpa 8a */
+  AOT_INSN(0x91, 3, 0xF274, 0x8A26);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F275: bne  f265 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xF276, 0xEE09);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF265)
+    goto aot_F265;
+  goto aot_F277;
+
+aot_F277: /* F277-F27E */
+  AOT_BEGIN(12);
+  /* F277: dex */
+  AOT_INSN(0x09, 1, 0xF278, 0x09A6);
+  x = (x - 1) & 0xFFFF; fz = x;
+  /* F278: dex */
+  AOT_INSN(0x09, 1, 0xF279, 0xA600);
+  x = (x - 1) & 0xFFFF; fz = x;
+  /* F279: ldaa 00,x */
+  AOT_CYCLES(2);
+  AOT_INSN(0xA6, 4, 0xF27A, 0x0095);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(6);
+  /* F27B: bita 8e */
+  AOT_INSN(0x95, 3, 0xF27C, 0x8E27);
+  DIR8(t); (void)LOGIC8(a & t);
+  /* F27D: beq  f286 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF27E, 0x0743);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF286)
+    goto aot_F286;
+  goto aot_F27F;
+
+aot_F27F: /* F27F-F285 */
+  AOT_BEGIN(10);
+  /* F27F: coma */
+  AOT_INSN(0x43, 1, 0xF280, 0x948E);
+  a = COM8(a);
+  /* F280: anda 8e */
+  AOT_INSN(0x94, 3, 0xF281, 0x8E97);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F282: staa 8e */
+  AOT_INSN(0x97, 3, 0xF283, 0x8E20);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F284: bra  f265 */
+  AOT_CYCLES(7);
+  AOT_INSN(0x20, 3, 0xF285, 0xDF5C);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F265;
+
+aot_F286: /* F286-F28E */
+  AOT_BEGIN(14);
+  /* F286: incb */
+  AOT_INSN(0x5C, 1, 0xF287, 0x53D4);
+  b = INC8(b);
+  /* F287: comb */
+  AOT_INSN(0x53, 1, 0xF288, 0xD489);
+  b = COM8(b);
+  /* F288: anda 89 */
+  AOT_INSN(0xD4, 3, 0xF289, 0x89D7);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F28A: stab 89 */
+  AOT_INSN(0xD7, 3, 0xF28B, 0x89BD);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F28C: jsr  f2e8 */
+  AOT_CYCLES(8);
+  AOT_INSN(0xBD, 6, 0xF28D, 0xF2E8);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F2E8;
+
+aot_F28F: /* F28F-F291 */
+  AOT_BEGIN(6);
+  /* F28F: jsr  f2f7 */
+  AOT_INSN(0xBD, 6, 0xF290, 0xF2F7);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F2F7;
+
+aot_F292: /* F292-F297 */
+  AOT_BEGIN(9);
+  /* F292: oraa #80 */
+  AOT_INSN(0x8A, 2, 0xF293, 0x805F);
+  IMM8(t); a = LOGIC8(a | t);
+  /* F294: clrb */
+  AOT_INSN(0x5F, 1, 0xF295, 0xBDFD);
+  b = CLR8();
+  /* F295: jsr  fd34 */
+  AOT_CYCLES(3);
+  AOT_INSN(0xBD, 6, 0xF296, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F298: /* F298-F299 */
+  AOT_BEGIN(3);
+  /* F298: bra  f265 */
+  AOT_INSN(0x20, 3, 0xF299, 0xCB96);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F265;
+
+aot_F29A: /* F29A-F29D */
+  AOT_BEGIN(6);
+  /* F29A: ldaa 8e */
+  AOT_INSN(0x96, 3, 0xF29B, 0x8E27);
+  DIR8(t); a = LOGIC8(t);
+  /* F29C: beq  f2d5 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF29D, 0x37C6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF2D5)
+    goto aot_F2D5;
+  goto aot_F29E;
+
+aot_F29E: /* F29E-F2A1 */
+  AOT_BEGIN(5);
+  /* F29E: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF29F, 0x0120);
+  IMM8(t); b = LOGIC8(t);
+  /* F2A0: bra  f2a3 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF2A1, 0x0158);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F2A3;
+
+aot_F2A2: /* F2A2-F2A2 */
+  AOT_BEGIN(1);
+  /* F2A2: lslb */
+  AOT_INSN(0x58, 1, 0xF2A3, 0x4424);
+  b = SHL8(b, 0);
+  AOT_CYCLES(1);
+  goto aot_F2A3;
+
+aot_F2A3: /* F2A3-F2A5 */
+  AOT_BEGIN(4);
+  /* F2A3: lsra */
+  AOT_INSN(0x44, 1, 0xF2A4, 0x24FC);
+  a = SHR8(a, 0);
+  /* F2A4: bcc  f2a2 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF2A5, 0xFC17);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF2A2)
+    goto aot_F2A2;
+  goto aot_F2A6;
+
+aot_F2A6: /* F2A6-F2C5 */
+  AOT_BEGIN(46);
+  /* F2A6: tba */
+  AOT_INSN(0x17, 1, 0xF2A7, 0xD793);
+  a = LOGIC8(b);
+  /* F2A7: stab 93 */
+  AOT_INSN(0xD7, 3, 0xF2A8, 0x9353);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F2A9: comb */
+  AOT_INSN(0x53, 1, 0xF2AA, 0xD48E);
+  b = COM8(b);
+  /* F2AA: anda 8e */
+  AOT_INSN(0xD4, 3, 0xF2AB, 0x8ED7);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F2AC: stab 8e */
+  AOT_INSN(0xD7, 3, 0xF2AD, 0x8ED6);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F2AE: ldab 8b */
+  AOT_INSN(0xD6, 3, 0xF2AF, 0x8BC4);
+  DIR8(t); b = LOGIC8(t);
+  /* F2B0: andb #03 */
+  AOT_INSN(0xC4, 2, 0xF2B1, 0x03CE);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F2B2: ldx  #008f */
+  AOT_INSN(0xCE, 3, 0xF2B3, 0x008F);
+  IMM16(w); x = LOGIC16(w);
+  /* F2B5: abx */
+  AOT_INSN(0x3A, 1, 0xF2B6, 0xA700);
+  x = (x + b) & 0xFFFF;
+  /* F2B6: staa 00,x */
+  AOT_CYCLES(20);
+  AOT_INSN(0xA7, 4, 0xF2B7, 0x0008);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(22);
+  /* F2B8: inx */
+  AOT_INSN(0x08, 1, 0xF2B9, 0x0896);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F2B9: inx */
+  AOT_INSN(0x08, 1, 0xF2BA, 0x968A);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F2BA: ldaa 8a */
+  AOT_INSN(0x96, 3, 0xF2BB, 0x8AA7);
+  DIR8(t); a = LOGIC8(t);
+  /* F2BC: staa 00,x */
+  AOT_CYCLES(5);
+  AOT_INSN(0xA7, 4, 0xF2BD, 0x005C);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(13);
+  /* F2BE: incb */
+  AOT_INSN(0x5C, 1, 0xF2BF, 0xDA89);
+  b = INC8(b);
+  /* F2BF: orab 89 */
+  AOT_INSN(0xDA, 3, 0xF2C0, 0x89D7);
+  DIR8(t); b = LOGIC8(b | t);
+  /* F2C1: stab 89 */
+  AOT_INSN(0xD7, 3, 0xF2C2, 0x89BD);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F2C3: jsr  f2e8 */
+  AOT_CYCLES(7);
+  AOT_INSN(0xBD, 6, 0xF2C4, 0xF2E8);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F2E8;
+
+aot_F2C6: /* F2C6-F2CA */
+  AOT_BEGIN(9);
+  /* F2C6: ldaa 93 */
+  AOT_INSN(0x96, 3, 0xF2C7, 0x93BD);
+  DIR8(t); a = LOGIC8(t);
+  /* F2C8: jsr  f2f7 */
+  AOT_CYCLES(3);
+  AOT_INSN(0xBD, 6, 0xF2C9, 0xF2F7);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F2F7;
+
+aot_F2CB: /* F2CB-F2CE */
+  AOT_BEGIN(7);
+  /* F2CB: clrb */
+  AOT_INSN(0x5F, 1, 0xF2CC, 0xBDFD);
+  b = CLR8();
+  /* F2CC: jsr  fd34 */
+  AOT_CYCLES(1);
+  AOT_INSN(0xBD, 6, 0xF2CD, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F2CF: /* F2CF-F2D4 */
+  AOT_BEGIN(8);
+  /* F2CF: ldaa 8b */
+  AOT_INSN(0x96, 3, 0xF2D0, 0x8B81);
+  DIR8(t); a = LOGIC8(t);
+  /* F2D1: cmpa #02 */
+  AOT_INSN(0x81, 2, 0xF2D2, 0x0226);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F2D3: bne  f29a */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xF2D4, 0xC5DC);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF29A)
+    goto aot_F29A;
+  goto aot_F2D5;
+
+aot_F2D5: /* F2D5-F2D9 */
+  AOT_BEGIN(8);
+  /* F2D5: ldd  8c */
+  AOT_INSN(0xDC, 4, 0xF2D6, 0x8C05);
+  DIR16(w); SETD(LOGIC16(w));
+  /* F2D7: asld */
+  AOT_INSN(0x05, 1, 0xF2D8, 0x2505);
+  SETD(SHL16(ACCD));
+  /* F2D8: bcs  f2df */
+  AOT_CYCLES(5);
+  AOT_INSN(0x25, 3, 0xF2D9, 0x057C);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF2DF)
+    goto aot_F2DF;
+  goto aot_F2DA;
+
+aot_F2DA: /* F2DA-F2DE */
+  AOT_BEGIN(9);
+  /* F2DA: inc 008a */
+  AOT_INSN(0x7C, 6, 0xF2DB, 0x008A);
+  EXT8(t); t = INC8(t); WR(ea, t);
+  /* F2DD: bra  f2e3 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF2DE, 0x045C);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F2E3;
+
+aot_F2DF: /* F2DF-F2E2 */
+  AOT_BEGIN(5);
+  /* F2DF: incb */
+  AOT_INSN(0x5C, 1, 0xF2E0, 0xD78A);
+  b = INC8(b);
+  /* F2E0: stab 8a */
+  AOT_INSN(0xD7, 3, 0xF2E1, 0x8A5C);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F2E2: incb */
+  AOT_INSN(0x5C, 1, 0xF2E3, 0xDD8C);
+  b = INC8(b);
+  AOT_CYCLES(5);
+  goto aot_F2E3;
+
+aot_F2E3: /* F2E3-F2E7 */
+  AOT_BEGIN(7);
+  /* F2E3: std  8c */
+  AOT_INSN(0xDD, 4, 0xF2E4, 0x8C7E);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  /* F2E5: jmp fecc */
+  AOT_CYCLES(4);
+  AOT_INSN(0x7E, 3, 0xF2E6, 0xFECC);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_FECC;
+
+aot_F2E8: /* F2E8-F2F2 */
+  AOT_BEGIN(18);
+  /* F2E8: andb #03 */
+  AOT_INSN(0xC4, 2, 0xF2E9, 0x03CE);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F2EA: ldx  #f2f3 */
+  AOT_INSN(0xCE, 3, 0xF2EB, 0xF2F3);
+  IMM16(w); x = LOGIC16(w);
+  /* F2ED: abx */
+  AOT_INSN(0x3A, 1, 0xF2EE, 0xE600);
+  x = (x + b) & 0xFFFF;
+  /* F2EE: ldab 00,x */
+  AOT_CYCLES(6);
+  AOT_INSN(0xE6, 4, 0xF2EF, 0x00D7);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* F2F0: stab 8b */
+  AOT_INSN(0xD7, 3, 0xF2F1, 0x8B39);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F2F2: rts */
+  AOT_CYCLES(3);
+  AOT_INSN(0x39, 5, 0xF2F3, 0x8001);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F2F7: /* F2F7-F2FF */
+  AOT_BEGIN(11);
+  /* F2F7: ldx  #f311 */
+  AOT_INSN(0xCE, 3, 0xF2F8, 0xF311);
+  IMM16(w); x = LOGIC16(w);
+  /* F2FA: ldab 8a */
+  AOT_INSN(0xD6, 3, 0xF2FB, 0x8AC1);
+  DIR8(t); b = LOGIC8(t);
+  /* F2FC: cmpb #05 */
+  AOT_INSN(0xC1, 2, 0xF2FD, 0x0525);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F2FE: bcs  f30d */
+  AOT_CYCLES(8);
+  AOT_INSN(0x25, 3, 0xF2FF, 0x0DC0);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF30D)
+    goto aot_F30D;
+  goto aot_F300;
+
+aot_F300: /* F300-F308 */
+  AOT_BEGIN(10);
+  /* F300: subb #04 */
+  AOT_INSN(0xC0, 2, 0xF301, 0x0458);
+  IMM8(t); b = SUB8(b, t, 0);
+  /* F302: lslb */
+  AOT_INSN(0x58, 1, 0xF303, 0x5858);
+  b = SHL8(b, 0);
+  /* F303: lslb */
+  AOT_INSN(0x58, 1, 0xF304, 0x583A);
+  b = SHL8(b, 0);
+  /* F304: lslb */
+  AOT_INSN(0x58, 1, 0xF305, 0x3A5F);
+  b = SHL8(b, 0);
+  /* F305: abx */
+  AOT_INSN(0x3A, 1, 0xF306, 0x5F20);
+  x = (x + b) & 0xFFFF;
+  /* F306: clrb */
+  AOT_INSN(0x5F, 1, 0xF307, 0x2001);
+  b = CLR8();
+  /* F307: bra  f30a */
+  AOT_CYCLES(7);
+  AOT_INSN(0x20, 3, 0xF308, 0x015C);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F30A;
+
+aot_F309: /* F309-F309 */
+  AOT_BEGIN(1);
+  /* F309: incb */
+  AOT_INSN(0x5C, 1, 0xF30A, 0x4424);
+  b = INC8(b);
+  AOT_CYCLES(1);
+  goto aot_F30A;
+
+aot_F30A: /* F30A-F30C */
+  AOT_BEGIN(4);
+  /* F30A: lsra */
+  AOT_INSN(0x44, 1, 0xF30B, 0x24FC);
+  a = SHR8(a, 0);
+  /* F30B: bcc  f309 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF30C, 0xFC3A);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF309)
+    goto aot_F309;
+  goto aot_F30D;
+
+aot_F30D: /* F30D-F310 */
+  AOT_BEGIN(10);
+  /* F30D: abx */
+  AOT_INSN(0x3A, 1, 0xF30E, 0xA600);
+  x = (x + b) & 0xFFFF;
+  /* F30E: ldaa 00,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xA6, 4, 0xF30F, 0x0039);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(5);
+  /* F310: rts */
+  AOT_INSN(0x39, 5, 0xF311, 0x0000);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F371: /* F371-F381 */
+  AOT_BEGIN(24);
+  /* F371: anda #0f */
+  AOT_INSN(0x84, 2, 0xF372, 0x0F97);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F373: staa c6 */
+  AOT_INSN(0x97, 3, 0xF374, 0xC684);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F375: anda #03 */
+  AOT_INSN(0x84, 2, 0xF376, 0x03CE);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F377: ldx  #00be */
+  AOT_INSN(0xCE, 3, 0xF378, 0x00BE);
+  IMM16(w); x = LOGIC16(w);
+  /* F37A: clr 00c8 */
+  AOT_INSN(0x7F, 5, 0xF37B, 0x00C8);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F37D: ldab c3 */
+  AOT_INSN(0xD6, 3, 0xF37E, 0xC3BD);
+  DIR8(t); b = LOGIC8(t);
+  /* F37F: jsr  f3e3 */
+  AOT_CYCLES(18);
+  AOT_INSN(0xBD, 6, 0xF380, 0xF3E3);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F3E3;
+
+aot_F382: /* F382-F395 */
+  AOT_BEGIN(27);
+  /* F382: staa c3 */
+  AOT_INSN(0x97, 3, 0xF383, 0xC396);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F384: ldaa c6 */
+  AOT_INSN(0x96, 3, 0xF385, 0xC644);
+  DIR8(t); a = LOGIC8(t);
+  /* F386: lsra */
+  AOT_INSN(0x44, 1, 0xF387, 0x4484);
+  a = SHR8(a, 0);
+  /* F387: lsra */
+  AOT_INSN(0x44, 1, 0xF388, 0x8403);
+  a = SHR8(a, 0);
+  /* F388: anda #03 */
+  AOT_INSN(0x84, 2, 0xF389, 0x03CE);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F38A: ldx  #00bf */
+  AOT_INSN(0xCE, 3, 0xF38B, 0x00BF);
+  IMM16(w); x = LOGIC16(w);
+  /* F38D: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF38E, 0x01D7);
+  IMM8(t); b = LOGIC8(t);
+  /* F38F: stab c8 */
+  AOT_INSN(0xD7, 3, 0xF390, 0xC8D6);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F391: ldab c4 */
+  AOT_INSN(0xD6, 3, 0xF392, 0xC4BD);
+  DIR8(t); b = LOGIC8(t);
+  /* F393: jsr  f3e3 */
+  AOT_CYCLES(21);
+  AOT_INSN(0xBD, 6, 0xF394, 0xF3E3);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F3E3;
+
+aot_F396: /* F396-F3A0 */
+  AOT_BEGIN(16);
+  /* F396: staa c4 */
+  AOT_INSN(0x97, 3, 0xF397, 0xC47F);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F398: clr 00c1 */
+  AOT_INSN(0x7F, 5, 0xF399, 0x00C1);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F39B: ldab 9b */
+  AOT_INSN(0xD6, 3, 0xF39C, 0x9BC4);
+  DIR8(t); b = LOGIC8(t);
+  /* F39D: andb #06 */
+  AOT_INSN(0xC4, 2, 0xF39E, 0x0627);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F39F: beq  f3a5 */
+  AOT_CYCLES(13);
+  AOT_INSN(0x27, 3, 0xF3A0, 0x04C1);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF3A5)
+    goto aot_F3A5;
+  goto aot_F3A1;
+
+aot_F3A1: /* F3A1-F3A4 */
+  AOT_BEGIN(5);
+  /* F3A1: cmpb #06 */
+  AOT_INSN(0xC1, 2, 0xF3A2, 0x0626);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F3A3: bne  f3a7 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF3A4, 0x02C8);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF3A7)
+    goto aot_F3A7;
+  goto aot_F3A5;
+
+aot_F3A5: /* F3A5-F3A6 */
+  AOT_BEGIN(2);
+  /* F3A5: eorb #06 */
+  AOT_INSN(0xC8, 2, 0xF3A6, 0x0617);
+  IMM8(t); b = LOGIC8(b ^ t);
+  AOT_CYCLES(2);
+  goto aot_F3A7;
+
+aot_F3A7: /* F3A7-F3AB */
+  AOT_BEGIN(7);
+  /* F3A7: tba */
+  AOT_INSN(0x17, 1, 0xF3A8, 0xD8C0);
+  a = LOGIC8(b);
+  /* F3A8: eorb c0 */
+  AOT_INSN(0xD8, 3, 0xF3A9, 0xC027);
+  DIR8(t); b = LOGIC8(b ^ t);
+  /* F3AA: beq  f3cb */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF3AB, 0x1F97);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF3CB)
+    goto aot_F3CB;
+  goto aot_F3AC;
+
+aot_F3AC: /* F3AC-F3CA */
+  AOT_BEGIN(42);
+  /* F3AC: staa c0 */
+  AOT_INSN(0x97, 3, 0xF3AD, 0xC0D7);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F3AE: stab c5 */
+  AOT_INSN(0xD7, 3, 0xF3AF, 0xC516);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F3B0: tab */
+  AOT_INSN(0x16, 1, 0xF3B1, 0xD4C5);
+  b = LOGIC8(a);
+  /* F3B1: anda c5 */
+  AOT_INSN(0xD4, 3, 0xF3B2, 0xC5D7);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F3B3: stab c6 */
+  AOT_INSN(0xD7, 3, 0xF3B4, 0xC654);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F3B5: lsrb */
+  AOT_INSN(0x54, 1, 0xF3B6, 0xDAC6);
+  b = SHR8(b, 0);
+  /* F3B6: orab c6 */
+  AOT_INSN(0xDA, 3, 0xF3B7, 0xC6C4);
+  DIR8(t); b = LOGIC8(b | t);
+  /* F3B8: andb #05 */
+  AOT_INSN(0xC4, 2, 0xF3B9, 0x05D7);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F3BA: stab c1 */
+  AOT_INSN(0xD7, 3, 0xF3BB, 0xC143);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F3BC: coma */
+  AOT_INSN(0x43, 1, 0xF3BD, 0x16D4);
+  a = COM8(a);
+  /* F3BD: tab */
+  AOT_INSN(0x16, 1, 0xF3BE, 0xD4C5);
+  b = LOGIC8(a);
+  /* F3BE: anda c5 */
+  AOT_INSN(0xD4, 3, 0xF3BF, 0xC5D7);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F3C0: stab c6 */
+  AOT_INSN(0xD7, 3, 0xF3C1, 0xC658);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F3C2: lslb */
+  AOT_INSN(0x58, 1, 0xF3C3, 0xDAC6);
+  b = SHL8(b, 0);
+  /* F3C3: orab c6 */
+  AOT_INSN(0xDA, 3, 0xF3C4, 0xC6C4);
+  DIR8(t); b = LOGIC8(b | t);
+  /* F3C5: andb #0a */
+  AOT_INSN(0xC4, 2, 0xF3C6, 0x0ADA);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F3C7: orab c1 */
+  AOT_INSN(0xDA, 3, 0xF3C8, 0xC1D7);
+  DIR8(t); b = LOGIC8(b | t);
+  /* F3C9: stab c1 */
+  AOT_INSN(0xD7, 3, 0xF3CA, 0xC196);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(42);
+  goto aot_F3CB;
+
+aot_F3CB: /* F3CB-F3D0 */
+  AOT_BEGIN(8);
+  /* F3CB: ldaa c9 */
+  AOT_INSN(0x96, 3, 0xF3CC, 0xC948);
+  DIR8(t); a = LOGIC8(t);
+  /* F3CD: lsla */
+  AOT_INSN(0x48, 1, 0xF3CE, 0x4824);
+  a = SHL8(a, 0);
+  /* F3CE: lsla */
+  AOT_INSN(0x48, 1, 0xF3CF, 0x2403);
+  a = SHL8(a, 0);
+  /* F3CF: bcc  f3d4 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x24, 3, 0xF3D0, 0x037E);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF3D4)
+    goto aot_F3D4;
+  goto aot_F3D1;
+
+aot_F3D1: /* F3D1-F3D3 */
+  AOT_BEGIN(3);
+  /* F3D1: jmp f5eb */
+  AOT_INSN(0x7E, 3, 0xF3D2, 0xF5EB);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F5EB;
+
+aot_F3D4: /* F3D4-F3D6 */
+  AOT_BEGIN(4);
+  /* F3D4: lsla */
+  AOT_INSN(0x48, 1, 0xF3D5, 0x2403);
+  a = SHL8(a, 0);
+  /* F3D5: bcc  f3da */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF3D6, 0x037E);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF3DA)
+    goto aot_F3DA;
+  goto aot_F3D7;
+
+aot_F3D7: /* F3D7-F3D9 */
+  AOT_BEGIN(3);
+  /* F3D7: jmp f439 */
+  AOT_INSN(0x7E, 3, 0xF3D8, 0xF439);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F439;
+
+aot_F3DA: /* F3DA-F3DC */
+  AOT_BEGIN(4);
+  /* F3DA: lsla */
+  AOT_INSN(0x48, 1, 0xF3DB, 0x2403);
+  a = SHL8(a, 0);
+  /* F3DB: bcc  f3e0 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF3DC, 0x037E);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF3E0)
+    goto aot_F3E0;
+  goto aot_F3DD;
+
+aot_F3DD: /* F3DD-F3DF */
+  AOT_BEGIN(3);
+  /* F3DD: jmp f4ba */
+  AOT_INSN(0x7E, 3, 0xF3DE, 0xF4BA);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F4BA;
+
+aot_F3E0: /* F3E0-F3E2 */
+  AOT_BEGIN(3);
+  /* F3E0: jmp f150 */
+  AOT_INSN(0x7E, 3, 0xF3E1, 0xF150);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F150;
+
+aot_F3E3: /* F3E3-F3EA */
+  AOT_BEGIN(12);
+  /* F3E3: andb #e0 */
+  AOT_INSN(0xC4, 2, 0xF3E4, 0xE097);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F3E5: staa c5 */
+  AOT_INSN(0x97, 3, 0xF3E6, 0xC5A8);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F3E7: eora 00,x */
+  AOT_CYCLES(5);
+  AOT_INSN(0xA8, 4, 0xF3E8, 0x0027);
+  IX8(t); a = LOGIC8(a ^ t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F3E9: beq  f434 */
+  AOT_INSN(0x27, 3, 0xF3EA, 0x4981);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF434)
+    goto aot_F434;
+  goto aot_F3EB;
+
+aot_F3EB: /* F3EB-F3EE */
+  AOT_BEGIN(5);
+  /* F3EB: cmpa #03 */
+  AOT_INSN(0x81, 2, 0xF3EC, 0x0326);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F3ED: bne  f3f4 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF3EE, 0x05CA);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF3F4)
+    goto aot_F3F4;
+  goto aot_F3EF;
+
+aot_F3EF: /* F3EF-F3F3 */
+  AOT_BEGIN(6);
+  /* F3EF: orab #02 */
+  AOT_INSN(0xCA, 2, 0xF3F0, 0x0217);
+  IMM8(t); b = LOGIC8(b | t);
+  /* F3F1: tba */
+  AOT_INSN(0x17, 1, 0xF3F2, 0x203B);
+  a = LOGIC8(b);
+  /* F3F2: bra  f42f */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xF3F3, 0x3B37);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F42F;
+
+aot_F3F4: /* F3F4-F3F8 */
+  AOT_BEGIN(11);
+  /* F3F4: pshb */
+  AOT_INSN(0x37, 4, 0xF3F5, 0xE600);
+  PUSH(b);
+  AOT_CYCLES(4);
+  AOT_SYNC(7);
+  /* F3F5: ldab 00,x */
+  AOT_INSN(0xE6, 4, 0xF3F6, 0x0027);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F3F7: beq  f400 */
+  AOT_INSN(0x27, 3, 0xF3F8, 0x07C1);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF400)
+    goto aot_F400;
+  goto aot_F3F9;
+
+aot_F3F9: /* F3F9-F3FC */
+  AOT_BEGIN(5);
+  /* F3F9: cmpb #03 */
+  AOT_INSN(0xC1, 2, 0xF3FA, 0x0327);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F3FB: beq  f400 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF3FC, 0x0343);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF400)
+    goto aot_F400;
+  goto aot_F3FD;
+
+aot_F3FD: /* F3FD-F3FF */
+  AOT_BEGIN(3);
+  /* F3FD: coma */
+  AOT_INSN(0x43, 1, 0xF3FE, 0x8403);
+  a = COM8(a);
+  /* F3FE: anda #03 */
+  AOT_INSN(0x84, 2, 0xF3FF, 0x0333);
+  IMM8(t); a = LOGIC8(a & t);
+  AOT_CYCLES(3);
+  goto aot_F400;
+
+aot_F400: /* F400-F404 */
+  AOT_BEGIN(8);
+  /* F400: pulb */
+  AOT_INSN(0x33, 3, 0xF401, 0x8101);
+  PULL(b);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* F401: cmpa #01 */
+  AOT_INSN(0x81, 2, 0xF402, 0x0126);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F403: bne  f413 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF404, 0x0EC5);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF413)
+    goto aot_F413;
+  goto aot_F405;
+
+aot_F405: /* F405-F408 */
+  AOT_BEGIN(5);
+  /* F405: bitb #60 */
+  AOT_INSN(0xC5, 2, 0xF406, 0x6027);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F407: beq  f41f */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF408, 0x1686);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF41F)
+    goto aot_F41F;
+  goto aot_F409;
+
+aot_F409: /* F409-F410 */
+  AOT_BEGIN(9);
+  /* F409: ldaa #01 */
+  AOT_INSN(0x86, 2, 0xF40A, 0x01C0);
+  IMM8(t); a = LOGIC8(t);
+  /* F40B: subb #20 */
+  AOT_INSN(0xC0, 2, 0xF40C, 0x20C5);
+  IMM8(t); b = SUB8(b, t, 0);
+  /* F40D: bitb #60 */
+  AOT_INSN(0xC5, 2, 0xF40E, 0x6027);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F40F: beq  f41f */
+  AOT_CYCLES(6);
+  AOT_INSN(0x27, 3, 0xF410, 0x0E20);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF41F)
+    goto aot_F41F;
+  goto aot_F411;
+
+aot_F411: /* F411-F412 */
+  AOT_BEGIN(3);
+  /* F411: bra  f436 */
+  AOT_INSN(0x20, 3, 0xF412, 0x23C5);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F436;
+
+aot_F413: /* F413-F416 */
+  AOT_BEGIN(5);
+  /* F413: bitb #40 */
+  AOT_INSN(0xC5, 2, 0xF414, 0x4026);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F415: bne  f41d */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF416, 0x06CB);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF41D)
+    goto aot_F41D;
+  goto aot_F417;
+
+aot_F417: /* F417-F41C */
+  AOT_BEGIN(7);
+  /* F417: addb #20 */
+  AOT_INSN(0xCB, 2, 0xF418, 0x20C5);
+  IMM8(t); b = ADD8(b, t, 0);
+  /* F419: bitb #40 */
+  AOT_INSN(0xC5, 2, 0xF41A, 0x4027);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F41B: beq  f436 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF41C, 0x1986);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF436)
+    goto aot_F436;
+  goto aot_F41D;
+
+aot_F41D: /* F41D-F41E */
+  AOT_BEGIN(2);
+  /* F41D: ldaa #c1 */
+  AOT_INSN(0x86, 2, 0xF41E, 0xC1D6);
+  IMM8(t); a = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F41F;
+
+aot_F41F: /* F41F-F422 */
+  AOT_BEGIN(6);
+  /* F41F: ldab c8 */
+  AOT_INSN(0xD6, 3, 0xF420, 0xC827);
+  DIR8(t); b = LOGIC8(t);
+  /* F421: beq  f42d */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF422, 0x0A7B);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF42D)
+    goto aot_F42D;
+  goto aot_F423;
+
+aot_F423: /* F423-F427 */
+  AOT_BEGIN(7);
+  /* F423: tim 40c9 */
+  AOT_INSN(0x7B, 4, 0xF424, 0x40C9);
+  IMM_MEM(ea, &, 0);
+  /* F426: bne  f42f */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF427, 0x077B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF42F)
+    goto aot_F42F;
+  goto aot_F428;
+
+aot_F428: /* F428-F42C */
+  AOT_BEGIN(7);
+  /* F428: tim 01c9 */
+  AOT_INSN(0x7B, 4, 0xF429, 0x01C9);
+  IMM_MEM(ea, &, 0);
+  /* F42B: bne  f42f */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF42C, 0x0288);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF42F)
+    goto aot_F42F;
+  goto aot_F42D;
+
+aot_F42D: /* F42D-F42E */
+  AOT_BEGIN(2);
+  /* F42D: eora #80 */
+  AOT_INSN(0x88, 2, 0xF42E, 0x80D6);
+  IMM8(t); a = LOGIC8(a ^ t);
+  AOT_CYCLES(2);
+  goto aot_F42F;
+
+aot_F42F: /* F42F-F433 */
+  AOT_BEGIN(12);
+  /* F42F: ldab c5 */
+  AOT_INSN(0xD6, 3, 0xF430, 0xC5E7);
+  DIR8(t); b = LOGIC8(t);
+  /* F431: stab 00,x */
+  AOT_CYCLES(3);
+  AOT_INSN(0xE7, 4, 0xF432, 0x0039);
+  EA_IX(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(4);
+  AOT_SYNC(5);
+  /* F433: rts */
+  AOT_INSN(0x39, 5, 0xF434, 0x1739);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F434: /* F434-F435 */
+  AOT_BEGIN(6);
+  /* F434: tba */
+  AOT_INSN(0x17, 1, 0xF435, 0x3917);
+  a = LOGIC8(b);
+  /* F435: rts */
+  AOT_CYCLES(1);
+  AOT_INSN(0x39, 5, 0xF436, 0x1720);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F436: /* F436-F438 */
+  AOT_BEGIN(4);
+  /* F436: tba */
+  AOT_INSN(0x17, 1, 0xF437, 0x20F6);
+  a = LOGIC8(b);
+  /* F437: bra  f42f */
+  AOT_CYCLES(1);
+  AOT_INSN(0x20, 3, 0xF438, 0xF6CE);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F42F;
+
+aot_F439: /* F439-F446 */
+  AOT_BEGIN(23);
+  /* F439: ldx  #00b8 */
+  AOT_INSN(0xCE, 3, 0xF43A, 0x00B8);
+  IMM16(w); x = LOGIC16(w);
+  /* F43C: ldd  ac */
+  AOT_INSN(0xDC, 4, 0xF43D, 0xACDD);
+  DIR16(w); SETD(LOGIC16(w));
+  /* F43E: std  c5 */
+  AOT_INSN(0xDD, 4, 0xF43F, 0xC596);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  /* F440: ldaa b3 */
+  AOT_INSN(0x96, 3, 0xF441, 0xB3D6);
+  DIR8(t); a = LOGIC8(t);
+  /* F442: ldab c4 */
+  AOT_INSN(0xD6, 3, 0xF443, 0xC4BD);
+  DIR8(t); b = LOGIC8(t);
+  /* F444: jsr  f488 */
+  AOT_CYCLES(17);
+  AOT_INSN(0xBD, 6, 0xF445, 0xF488);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F488;
+
+aot_F447: /* F447-F454 */
+  AOT_BEGIN(23);
+  /* F447: ldx  #00b6 */
+  AOT_INSN(0xCE, 3, 0xF448, 0x00B6);
+  IMM16(w); x = LOGIC16(w);
+  /* F44A: ldd  aa */
+  AOT_INSN(0xDC, 4, 0xF44B, 0xAADD);
+  DIR16(w); SETD(LOGIC16(w));
+  /* F44C: std  c5 */
+  AOT_INSN(0xDD, 4, 0xF44D, 0xC596);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  /* F44E: ldaa b2 */
+  AOT_INSN(0x96, 3, 0xF44F, 0xB2D6);
+  DIR8(t); a = LOGIC8(t);
+  /* F450: ldab c3 */
+  AOT_INSN(0xD6, 3, 0xF451, 0xC3BD);
+  DIR8(t); b = LOGIC8(t);
+  /* F452: jsr  f488 */
+  AOT_CYCLES(17);
+  AOT_INSN(0xBD, 6, 0xF453, 0xF488);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F488;
+
+aot_F455: /* F455-F458 */
+  AOT_BEGIN(6);
+  /* F455: ldab c1 */
+  AOT_INSN(0xD6, 3, 0xF456, 0xC127);
+  DIR8(t); b = LOGIC8(t);
+  /* F457: beq  f485 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF458, 0x2C17);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF485)
+    goto aot_F485;
+  goto aot_F459;
+
+aot_F459: /* F459-F462 */
+  AOT_BEGIN(14);
+  /* F459: tba */
+  AOT_INSN(0x17, 1, 0xF45A, 0x9AC2);
+  a = LOGIC8(b);
+  /* F45A: oraa c2 */
+  AOT_INSN(0x9A, 3, 0xF45B, 0xC297);
+  DIR8(t); a = LOGIC8(a | t);
+  /* F45C: staa c2 */
+  AOT_INSN(0x97, 3, 0xF45D, 0xC27B);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F45E: tim 04b4 */
+  AOT_INSN(0x7B, 4, 0xF45F, 0x04B4);
+  IMM_MEM(ea, &, 0);
+  /* F461: beq  f466 */
+  AOT_CYCLES(11);
+  AOT_INSN(0x27, 3, 0xF462, 0x037E);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF466)
+    goto aot_F466;
+  goto aot_F463;
+
+aot_F463: /* F463-F465 */
+  AOT_BEGIN(3);
+  /* F463: jmp f62b */
+  AOT_INSN(0x7E, 3, 0xF464, 0xF62B);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F62B;
+
+aot_F466: /* F466-F46A */
+  AOT_BEGIN(6);
+  /* F466: clra */
+  AOT_INSN(0x4F, 1, 0xF467, 0xC505);
+  a = CLR8();
+  /* F467: bitb #05 */
+  AOT_INSN(0xC5, 2, 0xF468, 0x0527);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F469: beq  f46d */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF46A, 0x028A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF46D)
+    goto aot_F46D;
+  goto aot_F46B;
+
+aot_F46B: /* F46B-F46C */
+  AOT_BEGIN(2);
+  /* F46B: oraa #01 */
+  AOT_INSN(0x8A, 2, 0xF46C, 0x01C5);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_F46D;
+
+aot_F46D: /* F46D-F470 */
+  AOT_BEGIN(5);
+  /* F46D: bitb #0a */
+  AOT_INSN(0xC5, 2, 0xF46E, 0x0A27);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F46F: beq  f473 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF470, 0x028A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF473)
+    goto aot_F473;
+  goto aot_F471;
+
+aot_F471: /* F471-F472 */
+  AOT_BEGIN(2);
+  /* F471: oraa #02 */
+  AOT_INSN(0x8A, 2, 0xF472, 0x0294);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_F473;
+
+aot_F473: /* F473-F476 */
+  AOT_BEGIN(6);
+  /* F473: anda b4 */
+  AOT_INSN(0x94, 3, 0xF474, 0xB427);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F475: beq  f485 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF476, 0x0ED7);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF485)
+    goto aot_F485;
+  goto aot_F477;
+
+aot_F477: /* F477-F483 */
+  AOT_BEGIN(17);
+  /* F477: stab b5 */
+  AOT_INSN(0xD7, 3, 0xF478, 0xB5C6);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F479: ldab #05 */
+  AOT_INSN(0xC6, 2, 0xF47A, 0x05CE);
+  IMM8(t); b = LOGIC8(t);
+  /* F47B: ldx  #00b5 */
+  AOT_INSN(0xCE, 3, 0xF47C, 0x00B5);
+  IMM16(w); x = LOGIC16(w);
+  /* F47E: sei */
+  AOT_INSN(0x0F, 1, 0xF47F, 0x86F7);
+  ccr |= IFLAG;
+  /* F47F: ldaa #f7 */
+  AOT_INSN(0x86, 2, 0xF480, 0xF7BD);
+  IMM8(t); a = LOGIC8(t);
+  /* F481: jsr  fd34 */
+  AOT_CYCLES(11);
+  AOT_INSN(0xBD, 6, 0xF482, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F484: /* F484-F484 */
+  AOT_BEGIN(1);
+  /* F484: cli */
+  AOT_INSN(0x0E, 1, 0xF485, 0x7EF1);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(0);
+  goto aot_F485;
+
+aot_F485: /* F485-F487 */
+  AOT_BEGIN(3);
+  /* F485: jmp f150 */
+  AOT_INSN(0x7E, 3, 0xF486, 0xF150);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F150;
+
+aot_F488: /* F488-F48B */
+  AOT_BEGIN(5);
+  /* F488: bitb #03 */
+  AOT_INSN(0xC5, 2, 0xF489, 0x0327);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F48A: beq  f4b9 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF48B, 0x2D37);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF4B9)
+    goto aot_F4B9;
+  goto aot_F48C;
+
+aot_F48C: /* F48C-F496 */
+  AOT_BEGIN(20);
+  /* F48C: pshb */
+  AOT_INSN(0x37, 4, 0xF48D, 0x5816);
+  PUSH(b);
+  AOT_CYCLES(4);
+  AOT_SYNC(16);
+  /* F48D: lslb */
+  AOT_INSN(0x58, 1, 0xF48E, 0x1686);
+  b = SHL8(b, 0);
+  /* F48E: tab */
+  AOT_INSN(0x16, 1, 0xF48F, 0x8600);
+  b = LOGIC8(a);
+  /* F48F: ldaa #00 */
+  AOT_INSN(0x86, 2, 0xF490, 0x00DD);
+  IMM8(t); a = LOGIC8(t);
+  /* F491: std  c7 */
+  AOT_INSN(0xDD, 4, 0xF492, 0xC7EC);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  /* F493: ldd  00,x */
+  AOT_CYCLES(8);
+  AOT_INSN(0xEC, 5, 0xF494, 0x0024);
+  IX16(w); SETD(LOGIC16(w));
+  AOT_CYCLES(5);
+  AOT_SYNC(3);
+  /* F495: bcc  f4a0 */
+  AOT_INSN(0x24, 3, 0xF496, 0x0993);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF4A0)
+    goto aot_F4A0;
+  goto aot_F497;
+
+aot_F497: /* F497-F49A */
+  AOT_BEGIN(7);
+  /* F497: subd c7 */
+  AOT_INSN(0x93, 4, 0xF498, 0xC724);
+  DIR16(w); SETD(SUB16(ACCD, w));
+  /* F499: bcc  f4a2 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x24, 3, 0xF49A, 0x07CC);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF4A2)
+    goto aot_F4A2;
+  goto aot_F49B;
+
+aot_F49B: /* F49B-F49F */
+  AOT_BEGIN(6);
+  /* F49B: ldd  #0000 */
+  AOT_INSN(0xCC, 3, 0xF49C, 0x0000);
+  IMM16(w); SETD(LOGIC16(w));
+  /* F49E: bra  f4b6 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xF49F, 0x16D3);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F4B6;
+
+aot_F4A0: /* F4A0-F4A1 */
+  AOT_BEGIN(4);
+  /* F4A0: addd c7 */
+  AOT_INSN(0xD3, 4, 0xF4A1, 0xC7DD);
+  DIR16(w); SETD(ADD16(ACCD, w));
+  AOT_CYCLES(4);
+  goto aot_F4A2;
+
+aot_F4A2: /* F4A2-F4A7 */
+  AOT_BEGIN(11);
+  /* F4A2: std  c7 */
+  AOT_INSN(0xDD, 4, 0xF4A3, 0xC793);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  /* F4A4: subd c5 */
+  AOT_INSN(0x93, 4, 0xF4A5, 0xC524);
+  DIR16(w); SETD(SUB16(ACCD, w));
+  /* F4A6: bcc  f4b4 */
+  AOT_CYCLES(8);
+  AOT_INSN(0x24, 3, 0xF4A7, 0x0CDC);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF4B4)
+    goto aot_F4B4;
+  goto aot_F4A8;
+
+aot_F4A8: /* F4A8-F4B2 */
+  AOT_BEGIN(19);
+  /* F4A8: ldd  c7 */
+  AOT_INSN(0xDC, 4, 0xF4A9, 0xC7ED);
+  DIR16(w); SETD(LOGIC16(w));
+  /* F4AA: std  00,x */
+  AOT_CYCLES(4);
+  AOT_INSN(0xED, 5, 0xF4AB, 0x0033);
+  EA_IX(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  AOT_CYCLES(5);
+  AOT_SYNC(10);
+  /* F4AC: pulb */
+  AOT_INSN(0x33, 3, 0xF4AD, 0xC001);
+  PULL(b);
+  AOT_CYCLES(3);
+  AOT_SYNC(7);
+  /* F4AD: subb #01 */
+  AOT_INSN(0xC0, 2, 0xF4AE, 0x01C5);
+  IMM8(t); b = SUB8(b, t, 0);
+  /* F4AF: bitb #01 */
+  AOT_INSN(0xC5, 2, 0xF4B0, 0x0126);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F4B1: bne  f48c */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF4B2, 0xD939);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF48C)
+    goto aot_F48C;
+  goto aot_F4B3;
+
+aot_F4B3: /* F4B3-F4B3 */
+  AOT_BEGIN(5);
+  /* F4B3: rts */
+  AOT_INSN(0x39, 5, 0xF4B4, 0xDCC5);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F4B4: /* F4B4-F4B5 */
+  AOT_BEGIN(4);
+  /* F4B4: ldd  c5 */
+  AOT_INSN(0xDC, 4, 0xF4B5, 0xC5ED);
+  DIR16(w); SETD(LOGIC16(w));
+  AOT_CYCLES(4);
+  goto aot_F4B6;
+
+aot_F4B6: /* F4B6-F4B8 */
+  AOT_BEGIN(8);
+  /* F4B6: std  00,x */
+  AOT_INSN(0xED, 5, 0xF4B7, 0x0033);
+  EA_IX(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  AOT_CYCLES(5);
+  AOT_SYNC(3);
+  /* F4B8: pulb */
+  AOT_INSN(0x33, 3, 0xF4B9, 0x397F);
+  PULL(b);
+  AOT_CYCLES(3);
+  AOT_SYNC(0);
+  goto aot_F4B9;
+
+aot_F4B9: /* F4B9-F4B9 */
+  AOT_BEGIN(5);
+  /* F4B9: rts */
+  AOT_INSN(0x39, 5, 0xF4BA, 0x7F00);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F4BA: /* F4BA-F4C8 */
+  AOT_BEGIN(24);
+  /* F4BA: clr 00c6 */
+  AOT_INSN(0x7F, 5, 0xF4BB, 0x00C6);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F4BD: ldab c4 */
+  AOT_INSN(0xD6, 3, 0xF4BE, 0xC4D7);
+  DIR8(t); b = LOGIC8(t);
+  /* F4BF: stab c8 */
+  AOT_INSN(0xD7, 3, 0xF4C0, 0xC871);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F4C1: aim 03c8 */
+  AOT_INSN(0x71, 6, 0xF4C2, 0x03C8);
+  IMM_MEM(ea, &, 1);
+  /* F4C4: ldaa bd */
+  AOT_INSN(0x96, 3, 0xF4C5, 0xBD58);
+  DIR8(t); a = LOGIC8(t);
+  /* F4C6: lslb */
+  AOT_INSN(0x58, 1, 0xF4C7, 0x2425);
+  b = SHL8(b, 0);
+  /* F4C7: bcc  f4ee */
+  AOT_CYCLES(21);
+  AOT_INSN(0x24, 3, 0xF4C8, 0x2590);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF4EE)
+    goto aot_F4EE;
+  goto aot_F4C9;
+
+aot_F4C9: /* F4C9-F4CE */
+  AOT_BEGIN(8);
+  /* F4C9: suba c8 */
+  AOT_INSN(0x90, 3, 0xF4CA, 0xC881);
+  DIR8(t); a = SUB8(a, t, 0);
+  /* F4CB: cmpa #81 */
+  AOT_INSN(0x81, 2, 0xF4CC, 0x8124);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F4CD: bcc  f4d7 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x24, 3, 0xF4CE, 0x0881);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF4D7)
+    goto aot_F4D7;
+  goto aot_F4CF;
+
+aot_F4CF: /* F4CF-F4D2 */
+  AOT_BEGIN(5);
+  /* F4CF: cmpa #7f */
+  AOT_INSN(0x81, 2, 0xF4D0, 0x7F25);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F4D1: bcs  f4d7 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xF4D2, 0x0486);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF4D7)
+    goto aot_F4D7;
+  goto aot_F4D3;
+
+aot_F4D3: /* F4D3-F4D6 */
+  AOT_BEGIN(5);
+  /* F4D3: ldaa #80 */
+  AOT_INSN(0x86, 2, 0xF4D4, 0x8097);
+  IMM8(t); a = LOGIC8(t);
+  /* F4D5: staa c6 */
+  AOT_INSN(0x97, 3, 0xF4D6, 0xC697);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(5);
+  goto aot_F4D7;
+
+aot_F4D7: /* F4D7-F4DA */
+  AOT_BEGIN(6);
+  /* F4D7: staa bd */
+  AOT_INSN(0x97, 3, 0xF4D8, 0xBD2A);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F4D9: bpl  f4e5 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xF4DA, 0x0A40);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF4E5)
+    goto aot_F4E5;
+  goto aot_F4DB;
+
+aot_F4DB: /* F4DB-F4DF */
+  AOT_BEGIN(7);
+  /* F4DB: nega */
+  AOT_INSN(0x40, 1, 0xF4DC, 0x91B1);
+  a = SUB8(0, a, 0);
+  /* F4DC: cmpa b1 */
+  AOT_INSN(0x91, 3, 0xF4DD, 0xB125);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F4DE: bcs  f4ff */
+  AOT_CYCLES(4);
+  AOT_INSN(0x25, 3, 0xF4DF, 0x1F72);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF4FF)
+    goto aot_F4FF;
+  goto aot_F4E0;
+
+aot_F4E0: /* F4E0-F4E4 */
+  AOT_BEGIN(9);
+  /* F4E0: oim 2c6 */
+  AOT_INSN(0x72, 6, 0xF4E1, 0x02C6);
+  IMM_MEM(ea, |, 1);
+  /* F4E3: bra  f4ff */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF4E4, 0x1A91);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F4FF;
+
+aot_F4E5: /* F4E5-F4E8 */
+  AOT_BEGIN(6);
+  /* F4E5: cmpa b1 */
+  AOT_INSN(0x91, 3, 0xF4E6, 0xB125);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F4E7: bcs  f4ff */
+  AOT_CYCLES(3);
+  AOT_INSN(0x25, 3, 0xF4E8, 0x1672);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF4FF)
+    goto aot_F4FF;
+  goto aot_F4E9;
+
+aot_F4E9: /* F4E9-F4ED */
+  AOT_BEGIN(9);
+  /* F4E9: oim 1c6 */
+  AOT_INSN(0x72, 6, 0xF4EA, 0x01C6);
+  IMM_MEM(ea, |, 1);
+  /* F4EC: bra  f4ff */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF4ED, 0x119B);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F4FF;
+
+aot_F4EE: /* F4EE-F4F3 */
+  AOT_BEGIN(8);
+  /* F4EE: adda c8 */
+  AOT_INSN(0x9B, 3, 0xF4EF, 0xC881);
+  DIR8(t); a = ADD8(a, t, 0);
+  /* F4F0: cmpa #7f */
+  AOT_INSN(0x81, 2, 0xF4F1, 0x7F25);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F4F2: bcs  f4d7 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x25, 3, 0xF4F3, 0xE381);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF4D7)
+    goto aot_F4D7;
+  goto aot_F4F4;
+
+aot_F4F4: /* F4F4-F4F7 */
+  AOT_BEGIN(5);
+  /* F4F4: cmpa #81 */
+  AOT_INSN(0x81, 2, 0xF4F5, 0x8124);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F4F6: bcc  f4d7 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x24, 3, 0xF4F7, 0xDF72);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF4D7)
+    goto aot_F4D7;
+  goto aot_F4F8;
+
+aot_F4F8: /* F4F8-F4FE */
+  AOT_BEGIN(11);
+  /* F4F8: oim 40c6 */
+  AOT_INSN(0x72, 6, 0xF4F9, 0x40C6);
+  IMM_MEM(ea, |, 1);
+  /* F4FB: ldaa #7f */
+  AOT_INSN(0x86, 2, 0xF4FC, 0x7F20);
+  IMM8(t); a = LOGIC8(t);
+  /* F4FD: bra  f4d7 */
+  AOT_CYCLES(8);
+  AOT_INSN(0x20, 3, 0xF4FE, 0xD8D6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F4D7;
+
+aot_F4FF: /* F4FF-F50A */
+  AOT_BEGIN(19);
+  /* F4FF: ldab c3 */
+  AOT_INSN(0xD6, 3, 0xF500, 0xC3D7);
+  DIR8(t); b = LOGIC8(t);
+  /* F501: stab c8 */
+  AOT_INSN(0xD7, 3, 0xF502, 0xC871);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F503: aim 03c8 */
+  AOT_INSN(0x71, 6, 0xF504, 0x03C8);
+  IMM_MEM(ea, &, 1);
+  /* F506: ldaa bc */
+  AOT_INSN(0x96, 3, 0xF507, 0xBC58);
+  DIR8(t); a = LOGIC8(t);
+  /* F508: lslb */
+  AOT_INSN(0x58, 1, 0xF509, 0x2426);
+  b = SHL8(b, 0);
+  /* F509: bcc  f531 */
+  AOT_CYCLES(16);
+  AOT_INSN(0x24, 3, 0xF50A, 0x2690);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF531)
+    goto aot_F531;
+  goto aot_F50B;
+
+aot_F50B: /* F50B-F510 */
+  AOT_BEGIN(8);
+  /* F50B: suba c8 */
+  AOT_INSN(0x90, 3, 0xF50C, 0xC881);
+  DIR8(t); a = SUB8(a, t, 0);
+  /* F50D: cmpa #81 */
+  AOT_INSN(0x81, 2, 0xF50E, 0x8124);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F50F: bcc  f51a */
+  AOT_CYCLES(5);
+  AOT_INSN(0x24, 3, 0xF510, 0x0981);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF51A)
+    goto aot_F51A;
+  goto aot_F511;
+
+aot_F511: /* F511-F514 */
+  AOT_BEGIN(5);
+  /* F511: cmpa #7f */
+  AOT_INSN(0x81, 2, 0xF512, 0x7F25);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F513: bcs  f51a */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xF514, 0x0586);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF51A)
+    goto aot_F51A;
+  goto aot_F515;
+
+aot_F515: /* F515-F519 */
+  AOT_BEGIN(8);
+  /* F515: ldaa #80 */
+  AOT_INSN(0x86, 2, 0xF516, 0x8072);
+  IMM8(t); a = LOGIC8(t);
+  /* F517: oim 80c6 */
+  AOT_INSN(0x72, 6, 0xF518, 0x80C6);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(8);
+  goto aot_F51A;
+
+aot_F51A: /* F51A-F51D */
+  AOT_BEGIN(6);
+  /* F51A: staa bc */
+  AOT_INSN(0x97, 3, 0xF51B, 0xBC2A);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F51C: bpl  f528 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xF51D, 0x0A40);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF528)
+    goto aot_F528;
+  goto aot_F51E;
+
+aot_F51E: /* F51E-F522 */
+  AOT_BEGIN(7);
+  /* F51E: nega */
+  AOT_INSN(0x40, 1, 0xF51F, 0x91B0);
+  a = SUB8(0, a, 0);
+  /* F51F: cmpa b0 */
+  AOT_INSN(0x91, 3, 0xF520, 0xB025);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F521: bcs  f542 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x25, 3, 0xF522, 0x1F72);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF542)
+    goto aot_F542;
+  goto aot_F523;
+
+aot_F523: /* F523-F527 */
+  AOT_BEGIN(9);
+  /* F523: oim 2c6 */
+  AOT_INSN(0x72, 6, 0xF524, 0x02C6);
+  IMM_MEM(ea, |, 1);
+  /* F526: bra  f542 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF527, 0x1A91);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F542;
+
+aot_F528: /* F528-F52B */
+  AOT_BEGIN(6);
+  /* F528: cmpa b0 */
+  AOT_INSN(0x91, 3, 0xF529, 0xB025);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F52A: bcs  f542 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x25, 3, 0xF52B, 0x1672);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF542)
+    goto aot_F542;
+  goto aot_F52C;
+
+aot_F52C: /* F52C-F530 */
+  AOT_BEGIN(9);
+  /* F52C: oim 1c6 */
+  AOT_INSN(0x72, 6, 0xF52D, 0x01C6);
+  IMM_MEM(ea, |, 1);
+  /* F52F: bra  f542 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF530, 0x119B);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F542;
+
+aot_F531: /* F531-F536 */
+  AOT_BEGIN(8);
+  /* F531: adda c8 */
+  AOT_INSN(0x9B, 3, 0xF532, 0xC881);
+  DIR8(t); a = ADD8(a, t, 0);
+  /* F533: cmpa #7f */
+  AOT_INSN(0x81, 2, 0xF534, 0x7F25);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F535: bcs  f51a */
+  AOT_CYCLES(5);
+  AOT_INSN(0x25, 3, 0xF536, 0xE381);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF51A)
+    goto aot_F51A;
+  goto aot_F537;
+
+aot_F537: /* F537-F53A */
+  AOT_BEGIN(5);
+  /* F537: cmpa #81 */
+  AOT_INSN(0x81, 2, 0xF538, 0x8124);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F539: bcc  f51a */
+  AOT_CYCLES(2);
+  AOT_INSN(0x24, 3, 0xF53A, 0xDF72);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF51A)
+    goto aot_F51A;
+  goto aot_F53B;
+
+aot_F53B: /* F53B-F541 */
+  AOT_BEGIN(11);
+  /* F53B: oim 40c6 */
+  AOT_INSN(0x72, 6, 0xF53C, 0x40C6);
+  IMM_MEM(ea, |, 1);
+  /* F53E: ldaa #7f */
+  AOT_INSN(0x86, 2, 0xF53F, 0x7F20);
+  IMM8(t); a = LOGIC8(t);
+  /* F540: bra  f51a */
+  AOT_CYCLES(8);
+  AOT_INSN(0x20, 3, 0xF541, 0xD896);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F51A;
+
+aot_F542: /* F542-F545 */
+  AOT_BEGIN(6);
+  /* F542: ldaa c6 */
+  AOT_INSN(0x96, 3, 0xF543, 0xC627);
+  DIR8(t); a = LOGIC8(t);
+  /* F544: beq  f55b */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF545, 0x1584);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF55B)
+    goto aot_F55B;
+  goto aot_F546;
+
+aot_F546: /* F546-F549 */
+  AOT_BEGIN(5);
+  /* F546: anda #c0 */
+  AOT_INSN(0x84, 2, 0xF547, 0xC026);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F548: bne  f581 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF549, 0x377B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF581)
+    goto aot_F581;
+  goto aot_F54A;
+
+aot_F54A: /* F54A-F54E */
+  AOT_BEGIN(7);
+  /* F54A: tim 08c9 */
+  AOT_INSN(0x7B, 4, 0xF54B, 0x08C9);
+  IMM_MEM(ea, &, 0);
+  /* F54D: bne  f556 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF54E, 0x077B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF556)
+    goto aot_F556;
+  goto aot_F54F;
+
+aot_F54F: /* F54F-F553 */
+  AOT_BEGIN(7);
+  /* F54F: tim 0fc1 */
+  AOT_INSN(0x7B, 4, 0xF550, 0x0FC1);
+  IMM_MEM(ea, &, 0);
+  /* F552: beq  f5a5 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF553, 0x5120);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF5A5)
+    goto aot_F5A5;
+  goto aot_F554;
+
+aot_F554: /* F554-F555 */
+  AOT_BEGIN(3);
+  /* F554: bra  f581 */
+  AOT_INSN(0x20, 3, 0xF555, 0x2B7B);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F581;
+
+aot_F556: /* F556-F55A */
+  AOT_BEGIN(7);
+  /* F556: tim 80d7 */
+  AOT_INSN(0x7B, 4, 0xF557, 0x80D7);
+  IMM_MEM(ea, &, 0);
+  /* F559: bne  f581 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF55A, 0x267B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF581)
+    goto aot_F581;
+  goto aot_F55B;
+
+aot_F55B: /* F55B-F55F */
+  AOT_BEGIN(7);
+  /* F55B: tim 0fc1 */
+  AOT_INSN(0x7B, 4, 0xF55C, 0x0FC1);
+  IMM_MEM(ea, &, 0);
+  /* F55E: beq  f5a5 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF55F, 0x457B);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF5A5)
+    goto aot_F5A5;
+  goto aot_F560;
+
+aot_F560: /* F560-F564 */
+  AOT_BEGIN(7);
+  /* F560: tim 04b4 */
+  AOT_INSN(0x7B, 4, 0xF561, 0x04B4);
+  IMM_MEM(ea, &, 0);
+  /* F563: beq  f568 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF564, 0x037E);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF568)
+    goto aot_F568;
+  goto aot_F565;
+
+aot_F565: /* F565-F567 */
+  AOT_BEGIN(3);
+  /* F565: jmp f62b */
+  AOT_INSN(0x7E, 3, 0xF566, 0xF62B);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F62B;
+
+aot_F568: /* F568-F575 */
+  AOT_BEGIN(18);
+  /* F568: ldaa c0 */
+  AOT_INSN(0x96, 3, 0xF569, 0xC044);
+  DIR8(t); a = LOGIC8(t);
+  /* F56A: lsra */
+  AOT_INSN(0x44, 1, 0xF56B, 0x8AF8);
+  a = SHR8(a, 0);
+  /* F56B: oraa #f8 */
+  AOT_INSN(0x8A, 2, 0xF56C, 0xF8CE);
+  IMM8(t); a = LOGIC8(a | t);
+  /* F56D: ldx  #00bc */
+  AOT_INSN(0xCE, 3, 0xF56E, 0x00BC);
+  IMM16(w); x = LOGIC16(w);
+  /* F570: sei */
+  AOT_INSN(0x0F, 1, 0xF571, 0xC602);
+  ccr |= IFLAG;
+  /* F571: ldab #02 */
+  AOT_INSN(0xC6, 2, 0xF572, 0x02BD);
+  IMM8(t); b = LOGIC8(t);
+  /* F573: jsr  fd34 */
+  AOT_CYCLES(12);
+  AOT_INSN(0xBD, 6, 0xF574, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F576: /* F576-F577 */
+  AOT_BEGIN(3);
+  /* F576: bcc  f57e */
+  AOT_INSN(0x24, 3, 0xF577, 0x067F);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF57E)
+    goto aot_F57E;
+  goto aot_F578;
+
+aot_F578: /* F578-F57D */
+  AOT_BEGIN(10);
+  /* F578: clr 00bd */
+  AOT_INSN(0x7F, 5, 0xF579, 0x00BD);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F57B: clr 00bc */
+  AOT_INSN(0x7F, 5, 0xF57C, 0x00BC);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  AOT_CYCLES(10);
+  goto aot_F57E;
+
+aot_F57E: /* F57E-F580 */
+  AOT_BEGIN(4);
+  /* F57E: cli */
+  AOT_INSN(0x0E, 1, 0xF57F, 0x2024);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(3);
+  /* F57F: bra  f5a5 */
+  AOT_INSN(0x20, 3, 0xF580, 0x2496);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F5A5;
+
+aot_F581: /* F581-F58E */
+  AOT_BEGIN(18);
+  /* F581: ldaa c0 */
+  AOT_INSN(0x96, 3, 0xF582, 0xC044);
+  DIR8(t); a = LOGIC8(t);
+  /* F583: lsra */
+  AOT_INSN(0x44, 1, 0xF584, 0x8AF8);
+  a = SHR8(a, 0);
+  /* F584: oraa #f8 */
+  AOT_INSN(0x8A, 2, 0xF585, 0xF8CE);
+  IMM8(t); a = LOGIC8(a | t);
+  /* F586: ldx  #00bc */
+  AOT_INSN(0xCE, 3, 0xF587, 0x00BC);
+  IMM16(w); x = LOGIC16(w);
+  /* F589: sei */
+  AOT_INSN(0x0F, 1, 0xF58A, 0xC602);
+  ccr |= IFLAG;
+  /* F58A: ldab #02 */
+  AOT_INSN(0xC6, 2, 0xF58B, 0x02BD);
+  IMM8(t); b = LOGIC8(t);
+  /* F58C: jsr  fd34 */
+  AOT_CYCLES(12);
+  AOT_INSN(0xBD, 6, 0xF58D, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F58F: /* F58F-F590 */
+  AOT_BEGIN(3);
+  /* F58F: bcc  f597 */
+  AOT_INSN(0x24, 3, 0xF590, 0x067F);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF597)
+    goto aot_F597;
+  goto aot_F591;
+
+aot_F591: /* F591-F596 */
+  AOT_BEGIN(10);
+  /* F591: clr 00bd */
+  AOT_INSN(0x7F, 5, 0xF592, 0x00BD);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F594: clr 00bc */
+  AOT_INSN(0x7F, 5, 0xF595, 0x00BC);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  AOT_CYCLES(10);
+  goto aot_F597;
+
+aot_F597: /* F597-F59C */
+  AOT_BEGIN(8);
+  /* F597: cli */
+  AOT_INSN(0x0E, 1, 0xF598, 0x7B0F);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(7);
+  /* F598: tim 0fc1 */
+  AOT_INSN(0x7B, 4, 0xF599, 0x0FC1);
+  IMM_MEM(ea, &, 0);
+  /* F59B: beq  f5a5 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF59C, 0x087B);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF5A5)
+    goto aot_F5A5;
+  goto aot_F59D;
+
+aot_F59D: /* F59D-F5A1 */
+  AOT_BEGIN(7);
+  /* F59D: tim 04b4 */
+  AOT_INSN(0x7B, 4, 0xF59E, 0x04B4);
+  IMM_MEM(ea, &, 0);
+  /* F5A0: beq  f5a5 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF5A1, 0x037E);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF5A5)
+    goto aot_F5A5;
+  goto aot_F5A2;
+
+aot_F5A2: /* F5A2-F5A4 */
+  AOT_BEGIN(3);
+  /* F5A2: jmp f62b */
+  AOT_INSN(0x7E, 3, 0xF5A3, 0xF62B);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F62B;
+
+aot_F5A5: /* F5A5-F5A7 */
+  AOT_BEGIN(3);
+  /* F5A5: jmp f150 */
+  AOT_INSN(0x7E, 3, 0xF5A6, 0xF150);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F150;
+
+aot_F5A8: /* F5A8-F5B4 */
+  AOT_BEGIN(22);
+  /* F5A8: clr 00c6 */
+  AOT_INSN(0x7F, 5, 0xF5A9, 0x00C6);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F5AB: stab c8 */
+  AOT_INSN(0xD7, 3, 0xF5AC, 0xC871);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F5AD: aim 03c8 */
+  AOT_INSN(0x71, 6, 0xF5AE, 0x03C8);
+  IMM_MEM(ea, &, 1);
+  /* F5B0: ldaa 00,x */
+  AOT_CYCLES(14);
+  AOT_INSN(0xA6, 4, 0xF5B1, 0x0058);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* F5B2: lslb */
+  AOT_INSN(0x58, 1, 0xF5B3, 0x2425);
+  b = SHL8(b, 0);
+  /* F5B3: bcc  f5da */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF5B4, 0x2590);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF5DA)
+    goto aot_F5DA;
+  goto aot_F5B5;
+
+aot_F5B5: /* F5B5-F5BA */
+  AOT_BEGIN(8);
+  /* F5B5: suba c8 */
+  AOT_INSN(0x90, 3, 0xF5B6, 0xC881);
+  DIR8(t); a = SUB8(a, t, 0);
+  /* F5B7: cmpa #81 */
+  AOT_INSN(0x81, 2, 0xF5B8, 0x8124);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F5B9: bcc  f5c4 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x24, 3, 0xF5BA, 0x0981);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF5C4)
+    goto aot_F5C4;
+  goto aot_F5BB;
+
+aot_F5BB: /* F5BB-F5BE */
+  AOT_BEGIN(5);
+  /* F5BB: cmpa #7f */
+  AOT_INSN(0x81, 2, 0xF5BC, 0x7F25);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F5BD: bcs  f5c4 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xF5BE, 0x0572);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF5C4)
+    goto aot_F5C4;
+  goto aot_F5BF;
+
+aot_F5BF: /* F5BF-F5C3 */
+  AOT_BEGIN(8);
+  /* F5BF: oim 80c6 */
+  AOT_INSN(0x72, 6, 0xF5C0, 0x80C6);
+  IMM_MEM(ea, |, 1);
+  /* F5C2: ldaa #80 */
+  AOT_INSN(0x86, 2, 0xF5C3, 0x80A7);
+  IMM8(t); a = LOGIC8(t);
+  AOT_CYCLES(8);
+  goto aot_F5C4;
+
+aot_F5C4: /* F5C4-F5C7 */
+  AOT_BEGIN(7);
+  /* F5C4: staa 00,x */
+  AOT_INSN(0xA7, 4, 0xF5C5, 0x002A);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F5C6: bpl  f5d2 */
+  AOT_INSN(0x2A, 3, 0xF5C7, 0x0A40);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF5D2)
+    goto aot_F5D2;
+  goto aot_F5C8;
+
+aot_F5C8: /* F5C8-F5CC */
+  AOT_BEGIN(7);
+  /* F5C8: nega */
+  AOT_INSN(0x40, 1, 0xF5C9, 0x91C5);
+  a = SUB8(0, a, 0);
+  /* F5C9: cmpa c5 */
+  AOT_INSN(0x91, 3, 0xF5CA, 0xC525);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F5CB: bcs  f5d9 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x25, 3, 0xF5CC, 0x0C72);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF5D9)
+    goto aot_F5D9;
+  goto aot_F5CD;
+
+aot_F5CD: /* F5CD-F5D1 */
+  AOT_BEGIN(9);
+  /* F5CD: oim 2c6 */
+  AOT_INSN(0x72, 6, 0xF5CE, 0x02C6);
+  IMM_MEM(ea, |, 1);
+  /* F5D0: bra  f5d9 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF5D1, 0x0791);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F5D9;
+
+aot_F5D2: /* F5D2-F5D5 */
+  AOT_BEGIN(6);
+  /* F5D2: cmpa c5 */
+  AOT_INSN(0x91, 3, 0xF5D3, 0xC525);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F5D4: bcs  f5d9 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x25, 3, 0xF5D5, 0x0372);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF5D9)
+    goto aot_F5D9;
+  goto aot_F5D6;
+
+aot_F5D6: /* F5D6-F5D8 */
+  AOT_BEGIN(6);
+  /* F5D6: oim 1c6 */
+  AOT_INSN(0x72, 6, 0xF5D7, 0x01C6);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  goto aot_F5D9;
+
+aot_F5D9: /* F5D9-F5D9 */
+  AOT_BEGIN(5);
+  /* F5D9: rts */
+  AOT_INSN(0x39, 5, 0xF5DA, 0x9BC8);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F5DA: /* F5DA-F5DF */
+  AOT_BEGIN(8);
+  /* F5DA: adda c8 */
+  AOT_INSN(0x9B, 3, 0xF5DB, 0xC881);
+  DIR8(t); a = ADD8(a, t, 0);
+  /* F5DC: cmpa #7f */
+  AOT_INSN(0x81, 2, 0xF5DD, 0x7F25);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F5DE: bcs  f5c4 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x25, 3, 0xF5DF, 0xE481);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF5C4)
+    goto aot_F5C4;
+  goto aot_F5E0;
+
+aot_F5E0: /* F5E0-F5E3 */
+  AOT_BEGIN(5);
+  /* F5E0: cmpa #81 */
+  AOT_INSN(0x81, 2, 0xF5E1, 0x8124);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F5E2: bcc  f5c4 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x24, 3, 0xF5E3, 0xE072);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF5C4)
+    goto aot_F5C4;
+  goto aot_F5E4;
+
+aot_F5E4: /* F5E4-F5EA */
+  AOT_BEGIN(11);
+  /* F5E4: oim 40c6 */
+  AOT_INSN(0x72, 6, 0xF5E5, 0x40C6);
+  IMM_MEM(ea, |, 1);
+  /* F5E7: ldaa #7f */
+  AOT_INSN(0x86, 2, 0xF5E8, 0x7F20);
+  IMM8(t); a = LOGIC8(t);
+  /* F5E9: bra  f5c4 */
+  AOT_CYCLES(8);
+  AOT_INSN(0x20, 3, 0xF5EA, 0xD996);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F5C4;
+
+aot_F5EB: /* F5EB-F5F6 */
+  AOT_BEGIN(18);
+  /* F5EB: ldaa af */
+  AOT_INSN(0x96, 3, 0xF5EC, 0xAF97);
+  DIR8(t); a = LOGIC8(t);
+  /* F5ED: staa c5 */
+  AOT_INSN(0x97, 3, 0xF5EE, 0xC5CE);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F5EF: ldx  #00bb */
+  AOT_INSN(0xCE, 3, 0xF5F0, 0x00BB);
+  IMM16(w); x = LOGIC16(w);
+  /* F5F2: ldab c4 */
+  AOT_INSN(0xD6, 3, 0xF5F3, 0xC4BD);
+  DIR8(t); b = LOGIC8(t);
+  /* F5F4: jsr  f5a8 */
+  AOT_CYCLES(12);
+  AOT_INSN(0xBD, 6, 0xF5F5, 0xF5A8);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F5A8;
+
+aot_F5F7: /* F5F7-F5FA */
+  AOT_BEGIN(6);
+  /* F5F7: ldaa c6 */
+  AOT_INSN(0x96, 3, 0xF5F8, 0xC627);
+  DIR8(t); a = LOGIC8(t);
+  /* F5F9: beq  f60b */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF5FA, 0x1084);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF60B)
+    goto aot_F60B;
+  goto aot_F5FB;
+
+aot_F5FB: /* F5FB-F5FE */
+  AOT_BEGIN(5);
+  /* F5FB: anda #82 */
+  AOT_INSN(0x84, 2, 0xF5FC, 0x8227);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F5FD: beq  f603 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF5FE, 0x04C6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF603)
+    goto aot_F603;
+  goto aot_F5FF;
+
+aot_F5FF: /* F5FF-F602 */
+  AOT_BEGIN(5);
+  /* F5FF: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF600, 0x0120);
+  IMM8(t); b = LOGIC8(t);
+  /* F601: bra  f605 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF602, 0x02C6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F605;
+
+aot_F603: /* F603-F604 */
+  AOT_BEGIN(2);
+  /* F603: ldab #00 */
+  AOT_INSN(0xC6, 2, 0xF604, 0x00BD);
+  IMM8(t); b = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F605;
+
+aot_F605: /* F605-F607 */
+  AOT_BEGIN(6);
+  /* F605: jsr  f656 */
+  AOT_INSN(0xBD, 6, 0xF606, 0xF656);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F656;
+
+aot_F608: /* F608-F60A */
+  AOT_BEGIN(5);
+  /* F608: clr 00bb */
+  AOT_INSN(0x7F, 5, 0xF609, 0x00BB);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  AOT_CYCLES(5);
+  goto aot_F60B;
+
+aot_F60B: /* F60B-F616 */
+  AOT_BEGIN(18);
+  /* F60B: ldaa ae */
+  AOT_INSN(0x96, 3, 0xF60C, 0xAE97);
+  DIR8(t); a = LOGIC8(t);
+  /* F60D: staa c5 */
+  AOT_INSN(0x97, 3, 0xF60E, 0xC5CE);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F60F: ldx  #00ba */
+  AOT_INSN(0xCE, 3, 0xF610, 0x00BA);
+  IMM16(w); x = LOGIC16(w);
+  /* F612: ldab c3 */
+  AOT_INSN(0xD6, 3, 0xF613, 0xC3BD);
+  DIR8(t); b = LOGIC8(t);
+  /* F614: jsr  f5a8 */
+  AOT_CYCLES(12);
+  AOT_INSN(0xBD, 6, 0xF615, 0xF5A8);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F5A8;
+
+aot_F617: /* F617-F61A */
+  AOT_BEGIN(6);
+  /* F617: ldaa c6 */
+  AOT_INSN(0x96, 3, 0xF618, 0xC627);
+  DIR8(t); a = LOGIC8(t);
+  /* F619: beq  f62b */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF61A, 0x1084);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF62B)
+    goto aot_F62B;
+  goto aot_F61B;
+
+aot_F61B: /* F61B-F61E */
+  AOT_BEGIN(5);
+  /* F61B: anda #82 */
+  AOT_INSN(0x84, 2, 0xF61C, 0x8227);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F61D: beq  f623 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF61E, 0x04C6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF623)
+    goto aot_F623;
+  goto aot_F61F;
+
+aot_F61F: /* F61F-F622 */
+  AOT_BEGIN(5);
+  /* F61F: ldab #03 */
+  AOT_INSN(0xC6, 2, 0xF620, 0x0320);
+  IMM8(t); b = LOGIC8(t);
+  /* F621: bra  f625 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF622, 0x02C6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F625;
+
+aot_F623: /* F623-F624 */
+  AOT_BEGIN(2);
+  /* F623: ldab #02 */
+  AOT_INSN(0xC6, 2, 0xF624, 0x02BD);
+  IMM8(t); b = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F625;
+
+aot_F625: /* F625-F627 */
+  AOT_BEGIN(6);
+  /* F625: jsr  f656 */
+  AOT_INSN(0xBD, 6, 0xF626, 0xF656);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F656;
+
+aot_F628: /* F628-F62A */
+  AOT_BEGIN(5);
+  /* F628: clr 00ba */
+  AOT_INSN(0x7F, 5, 0xF629, 0x00BA);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  AOT_CYCLES(5);
+  goto aot_F62B;
+
+aot_F62B: /* F62B-F62E */
+  AOT_BEGIN(6);
+  /* F62B: ldab c1 */
+  AOT_INSN(0xD6, 3, 0xF62C, 0xC127);
+  DIR8(t); b = LOGIC8(t);
+  /* F62D: beq  f653 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF62E, 0x24C4);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF653)
+    goto aot_F653;
+  goto aot_F62F;
+
+aot_F62F: /* F62F-F632 */
+  AOT_BEGIN(5);
+  /* F62F: andb #03 */
+  AOT_INSN(0xC4, 2, 0xF630, 0x0327);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F631: beq  f63f */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF632, 0x0C54);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF63F)
+    goto aot_F63F;
+  goto aot_F633;
+
+aot_F633: /* F633-F635 */
+  AOT_BEGIN(4);
+  /* F633: lsrb */
+  AOT_INSN(0x54, 1, 0xF634, 0x2404);
+  b = SHR8(b, 0);
+  /* F634: bcc  f63a */
+  AOT_CYCLES(1);
+  AOT_INSN(0x24, 3, 0xF635, 0x04C6);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF63A)
+    goto aot_F63A;
+  goto aot_F636;
+
+aot_F636: /* F636-F639 */
+  AOT_BEGIN(5);
+  /* F636: ldab #05 */
+  AOT_INSN(0xC6, 2, 0xF637, 0x0520);
+  IMM8(t); b = LOGIC8(t);
+  /* F638: bra  f63c */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF639, 0x02C6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F63C;
+
+aot_F63A: /* F63A-F63B */
+  AOT_BEGIN(2);
+  /* F63A: ldab #07 */
+  AOT_INSN(0xC6, 2, 0xF63B, 0x07BD);
+  IMM8(t); b = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F63C;
+
+aot_F63C: /* F63C-F63E */
+  AOT_BEGIN(6);
+  /* F63C: jsr  f656 */
+  AOT_INSN(0xBD, 6, 0xF63D, 0xF656);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F656;
+
+aot_F63F: /* F63F-F644 */
+  AOT_BEGIN(8);
+  /* F63F: ldab c1 */
+  AOT_INSN(0xD6, 3, 0xF640, 0xC1C4);
+  DIR8(t); b = LOGIC8(t);
+  /* F641: andb #0c */
+  AOT_INSN(0xC4, 2, 0xF642, 0x0C27);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F643: beq  f653 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x27, 3, 0xF644, 0x0E54);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF653)
+    goto aot_F653;
+  goto aot_F645;
+
+aot_F645: /* F645-F649 */
+  AOT_BEGIN(6);
+  /* F645: lsrb */
+  AOT_INSN(0x54, 1, 0xF646, 0x5454);
+  b = SHR8(b, 0);
+  /* F646: lsrb */
+  AOT_INSN(0x54, 1, 0xF647, 0x5424);
+  b = SHR8(b, 0);
+  /* F647: lsrb */
+  AOT_INSN(0x54, 1, 0xF648, 0x2404);
+  b = SHR8(b, 0);
+  /* F648: bcc  f64e */
+  AOT_CYCLES(3);
+  AOT_INSN(0x24, 3, 0xF649, 0x04C6);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF64E)
+    goto aot_F64E;
+  goto aot_F64A;
+
+aot_F64A: /* F64A-F64D */
+  AOT_BEGIN(5);
+  /* F64A: ldab #04 */
+  AOT_INSN(0xC6, 2, 0xF64B, 0x0420);
+  IMM8(t); b = LOGIC8(t);
+  /* F64C: bra  f650 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF64D, 0x02C6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F650;
+
+aot_F64E: /* F64E-F64F */
+  AOT_BEGIN(2);
+  /* F64E: ldab #06 */
+  AOT_INSN(0xC6, 2, 0xF64F, 0x06BD);
+  IMM8(t); b = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F650;
+
+aot_F650: /* F650-F652 */
+  AOT_BEGIN(6);
+  /* F650: jsr  f656 */
+  AOT_INSN(0xBD, 6, 0xF651, 0xF656);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_F656;
+
+aot_F653: /* F653-F655 */
+  AOT_BEGIN(3);
+  /* F653: jmp f150 */
+  AOT_INSN(0x7E, 3, 0xF654, 0xF150);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F150;
+
+aot_F656: /* F656-F662 */
+  AOT_BEGIN(18);
+  /* F656: clr 00c7 */
+  AOT_INSN(0x7F, 5, 0xF657, 0x00C7);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F659: ldx  #f679 */
+  AOT_INSN(0xCE, 3, 0xF65A, 0xF679);
+  IMM16(w); x = LOGIC16(w);
+  /* F65C: abx */
+  AOT_INSN(0x3A, 1, 0xF65D, 0xA600);
+  x = (x + b) & 0xFFFF;
+  /* F65D: ldaa 00,x */
+  AOT_CYCLES(9);
+  AOT_INSN(0xA6, 4, 0xF65E, 0x0081);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(5);
+  /* F65F: cmpa #60 */
+  AOT_INSN(0x81, 2, 0xF660, 0x6024);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F661: bcc  f665 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x24, 3, 0xF662, 0x0297);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF665)
+    goto aot_F665;
+  goto aot_F663;
+
+aot_F663: /* F663-F664 */
+  AOT_BEGIN(3);
+  /* F663: staa c7 */
+  AOT_INSN(0x97, 3, 0xF664, 0xC70F);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  goto aot_F665;
+
+aot_F665: /* F665-F669 */
+  AOT_BEGIN(8);
+  /* F665: sei */
+  AOT_INSN(0x0F, 1, 0xF666, 0x5FBD);
+  ccr |= IFLAG;
+  /* F666: clrb */
+  AOT_INSN(0x5F, 1, 0xF667, 0xBDFD);
+  b = CLR8();
+  /* F667: jsr  fd34 */
+  AOT_CYCLES(2);
+  AOT_INSN(0xBD, 6, 0xF668, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F66A: /* F66A-F66B */
+  AOT_BEGIN(3);
+  /* F66A: bcc  f677 */
+  AOT_INSN(0x24, 3, 0xF66B, 0x0B96);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF677)
+    goto aot_F677;
+  goto aot_F66C;
+
+aot_F66C: /* F66C-F66F */
+  AOT_BEGIN(6);
+  /* F66C: ldaa c7 */
+  AOT_INSN(0x96, 3, 0xF66D, 0xC727);
+  DIR8(t); a = LOGIC8(t);
+  /* F66E: beq  f677 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF66F, 0x078A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF677)
+    goto aot_F677;
+  goto aot_F670;
+
+aot_F670: /* F670-F676 */
+  AOT_BEGIN(10);
+  /* F670: oraa #80 */
+  AOT_INSN(0x8A, 2, 0xF671, 0x807F);
+  IMM8(t); a = LOGIC8(a | t);
+  /* F672: clr 00c7 */
+  AOT_INSN(0x7F, 5, 0xF673, 0x00C7);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F675: bra  f665 */
+  AOT_CYCLES(7);
+  AOT_INSN(0x20, 3, 0xF676, 0xEE0E);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F665;
+
+aot_F677: /* F677-F678 */
+  AOT_BEGIN(6);
+  /* F677: cli */
+  AOT_INSN(0x0E, 1, 0xF678, 0x3948);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(5);
+  /* F678: rts */
+  AOT_INSN(0x39, 5, 0xF679, 0x4850);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F681: /* F681-F685 */
+  AOT_BEGIN(7);
+  /* F681: coma */
+  AOT_INSN(0x43, 1, 0xF682, 0xD69E);
+  a = COM8(a);
+  /* F682: ldab 9e */
+  AOT_INSN(0xD6, 3, 0xF683, 0x9E27);
+  DIR8(t); b = LOGIC8(t);
+  /* F684: beq  f69b */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF685, 0x15C1);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF69B)
+    goto aot_F69B;
+  goto aot_F686;
+
+aot_F686: /* F686-F689 */
+  AOT_BEGIN(5);
+  /* F686: cmpb #05 */
+  AOT_INSN(0xC1, 2, 0xF687, 0x0525);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F688: bcs  f6a4 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xF689, 0x1A5F);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF6A4)
+    goto aot_F6A4;
+  goto aot_F68A;
+
+aot_F68A: /* F68A-F69A */
+  AOT_BEGIN(24);
+  /* F68A: clrb */
+  AOT_INSN(0x5F, 1, 0xF68B, 0xD79E);
+  b = CLR8();
+  /* F68B: stab 9e */
+  AOT_INSN(0xD7, 3, 0xF68C, 0x9E97);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F68D: staa c5 */
+  AOT_INSN(0x97, 3, 0xF68E, 0xC516);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F68F: tab */
+  AOT_INSN(0x16, 1, 0xF690, 0x98A0);
+  b = LOGIC8(a);
+  /* F690: eora a0 */
+  AOT_INSN(0x98, 3, 0xF691, 0xA094);
+  DIR8(t); a = LOGIC8(a ^ t);
+  /* F692: anda 9f */
+  AOT_INSN(0x94, 3, 0xF693, 0x9FD4);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F694: anda a0 */
+  AOT_INSN(0xD4, 3, 0xF695, 0xA01B);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F696: aba */
+  AOT_INSN(0x1B, 1, 0xF697, 0x979F);
+  a = ADD8(a, b, 0);
+  /* F697: staa 9f */
+  AOT_INSN(0x97, 3, 0xF698, 0x9F96);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F699: ldaa c5 */
+  AOT_INSN(0x96, 3, 0xF69A, 0xC591);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(24);
+  goto aot_F69B;
+
+aot_F69B: /* F69B-F69E */
+  AOT_BEGIN(6);
+  /* F69B: cmpa 9f */
+  AOT_INSN(0x91, 3, 0xF69C, 0x9F27);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F69D: beq  f6a4 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF69E, 0x0597);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF6A4)
+    goto aot_F6A4;
+  goto aot_F69F;
+
+aot_F69F: /* F69F-F6A3 */
+  AOT_BEGIN(9);
+  /* F69F: staa a0 */
+  AOT_INSN(0x97, 3, 0xF6A0, 0xA07C);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F6A1: inc 009e */
+  AOT_INSN(0x7C, 6, 0xF6A2, 0x009E);
+  EXT8(t); t = INC8(t); WR(ea, t);
+  AOT_CYCLES(9);
+  goto aot_F6A4;
+
+aot_F6A4: /* F6A4-F6A8 */
+  AOT_BEGIN(7);
+  /* F6A4: tim 04ca */
+  AOT_INSN(0x7B, 4, 0xF6A5, 0x04CA);
+  IMM_MEM(ea, &, 0);
+  /* F6A7: beq  f6ac */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF6A8, 0x037E);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF6AC)
+    goto aot_F6AC;
+  goto aot_F6A9;
+
+aot_F6A9: /* F6A9-F6AB */
+  AOT_BEGIN(3);
+  /* F6A9: jmp f7a6 */
+  AOT_INSN(0x7E, 3, 0xF6AA, 0xF7A6);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F7A6;
+
+aot_F6AC: /* F6AC-F6B1 */
+  AOT_BEGIN(9);
+  /* F6AC: ldaa 9f */
+  AOT_INSN(0x96, 3, 0xF6AD, 0x9F91);
+  DIR8(t); a = LOGIC8(t);
+  /* F6AE: cmpa a9 */
+  AOT_INSN(0x91, 3, 0xF6AF, 0xA926);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F6B0: bne  f6c0 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x26, 3, 0xF6B1, 0x0E96);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF6C0)
+    goto aot_F6C0;
+  goto aot_F6B2;
+
+aot_F6B2: /* F6B2-F6B9 */
+  AOT_BEGIN(11);
+  /* F6B2: ldaa 9b */
+  AOT_INSN(0x96, 3, 0xF6B3, 0x9BD6);
+  DIR8(t); a = LOGIC8(t);
+  /* F6B4: ldab c9 */
+  AOT_INSN(0xD6, 3, 0xF6B5, 0xC9C5);
+  DIR8(t); b = LOGIC8(t);
+  /* F6B6: bitb #02 */
+  AOT_INSN(0xC5, 2, 0xF6B7, 0x0226);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F6B8: bne  f707 */
+  AOT_CYCLES(8);
+  AOT_INSN(0x26, 3, 0xF6B9, 0x4D5D);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF707)
+    goto aot_F707;
+  goto aot_F6BA;
+
+aot_F6BA: /* F6BA-F6BC */
+  AOT_BEGIN(4);
+  /* F6BA: tstb */
+  AOT_INSN(0x5D, 1, 0xF6BB, 0x2A48);
+  (void)TEST8(b);
+  /* F6BB: bpl  f705 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x2A, 3, 0xF6BC, 0x487E);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF705)
+    goto aot_F705;
+  goto aot_F6BD;
+
+aot_F6BD: /* F6BD-F6BF */
+  AOT_BEGIN(3);
+  /* F6BD: jmp f13a */
+  AOT_INSN(0x7E, 3, 0xF6BE, 0xF13A);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F13A;
+
+aot_F6C0: /* F6C0-F6C6 */
+  AOT_BEGIN(10);
+  /* F6C0: staa a9 */
+  AOT_INSN(0x97, 3, 0xF6C1, 0xA97B);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F6C2: tim 02c9 */
+  AOT_INSN(0x7B, 4, 0xF6C3, 0x02C9);
+  IMM_MEM(ea, &, 0);
+  /* F6C5: bne  f6cc */
+  AOT_CYCLES(7);
+  AOT_INSN(0x26, 3, 0xF6C6, 0x05CE);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF6CC)
+    goto aot_F6CC;
+  goto aot_F6C7;
+
+aot_F6C7: /* F6C7-F6CB */
+  AOT_BEGIN(6);
+  /* F6C7: ldx  #ffff */
+  AOT_INSN(0xCE, 3, 0xF6C8, 0xFFFF);
+  IMM16(w); x = LOGIC16(w);
+  /* F6CA: bra  f6ea */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xF6CB, 0x1ECE);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F6EA;
+
+aot_F6CC: /* F6CC-F6D0 */
+  AOT_BEGIN(5);
+  /* F6CC: ldx  #0000 */
+  AOT_INSN(0xCE, 3, 0xF6CD, 0x0000);
+  IMM16(w); x = LOGIC16(w);
+  /* F6CF: anda #0f */
+  AOT_INSN(0x84, 2, 0xF6D0, 0x0FE6);
+  IMM8(t); a = LOGIC8(a & t);
+  AOT_CYCLES(5);
+  goto aot_F6D1;
+
+aot_F6D1: /* F6D1-F6D7 */
+  AOT_BEGIN(10);
+  /* F6D1: ldab a4,x */
+  AOT_INSN(0xE6, 4, 0xF6D2, 0xA4C4);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(6);
+  /* F6D3: andb #0f */
+  AOT_INSN(0xC4, 2, 0xF6D4, 0x0F11);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F6D5: cba */
+  AOT_INSN(0x11, 1, 0xF6D6, 0x271C);
+  (void)SUB8(a, b, 0);
+  /* F6D6: beq  f6f4 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xF6D7, 0x1CE6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF6F4)
+    goto aot_F6F4;
+  goto aot_F6D8;
+
+aot_F6D8: /* F6D8-F6E1 */
+  AOT_BEGIN(15);
+  /* F6D8: ldab a4,x */
+  AOT_INSN(0xE6, 4, 0xF6D9, 0xA448);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(11);
+  /* F6DA: lsla */
+  AOT_INSN(0x48, 1, 0xF6DB, 0x5846);
+  a = SHL8(a, 0);
+  /* F6DB: lslb */
+  AOT_INSN(0x58, 1, 0xF6DC, 0x46A7);
+  b = SHL8(b, 0);
+  /* F6DC: rora */
+  AOT_INSN(0x46, 1, 0xF6DD, 0xA7A4);
+  a = SHR8(a, CFLAGV);
+  /* F6DD: staa a4,x */
+  AOT_CYCLES(3);
+  AOT_INSN(0xA7, 4, 0xF6DE, 0xA409);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* F6DF: dex */
+  AOT_INSN(0x09, 1, 0xF6E0, 0x2605);
+  x = (x - 1) & 0xFFFF; fz = x;
+  /* F6E0: bne  f6e7 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xF6E1, 0x0572);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF6E7)
+    goto aot_F6E7;
+  goto aot_F6E2;
+
+aot_F6E2: /* F6E2-F6E6 */
+  AOT_BEGIN(9);
+  /* F6E2: oim 40ca */
+  AOT_INSN(0x72, 6, 0xF6E3, 0x40CA);
+  IMM_MEM(ea, |, 1);
+  /* F6E5: bra  f6f7 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF6E6, 0x1072);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F6F7;
+
+aot_F6E7: /* F6E7-F6E9 */
+  AOT_BEGIN(6);
+  /* F6E7: oim 80ca */
+  AOT_INSN(0x72, 6, 0xF6E8, 0x80CA);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  goto aot_F6EA;
+
+aot_F6EA: /* F6EA-F6F3 */
+  AOT_BEGIN(12);
+  /* F6EA: ldaa a9 */
+  AOT_INSN(0x96, 3, 0xF6EB, 0xA944);
+  DIR8(t); a = LOGIC8(t);
+  /* F6EC: lsra */
+  AOT_INSN(0x44, 1, 0xF6ED, 0x4444);
+  a = SHR8(a, 0);
+  /* F6ED: lsra */
+  AOT_INSN(0x44, 1, 0xF6EE, 0x4444);
+  a = SHR8(a, 0);
+  /* F6EE: lsra */
+  AOT_INSN(0x44, 1, 0xF6EF, 0x4408);
+  a = SHR8(a, 0);
+  /* F6EF: lsra */
+  AOT_INSN(0x44, 1, 0xF6F0, 0x0808);
+  a = SHR8(a, 0);
+  /* F6F0: inx */
+  AOT_INSN(0x08, 1, 0xF6F1, 0x0820);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F6F1: inx */
+  AOT_INSN(0x08, 1, 0xF6F2, 0x20DD);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F6F2: bra  f6d1 */
+  AOT_CYCLES(9);
+  AOT_INSN(0x20, 3, 0xF6F3, 0xDD09);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F6D1;
+
+aot_F6F4: /* F6F4-F6F6 */
+  AOT_BEGIN(4);
+  /* F6F4: dex */
+  AOT_INSN(0x09, 1, 0xF6F5, 0x26F3);
+  x = (x - 1) & 0xFFFF; fz = x;
+  /* F6F5: bne  f6ea */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xF6F6, 0xF396);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF6EA)
+    goto aot_F6EA;
+  goto aot_F6F7;
+
+aot_F6F7: /* F6F7-F6FE */
+  AOT_BEGIN(11);
+  /* F6F7: ldaa 9b */
+  AOT_INSN(0x96, 3, 0xF6F8, 0x9BD6);
+  DIR8(t); a = LOGIC8(t);
+  /* F6F9: ldab c9 */
+  AOT_INSN(0xD6, 3, 0xF6FA, 0xC9C5);
+  DIR8(t); b = LOGIC8(t);
+  /* F6FB: bitb #02 */
+  AOT_INSN(0xC5, 2, 0xF6FC, 0x0226);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F6FD: bne  f707 */
+  AOT_CYCLES(8);
+  AOT_INSN(0x26, 3, 0xF6FE, 0x085D);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF707)
+    goto aot_F707;
+  goto aot_F6FF;
+
+aot_F6FF: /* F6FF-F701 */
+  AOT_BEGIN(4);
+  /* F6FF: tstb */
+  AOT_INSN(0x5D, 1, 0xF700, 0x2A03);
+  (void)TEST8(b);
+  /* F700: bpl  f705 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x2A, 3, 0xF701, 0x037E);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF705)
+    goto aot_F705;
+  goto aot_F702;
+
+aot_F702: /* F702-F704 */
+  AOT_BEGIN(3);
+  /* F702: jmp f741 */
+  AOT_INSN(0x7E, 3, 0xF703, 0xF741);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F741;
+
+aot_F705: /* F705-F706 */
+  AOT_BEGIN(2);
+  /* F705: oraa #fb */
+  AOT_INSN(0x8A, 2, 0xF706, 0xFB43);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_F707;
+
+aot_F707: /* F707-F70B */
+  AOT_BEGIN(7);
+  /* F707: coma */
+  AOT_INSN(0x43, 1, 0xF708, 0x91A8);
+  a = COM8(a);
+  /* F708: cmpa a8 */
+  AOT_INSN(0x91, 3, 0xF709, 0xA827);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* F70A: beq  f741 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF70B, 0x3597);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF741)
+    goto aot_F741;
+  goto aot_F70C;
+
+aot_F70C: /* F70C-F714 */
+  AOT_BEGIN(12);
+  /* F70C: staa a8 */
+  AOT_INSN(0x97, 3, 0xF70D, 0xA846);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F70E: rora */
+  AOT_INSN(0x46, 1, 0xF70F, 0xD6C9);
+  a = SHR8(a, CFLAGV);
+  /* F70F: ldab c9 */
+  AOT_INSN(0xD6, 3, 0xF710, 0xC9C5);
+  DIR8(t); b = LOGIC8(t);
+  /* F711: bitb #02 */
+  AOT_INSN(0xC5, 2, 0xF712, 0x0226);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F713: bne  f71c */
+  AOT_CYCLES(9);
+  AOT_INSN(0x26, 3, 0xF714, 0x07CE);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF71C)
+    goto aot_F71C;
+  goto aot_F715;
+
+aot_F715: /* F715-F71B */
+  AOT_BEGIN(8);
+  /* F715: ldx  #0001 */
+  AOT_INSN(0xCE, 3, 0xF716, 0x0001);
+  IMM16(w); x = LOGIC16(w);
+  /* F718: rora */
+  AOT_INSN(0x46, 1, 0xF719, 0x0D20);
+  a = SHR8(a, CFLAGV);
+  /* F719: sec */
+  AOT_INSN(0x0D, 1, 0xF71A, 0x2004);
+  ccr |= CFLAG;
+  /* F71A: bra  f720 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x20, 3, 0xF71B, 0x04CE);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F720;
+
+aot_F71C: /* F71C-F71F */
+  AOT_BEGIN(4);
+  /* F71C: ldx  #0000 */
+  AOT_INSN(0xCE, 3, 0xF71D, 0x0000);
+  IMM16(w); x = LOGIC16(w);
+  /* F71F: clc */
+  AOT_INSN(0x0C, 1, 0xF720, 0x46E6);
+  ccr &= ~CFLAG;
+  AOT_CYCLES(4);
+  goto aot_F720;
+
+aot_F720: /* F720-F724 */
+  AOT_BEGIN(8);
+  /* F720: rora */
+  AOT_INSN(0x46, 1, 0xF721, 0xE6A4);
+  a = SHR8(a, CFLAGV);
+  /* F721: ldab a4,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xE6, 4, 0xF722, 0xA424);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F723: bcc  f72b */
+  AOT_INSN(0x24, 3, 0xF724, 0x062B);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF72B)
+    goto aot_F72B;
+  goto aot_F725;
+
+aot_F725: /* F725-F726 */
+  AOT_BEGIN(3);
+  /* F725: bmi  f737 */
+  AOT_INSN(0x2B, 3, 0xF726, 0x10CA);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF737)
+    goto aot_F737;
+  goto aot_F727;
+
+aot_F727: /* F727-F72A */
+  AOT_BEGIN(5);
+  /* F727: orab #80 */
+  AOT_INSN(0xCA, 2, 0xF728, 0x8020);
+  IMM8(t); b = LOGIC8(b | t);
+  /* F729: bra  f72f */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF72A, 0x042A);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F72F;
+
+aot_F72B: /* F72B-F72C */
+  AOT_BEGIN(3);
+  /* F72B: bpl  f737 */
+  AOT_INSN(0x2A, 3, 0xF72C, 0x0AC4);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF737)
+    goto aot_F737;
+  goto aot_F72D;
+
+aot_F72D: /* F72D-F72E */
+  AOT_BEGIN(2);
+  /* F72D: andb #7f */
+  AOT_INSN(0xC4, 2, 0xF72E, 0x7FE7);
+  IMM8(t); b = LOGIC8(b & t);
+  AOT_CYCLES(2);
+  goto aot_F72F;
+
+aot_F72F: /* F72F-F733 */
+  AOT_BEGIN(8);
+  /* F72F: stab a4,x */
+  AOT_INSN(0xE7, 4, 0xF730, 0xA44D);
+  EA_IX(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* F731: tsta */
+  AOT_INSN(0x4D, 1, 0xF732, 0x2B0A);
+  (void)TEST8(a);
+  /* F732: bmi  f73e */
+  AOT_CYCLES(1);
+  AOT_INSN(0x2B, 3, 0xF733, 0x0A72);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF73E)
+    goto aot_F73E;
+  goto aot_F734;
+
+aot_F734: /* F734-F736 */
+  AOT_BEGIN(6);
+  /* F734: oim 80ca */
+  AOT_INSN(0x72, 6, 0xF735, 0x80CA);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  goto aot_F737;
+
+aot_F737: /* F737-F739 */
+  AOT_BEGIN(4);
+  /* F737: tsta */
+  AOT_INSN(0x4D, 1, 0xF738, 0x2B07);
+  (void)TEST8(a);
+  /* F738: bmi  f741 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x2B, 3, 0xF739, 0x0708);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF741)
+    goto aot_F741;
+  goto aot_F73A;
+
+aot_F73A: /* F73A-F73D */
+  AOT_BEGIN(5);
+  /* F73A: inx */
+  AOT_INSN(0x08, 1, 0xF73B, 0x0D20);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F73B: sec */
+  AOT_INSN(0x0D, 1, 0xF73C, 0x20E2);
+  ccr |= CFLAG;
+  /* F73C: bra  f720 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF73D, 0xE272);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F720;
+
+aot_F73E: /* F73E-F740 */
+  AOT_BEGIN(6);
+  /* F73E: oim 40ca */
+  AOT_INSN(0x72, 6, 0xF73F, 0x40CA);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  goto aot_F741;
+
+aot_F741: /* F741-F746 */
+  AOT_BEGIN(8);
+  /* F741: ldaa ca */
+  AOT_INSN(0x96, 3, 0xF742, 0xCA85);
+  DIR8(t); a = LOGIC8(t);
+  /* F743: bita #02 */
+  AOT_INSN(0x85, 2, 0xF744, 0x0226);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F745: bne  f778 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xF746, 0x3185);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF778)
+    goto aot_F778;
+  goto aot_F747;
+
+aot_F747: /* F747-F74A */
+  AOT_BEGIN(5);
+  /* F747: bita #c0 */
+  AOT_INSN(0x85, 2, 0xF748, 0xC027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F749: beq  f753 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF74A, 0x0885);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF753)
+    goto aot_F753;
+  goto aot_F74B;
+
+aot_F74B: /* F74B-F74E */
+  AOT_BEGIN(5);
+  /* F74B: bita #08 */
+  AOT_INSN(0x85, 2, 0xF74C, 0x0826);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F74D: bne  f756 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF74E, 0x070E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF756)
+    goto aot_F756;
+  goto aot_F74F;
+
+aot_F74F: /* F74F-F752 */
+  AOT_BEGIN(7);
+  /* F74F: cli */
+  AOT_INSN(0x0E, 1, 0xF750, 0x713F);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(6);
+  /* F750: aim 3fca */
+  AOT_INSN(0x71, 6, 0xF751, 0x3FCA);
+  IMM_MEM(ea, &, 1);
+  AOT_CYCLES(6);
+  goto aot_F753;
+
+aot_F753: /* F753-F755 */
+  AOT_BEGIN(3);
+  /* F753: jmp f13a */
+  AOT_INSN(0x7E, 3, 0xF754, 0xF13A);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F13A;
+
+aot_F756: /* F756-F759 */
+  AOT_BEGIN(5);
+  /* F756: bita #80 */
+  AOT_INSN(0x85, 2, 0xF757, 0x8027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F758: beq  f766 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF759, 0x0C0F);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF766)
+    goto aot_F766;
+  goto aot_F75A;
+
+aot_F75A: /* F75A-F764 */
+  AOT_BEGIN(14);
+  /* F75A: sei */
+  AOT_INSN(0x0F, 1, 0xF75B, 0x86FE);
+  ccr |= IFLAG;
+  /* F75B: ldaa #fe */
+  AOT_INSN(0x86, 2, 0xF75C, 0xFEC6);
+  IMM8(t); a = LOGIC8(t);
+  /* F75D: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF75E, 0x01CE);
+  IMM8(t); b = LOGIC8(t);
+  /* F75F: ldx  #00a4 */
+  AOT_INSN(0xCE, 3, 0xF760, 0x00A4);
+  IMM16(w); x = LOGIC16(w);
+  /* F762: jsr  fd34 */
+  AOT_CYCLES(8);
+  AOT_INSN(0xBD, 6, 0xF763, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F765: /* F765-F765 */
+  AOT_BEGIN(1);
+  /* F765: cli */
+  AOT_INSN(0x0E, 1, 0xF766, 0x7B40);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(0);
+  goto aot_F766;
+
+aot_F766: /* F766-F76A */
+  AOT_BEGIN(7);
+  /* F766: tim 40ca */
+  AOT_INSN(0x7B, 4, 0xF767, 0x40CA);
+  IMM_MEM(ea, &, 0);
+  /* F769: beq  f74f */
+  AOT_CYCLES(4);
+  AOT_INSN(0x27, 3, 0xF76A, 0xE40F);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF74F)
+    goto aot_F74F;
+  goto aot_F76B;
+
+aot_F76B: /* F76B-F775 */
+  AOT_BEGIN(14);
+  /* F76B: sei */
+  AOT_INSN(0x0F, 1, 0xF76C, 0x86FF);
+  ccr |= IFLAG;
+  /* F76C: ldaa #ff */
+  AOT_INSN(0x86, 2, 0xF76D, 0xFFC6);
+  IMM8(t); a = LOGIC8(t);
+  /* F76E: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF76F, 0x01CE);
+  IMM8(t); b = LOGIC8(t);
+  /* F770: ldx  #00a5 */
+  AOT_INSN(0xCE, 3, 0xF771, 0x00A5);
+  IMM16(w); x = LOGIC16(w);
+  /* F773: jsr  fd34 */
+  AOT_CYCLES(8);
+  AOT_INSN(0xBD, 6, 0xF774, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F776: /* F776-F777 */
+  AOT_BEGIN(3);
+  /* F776: bra  f74f */
+  AOT_INSN(0x20, 3, 0xF777, 0xD7B6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F74F;
+
+aot_F778: /* F778-F77C */
+  AOT_BEGIN(7);
+  /* F778: ldaa 00a7 */
+  AOT_INSN(0xB6, 4, 0xF779, 0x00A7);
+  EXT8(t); a = LOGIC8(t);
+  /* F77B: bne  f74f */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF77C, 0xD296);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF74F)
+    goto aot_F74F;
+  goto aot_F77D;
+
+aot_F77D: /* F77D-F786 */
+  AOT_BEGIN(14);
+  /* F77D: ldaa 94 */
+  AOT_INSN(0x96, 3, 0xF77E, 0x94B7);
+  DIR8(t); a = LOGIC8(t);
+  /* F77F: staa 00a7 */
+  AOT_INSN(0xB7, 4, 0xF780, 0x00A7);
+  EA_EXT(); (void)LOGIC8(a); WR(ea, a);
+  /* F782: clra */
+  AOT_INSN(0x4F, 1, 0xF783, 0xD6A4);
+  a = CLR8();
+  /* F783: ldab a4 */
+  AOT_INSN(0xD6, 3, 0xF784, 0xA42A);
+  DIR8(t); b = LOGIC8(t);
+  /* F785: bpl  f789 */
+  AOT_CYCLES(11);
+  AOT_INSN(0x2A, 3, 0xF786, 0x028A);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF789)
+    goto aot_F789;
+  goto aot_F787;
+
+aot_F787: /* F787-F788 */
+  AOT_BEGIN(2);
+  /* F787: oraa #02 */
+  AOT_INSN(0x8A, 2, 0xF788, 0x0258);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_F789;
+
+aot_F789: /* F789-F792 */
+  AOT_BEGIN(13);
+  /* F789: lslb */
+  AOT_INSN(0x58, 1, 0xF78A, 0x5858);
+  b = SHL8(b, 0);
+  /* F78A: lslb */
+  AOT_INSN(0x58, 1, 0xF78B, 0x5858);
+  b = SHL8(b, 0);
+  /* F78B: lslb */
+  AOT_INSN(0x58, 1, 0xF78C, 0x58D7);
+  b = SHL8(b, 0);
+  /* F78C: lslb */
+  AOT_INSN(0x58, 1, 0xF78D, 0xD7A9);
+  b = SHL8(b, 0);
+  /* F78D: stab a9 */
+  AOT_INSN(0xD7, 3, 0xF78E, 0xA9D6);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F78F: ldab a5 */
+  AOT_INSN(0xD6, 3, 0xF790, 0xA52A);
+  DIR8(t); b = LOGIC8(t);
+  /* F791: bpl  f795 */
+  AOT_CYCLES(10);
+  AOT_INSN(0x2A, 3, 0xF792, 0x028A);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF795)
+    goto aot_F795;
+  goto aot_F793;
+
+aot_F793: /* F793-F794 */
+  AOT_BEGIN(2);
+  /* F793: oraa #01 */
+  AOT_INSN(0x8A, 2, 0xF794, 0x01C4);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_F795;
+
+aot_F795: /* F795-F7A3 */
+  AOT_BEGIN(20);
+  /* F795: andb #7f */
+  AOT_INSN(0xC4, 2, 0xF796, 0x7FDA);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F797: orab a9 */
+  AOT_INSN(0xDA, 3, 0xF798, 0xA9D7);
+  DIR8(t); b = LOGIC8(b | t);
+  /* F799: stab a9 */
+  AOT_INSN(0xD7, 3, 0xF79A, 0xA90F);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F79B: sei */
+  AOT_INSN(0x0F, 1, 0xF79C, 0xC601);
+  ccr |= IFLAG;
+  /* F79C: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF79D, 0x01CE);
+  IMM8(t); b = LOGIC8(t);
+  /* F79E: ldx  #00a9 */
+  AOT_INSN(0xCE, 3, 0xF79F, 0x00A9);
+  IMM16(w); x = LOGIC16(w);
+  /* F7A1: jsr  fd34 */
+  AOT_CYCLES(14);
+  AOT_INSN(0xBD, 6, 0xF7A2, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F7A4: /* F7A4-F7A5 */
+  AOT_BEGIN(3);
+  /* F7A4: bra  f74f */
+  AOT_INSN(0x20, 3, 0xF7A5, 0xA971);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F74F;
+
+aot_F7A6: /* F7A6-F7AF */
+  AOT_BEGIN(14);
+  /* F7A6: aim 7fa1 */
+  AOT_INSN(0x71, 6, 0xF7A7, 0x7FA1);
+  IMM_MEM(ea, &, 1);
+  /* F7A9: ldx  #0000 */
+  AOT_INSN(0xCE, 3, 0xF7AA, 0x0000);
+  IMM16(w); x = LOGIC16(w);
+  /* F7AC: ldaa #0c */
+  AOT_INSN(0x86, 2, 0xF7AD, 0x0C97);
+  IMM8(t); a = LOGIC8(t);
+  /* F7AE: staa c5 */
+  AOT_INSN(0x97, 3, 0xF7AF, 0xC5D6);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(14);
+  goto aot_F7B0;
+
+aot_F7B0: /* F7B0-F7B5 */
+  AOT_BEGIN(9);
+  /* F7B0: ldab 9f */
+  AOT_INSN(0xD6, 3, 0xF7B1, 0x9FD4);
+  DIR8(t); b = LOGIC8(t);
+  /* F7B2: anda c5 */
+  AOT_INSN(0xD4, 3, 0xF7B3, 0xC526);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F7B4: bne  f7cd */
+  AOT_CYCLES(6);
+  AOT_INSN(0x26, 3, 0xF7B5, 0x17D6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF7CD)
+    goto aot_F7CD;
+  goto aot_F7B6;
+
+aot_F7B6: /* F7B6-F7BB */
+  AOT_BEGIN(9);
+  /* F7B6: ldab c5 */
+  AOT_INSN(0xD6, 3, 0xF7B7, 0xC5D5);
+  DIR8(t); b = LOGIC8(t);
+  /* F7B8: bita 94 */
+  AOT_INSN(0xD5, 3, 0xF7B9, 0x9427);
+  DIR8(t); (void)LOGIC8(b & t);
+  /* F7BA: beq  f7ca */
+  AOT_CYCLES(6);
+  AOT_INSN(0x27, 3, 0xF7BB, 0x0E4F);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF7CA)
+    goto aot_F7CA;
+  goto aot_F7BC;
+
+aot_F7BC: /* F7BC-F7C9 */
+  AOT_BEGIN(25);
+  /* F7BC: clra */
+  AOT_INSN(0x4F, 1, 0xF7BD, 0xA7A4);
+  a = CLR8();
+  /* F7BD: staa a4,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xA7, 4, 0xF7BE, 0xA4A7);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(20);
+  /* F7BF: staa a6,x */
+  AOT_INSN(0xA7, 4, 0xF7C0, 0xA6A7);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(16);
+  /* F7C1: staa a8,x */
+  AOT_INSN(0xA7, 4, 0xF7C2, 0xA853);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(12);
+  /* F7C3: comb */
+  AOT_INSN(0x53, 1, 0xF7C4, 0xD494);
+  b = COM8(b);
+  /* F7C4: anda 94 */
+  AOT_INSN(0xD4, 3, 0xF7C5, 0x94D7);
+  DIR8(t); b = LOGIC8(b & t);
+  /* F7C6: stab 94 */
+  AOT_INSN(0xD7, 3, 0xF7C7, 0x948D);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F7C8: bsr  f7ef */
+  AOT_CYCLES(7);
+  AOT_INSN(0x8D, 5, 0xF7C9, 0x257E);
+  IMM8(t); ea = (pc + (s_char)t) & 0xFFFF; PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  goto aot_F7EF;
+
+aot_F7CA: /* F7CA-F7CC */
+  AOT_BEGIN(3);
+  /* F7CA: jmp f85d */
+  AOT_INSN(0x7E, 3, 0xF7CB, 0xF85D);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F85D;
+
+aot_F7CD: /* F7CD-F7D0 */
+  AOT_BEGIN(6);
+  /* F7CD: cmpb c5 */
+  AOT_INSN(0xD1, 3, 0xF7CE, 0xC526);
+  DIR8(t); (void)SUB8(b, t, 0);
+  /* F7CF: bne  f7d4 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xF7D0, 0x037E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF7D4)
+    goto aot_F7D4;
+  goto aot_F7D1;
+
+aot_F7D1: /* F7D1-F7D3 */
+  AOT_BEGIN(3);
+  /* F7D1: jmp f85d */
+  AOT_INSN(0x7E, 3, 0xF7D2, 0xF85D);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F85D;
+
+aot_F7D4: /* F7D4-F7DA */
+  AOT_BEGIN(10);
+  /* F7D4: ldaa 94 */
+  AOT_INSN(0x96, 3, 0xF7D5, 0x9494);
+  DIR8(t); a = LOGIC8(t);
+  /* F7D6: anda c5 */
+  AOT_INSN(0x94, 3, 0xF7D7, 0xC511);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F7D8: cba */
+  AOT_INSN(0x11, 1, 0xF7D9, 0x2720);
+  (void)SUB8(a, b, 0);
+  /* F7D9: beq  f7fb */
+  AOT_CYCLES(7);
+  AOT_INSN(0x27, 3, 0xF7DA, 0x2043);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF7FB)
+    goto aot_F7FB;
+  goto aot_F7DB;
+
+aot_F7DB: /* F7DB-F7E2 */
+  AOT_BEGIN(13);
+  /* F7DB: coma */
+  AOT_INSN(0x43, 1, 0xF7DC, 0x9494);
+  a = COM8(a);
+  /* F7DC: anda 94 */
+  AOT_INSN(0x94, 3, 0xF7DD, 0x941B);
+  DIR8(t); a = LOGIC8(a & t);
+  /* F7DE: aba */
+  AOT_INSN(0x1B, 1, 0xF7DF, 0x9794);
+  a = ADD8(a, b, 0);
+  /* F7DF: staa 94 */
+  AOT_INSN(0x97, 3, 0xF7E0, 0x948D);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F7E1: bsr  f7ef */
+  AOT_CYCLES(8);
+  AOT_INSN(0x8D, 5, 0xF7E2, 0x0C86);
+  IMM8(t); ea = (pc + (s_char)t) & 0xFFFF; PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  goto aot_F7EF;
+
+aot_F7E3: /* F7E3-F7EA */
+  AOT_BEGIN(13);
+  /* F7E3: ldaa #64 */
+  AOT_INSN(0x86, 2, 0xF7E4, 0x64A7);
+  IMM8(t); a = LOGIC8(t);
+  /* F7E5: staa a2,x */
+  AOT_CYCLES(2);
+  AOT_INSN(0xA7, 4, 0xF7E6, 0xA2A6);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(7);
+  /* F7E7: ldaa 95,x */
+  AOT_INSN(0xA6, 4, 0xF7E8, 0x9527);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F7E9: beq  f837 */
+  AOT_INSN(0x27, 3, 0xF7EA, 0x4CA7);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF837)
+    goto aot_F837;
+  goto aot_F7EB;
+
+aot_F7EB: /* F7EB-F7EE */
+  AOT_BEGIN(7);
+  /* F7EB: staa a4,x */
+  AOT_INSN(0xA7, 4, 0xF7EC, 0xA420);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F7ED: bra  f82f */
+  AOT_INSN(0x20, 3, 0xF7EE, 0x4096);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F82F;
+
+aot_F7EF: /* F7EF-F7F2 */
+  AOT_BEGIN(6);
+  /* F7EF: ldaa a1 */
+  AOT_INSN(0x96, 3, 0xF7F0, 0xA12B);
+  DIR8(t); a = LOGIC8(t);
+  /* F7F1: bmi  f7f6 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2B, 3, 0xF7F2, 0x0384);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF7F6)
+    goto aot_F7F6;
+  goto aot_F7F3;
+
+aot_F7F3: /* F7F3-F7FA */
+  AOT_BEGIN(14);
+  /* F7F3: anda #df */
+  AOT_INSN(0x84, 2, 0xF7F4, 0xDF7D);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F7F5: tst 84bf */
+  AOT_CYCLES(2);
+  AOT_INSN(0x7D, 4, 0xF7F6, 0x84BF);
+  EXT8(t); (void)TEST8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* F7F8: staa a1 */
+  AOT_INSN(0x97, 3, 0xF7F9, 0xA139);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F7FA: rts */
+  AOT_CYCLES(3);
+  AOT_INSN(0x39, 5, 0xF7FB, 0x96A1);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F7F6: /* F7F6-F7FA */
+  AOT_BEGIN(10);
+  /* F7F6: anda #bf */
+  AOT_INSN(0x84, 2, 0xF7F7, 0xBF97);
+  IMM8(t); a = LOGIC8(a & t);
+  /* F7F8: staa a1 */
+  AOT_INSN(0x97, 3, 0xF7F9, 0xA139);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F7FA: rts */
+  AOT_CYCLES(5);
+  AOT_INSN(0x39, 5, 0xF7FB, 0x96A1);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F7FB: /* F7FB-F7FE */
+  AOT_BEGIN(6);
+  /* F7FB: ldaa a1 */
+  AOT_INSN(0x96, 3, 0xF7FC, 0xA12B);
+  DIR8(t); a = LOGIC8(t);
+  /* F7FD: bmi  f805 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2B, 3, 0xF7FE, 0x0685);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF805)
+    goto aot_F805;
+  goto aot_F7FF;
+
+aot_F7FF: /* F7FF-F802 */
+  AOT_BEGIN(5);
+  /* F7FF: bita #20 */
+  AOT_INSN(0x85, 2, 0xF800, 0x2026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F801: bne  f80d */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF802, 0x0A20);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF80D)
+    goto aot_F80D;
+  goto aot_F803;
+
+aot_F803: /* F803-F804 */
+  AOT_BEGIN(3);
+  /* F803: bra  f809 */
+  AOT_INSN(0x20, 3, 0xF804, 0x0485);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F809;
+
+aot_F805: /* F805-F808 */
+  AOT_BEGIN(5);
+  /* F805: bita #40 */
+  AOT_INSN(0x85, 2, 0xF806, 0x4026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F807: bne  f80d */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF808, 0x04E6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF80D)
+    goto aot_F80D;
+  goto aot_F809;
+
+aot_F809: /* F809-F80C */
+  AOT_BEGIN(7);
+  /* F809: ldab 95,x */
+  AOT_INSN(0xE6, 4, 0xF80A, 0x9526);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F80B: bne  f817 */
+  AOT_INSN(0x26, 3, 0xF80C, 0x0AE6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF817)
+    goto aot_F817;
+  goto aot_F80D;
+
+aot_F80D: /* F80D-F810 */
+  AOT_BEGIN(7);
+  /* F80D: ldab 99,x */
+  AOT_INSN(0xE6, 4, 0xF80E, 0x9927);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F80F: beq  f85d */
+  AOT_INSN(0x27, 3, 0xF810, 0x4CE6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF85D)
+    goto aot_F85D;
+  goto aot_F811;
+
+aot_F811: /* F811-F814 */
+  AOT_BEGIN(7);
+  /* F811: ldab a8,x */
+  AOT_INSN(0xE6, 4, 0xF812, 0xA826);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F813: bne  f85d */
+  AOT_INSN(0x26, 3, 0xF814, 0x4820);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF85D)
+    goto aot_F85D;
+  goto aot_F815;
+
+aot_F815: /* F815-F816 */
+  AOT_BEGIN(3);
+  /* F815: bra  f837 */
+  AOT_INSN(0x20, 3, 0xF816, 0x20E6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F837;
+
+aot_F817: /* F817-F81A */
+  AOT_BEGIN(7);
+  /* F817: ldab 97,x */
+  AOT_INSN(0xE6, 4, 0xF818, 0x9727);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F819: beq  f81f */
+  AOT_INSN(0x27, 3, 0xF81A, 0x04E6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF81F)
+    goto aot_F81F;
+  goto aot_F81B;
+
+aot_F81B: /* F81B-F81E */
+  AOT_BEGIN(7);
+  /* F81B: ldab a6,x */
+  AOT_INSN(0xE6, 4, 0xF81C, 0xA627);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F81D: beq  f82b */
+  AOT_INSN(0x27, 3, 0xF81E, 0x0CE6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF82B)
+    goto aot_F82B;
+  goto aot_F81F;
+
+aot_F81F: /* F81F-F822 */
+  AOT_BEGIN(7);
+  /* F81F: ldab a4,x */
+  AOT_INSN(0xE6, 4, 0xF820, 0xA426);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F821: bne  f85d */
+  AOT_INSN(0x26, 3, 0xF822, 0x3A8D);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF85D)
+    goto aot_F85D;
+  goto aot_F823;
+
+aot_F823: /* F823-F824 */
+  AOT_BEGIN(5);
+  /* F823: bsr  f86f */
+  AOT_INSN(0x8D, 5, 0xF824, 0x4AE6);
+  IMM8(t); ea = (pc + (s_char)t) & 0xFFFF; PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  goto aot_F86F;
+
+aot_F825: /* F825-F82A */
+  AOT_BEGIN(11);
+  /* F825: ldab 99,x */
+  AOT_INSN(0xE6, 4, 0xF826, 0x99E7);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(7);
+  /* F827: stab a8,x */
+  AOT_INSN(0xE7, 4, 0xF828, 0xA820);
+  EA_IX(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F829: bra  f85d */
+  AOT_INSN(0x20, 3, 0xF82A, 0x32E6);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F85D;
+
+aot_F82B: /* F82B-F82E */
+  AOT_BEGIN(7);
+  /* F82B: ldab a4,x */
+  AOT_INSN(0xE6, 4, 0xF82C, 0xA427);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F82D: beq  f835 */
+  AOT_INSN(0x27, 3, 0xF82E, 0x06E6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF835)
+    goto aot_F835;
+  goto aot_F82F;
+
+aot_F82F: /* F82F-F834 */
+  AOT_BEGIN(11);
+  /* F82F: ldab 97,x */
+  AOT_INSN(0xE6, 4, 0xF830, 0x97E7);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(7);
+  /* F831: stab a6,x */
+  AOT_INSN(0xE7, 4, 0xF832, 0xA620);
+  EA_IX(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F833: bra  f83b */
+  AOT_INSN(0x20, 3, 0xF834, 0x068D);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F83B;
+
+aot_F835: /* F835-F836 */
+  AOT_BEGIN(5);
+  /* F835: bsr  f86f */
+  AOT_INSN(0x8D, 5, 0xF836, 0x38E6);
+  IMM8(t); ea = (pc + (s_char)t) & 0xFFFF; PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  goto aot_F86F;
+
+aot_F837: /* F837-F83A */
+  AOT_BEGIN(8);
+  /* F837: ldab 99,x */
+  AOT_INSN(0xE6, 4, 0xF838, 0x99E7);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* F839: stab a8,x */
+  AOT_INSN(0xE7, 4, 0xF83A, 0xA8D6);
+  EA_IX(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(4);
+  AOT_SYNC(0);
+  goto aot_F83B;
+
+aot_F83B: /* F83B-F843 */
+  AOT_BEGIN(12);
+  /* F83B: ldab 94 */
+  AOT_INSN(0xD6, 3, 0xF83C, 0x94CE);
+  DIR8(t); b = LOGIC8(t);
+  /* F83D: ldx  #f87a */
+  AOT_INSN(0xCE, 3, 0xF83E, 0xF87A);
+  IMM16(w); x = LOGIC16(w);
+  /* F840: ldaa a1 */
+  AOT_INSN(0x96, 3, 0xF841, 0xA12B);
+  DIR8(t); a = LOGIC8(t);
+  /* F842: bmi  f848 */
+  AOT_CYCLES(9);
+  AOT_INSN(0x2B, 3, 0xF843, 0x0408);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF848)
+    goto aot_F848;
+  goto aot_F844;
+
+aot_F844: /* F844-F847 */
+  AOT_BEGIN(4);
+  /* F844: inx */
+  AOT_INSN(0x08, 1, 0xF845, 0x0854);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F845: inx */
+  AOT_INSN(0x08, 1, 0xF846, 0x5454);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* F846: lsrb */
+  AOT_INSN(0x54, 1, 0xF847, 0x5454);
+  b = SHR8(b, 0);
+  /* F847: lsrb */
+  AOT_INSN(0x54, 1, 0xF848, 0x54C4);
+  b = SHR8(b, 0);
+  AOT_CYCLES(4);
+  goto aot_F848;
+
+aot_F848: /* F848-F85B */
+  AOT_BEGIN(26);
+  /* F848: lsrb */
+  AOT_INSN(0x54, 1, 0xF849, 0xC401);
+  b = SHR8(b, 0);
+  /* F849: andb #01 */
+  AOT_INSN(0xC4, 2, 0xF84A, 0x013A);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F84B: abx */
+  AOT_INSN(0x3A, 1, 0xF84C, 0xA600);
+  x = (x + b) & 0xFFFF;
+  /* F84C: ldaa 00,x */
+  AOT_CYCLES(4);
+  AOT_INSN(0xA6, 4, 0xF84D, 0x000F);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(18);
+  /* F84E: sei */
+  AOT_INSN(0x0F, 1, 0xF84F, 0x16CA);
+  ccr |= IFLAG;
+  /* F84F: tab */
+  AOT_INSN(0x16, 1, 0xF850, 0xCA80);
+  b = LOGIC8(a);
+  /* F850: orab #80 */
+  AOT_INSN(0xCA, 2, 0xF851, 0x80D7);
+  IMM8(t); b = LOGIC8(b | t);
+  /* F852: stab c6 */
+  AOT_INSN(0xD7, 3, 0xF853, 0xC6CE);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F854: ldx  #00c6 */
+  AOT_INSN(0xCE, 3, 0xF855, 0x00C6);
+  IMM16(w); x = LOGIC16(w);
+  /* F857: ldab #01 */
+  AOT_INSN(0xC6, 2, 0xF858, 0x01BD);
+  IMM8(t); b = LOGIC8(t);
+  /* F859: jsr  fd34 */
+  AOT_CYCLES(12);
+  AOT_INSN(0xBD, 6, 0xF85A, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F85C: /* F85C-F85C */
+  AOT_BEGIN(1);
+  /* F85C: cli */
+  AOT_INSN(0x0E, 1, 0xF85D, 0x96A1);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(0);
+  goto aot_F85D;
+
+aot_F85D: /* F85D-F860 */
+  AOT_BEGIN(6);
+  /* F85D: ldaa a1 */
+  AOT_INSN(0x96, 3, 0xF85E, 0xA12B);
+  DIR8(t); a = LOGIC8(t);
+  /* F85F: bmi  f87e */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2B, 3, 0xF860, 0x1D8A);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF87E)
+    goto aot_F87E;
+  goto aot_F861;
+
+aot_F861: /* F861-F86E */
+  AOT_BEGIN(16);
+  /* F861: oraa #80 */
+  AOT_INSN(0x8A, 2, 0xF862, 0x8097);
+  IMM8(t); a = LOGIC8(a | t);
+  /* F863: staa a1 */
+  AOT_INSN(0x97, 3, 0xF864, 0xA186);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F865: ldaa #03 */
+  AOT_INSN(0x86, 2, 0xF866, 0x0397);
+  IMM8(t); a = LOGIC8(t);
+  /* F867: staa c5 */
+  AOT_INSN(0x97, 3, 0xF868, 0xC5CE);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F869: ldx  #0001 */
+  AOT_INSN(0xCE, 3, 0xF86A, 0x0001);
+  IMM16(w); x = LOGIC16(w);
+  /* F86C: jmp f7b0 */
+  AOT_CYCLES(13);
+  AOT_INSN(0x7E, 3, 0xF86D, 0xF7B0);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F7B0;
+
+aot_F86F: /* F86F-F871 */
+  AOT_BEGIN(4);
+  /* F86F: tsta */
+  AOT_INSN(0x4D, 1, 0xF870, 0x2B03);
+  (void)TEST8(a);
+  /* F870: bmi  f875 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x2B, 3, 0xF871, 0x038A);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF875)
+    goto aot_F875;
+  goto aot_F872;
+
+aot_F872: /* F872-F879 */
+  AOT_BEGIN(14);
+  /* F872: oraa #20 */
+  AOT_INSN(0x8A, 2, 0xF873, 0x207D);
+  IMM8(t); a = LOGIC8(a | t);
+  /* F874: tst 8a40 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x7D, 4, 0xF875, 0x8A40);
+  EXT8(t); (void)TEST8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* F877: staa a1 */
+  AOT_INSN(0x97, 3, 0xF878, 0xA139);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F879: rts */
+  AOT_CYCLES(3);
+  AOT_INSN(0x39, 5, 0xF87A, 0x4850);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F875: /* F875-F879 */
+  AOT_BEGIN(10);
+  /* F875: oraa #40 */
+  AOT_INSN(0x8A, 2, 0xF876, 0x4097);
+  IMM8(t); a = LOGIC8(a | t);
+  /* F877: staa a1 */
+  AOT_INSN(0x97, 3, 0xF878, 0xA139);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F879: rts */
+  AOT_CYCLES(5);
+  AOT_INSN(0x39, 5, 0xF87A, 0x4850);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F87E: /* F87E-F886 */
+  AOT_BEGIN(12);
+  /* F87E: ldaa #74 */
+  AOT_INSN(0x86, 2, 0xF87F, 0x74D6);
+  IMM8(t); a = LOGIC8(t);
+  /* F880: ldab a1 */
+  AOT_INSN(0xD6, 3, 0xF881, 0xA17B);
+  DIR8(t); b = LOGIC8(t);
+  /* F882: tim 029b */
+  AOT_INSN(0x7B, 4, 0xF883, 0x029B);
+  IMM_MEM(ea, &, 0);
+  /* F885: bne  f88f */
+  AOT_CYCLES(9);
+  AOT_INSN(0x26, 3, 0xF886, 0x08C5);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF88F)
+    goto aot_F88F;
+  goto aot_F887;
+
+aot_F887: /* F887-F88A */
+  AOT_BEGIN(5);
+  /* F887: bitb #02 */
+  AOT_INSN(0xC5, 2, 0xF888, 0x0226);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F889: bne  f89f */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF88A, 0x14CA);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF89F)
+    goto aot_F89F;
+  goto aot_F88B;
+
+aot_F88B: /* F88B-F88E */
+  AOT_BEGIN(5);
+  /* F88B: orab #02 */
+  AOT_INSN(0xCA, 2, 0xF88C, 0x0220);
+  IMM8(t); b = LOGIC8(b | t);
+  /* F88D: bra  f897 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xF88E, 0x08C5);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F897;
+
+aot_F88F: /* F88F-F892 */
+  AOT_BEGIN(5);
+  /* F88F: bitb #02 */
+  AOT_INSN(0xC5, 2, 0xF890, 0x0227);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* F891: beq  f89f */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF892, 0x0CC4);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF89F)
+    goto aot_F89F;
+  goto aot_F893;
+
+aot_F893: /* F893-F896 */
+  AOT_BEGIN(4);
+  /* F893: andb #fd */
+  AOT_INSN(0xC4, 2, 0xF894, 0xFD8A);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F895: oraa #80 */
+  AOT_INSN(0x8A, 2, 0xF896, 0x80D7);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(4);
+  goto aot_F897;
+
+aot_F897: /* F897-F89D */
+  AOT_BEGIN(11);
+  /* F897: stab a1 */
+  AOT_INSN(0xD7, 3, 0xF898, 0xA10F);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* F899: sei */
+  AOT_INSN(0x0F, 1, 0xF89A, 0x5FBD);
+  ccr |= IFLAG;
+  /* F89A: clrb */
+  AOT_INSN(0x5F, 1, 0xF89B, 0xBDFD);
+  b = CLR8();
+  /* F89B: jsr  fd34 */
+  AOT_CYCLES(5);
+  AOT_INSN(0xBD, 6, 0xF89C, 0xFD34);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD34;
+
+aot_F89E: /* F89E-F89E */
+  AOT_BEGIN(1);
+  /* F89E: cli */
+  AOT_INSN(0x0E, 1, 0xF89F, 0x7EF1);
+  ccr &= ~IFLAG; cpu_int_recheck();
+  AOT_CYCLES(1);
+  AOT_SYNC(0);
+  goto aot_F89F;
+
+aot_F89F: /* F89F-F8A1 */
+  AOT_BEGIN(3);
+  /* F89F: jmp f13a */
+  AOT_INSN(0x7E, 3, 0xF8A0, 0xF13A);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F13A;
+
+aot_F8A2: /* F8A2-F8A6 */
+  AOT_BEGIN(7);
+  /* F8A2: tim 10cb */
+  AOT_INSN(0x7B, 4, 0xF8A3, 0x10CB);
+  IMM_MEM(ea, &, 0);
+  /* F8A5: bne  f8d1 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF8A6, 0x2AD6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8D1)
+    goto aot_F8D1;
+  goto aot_F8A7;
+
+aot_F8A7: /* F8A7-F8AA */
+  AOT_BEGIN(6);
+  /* F8A7: ldab d7 */
+  AOT_INSN(0xD6, 3, 0xF8A8, 0xD72A);
+  DIR8(t); b = LOGIC8(t);
+  /* F8A9: bpl  f8d1 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xF8AA, 0x2686);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF8D1)
+    goto aot_F8D1;
+  goto aot_F8AB;
+
+aot_F8AB: /* F8AB-F8AC */
+  AOT_BEGIN(2);
+  /* F8AB: ldaa #16 */
+  AOT_INSN(0x86, 2, 0xF8AC, 0x164A);
+  IMM8(t); a = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_F8AD;
+
+aot_F8AD: /* F8AD-F8AF */
+  AOT_BEGIN(4);
+  /* F8AD: deca */
+  AOT_INSN(0x4A, 1, 0xF8AE, 0x26FD);
+  a = DEC8(a);
+  /* F8AE: bne  f8ad */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xF8AF, 0xFD96);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8AD)
+    goto aot_F8AD;
+  goto aot_F8B0;
+
+aot_F8B0: /* F8B0-F8B5 */
+  AOT_BEGIN(9);
+  /* F8B0: ldaa 03 */
+  AOT_INSN(0x96, 3, 0xF8B1, 0x0391);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(6);
+  /* F8B2: cmpa 03 */
+  AOT_INSN(0x91, 3, 0xF8B3, 0x0326);
+  DIR8(t); (void)SUB8(a, t, 0);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* F8B4: bne  f8b0 */
+  AOT_INSN(0x26, 3, 0xF8B5, 0xFA85);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8B0)
+    goto aot_F8B0;
+  goto aot_F8B6;
+
+aot_F8B6: /* F8B6-F8B9 */
+  AOT_BEGIN(5);
+  /* F8B6: bita #04 */
+  AOT_INSN(0x85, 2, 0xF8B7, 0x0427);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F8B8: beq  f8bb */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF8B9, 0x016D);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8BB)
+    goto aot_F8BB;
+  goto aot_F8BA;
+
+aot_F8BA: /* F8BA-F8C5 */
+  AOT_BEGIN(20);
+  /* F8BA: tst 0d,x */
+  AOT_INSN(0x6D, 4, 0xF8BB, 0x0D96);
+  IX8(t); (void)TEST8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(16);
+  /* F8BC: ldaa a4 */
+  AOT_INSN(0x96, 3, 0xF8BD, 0xA449);
+  DIR8(t); a = LOGIC8(t);
+  /* F8BE: rola */
+  AOT_INSN(0x49, 1, 0xF8BF, 0x97A4);
+  a = SHL8(a, CFLAGV);
+  /* F8BF: staa a4 */
+  AOT_INSN(0x97, 3, 0xF8C0, 0xA47A);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F8C1: dec 00a5 */
+  AOT_INSN(0x7A, 6, 0xF8C2, 0x00A5);
+  EXT8(t); t = DEC8(t); WR(ea, t);
+  /* F8C4: bne  f8d1 */
+  AOT_CYCLES(13);
+  AOT_INSN(0x26, 3, 0xF8C5, 0x0BC6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8D1)
+    goto aot_F8D1;
+  goto aot_F8C6;
+
+aot_F8BB: /* F8BB-F8C5 */
+  AOT_BEGIN(17);
+  /* F8BB: sec */
+  AOT_INSN(0x0D, 1, 0xF8BC, 0x96A4);
+  ccr |= CFLAG;
+  /* F8BC: ldaa a4 */
+  AOT_INSN(0x96, 3, 0xF8BD, 0xA449);
+  DIR8(t); a = LOGIC8(t);
+  /* F8BE: rola */
+  AOT_INSN(0x49, 1, 0xF8BF, 0x97A4);
+  a = SHL8(a, CFLAGV);
+  /* F8BF: staa a4 */
+  AOT_INSN(0x97, 3, 0xF8C0, 0xA47A);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* F8C1: dec 00a5 */
+  AOT_INSN(0x7A, 6, 0xF8C2, 0x00A5);
+  EXT8(t); t = DEC8(t); WR(ea, t);
+  /* F8C4: bne  f8d1 */
+  AOT_CYCLES(14);
+  AOT_INSN(0x26, 3, 0xF8C5, 0x0BC6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8D1)
+    goto aot_F8D1;
+  goto aot_F8C6;
+
+aot_F8C6: /* F8C6-F8C9 */
+  AOT_BEGIN(5);
+  /* F8C6: ldab #08 */
+  AOT_INSN(0xC6, 2, 0xF8C7, 0x08D7);
+  IMM8(t); b = LOGIC8(t);
+  /* F8C8: stab a5 */
+  AOT_INSN(0xD7, 3, 0xF8C9, 0xA57B);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(5);
+  goto aot_F8CA;
+
+aot_F8CA: /* F8CA-F8CE */
+  AOT_BEGIN(7);
+  /* F8CA: tim 2011 */
+  AOT_INSN(0x7B, 4, 0xF8CB, 0x2011);
+  IMM_MEM(ea, &, 0);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* F8CD: beq  f8ca */
+  AOT_INSN(0x27, 3, 0xF8CE, 0xFB97);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8CA)
+    goto aot_F8CA;
+  goto aot_F8CF;
+
+aot_F8CF: /* F8CF-F8D0 */
+  AOT_BEGIN(3);
+  /* F8CF: staa 13 */
+  AOT_INSN(0x97, 3, 0xF8D0, 0x137E);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  AOT_SYNC(0);
+  goto aot_F8D1;
+
+aot_F8D1: /* F8D1-F8D3 */
+  AOT_BEGIN(3);
+  /* F8D1: jmp f13a */
+  AOT_INSN(0x7E, 3, 0xF8D2, 0xF13A);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F13A;
+
+aot_F8D4: /* F8D4-F8DB */
+  AOT_BEGIN(13);
+  /* F8D4: aim 78cb */
+  AOT_INSN(0x71, 6, 0xF8D5, 0x78CB);
+  IMM_MEM(ea, &, 1);
+  /* F8D7: ldab cd */
+  AOT_INSN(0xD6, 3, 0xF8D8, 0xCD17);
+  DIR8(t); b = LOGIC8(t);
+  /* F8D9: tba */
+  AOT_INSN(0x17, 1, 0xF8DA, 0x2A17);
+  a = LOGIC8(b);
+  /* F8DA: bpl  f8f3 */
+  AOT_CYCLES(10);
+  AOT_INSN(0x2A, 3, 0xF8DB, 0x17C1);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xF8F3)
+    goto aot_F8F3;
+  goto aot_F8DC;
+
+aot_F8DC: /* F8DC-F8DF */
+  AOT_BEGIN(5);
+  /* F8DC: cmpb #80 */
+  AOT_INSN(0xC1, 2, 0xF8DD, 0x8026);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F8DE: bne  f8e3 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xF8DF, 0x037E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF8E3)
+    goto aot_F8E3;
+  goto aot_F8E0;
+
+aot_F8E0: /* F8E0-F8E2 */
+  AOT_BEGIN(3);
+  /* F8E0: jmp f990 */
+  AOT_INSN(0x7E, 3, 0xF8E1, 0xF990);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F990;
+
+aot_F8E3: /* F8E3-F8E6 */
+  AOT_BEGIN(5);
+  /* F8E3: cmpb #87 */
+  AOT_INSN(0xC1, 2, 0xF8E4, 0x8725);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F8E5: bcs  f916 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xF8E6, 0x2FC1);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF916)
+    goto aot_F916;
+  goto aot_F8E7;
+
+aot_F8E7: /* F8E7-F8EA */
+  AOT_BEGIN(5);
+  /* F8E7: cmpb #9b */
+  AOT_INSN(0xC1, 2, 0xF8E8, 0x9B24);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F8E9: bcc  f916 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x24, 3, 0xF8EA, 0x2BC4);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF916)
+    goto aot_F916;
+  goto aot_F8EB;
+
+aot_F8EB: /* F8EB-F8F2 */
+  AOT_BEGIN(9);
+  /* F8EB: andb #7f */
+  AOT_INSN(0xC4, 2, 0xF8EC, 0x7FC0);
+  IMM8(t); b = LOGIC8(b & t);
+  /* F8ED: subb #07 */
+  AOT_INSN(0xC0, 2, 0xF8EE, 0x07CB);
+  IMM8(t); b = SUB8(b, t, 0);
+  /* F8EF: addb #1c */
+  AOT_INSN(0xCB, 2, 0xF8F0, 0x1C20);
+  IMM8(t); b = ADD8(b, t, 0);
+  /* F8F1: bra  f8fd */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF8F2, 0x0AC1);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F8FD;
+
+aot_F8F3: /* F8F3-F8F6 */
+  AOT_BEGIN(5);
+  /* F8F3: cmpb #07 */
+  AOT_INSN(0xC1, 2, 0xF8F4, 0x0725);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F8F5: bcs  f916 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xF8F6, 0x1FC1);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xF916)
+    goto aot_F916;
+  goto aot_F8F7;
+
+aot_F8F7: /* F8F7-F8FA */
+  AOT_BEGIN(5);
+  /* F8F7: cmpb #23 */
+  AOT_INSN(0xC1, 2, 0xF8F8, 0x2324);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* F8F9: bcc  f916 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x24, 3, 0xF8FA, 0x1BC0);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF916)
+    goto aot_F916;
+  goto aot_F8FB;
+
+aot_F8FB: /* F8FB-F8FC */
+  AOT_BEGIN(2);
+  /* F8FB: subb #07 */
+  AOT_INSN(0xC0, 2, 0xF8FC, 0x0758);
+  IMM8(t); b = SUB8(b, t, 0);
+  AOT_CYCLES(2);
+  goto aot_F8FD;
+
+aot_F8FD: /* F8FD-F905 */
+  AOT_BEGIN(13);
+  /* F8FD: lslb */
+  AOT_INSN(0x58, 1, 0xF8FE, 0xCEF9);
+  b = SHL8(b, 0);
+  /* F8FE: ldx  #f930 */
+  AOT_INSN(0xCE, 3, 0xF8FF, 0xF930);
+  IMM16(w); x = LOGIC16(w);
+  /* F901: abx */
+  AOT_INSN(0x3A, 1, 0xF902, 0xEE00);
+  x = (x + b) & 0xFFFF;
+  /* F902: ldx  00,x */
+  AOT_CYCLES(5);
+  AOT_INSN(0xEE, 5, 0xF903, 0x0027);
+  IX16(w); x = LOGIC16(w);
+  AOT_CYCLES(5);
+  AOT_SYNC(3);
+  /* F904: beq  f916 */
+  AOT_INSN(0x27, 3, 0xF905, 0x1085);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF916)
+    goto aot_F916;
+  goto aot_F906;
+
+aot_F906: /* F906-F909 */
+  AOT_BEGIN(5);
+  /* F906: bita #80 */
+  AOT_INSN(0x85, 2, 0xF907, 0x8027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* F908: beq  f914 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xF909, 0x0A7B);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF914)
+    goto aot_F914;
+  goto aot_F90A;
+
+aot_F90A: /* F90A-F90E */
+  AOT_BEGIN(7);
+  /* F90A: tim 08cb */
+  AOT_INSN(0x7B, 4, 0xF90B, 0x08CB);
+  IMM_MEM(ea, &, 0);
+  /* F90D: bne  f916 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF90E, 0x077B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF916)
+    goto aot_F916;
+  goto aot_F90F;
+
+aot_F90F: /* F90F-F913 */
+  AOT_BEGIN(7);
+  /* F90F: tim 03ca */
+  AOT_INSN(0x7B, 4, 0xF910, 0x03CA);
+  IMM_MEM(ea, &, 0);
+  /* F912: bne  f916 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xF913, 0x026E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF916)
+    goto aot_F916;
+  goto aot_F914;
+
+aot_F914: /* F914-F915 */
+  AOT_BEGIN(3);
+  /* F914: jmp 00,x */
+  AOT_INSN(0x6E, 3, 0xF915, 0x0071);
+  EA_IX(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  AOT_EXIT();
+
+aot_F916: /* F916-F91A */
+  AOT_BEGIN(9);
+  /* F916: aim 18cb */
+  AOT_INSN(0x71, 6, 0xF917, 0x18CB);
+  IMM_MEM(ea, &, 1);
+  /* F919: bra  f929 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x20, 3, 0xF91A, 0x0E7B);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_F929;
+
+aot_F929: /* F929-F92F */
+  AOT_BEGIN(16);
+  /* F929: clr 00cc */
+  AOT_INSN(0x7F, 5, 0xF92A, 0x00CC);
+  EXT8(t); t = CLR8(); WR(ea, t);
+  /* F92C: oim 1011 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x72, 6, 0xF92D, 0x1011);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(5);
+  /* F92F: rts */
+  AOT_INSN(0x39, 5, 0xF930, 0xFAA4);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F990: /* F990-F997 */
+  AOT_BEGIN(14);
+  /* F990: aim ef11 */
+  AOT_INSN(0x71, 6, 0xF991, 0xEF11);
+  IMM_MEM(ea, &, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(8);
+  /* F993: ldab #02 */
+  AOT_INSN(0xC6, 2, 0xF994, 0x02BD);
+  IMM8(t); b = LOGIC8(t);
+  /* F995: jsr  fcfe */
+  AOT_CYCLES(2);
+  AOT_INSN(0xBD, 6, 0xF996, 0xFCFE);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FCFE;
+
+aot_F998: /* F998-F999 */
+  AOT_BEGIN(3);
+  /* F998: bcc  f9ab */
+  AOT_INSN(0x24, 3, 0xF999, 0x1196);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xF9AB)
+    goto aot_F9AB;
+  goto aot_F99A;
+
+aot_F99A: /* F99A-F99F */
+  AOT_BEGIN(8);
+  /* F99A: ldaa ce */
+  AOT_INSN(0x96, 3, 0xF99B, 0xCE81);
+  DIR8(t); a = LOGIC8(t);
+  /* F99C: cmpa #01 */
+  AOT_INSN(0x81, 2, 0xF99D, 0x0126);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* F99E: bne  f9a8 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xF99F, 0x088E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xF9A8)
+    goto aot_F9A8;
+  goto aot_F9A0;
+
+aot_F9A0: /* F9A0-F9A7 */
+  AOT_BEGIN(16);
+  /* F9A0: lds  #00ff */
+  AOT_INSN(0x8E, 3, 0xF9A1, 0x00FF);
+  IMM16(w); sp = LOGIC16(w);
+  /* F9A3: ldx  #f010 */
+  AOT_INSN(0xCE, 3, 0xF9A4, 0xF010);
+  IMM16(w); x = LOGIC16(w);
+  /* F9A6: pshx */
+  AOT_CYCLES(6);
+  AOT_INSN(0x3C, 5, 0xF9A7, 0x397E);
+  PUSHW(x);
+  AOT_CYCLES(5);
+  AOT_SYNC(5);
+  /* F9A7: rts */
+  AOT_INSN(0x39, 5, 0xF9A8, 0x7EF9);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_F9A8: /* F9A8-F9AA */
+  AOT_BEGIN(3);
+  /* F9A8: jmp f929 */
+  AOT_INSN(0x7E, 3, 0xF9A9, 0xF929);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F929;
+
+aot_F9AB: /* F9AB-F9AE */
+  AOT_BEGIN(11);
+  /* F9AB: oim 1011 */
+  AOT_INSN(0x72, 6, 0xF9AC, 0x1011);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(5);
+  /* F9AE: rts */
+  AOT_INSN(0x39, 5, 0xF9AF, 0x7B08);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FB8E: /* FB8E-FBA5 */
+  AOT_BEGIN(31);
+  /* FB8E: ldaa 07 */
+  AOT_INSN(0x96, 3, 0xFB8F, 0x0716);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(28);
+  /* FB90: tab */
+  AOT_INSN(0x16, 1, 0xFB91, 0x8403);
+  b = LOGIC8(a);
+  /* FB91: anda #03 */
+  AOT_INSN(0x84, 2, 0xFB92, 0x0397);
+  IMM8(t); a = LOGIC8(a & t);
+  /* FB93: staa be */
+  AOT_INSN(0x97, 3, 0xFB94, 0xBE54);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FB95: lsrb */
+  AOT_INSN(0x54, 1, 0xFB96, 0x54C4);
+  b = SHR8(b, 0);
+  /* FB96: lsrb */
+  AOT_INSN(0x54, 1, 0xFB97, 0xC403);
+  b = SHR8(b, 0);
+  /* FB97: andb #03 */
+  AOT_INSN(0xC4, 2, 0xFB98, 0x03D7);
+  IMM8(t); b = LOGIC8(b & t);
+  /* FB99: stab bf */
+  AOT_INSN(0xD7, 3, 0xFB9A, 0xBF5F);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* FB9B: clrb */
+  AOT_INSN(0x5F, 1, 0xFB9C, 0xD79D);
+  b = CLR8();
+  /* FB9C: stab 9d */
+  AOT_INSN(0xD7, 3, 0xFB9D, 0x9D96);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* FB9E: ldaa 03 */
+  AOT_CYCLES(17);
+  AOT_INSN(0x96, 3, 0xFB9F, 0x0384);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(8);
+  /* FBA0: anda #06 */
+  AOT_INSN(0x84, 2, 0xFBA1, 0x0697);
+  IMM8(t); a = LOGIC8(a & t);
+  /* FBA2: staa 9b */
+  AOT_INSN(0x97, 3, 0xFBA3, 0x9B27);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FBA4: beq  fbaa */
+  AOT_CYCLES(5);
+  AOT_INSN(0x27, 3, 0xFBA5, 0x0481);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFBAA)
+    goto aot_FBAA;
+  goto aot_FBA6;
+
+aot_FBA6: /* FBA6-FBA9 */
+  AOT_BEGIN(5);
+  /* FBA6: cmpa #06 */
+  AOT_INSN(0x81, 2, 0xFBA7, 0x0626);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* FBA8: bne  fbac */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFBA9, 0x0288);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFBAC)
+    goto aot_FBAC;
+  goto aot_FBAA;
+
+aot_FBAA: /* FBAA-FBAB */
+  AOT_BEGIN(2);
+  /* FBAA: eora #06 */
+  AOT_INSN(0x88, 2, 0xFBAB, 0x0697);
+  IMM8(t); a = LOGIC8(a ^ t);
+  AOT_CYCLES(2);
+  goto aot_FBAC;
+
+aot_FBAC: /* FBAC-FBAE */
+  AOT_BEGIN(8);
+  /* FBAC: staa c0 */
+  AOT_INSN(0x97, 3, 0xFBAD, 0xC039);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FBAE: rts */
+  AOT_CYCLES(3);
+  AOT_INSN(0x39, 5, 0xFBAF, 0x71FD);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FCFE: /* FCFE-FD06 */
+  AOT_BEGIN(14);
+  /* FCFE: aim ef11 */
+  AOT_INSN(0x71, 6, 0xFCFF, 0xEF11);
+  IMM_MEM(ea, &, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(8);
+  /* FD01: ldaa cb */
+  AOT_INSN(0x96, 3, 0xFD02, 0xCB85);
+  DIR8(t); a = LOGIC8(t);
+  /* FD03: bita #40 */
+  AOT_INSN(0x85, 2, 0xFD04, 0x4026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FD05: bne  fd16 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xFD06, 0x0FD1);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD16)
+    goto aot_FD16;
+  goto aot_FD07;
+
+aot_FD07: /* FD07-FD0A */
+  AOT_BEGIN(6);
+  /* FD07: cmpb cc */
+  AOT_INSN(0xD1, 3, 0xFD08, 0xCC25);
+  DIR8(t); (void)SUB8(b, t, 0);
+  /* FD09: bcs  fd16 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x25, 3, 0xFD0A, 0x0B27);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xFD16)
+    goto aot_FD16;
+  goto aot_FD0B;
+
+aot_FD0B: /* FD0B-FD0C */
+  AOT_BEGIN(3);
+  /* FD0B: beq  fd16 */
+  AOT_INSN(0x27, 3, 0xFD0C, 0x09D0);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD16)
+    goto aot_FD16;
+  goto aot_FD0D;
+
+aot_FD0D: /* FD0D-FD15 */
+  AOT_BEGIN(13);
+  /* FD0D: subb cc */
+  AOT_INSN(0xD0, 3, 0xFD0E, 0xCCDA);
+  DIR8(t); b = SUB8(b, t, 0);
+  /* FD0F: orab cb */
+  AOT_INSN(0xDA, 3, 0xFD10, 0xCBD7);
+  DIR8(t); b = LOGIC8(b | t);
+  /* FD11: stab cb */
+  AOT_INSN(0xD7, 3, 0xFD12, 0xCB0C);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* FD13: clc */
+  AOT_INSN(0x0C, 1, 0xFD14, 0x2007);
+  ccr &= ~CFLAG;
+  /* FD14: bra  fd1d */
+  AOT_CYCLES(10);
+  AOT_INSN(0x20, 3, 0xFD15, 0x0784);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FD1D;
+
+aot_FD16: /* FD16-FD1C */
+  AOT_BEGIN(8);
+  /* FD16: anda #18 */
+  AOT_INSN(0x84, 2, 0xFD17, 0x185A);
+  IMM8(t); a = LOGIC8(a & t);
+  /* FD18: decb */
+  AOT_INSN(0x5A, 1, 0xFD19, 0x1B97);
+  b = DEC8(b);
+  /* FD19: aba */
+  AOT_INSN(0x1B, 1, 0xFD1A, 0x97CB);
+  a = ADD8(a, b, 0);
+  /* FD1A: staa cb */
+  AOT_INSN(0x97, 3, 0xFD1B, 0xCB0D);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FD1C: sec */
+  AOT_INSN(0x0D, 1, 0xFD1D, 0x395F);
+  ccr |= CFLAG;
+  AOT_CYCLES(8);
+  goto aot_FD1D;
+
+aot_FD1D: /* FD1D-FD1D */
+  AOT_BEGIN(5);
+  /* FD1D: rts */
+  AOT_INSN(0x39, 5, 0xFD1E, 0x5F3C);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FD34: /* FD34-FD38 */
+  AOT_BEGIN(7);
+  /* FD34: tim 10cb */
+  AOT_INSN(0x7B, 4, 0xFD35, 0x10CB);
+  IMM_MEM(ea, &, 0);
+  /* FD37: bne  fd67 */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xFD38, 0x2ED1);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD67)
+    goto aot_FD67;
+  goto aot_FD39;
+
+aot_FD39: /* FD39-FD3C */
+  AOT_BEGIN(6);
+  /* FD39: cmpb d7 */
+  AOT_INSN(0xD1, 3, 0xFD3A, 0xD724);
+  DIR8(t); (void)SUB8(b, t, 0);
+  /* FD3B: bcc  fd67 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x24, 3, 0xFD3C, 0x2A3C);
+  BRANCH(!(ccr & CFLAG));
+  AOT_CYCLES(3);
+  if (pc == 0xFD67)
+    goto aot_FD67;
+  goto aot_FD3D;
+
+aot_FD3D: /* FD3D-FD4B */
+  AOT_BEGIN(26);
+  /* FD3D: pshx */
+  AOT_INSN(0x3C, 5, 0xFD3E, 0x184F);
+  PUSHW(x);
+  AOT_CYCLES(5);
+  AOT_SYNC(21);
+  /* FD3E: xgdx */
+  AOT_INSN(0x18, 2, 0xFD3F, 0x4FD6);
+  t = x; x = ACCD; SETD(t);
+  /* FD3F: clra */
+  AOT_INSN(0x4F, 1, 0xFD40, 0xD6D5);
+  a = CLR8();
+  /* FD40: ldab d5 */
+  AOT_INSN(0xD6, 3, 0xFD41, 0xD518);
+  DIR8(t); b = LOGIC8(t);
+  /* FD42: xgdx */
+  AOT_INSN(0x18, 2, 0xFD43, 0xA7D9);
+  t = x; x = ACCD; SETD(t);
+  /* FD43: staa d9,x */
+  AOT_CYCLES(8);
+  AOT_INSN(0xA7, 4, 0xFD44, 0xD996);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(9);
+  /* FD45: ldaa d5 */
+  AOT_INSN(0x96, 3, 0xFD46, 0xD54C);
+  DIR8(t); a = LOGIC8(t);
+  /* FD47: inca */
+  AOT_INSN(0x4C, 1, 0xFD48, 0x8115);
+  a = INC8(a);
+  /* FD48: cmpa #15 */
+  AOT_INSN(0x81, 2, 0xFD49, 0x1526);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* FD4A: bne  fd4d */
+  AOT_CYCLES(6);
+  AOT_INSN(0x26, 3, 0xFD4B, 0x014F);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD4D)
+    goto aot_FD4D;
+  goto aot_FD4C;
+
+aot_FD4C: /* FD4C-FD4C */
+  AOT_BEGIN(1);
+  /* FD4C: clra */
+  AOT_INSN(0x4F, 1, 0xFD4D, 0x97D5);
+  a = CLR8();
+  AOT_CYCLES(1);
+  goto aot_FD4D;
+
+aot_FD4D: /* FD4D-FD55 */
+  AOT_BEGIN(17);
+  /* FD4D: staa d5 */
+  AOT_INSN(0x97, 3, 0xFD4E, 0xD57A);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FD4F: dec 00d7 */
+  AOT_INSN(0x7A, 6, 0xFD50, 0x00D7);
+  EXT8(t); t = DEC8(t); WR(ea, t);
+  /* FD52: pulx */
+  AOT_CYCLES(9);
+  AOT_INSN(0x38, 4, 0xFD53, 0x5D27);
+  PULLW(x);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* FD53: tstb */
+  AOT_INSN(0x5D, 1, 0xFD54, 0x2706);
+  (void)TEST8(b);
+  /* FD54: beq  fd5c */
+  AOT_CYCLES(1);
+  AOT_INSN(0x27, 3, 0xFD55, 0x06A6);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD5C)
+    goto aot_FD5C;
+  goto aot_FD56;
+
+aot_FD56: /* FD56-FD5B */
+  AOT_BEGIN(9);
+  /* FD56: ldaa 00,x */
+  AOT_INSN(0xA6, 4, 0xFD57, 0x0008);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(5);
+  /* FD58: inx */
+  AOT_INSN(0x08, 1, 0xFD59, 0x5A20);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* FD59: decb */
+  AOT_INSN(0x5A, 1, 0xFD5A, 0x20E1);
+  b = DEC8(b);
+  /* FD5A: bra  fd3d */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xFD5B, 0xE196);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FD3D;
+
+aot_FD5C: /* FD5C-FD5F */
+  AOT_BEGIN(6);
+  /* FD5C: ldaa d7 */
+  AOT_INSN(0x96, 3, 0xFD5D, 0xD72A);
+  DIR8(t); a = LOGIC8(t);
+  /* FD5E: bpl  fd66 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xFD5F, 0x0671);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xFD66)
+    goto aot_FD66;
+  goto aot_FD60;
+
+aot_FD60: /* FD60-FD65 */
+  AOT_BEGIN(12);
+  /* FD60: aim 7fd7 */
+  AOT_INSN(0x71, 6, 0xFD61, 0x7FD7);
+  IMM_MEM(ea, &, 1);
+  /* FD63: jsr  fd68 */
+  AOT_CYCLES(6);
+  AOT_INSN(0xBD, 6, 0xFD64, 0xFD68);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD68;
+
+aot_FD66: /* FD66-FD66 */
+  AOT_BEGIN(1);
+  /* FD66: sec */
+  AOT_INSN(0x0D, 1, 0xFD67, 0x3996);
+  ccr |= CFLAG;
+  AOT_CYCLES(1);
+  goto aot_FD67;
+
+aot_FD67: /* FD67-FD67 */
+  AOT_BEGIN(5);
+  /* FD67: rts */
+  AOT_INSN(0x39, 5, 0xFD68, 0x9611);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FD68: /* FD68-FD6D */
+  AOT_BEGIN(8);
+  /* FD68: ldaa 11 */
+  AOT_INSN(0x96, 3, 0xFD69, 0x1185);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* FD6A: bita #20 */
+  AOT_INSN(0x85, 2, 0xFD6B, 0x2027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FD6C: beq  fd9c */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xFD6D, 0x2E96);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD9C)
+    goto aot_FD9C;
+  goto aot_FD6E;
+
+aot_FD6E: /* FD6E-FD75 */
+  AOT_BEGIN(11);
+  /* FD6E: ldaa d6 */
+  AOT_INSN(0x96, 3, 0xFD6F, 0xD6D6);
+  DIR8(t); a = LOGIC8(t);
+  /* FD70: ldab cb */
+  AOT_INSN(0xD6, 3, 0xFD71, 0xCBC5);
+  DIR8(t); b = LOGIC8(t);
+  /* FD72: bitb #08 */
+  AOT_INSN(0xC5, 2, 0xFD73, 0x0827);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* FD74: beq  fd7a */
+  AOT_CYCLES(8);
+  AOT_INSN(0x27, 3, 0xFD75, 0x0491);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD7A)
+    goto aot_FD7A;
+  goto aot_FD76;
+
+aot_FD76: /* FD76-FD79 */
+  AOT_BEGIN(6);
+  /* FD76: cmpa d8 */
+  AOT_INSN(0x91, 3, 0xFD77, 0xD827);
+  DIR8(t); (void)SUB8(a, t, 0);
+  /* FD78: beq  fd9c */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFD79, 0x22CE);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD9C)
+    goto aot_FD9C;
+  goto aot_FD7A;
+
+aot_FD7A: /* FD7A-FD8B */
+  AOT_BEGIN(26);
+  /* FD7A: ldx  #00d9 */
+  AOT_INSN(0xCE, 3, 0xFD7B, 0x00D9);
+  IMM16(w); x = LOGIC16(w);
+  /* FD7D: ldab d6 */
+  AOT_INSN(0xD6, 3, 0xFD7E, 0xD63A);
+  DIR8(t); b = LOGIC8(t);
+  /* FD7F: abx */
+  AOT_INSN(0x3A, 1, 0xFD80, 0xE600);
+  x = (x + b) & 0xFFFF;
+  /* FD80: ldab 00,x */
+  AOT_CYCLES(7);
+  AOT_INSN(0xE6, 4, 0xFD81, 0x00D7);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(15);
+  /* FD82: stab 13 */
+  AOT_INSN(0xD7, 3, 0xFD83, 0x1372);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(3);
+  AOT_SYNC(12);
+  /* FD84: oim 411 */
+  AOT_INSN(0x72, 6, 0xFD85, 0x0411);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(6);
+  /* FD87: inca */
+  AOT_INSN(0x4C, 1, 0xFD88, 0x8115);
+  a = INC8(a);
+  /* FD88: cmpa #15 */
+  AOT_INSN(0x81, 2, 0xFD89, 0x1526);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* FD8A: bne  fd8d */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xFD8B, 0x014F);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD8D)
+    goto aot_FD8D;
+  goto aot_FD8C;
+
+aot_FD8C: /* FD8C-FD8C */
+  AOT_BEGIN(1);
+  /* FD8C: clra */
+  AOT_INSN(0x4F, 1, 0xFD8D, 0x97D6);
+  a = CLR8();
+  AOT_CYCLES(1);
+  goto aot_FD8D;
+
+aot_FD8D: /* FD8D-FD97 */
+  AOT_BEGIN(14);
+  /* FD8D: staa d6 */
+  AOT_INSN(0x97, 3, 0xFD8E, 0xD696);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FD8F: ldaa d7 */
+  AOT_INSN(0x96, 3, 0xFD90, 0xD784);
+  DIR8(t); a = LOGIC8(t);
+  /* FD91: anda #7f */
+  AOT_INSN(0x84, 2, 0xFD92, 0x7F4C);
+  IMM8(t); a = LOGIC8(a & t);
+  /* FD93: inca */
+  AOT_INSN(0x4C, 1, 0xFD94, 0x8115);
+  a = INC8(a);
+  /* FD94: cmpa #15 */
+  AOT_INSN(0x81, 2, 0xFD95, 0x1526);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* FD96: bne  fd9a */
+  AOT_CYCLES(11);
+  AOT_INSN(0x26, 3, 0xFD97, 0x028A);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFD9A)
+    goto aot_FD9A;
+  goto aot_FD98;
+
+aot_FD98: /* FD98-FD99 */
+  AOT_BEGIN(2);
+  /* FD98: oraa #80 */
+  AOT_INSN(0x8A, 2, 0xFD99, 0x8097);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_FD9A;
+
+aot_FD9A: /* FD9A-FD9B */
+  AOT_BEGIN(3);
+  /* FD9A: staa d7 */
+  AOT_INSN(0x97, 3, 0xFD9B, 0xD739);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  goto aot_FD9C;
+
+aot_FD9C: /* FD9C-FD9C */
+  AOT_BEGIN(5);
+  /* FD9C: rts */
+  AOT_INSN(0x39, 5, 0xFD9D, 0x9608);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FD9D: /* FD9D-FDA2 */
+  AOT_BEGIN(8);
+  /* FD9D: ldaa 08 */
+  AOT_INSN(0x96, 3, 0xFD9E, 0x0885);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* FD9F: bita #40 */
+  AOT_INSN(0x85, 2, 0xFDA0, 0x4026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FDA1: bne  fda6 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFDA2, 0x037E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFDA6)
+    goto aot_FDA6;
+  goto aot_FDA3;
+
+aot_FDA3: /* FDA3-FDA5 */
+  AOT_BEGIN(3);
+  /* FDA3: jmp fecf */
+  AOT_INSN(0x7E, 3, 0xFDA4, 0xFECF);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_FECF;
+
+aot_FDA6: /* FDA6-FDAD */
+  AOT_BEGIN(12);
+  /* FDA6: ldd  09 */
+  AOT_INSN(0xDC, 4, 0xFDA7, 0x09CB);
+  DIR16(w); SETD(LOGIC16(w));
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* FDA8: addb #13 */
+  AOT_INSN(0xCB, 2, 0xFDA9, 0x13D1);
+  IMM8(t); b = ADD8(b, t, 0);
+  /* FDAA: cmpb 0c */
+  AOT_CYCLES(2);
+  AOT_INSN(0xD1, 3, 0xFDAB, 0x0C26);
+  DIR8(t); (void)SUB8(b, t, 0);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* FDAC: bne  fdaf */
+  AOT_INSN(0x26, 3, 0xFDAD, 0x0101);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFDAF)
+    goto aot_FDAF;
+  goto aot_FDAE;
+
+aot_FDAE: /* FDAE-FDAE */
+  AOT_BEGIN(1);
+  /* FDAE: nop */
+  AOT_INSN(0x01, 1, 0xFDAF, 0xDC0B);
+  ;
+  AOT_CYCLES(1);
+  goto aot_FDAF;
+
+aot_FDAF: /* FDAF-FDB9 */
+  AOT_BEGIN(17);
+  /* FDAF: ldd  0b */
+  AOT_INSN(0xDC, 4, 0xFDB0, 0x0BC3);
+  DIR16(w); SETD(LOGIC16(w));
+  AOT_CYCLES(4);
+  AOT_SYNC(13);
+  /* FDB1: addd #03e8 */
+  AOT_INSN(0xC3, 3, 0xFDB2, 0x03E8);
+  IMM16(w); SETD(ADD16(ACCD, w));
+  /* FDB4: std  0b */
+  AOT_CYCLES(3);
+  AOT_INSN(0xDD, 4, 0xFDB5, 0x0B96);
+  EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w);
+  AOT_CYCLES(4);
+  AOT_SYNC(6);
+  /* FDB6: ldaa 83 */
+  AOT_INSN(0x96, 3, 0xFDB7, 0x8326);
+  DIR8(t); a = LOGIC8(t);
+  /* FDB8: bne  fdbd */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xFDB9, 0x037E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFDBD)
+    goto aot_FDBD;
+  goto aot_FDBA;
+
+aot_FDBA: /* FDBA-FDBC */
+  AOT_BEGIN(3);
+  /* FDBA: jmp fe29 */
+  AOT_INSN(0x7E, 3, 0xFDBB, 0xFE29);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_FE29;
+
+aot_FDBD: /* FDBD-FDC3 */
+  AOT_BEGIN(12);
+  /* FDBD: ldx  80 */
+  AOT_INSN(0xDE, 4, 0xFDBE, 0x8009);
+  DIR16(w); x = LOGIC16(w);
+  /* FDBF: dex */
+  AOT_INSN(0x09, 1, 0xFDC0, 0xDF80);
+  x = (x - 1) & 0xFFFF; fz = x;
+  /* FDC0: stx  80 */
+  AOT_INSN(0xDF, 4, 0xFDC1, 0x8026);
+  EA_DIR(); (void)LOGIC16(x); WRW(ea, x);
+  /* FDC2: bne  fdba */
+  AOT_CYCLES(9);
+  AOT_INSN(0x26, 3, 0xFDC3, 0xF6CE);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFDBA)
+    goto aot_FDBA;
+  goto aot_FDC4;
+
+aot_FDC4: /* FDC4-FDCD */
+  AOT_BEGIN(12);
+  /* FDC4: ldx  #03e8 */
+  AOT_INSN(0xCE, 3, 0xFDC5, 0x03E8);
+  IMM16(w); x = LOGIC16(w);
+  /* FDC7: stx  80 */
+  AOT_INSN(0xDF, 4, 0xFDC8, 0x80CE);
+  EA_DIR(); (void)LOGIC16(x); WRW(ea, x);
+  /* FDC9: ldx  #0006 */
+  AOT_INSN(0xCE, 3, 0xFDCA, 0x0006);
+  IMM16(w); x = LOGIC16(w);
+  /* FDCC: ldab #60 */
+  AOT_INSN(0xC6, 2, 0xFDCD, 0x6009);
+  IMM8(t); b = LOGIC8(t);
+  AOT_CYCLES(12);
+  goto aot_FDCE;
+
+aot_FDCE: /* FDCE-FDD8 */
+  AOT_BEGIN(15);
+  /* FDCE: dex */
+  AOT_INSN(0x09, 1, 0xFDCF, 0xA682);
+  x = (x - 1) & 0xFFFF; fz = x;
+  /* FDCF: ldaa 82,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xA6, 4, 0xFDD0, 0x828B);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(10);
+  /* FDD1: adda #01 */
+  AOT_INSN(0x8B, 2, 0xFDD2, 0x0119);
+  IMM8(t); a = ADD8(a, t, 0);
+  /* FDD3: daa */
+  AOT_CYCLES(2);
+  AOT_INSN(0x19, 2, 0xFDD4, 0x8C00);
+  OPFUNC(daa_inh);
+  AOT_CYCLES(2);
+  AOT_SYNC(6);
+  /* FDD4: cpx  #0000 */
+  AOT_INSN(0x8C, 3, 0xFDD5, 0x0000);
+  IMM16(w); (void)SUB16(x, w);
+  /* FDD7: beq  fe27 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFDD8, 0x4E11);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE27)
+    goto aot_FE27;
+  goto aot_FDD9;
+
+aot_FDD9: /* FDD9-FDDB */
+  AOT_BEGIN(4);
+  /* FDD9: cba */
+  AOT_INSN(0x11, 1, 0xFDDA, 0x264B);
+  (void)SUB8(a, b, 0);
+  /* FDDA: bne  fe27 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xFDDB, 0x4B4F);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE27)
+    goto aot_FE27;
+  goto aot_FDDC;
+
+aot_FDDC: /* FDDC-FDE3 */
+  AOT_BEGIN(11);
+  /* FDDC: clra */
+  AOT_INSN(0x4F, 1, 0xFDDD, 0xA782);
+  a = CLR8();
+  /* FDDD: staa 82,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xA7, 4, 0xFDDE, 0x828C);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(6);
+  /* FDDF: cpx  #0005 */
+  AOT_INSN(0x8C, 3, 0xFDE0, 0x0005);
+  IMM16(w); (void)SUB16(x, w);
+  /* FDE2: beq  fdce */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFDE3, 0xEA8C);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFDCE)
+    goto aot_FDCE;
+  goto aot_FDE4;
+
+aot_FDE4: /* FDE4-FDE8 */
+  AOT_BEGIN(6);
+  /* FDE4: cpx  #0004 */
+  AOT_INSN(0x8C, 3, 0xFDE5, 0x0004);
+  IMM16(w); (void)SUB16(x, w);
+  /* FDE7: bne  fded */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xFDE8, 0x04C6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFDED)
+    goto aot_FDED;
+  goto aot_FDE9;
+
+aot_FDE9: /* FDE9-FDEC */
+  AOT_BEGIN(5);
+  /* FDE9: ldab #24 */
+  AOT_INSN(0xC6, 2, 0xFDEA, 0x2420);
+  IMM8(t); b = LOGIC8(t);
+  /* FDEB: bra  fdce */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xFDEC, 0xE18C);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FDCE;
+
+aot_FDED: /* FDED-FDF1 */
+  AOT_BEGIN(6);
+  /* FDED: cpx  #0003 */
+  AOT_INSN(0x8C, 3, 0xFDEE, 0x0003);
+  IMM16(w); (void)SUB16(x, w);
+  /* FDF0: bne  fe1e */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xFDF1, 0x2CD6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE1E)
+    goto aot_FE1E;
+  goto aot_FDF2;
+
+aot_FDF2: /* FDF2-FDF7 */
+  AOT_BEGIN(8);
+  /* FDF2: ldab 83 */
+  AOT_INSN(0xD6, 3, 0xFDF3, 0x83C1);
+  DIR8(t); b = LOGIC8(t);
+  /* FDF4: cmpb #02 */
+  AOT_INSN(0xC1, 2, 0xFDF5, 0x0226);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* FDF6: bne  fe10 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xFDF7, 0x18C6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE10)
+    goto aot_FE10;
+  goto aot_FDF8;
+
+aot_FDF8: /* FDF8-FDFF */
+  AOT_BEGIN(10);
+  /* FDF8: ldab #29 */
+  AOT_INSN(0xC6, 2, 0xFDF9, 0x2996);
+  IMM8(t); b = LOGIC8(t);
+  /* FDFA: ldaa 84 */
+  AOT_INSN(0x96, 3, 0xFDFB, 0x8481);
+  DIR8(t); a = LOGIC8(t);
+  /* FDFC: cmpa #28 */
+  AOT_INSN(0x81, 2, 0xFDFD, 0x2825);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* FDFE: bcs  fdce */
+  AOT_CYCLES(7);
+  AOT_INSN(0x25, 3, 0xFDFF, 0xCE96);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xFDCE)
+    goto aot_FDCE;
+  goto aot_FE00;
+
+aot_FE00: /* FE00-FE05 */
+  AOT_BEGIN(8);
+  /* FE00: ldaa 82 */
+  AOT_INSN(0x96, 3, 0xFE01, 0x8285);
+  DIR8(t); a = LOGIC8(t);
+  /* FE02: bita #10 */
+  AOT_INSN(0x85, 2, 0xFE03, 0x1027);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FE04: beq  fe08 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x27, 3, 0xFE05, 0x028B);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE08)
+    goto aot_FE08;
+  goto aot_FE06;
+
+aot_FE06: /* FE06-FE07 */
+  AOT_BEGIN(2);
+  /* FE06: adda #0a */
+  AOT_INSN(0x8B, 2, 0xFE07, 0x0A84);
+  IMM8(t); a = ADD8(a, t, 0);
+  AOT_CYCLES(2);
+  goto aot_FE08;
+
+aot_FE08: /* FE08-FE0B */
+  AOT_BEGIN(5);
+  /* FE08: anda #03 */
+  AOT_INSN(0x84, 2, 0xFE09, 0x0326);
+  IMM8(t); a = LOGIC8(a & t);
+  /* FE0A: bne  fdce */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFE0B, 0xC2C6);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFDCE)
+    goto aot_FDCE;
+  goto aot_FE0C;
+
+aot_FE0C: /* FE0C-FE0F */
+  AOT_BEGIN(5);
+  /* FE0C: ldab #30 */
+  AOT_INSN(0xC6, 2, 0xFE0D, 0x3020);
+  IMM8(t); b = LOGIC8(t);
+  /* FE0E: bra  fdce */
+  AOT_CYCLES(2);
+  AOT_INSN(0x20, 3, 0xFE0F, 0xBECE);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FDCE;
+
+aot_FE10: /* FE10-FE1D */
+  AOT_BEGIN(18);
+  /* FE10: ldx  #fed0 */
+  AOT_INSN(0xCE, 3, 0xFE11, 0xFED0);
+  IMM16(w); x = LOGIC16(w);
+  /* FE13: ldab 83 */
+  AOT_INSN(0xD6, 3, 0xFE14, 0x835A);
+  DIR8(t); b = LOGIC8(t);
+  /* FE15: decb */
+  AOT_INSN(0x5A, 1, 0xFE16, 0x3AE6);
+  b = DEC8(b);
+  /* FE16: abx */
+  AOT_INSN(0x3A, 1, 0xFE17, 0xE600);
+  x = (x + b) & 0xFFFF;
+  /* FE17: ldab 00,x */
+  AOT_CYCLES(8);
+  AOT_INSN(0xE6, 4, 0xFE18, 0x00CE);
+  IX8(t); b = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(6);
+  /* FE19: ldx  #0003 */
+  AOT_INSN(0xCE, 3, 0xFE1A, 0x0003);
+  IMM16(w); x = LOGIC16(w);
+  /* FE1C: bra  fdce */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xFE1D, 0xB086);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FDCE;
+
+aot_FE1E: /* FE1E-FE26 */
+  AOT_BEGIN(11);
+  /* FE1E: ldaa #01 */
+  AOT_INSN(0x86, 2, 0xFE1F, 0x01A7);
+  IMM8(t); a = LOGIC8(t);
+  /* FE20: staa 82,x */
+  AOT_CYCLES(2);
+  AOT_INSN(0xA7, 4, 0xFE21, 0x82C6);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(5);
+  /* FE22: ldab #13 */
+  AOT_INSN(0xC6, 2, 0xFE23, 0x137E);
+  IMM8(t); b = LOGIC8(t);
+  /* FE24: jmp fdce */
+  AOT_CYCLES(2);
+  AOT_INSN(0x7E, 3, 0xFE25, 0xFDCE);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_FDCE;
+
+aot_FE27: /* FE27-FE28 */
+  AOT_BEGIN(4);
+  /* FE27: staa 82,x */
+  AOT_INSN(0xA7, 4, 0xFE28, 0x8296);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(0);
+  goto aot_FE29;
+
+aot_FE29: /* FE29-FE2C */
+  AOT_BEGIN(6);
+  /* FE29: ldaa d4 */
+  AOT_INSN(0x96, 3, 0xFE2A, 0xD427);
+  DIR8(t); a = LOGIC8(t);
+  /* FE2B: beq  fe4e */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFE2C, 0x2181);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE4E)
+    goto aot_FE4E;
+  goto aot_FE2D;
+
+aot_FE2D: /* FE2D-FE30 */
+  AOT_BEGIN(5);
+  /* FE2D: cmpa #cd */
+  AOT_INSN(0x81, 2, 0xFE2E, 0xCD26);
+  IMM8(t); (void)SUB8(a, t, 0);
+  /* FE2F: bne  fe3e */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFE30, 0x0D8E);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE3E)
+    goto aot_FE3E;
+  goto aot_FE31;
+
+aot_FE31: /* FE31-FE3D */
+  AOT_BEGIN(17);
+  /* FE31: lds  #00ff */
+  AOT_INSN(0x8E, 3, 0xFE32, 0x00FF);
+  IMM16(w); sp = LOGIC16(w);
+  /* FE34: ldx  #f00b */
+  AOT_INSN(0xCE, 3, 0xFE35, 0xF00B);
+  IMM16(w); x = LOGIC16(w);
+  /* FE37: pshx */
+  AOT_CYCLES(6);
+  AOT_INSN(0x3C, 5, 0xFE38, 0x8E00);
+  PUSHW(x);
+  AOT_CYCLES(5);
+  AOT_SYNC(6);
+  /* FE38: lds  #00f8 */
+  AOT_INSN(0x8E, 3, 0xFE39, 0x00F8);
+  IMM16(w); sp = LOGIC16(w);
+  /* FE3B: jmp fecf */
+  AOT_CYCLES(3);
+  AOT_INSN(0x7E, 3, 0xFE3C, 0xFECF);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_FECF;
+
+aot_FE3E: /* FE3E-FE42 */
+  AOT_BEGIN(7);
+  /* FE3E: tim 0111 */
+  AOT_INSN(0x7B, 4, 0xFE3F, 0x0111);
+  IMM_MEM(ea, &, 0);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* FE41: bne  fe4b */
+  AOT_INSN(0x26, 3, 0xFE42, 0x084F);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE4B)
+    goto aot_FE4B;
+  goto aot_FE43;
+
+aot_FE43: /* FE43-FE4D */
+  AOT_BEGIN(20);
+  /* FE43: clra */
+  AOT_INSN(0x4F, 1, 0xFE44, 0x71EF);
+  a = CLR8();
+  /* FE44: aim efcb */
+  AOT_INSN(0x71, 6, 0xFE45, 0xEFCB);
+  IMM_MEM(ea, &, 1);
+  /* FE47: oim 411 */
+  AOT_CYCLES(7);
+  AOT_INSN(0x72, 6, 0xFE48, 0x0411);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(7);
+  /* FE4A: tst 4c,x */
+  AOT_INSN(0x6D, 4, 0xFE4B, 0x4C97);
+  IX8(t); (void)TEST8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* FE4C: staa d4 */
+  AOT_INSN(0x97, 3, 0xFE4D, 0xD4D6);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(3);
+  goto aot_FE4E;
+
+aot_FE4B: /* FE4B-FE4D */
+  AOT_BEGIN(4);
+  /* FE4B: inca */
+  AOT_INSN(0x4C, 1, 0xFE4C, 0x97D4);
+  a = INC8(a);
+  /* FE4C: staa d4 */
+  AOT_INSN(0x97, 3, 0xFE4D, 0xD4D6);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  goto aot_FE4E;
+
+aot_FE4E: /* FE4E-FE55 */
+  AOT_BEGIN(11);
+  /* FE4E: ldab ca */
+  AOT_INSN(0xD6, 3, 0xFE4F, 0xCA96);
+  DIR8(t); b = LOGIC8(t);
+  /* FE50: ldaa c9 */
+  AOT_INSN(0x96, 3, 0xFE51, 0xC985);
+  DIR8(t); a = LOGIC8(t);
+  /* FE52: bita #02 */
+  AOT_INSN(0x85, 2, 0xFE53, 0x0226);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FE54: bne  fe5f */
+  AOT_CYCLES(8);
+  AOT_INSN(0x26, 3, 0xFE55, 0x09C5);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE5F)
+    goto aot_FE5F;
+  goto aot_FE56;
+
+aot_FE56: /* FE56-FE59 */
+  AOT_BEGIN(5);
+  /* FE56: bitb #20 */
+  AOT_INSN(0xC5, 2, 0xFE57, 0x2026);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* FE58: bne  fe67 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFE59, 0x0D4D);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE67)
+    goto aot_FE67;
+  goto aot_FE5A;
+
+aot_FE5A: /* FE5A-FE5C */
+  AOT_BEGIN(4);
+  /* FE5A: tsta */
+  AOT_INSN(0x4D, 1, 0xFE5B, 0x2B11);
+  (void)TEST8(a);
+  /* FE5B: bmi  fe6e */
+  AOT_CYCLES(1);
+  AOT_INSN(0x2B, 3, 0xFE5C, 0x1120);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xFE6E)
+    goto aot_FE6E;
+  goto aot_FE5D;
+
+aot_FE5D: /* FE5D-FE5E */
+  AOT_BEGIN(3);
+  /* FE5D: bra  fec5 */
+  AOT_INSN(0x20, 3, 0xFE5E, 0x66C5);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FEC5;
+
+aot_FE5F: /* FE5F-FE62 */
+  AOT_BEGIN(5);
+  /* FE5F: bitb #20 */
+  AOT_INSN(0xC5, 2, 0xFE60, 0x2027);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* FE61: beq  fec5 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xFE62, 0x62C5);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEC5)
+    goto aot_FEC5;
+  goto aot_FE63;
+
+aot_FE63: /* FE63-FE66 */
+  AOT_BEGIN(5);
+  /* FE63: bitb #01 */
+  AOT_INSN(0xC5, 2, 0xFE64, 0x0125);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* FE65: bcs  fecf */
+  AOT_CYCLES(2);
+  AOT_INSN(0x25, 3, 0xFE66, 0x6896);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xFECF)
+    goto aot_FECF;
+  goto aot_FE67;
+
+aot_FE67: /* FE67-FE6A */
+  AOT_BEGIN(6);
+  /* FE67: ldaa 9e */
+  AOT_INSN(0x96, 3, 0xFE68, 0x9E27);
+  DIR8(t); a = LOGIC8(t);
+  /* FE69: beq  fe6e */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFE6A, 0x034C);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE6E)
+    goto aot_FE6E;
+  goto aot_FE6B;
+
+aot_FE6B: /* FE6B-FE6D */
+  AOT_BEGIN(4);
+  /* FE6B: inca */
+  AOT_INSN(0x4C, 1, 0xFE6C, 0x979E);
+  a = INC8(a);
+  /* FE6C: staa 9e */
+  AOT_INSN(0x97, 3, 0xFE6D, 0x9E96);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  goto aot_FE6E;
+
+aot_FE6E: /* FE6E-FE71 */
+  AOT_BEGIN(6);
+  /* FE6E: ldaa 9d */
+  AOT_INSN(0x96, 3, 0xFE6F, 0x9D27);
+  DIR8(t); a = LOGIC8(t);
+  /* FE70: beq  fe75 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFE71, 0x034C);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE75)
+    goto aot_FE75;
+  goto aot_FE72;
+
+aot_FE72: /* FE72-FE74 */
+  AOT_BEGIN(4);
+  /* FE72: inca */
+  AOT_INSN(0x4C, 1, 0xFE73, 0x979D);
+  a = INC8(a);
+  /* FE73: staa 9d */
+  AOT_INSN(0x97, 3, 0xFE74, 0x9DC5);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  goto aot_FE75;
+
+aot_FE75: /* FE75-FE78 */
+  AOT_BEGIN(5);
+  /* FE75: bitb #20 */
+  AOT_INSN(0xC5, 2, 0xFE76, 0x2027);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* FE77: beq  fec5 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xFE78, 0x4CC5);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEC5)
+    goto aot_FEC5;
+  goto aot_FE79;
+
+aot_FE79: /* FE79-FE7C */
+  AOT_BEGIN(5);
+  /* FE79: bitb #04 */
+  AOT_INSN(0xC5, 2, 0xFE7A, 0x0427);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* FE7B: beq  fea8 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xFE7C, 0x2BCE);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEA8)
+    goto aot_FEA8;
+  goto aot_FE7D;
+
+aot_FE7D: /* FE7D-FE7F */
+  AOT_BEGIN(3);
+  /* FE7D: ldx  #0000 */
+  AOT_INSN(0xCE, 3, 0xFE7E, 0x0000);
+  IMM16(w); x = LOGIC16(w);
+  AOT_CYCLES(3);
+  goto aot_FE80;
+
+aot_FE80: /* FE80-FE83 */
+  AOT_BEGIN(7);
+  /* FE80: ldaa a2,x */
+  AOT_INSN(0xA6, 4, 0xFE81, 0xA227);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* FE82: beq  fe8c */
+  AOT_INSN(0x27, 3, 0xFE83, 0x084A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE8C)
+    goto aot_FE8C;
+  goto aot_FE84;
+
+aot_FE84: /* FE84-FE89 */
+  AOT_BEGIN(9);
+  /* FE84: deca */
+  AOT_INSN(0x4A, 1, 0xFE85, 0xA7A2);
+  a = DEC8(a);
+  /* FE85: staa a2,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xA7, 4, 0xFE86, 0xA209);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(4);
+  /* FE87: dex */
+  AOT_INSN(0x09, 1, 0xFE88, 0x273B);
+  x = (x - 1) & 0xFFFF; fz = x;
+  /* FE88: beq  fec5 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x27, 3, 0xFE89, 0x3B20);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEC5)
+    goto aot_FEC5;
+  goto aot_FE8A;
+
+aot_FE8A: /* FE8A-FE8B */
+  AOT_BEGIN(3);
+  /* FE8A: bra  fea3 */
+  AOT_INSN(0x20, 3, 0xFE8B, 0x1786);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FEA3;
+
+aot_FE8C: /* FE8C-FE8F */
+  AOT_BEGIN(6);
+  /* FE8C: ldaa #64 */
+  AOT_INSN(0x86, 2, 0xFE8D, 0x64A7);
+  IMM8(t); a = LOGIC8(t);
+  /* FE8E: staa a2,x */
+  AOT_CYCLES(2);
+  AOT_INSN(0xA7, 4, 0xFE8F, 0xA208);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(0);
+  goto aot_FE90;
+
+aot_FE90: /* FE90-FE95 */
+  AOT_BEGIN(9);
+  /* FE90: inx */
+  AOT_INSN(0x08, 1, 0xFE91, 0x08A6);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* FE91: inx */
+  AOT_INSN(0x08, 1, 0xFE92, 0xA6A2);
+  x = (x + 1) & 0xFFFF; fz = x;
+  /* FE92: ldaa a2,x */
+  AOT_CYCLES(2);
+  AOT_INSN(0xA6, 4, 0xFE93, 0xA227);
+  IX8(t); a = LOGIC8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* FE94: beq  fe99 */
+  AOT_INSN(0x27, 3, 0xFE95, 0x034A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFE99)
+    goto aot_FE99;
+  goto aot_FE96;
+
+aot_FE96: /* FE96-FE98 */
+  AOT_BEGIN(5);
+  /* FE96: deca */
+  AOT_INSN(0x4A, 1, 0xFE97, 0xA7A2);
+  a = DEC8(a);
+  /* FE97: staa a2,x */
+  AOT_CYCLES(1);
+  AOT_INSN(0xA7, 4, 0xFE98, 0xA28C);
+  EA_IX(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(4);
+  AOT_SYNC(0);
+  goto aot_FE99;
+
+aot_FE99: /* FE99-FE9D */
+  AOT_BEGIN(6);
+  /* FE99: cpx  #0006 */
+  AOT_INSN(0x8C, 3, 0xFE9A, 0x0006);
+  IMM16(w); (void)SUB16(x, w);
+  /* FE9C: bcs  fe90 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x25, 3, 0xFE9D, 0xF28C);
+  BRANCH(ccr & CFLAG);
+  AOT_CYCLES(3);
+  if (pc == 0xFE90)
+    goto aot_FE90;
+  goto aot_FE9E;
+
+aot_FE9E: /* FE9E-FEA2 */
+  AOT_BEGIN(6);
+  /* FE9E: cpx  #0007 */
+  AOT_INSN(0x8C, 3, 0xFE9F, 0x0007);
+  IMM16(w); (void)SUB16(x, w);
+  /* FEA1: beq  fec5 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFEA2, 0x22CE);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEC5)
+    goto aot_FEC5;
+  goto aot_FEA3;
+
+aot_FEA3: /* FEA3-FEA7 */
+  AOT_BEGIN(6);
+  /* FEA3: ldx  #0001 */
+  AOT_INSN(0xCE, 3, 0xFEA4, 0x0001);
+  IMM16(w); x = LOGIC16(w);
+  /* FEA6: bra  fe80 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xFEA7, 0xD8C5);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FE80;
+
+aot_FEA8: /* FEA8-FEAB */
+  AOT_BEGIN(5);
+  /* FEA8: bitb #02 */
+  AOT_INSN(0xC5, 2, 0xFEA9, 0x0227);
+  IMM8(t); (void)LOGIC8(b & t);
+  /* FEAA: beq  fec5 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xFEAB, 0x197B);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEC5)
+    goto aot_FEC5;
+  goto aot_FEAC;
+
+aot_FEAC: /* FEAC-FEB0 */
+  AOT_BEGIN(7);
+  /* FEAC: tim 08cb */
+  AOT_INSN(0x7B, 4, 0xFEAD, 0x08CB);
+  IMM_MEM(ea, &, 0);
+  /* FEAF: bne  fecf */
+  AOT_CYCLES(4);
+  AOT_INSN(0x26, 3, 0xFEB0, 0x1E96);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFECF)
+    goto aot_FECF;
+  goto aot_FEB1;
+
+aot_FEB1: /* FEB1-FEB4 */
+  AOT_BEGIN(6);
+  /* FEB1: ldaa a6 */
+  AOT_INSN(0x96, 3, 0xFEB2, 0xA627);
+  DIR8(t); a = LOGIC8(t);
+  /* FEB3: beq  feb8 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x27, 3, 0xFEB4, 0x034A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEB8)
+    goto aot_FEB8;
+  goto aot_FEB5;
+
+aot_FEB5: /* FEB5-FEB7 */
+  AOT_BEGIN(4);
+  /* FEB5: deca */
+  AOT_INSN(0x4A, 1, 0xFEB6, 0x2009);
+  a = DEC8(a);
+  /* FEB6: bra  fec1 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x20, 3, 0xFEB7, 0x0986);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FEC1;
+
+aot_FEB8: /* FEB8-FEBD */
+  AOT_BEGIN(8);
+  /* FEB8: ldaa #0a */
+  AOT_INSN(0x86, 2, 0xFEB9, 0x0AD6);
+  IMM8(t); a = LOGIC8(t);
+  /* FEBA: ldab a7 */
+  AOT_INSN(0xD6, 3, 0xFEBB, 0xA727);
+  DIR8(t); b = LOGIC8(t);
+  /* FEBC: beq  fec1 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x27, 3, 0xFEBD, 0x035A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEC1)
+    goto aot_FEC1;
+  goto aot_FEBE;
+
+aot_FEBE: /* FEBE-FEC0 */
+  AOT_BEGIN(4);
+  /* FEBE: decb */
+  AOT_INSN(0x5A, 1, 0xFEBF, 0xD7A7);
+  b = DEC8(b);
+  /* FEBF: stab a7 */
+  AOT_INSN(0xD7, 3, 0xFEC0, 0xA797);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(4);
+  goto aot_FEC1;
+
+aot_FEC1: /* FEC1-FEC4 */
+  AOT_BEGIN(6);
+  /* FEC1: staa a6 */
+  AOT_INSN(0x97, 3, 0xFEC2, 0xA620);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FEC3: bra  fecf */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xFEC4, 0x0A96);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FECF;
+
+aot_FEC5: /* FEC5-FEC8 */
+  AOT_BEGIN(6);
+  /* FEC5: ldaa 89 */
+  AOT_INSN(0x96, 3, 0xFEC6, 0x892B);
+  DIR8(t); a = LOGIC8(t);
+  /* FEC7: bmi  fecc */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2B, 3, 0xFEC8, 0x037E);
+  BRANCH(FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xFECC)
+    goto aot_FECC;
+  goto aot_FEC9;
+
+aot_FEC9: /* FEC9-FECB */
+  AOT_BEGIN(3);
+  /* FEC9: jmp f1b7 */
+  AOT_INSN(0x7E, 3, 0xFECA, 0xF1B7);
+  EA_EXT(); pc = ea; TAKEN();
+  AOT_CYCLES(3);
+  goto aot_F1B7;
+
+aot_FECC: /* FECC-FECE */
+  AOT_BEGIN(6);
+  /* FECC: eim 8089 */
+  AOT_INSN(0x75, 6, 0xFECD, 0x8089);
+  IMM_MEM(ea, ^, 1);
+  AOT_CYCLES(6);
+  goto aot_FECF;
+
+aot_FECF: /* FECF-FECF */
+  AOT_BEGIN(10);
+  /* FECF: rti */
+  AOT_INSN(0x3B, 10, 0xFED0, 0x3229);
+  PULL(t); SET_CCR(t); PULL(b); PULL(a); PULLW(x); PULLW(pc); cpu_int_recheck(); TAKEN();
+  AOT_CYCLES(10);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FEE2: /* FEE2-FEE7 */
+  AOT_BEGIN(8);
+  /* FEE2: ldaa 11 */
+  AOT_INSN(0x96, 3, 0xFEE3, 0x1185);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(5);
+  /* FEE4: bita #40 */
+  AOT_INSN(0x85, 2, 0xFEE5, 0x4026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FEE6: bne  fef4 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFEE7, 0x0C85);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEF4)
+    goto aot_FEF4;
+  goto aot_FEE8;
+
+aot_FEE8: /* FEE8-FEEB */
+  AOT_BEGIN(5);
+  /* FEE8: bita #80 */
+  AOT_INSN(0x85, 2, 0xFEE9, 0x8026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FEEA: bne  fef1 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFEEB, 0x0585);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEF1)
+    goto aot_FEF1;
+  goto aot_FEEC;
+
+aot_FEEC: /* FEEC-FEEF */
+  AOT_BEGIN(5);
+  /* FEEC: bita #20 */
+  AOT_INSN(0x85, 2, 0xFEED, 0x2026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FEEE: bne  fef7 */
+  AOT_CYCLES(2);
+  AOT_INSN(0x26, 3, 0xFEEF, 0x073B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFEF7)
+    goto aot_FEF7;
+  goto aot_FEF0;
+
+aot_FEF0: /* FEF0-FEF0 */
+  AOT_BEGIN(10);
+  /* FEF0: rti */
+  AOT_INSN(0x3B, 10, 0xFEF1, 0x8D11);
+  PULL(t); SET_CCR(t); PULL(b); PULL(a); PULLW(x); PULLW(pc); cpu_int_recheck(); TAKEN();
+  AOT_CYCLES(10);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FEF1: /* FEF1-FEF2 */
+  AOT_BEGIN(5);
+  /* FEF1: bsr  ff04 */
+  AOT_INSN(0x8D, 5, 0xFEF2, 0x113B);
+  IMM8(t); ea = (pc + (s_char)t) & 0xFFFF; PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  goto aot_FF04;
+
+aot_FEF3: /* FEF3-FEF3 */
+  AOT_BEGIN(10);
+  /* FEF3: rti */
+  AOT_INSN(0x3B, 10, 0xFEF4, 0x8D4A);
+  PULL(t); SET_CCR(t); PULL(b); PULL(a); PULLW(x); PULLW(pc); cpu_int_recheck(); TAKEN();
+  AOT_CYCLES(10);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FEF4: /* FEF4-FEF5 */
+  AOT_BEGIN(5);
+  /* FEF4: bsr  ff40 */
+  AOT_INSN(0x8D, 5, 0xFEF5, 0x4A3B);
+  IMM8(t); ea = (pc + (s_char)t) & 0xFFFF; PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  goto aot_FF40;
+
+aot_FEF6: /* FEF6-FEF6 */
+  AOT_BEGIN(10);
+  /* FEF6: rti */
+  AOT_INSN(0x3B, 10, 0xFEF7, 0x96D7);
+  PULL(t); SET_CCR(t); PULL(b); PULL(a); PULLW(x); PULLW(pc); cpu_int_recheck(); TAKEN();
+  AOT_CYCLES(10);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FEF7: /* FEF7-FEFA */
+  AOT_BEGIN(6);
+  /* FEF7: ldaa d7 */
+  AOT_INSN(0x96, 3, 0xFEF8, 0xD72A);
+  DIR8(t); a = LOGIC8(t);
+  /* FEF9: bpl  ff00 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x2A, 3, 0xFEFA, 0x0571);
+  BRANCH(!FLAG_N);
+  AOT_CYCLES(3);
+  if (pc == 0xFF00)
+    goto aot_FF00;
+  goto aot_FEFB;
+
+aot_FEFB: /* FEFB-FEFF */
+  AOT_BEGIN(9);
+  /* FEFB: aim fb11 */
+  AOT_INSN(0x71, 6, 0xFEFC, 0xFB11);
+  IMM_MEM(ea, &, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(3);
+  /* FEFE: bra  ff03 */
+  AOT_INSN(0x20, 3, 0xFEFF, 0x03BD);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FF03;
+
+aot_FF00: /* FF00-FF02 */
+  AOT_BEGIN(6);
+  /* FF00: jsr  fd68 */
+  AOT_INSN(0xBD, 6, 0xFF01, 0xFD68);
+  EA_EXT(); PUSHW(pc); pc = ea; TAKEN();
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FD68;
+
+aot_FF03: /* FF03-FF03 */
+  AOT_BEGIN(10);
+  /* FF03: rti */
+  AOT_INSN(0x3B, 10, 0xFF04, 0xD6CC);
+  PULL(t); SET_CCR(t); PULL(b); PULL(a); PULLW(x); PULLW(pc); cpu_int_recheck(); TAKEN();
+  AOT_CYCLES(10);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FF04: /* FF04-FF09 */
+  AOT_BEGIN(9);
+  /* FF04: ldab cc */
+  AOT_INSN(0xD6, 3, 0xFF05, 0xCC96);
+  DIR8(t); b = LOGIC8(t);
+  /* FF06: ldaa 12 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x96, 3, 0xFF07, 0x1226);
+  DIR8(t); a = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(3);
+  /* FF08: bne  ff0d */
+  AOT_INSN(0x26, 3, 0xFF09, 0x035D);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF0D)
+    goto aot_FF0D;
+  goto aot_FF0A;
+
+aot_FF0A: /* FF0A-FF0C */
+  AOT_BEGIN(4);
+  /* FF0A: tstb */
+  AOT_INSN(0x5D, 1, 0xFF0B, 0x2732);
+  (void)TEST8(b);
+  /* FF0B: beq  ff3f */
+  AOT_CYCLES(1);
+  AOT_INSN(0x27, 3, 0xFF0C, 0x32C1);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF3F)
+    goto aot_FF3F;
+  goto aot_FF0D;
+
+aot_FF0D: /* FF0D-FF10 */
+  AOT_BEGIN(5);
+  /* FF0D: cmpb #07 */
+  AOT_INSN(0xC1, 2, 0xFF0E, 0x0727);
+  IMM8(t); (void)SUB8(b, t, 0);
+  /* FF0F: beq  ff3f */
+  AOT_CYCLES(2);
+  AOT_INSN(0x27, 3, 0xFF10, 0x2E96);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF3F)
+    goto aot_FF3F;
+  goto aot_FF11;
+
+aot_FF11: /* FF11-FF16 */
+  AOT_BEGIN(8);
+  /* FF11: ldaa cb */
+  AOT_INSN(0x96, 3, 0xFF12, 0xCB85);
+  DIR8(t); a = LOGIC8(t);
+  /* FF13: bita #20 */
+  AOT_INSN(0x85, 2, 0xFF14, 0x2026);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FF15: bne  ff33 */
+  AOT_CYCLES(5);
+  AOT_INSN(0x26, 3, 0xFF16, 0x1CCE);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF33)
+    goto aot_FF33;
+  goto aot_FF17;
+
+aot_FF17: /* FF17-FF25 */
+  AOT_BEGIN(22);
+  /* FF17: ldx  #00cd */
+  AOT_INSN(0xCE, 3, 0xFF18, 0x00CD);
+  IMM16(w); x = LOGIC16(w);
+  /* FF1A: abx */
+  AOT_INSN(0x3A, 1, 0xFF1B, 0xD612);
+  x = (x + b) & 0xFFFF;
+  /* FF1B: ldab 12 */
+  AOT_CYCLES(4);
+  AOT_INSN(0xD6, 3, 0xFF1C, 0x12E7);
+  DIR8(t); b = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(15);
+  /* FF1D: stab 00,x */
+  AOT_INSN(0xE7, 4, 0xFF1E, 0x007C);
+  EA_IX(); (void)LOGIC8(b); WR(ea, b);
+  AOT_CYCLES(4);
+  AOT_SYNC(11);
+  /* FF1F: inc 00cc */
+  AOT_INSN(0x7C, 6, 0xFF20, 0x00CC);
+  EXT8(t); t = INC8(t); WR(ea, t);
+  /* FF22: bita #07 */
+  AOT_INSN(0x85, 2, 0xFF23, 0x0727);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FF24: beq  ff2d */
+  AOT_CYCLES(8);
+  AOT_INSN(0x27, 3, 0xFF25, 0x074A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF2D)
+    goto aot_FF2D;
+  goto aot_FF26;
+
+aot_FF26: /* FF26-FF2A */
+  AOT_BEGIN(6);
+  /* FF26: deca */
+  AOT_INSN(0x4A, 1, 0xFF27, 0x8507);
+  a = DEC8(a);
+  /* FF27: bita #07 */
+  AOT_INSN(0x85, 2, 0xFF28, 0x0726);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FF29: bne  ff2f */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xFF2A, 0x048A);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF2F)
+    goto aot_FF2F;
+  goto aot_FF2B;
+
+aot_FF2B: /* FF2B-FF2C */
+  AOT_BEGIN(2);
+  /* FF2B: oraa #40 */
+  AOT_INSN(0x8A, 2, 0xFF2C, 0x408A);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_FF2D;
+
+aot_FF2D: /* FF2D-FF2E */
+  AOT_BEGIN(2);
+  /* FF2D: oraa #80 */
+  AOT_INSN(0x8A, 2, 0xFF2E, 0x8097);
+  IMM8(t); a = LOGIC8(a | t);
+  AOT_CYCLES(2);
+  goto aot_FF2F;
+
+aot_FF2F: /* FF2F-FF32 */
+  AOT_BEGIN(6);
+  /* FF2F: staa cb */
+  AOT_INSN(0x97, 3, 0xFF30, 0xCB20);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FF31: bra  ff3f */
+  AOT_CYCLES(3);
+  AOT_INSN(0x20, 3, 0xFF32, 0x0C4A);
+  BRANCH(1);
+  AOT_CYCLES(3);
+  goto aot_FF3F;
+
+aot_FF33: /* FF33-FF37 */
+  AOT_BEGIN(6);
+  /* FF33: deca */
+  AOT_INSN(0x4A, 1, 0xFF34, 0x8507);
+  a = DEC8(a);
+  /* FF34: bita #07 */
+  AOT_INSN(0x85, 2, 0xFF35, 0x0726);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FF36: bne  ff2f */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xFF37, 0xF784);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF2F)
+    goto aot_FF2F;
+  goto aot_FF38;
+
+aot_FF38: /* FF38-FF3E */
+  AOT_BEGIN(9);
+  /* FF38: anda #18 */
+  AOT_INSN(0x84, 2, 0xFF39, 0x1897);
+  IMM8(t); a = LOGIC8(a & t);
+  /* FF3A: staa cb */
+  AOT_INSN(0x97, 3, 0xFF3B, 0xCB4F);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FF3C: clra */
+  AOT_INSN(0x4F, 1, 0xFF3D, 0x97CC);
+  a = CLR8();
+  /* FF3D: staa cc */
+  AOT_INSN(0x97, 3, 0xFF3E, 0xCC39);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  AOT_CYCLES(9);
+  goto aot_FF3F;
+
+aot_FF3F: /* FF3F-FF3F */
+  AOT_BEGIN(5);
+  /* FF3F: rts */
+  AOT_INSN(0x39, 5, 0xFF40, 0xD612);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FF40: /* FF40-FF46 */
+  AOT_BEGIN(11);
+  /* FF40: ldab 12 */
+  AOT_INSN(0xD6, 3, 0xFF41, 0x1272);
+  DIR8(t); b = LOGIC8(t);
+  AOT_CYCLES(3);
+  AOT_SYNC(8);
+  /* FF42: oim 111 */
+  AOT_INSN(0x72, 6, 0xFF43, 0x0111);
+  IMM_MEM(ea, |, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(2);
+  /* FF45: ldaa #20 */
+  AOT_INSN(0x86, 2, 0xFF46, 0x204A);
+  IMM8(t); a = LOGIC8(t);
+  AOT_CYCLES(2);
+  goto aot_FF47;
+
+aot_FF47: /* FF47-FF49 */
+  AOT_BEGIN(4);
+  /* FF47: deca */
+  AOT_INSN(0x4A, 1, 0xFF48, 0x26FD);
+  a = DEC8(a);
+  /* FF48: bne  ff47 */
+  AOT_CYCLES(1);
+  AOT_INSN(0x26, 3, 0xFF49, 0xFD7B);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF47)
+    goto aot_FF47;
+  goto aot_FF4A;
+
+aot_FF4A: /* FF4A-FF4E */
+  AOT_BEGIN(7);
+  /* FF4A: tim 0111 */
+  AOT_INSN(0x7B, 4, 0xFF4B, 0x0111);
+  IMM_MEM(ea, &, 0);
+  AOT_CYCLES(4);
+  AOT_SYNC(3);
+  /* FF4D: beq  ff58 */
+  AOT_INSN(0x27, 3, 0xFF4E, 0x097C);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF58)
+    goto aot_FF58;
+  goto aot_FF4F;
+
+aot_FF4F: /* FF4F-FF57 */
+  AOT_BEGIN(18);
+  /* FF4F: inc 00d4 */
+  AOT_INSN(0x7C, 6, 0xFF50, 0x00D4);
+  EXT8(t); t = INC8(t); WR(ea, t);
+  /* FF52: oim 10cb */
+  AOT_INSN(0x72, 6, 0xFF53, 0x10CB);
+  IMM_MEM(ea, |, 1);
+  /* FF55: aim fb11 */
+  AOT_CYCLES(12);
+  AOT_INSN(0x71, 6, 0xFF56, 0xFB11);
+  IMM_MEM(ea, &, 1);
+  AOT_CYCLES(6);
+  AOT_SYNC(0);
+  goto aot_FF58;
+
+aot_FF58: /* FF58-FF5D */
+  AOT_BEGIN(9);
+  /* FF58: ldaa cb */
+  AOT_INSN(0x96, 3, 0xFF59, 0xCBD6);
+  DIR8(t); a = LOGIC8(t);
+  /* FF5A: ldab cc */
+  AOT_INSN(0xD6, 3, 0xFF5B, 0xCC27);
+  DIR8(t); b = LOGIC8(t);
+  /* FF5C: beq  ff63 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x27, 3, 0xFF5D, 0x054A);
+  BRANCH(FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF63)
+    goto aot_FF63;
+  goto aot_FF5E;
+
+aot_FF5E: /* FF5E-FF62 */
+  AOT_BEGIN(6);
+  /* FF5E: deca */
+  AOT_INSN(0x4A, 1, 0xFF5F, 0x8507);
+  a = DEC8(a);
+  /* FF5F: bita #07 */
+  AOT_INSN(0x85, 2, 0xFF60, 0x0726);
+  IMM8(t); (void)LOGIC8(a & t);
+  /* FF61: bne  ff69 */
+  AOT_CYCLES(3);
+  AOT_INSN(0x26, 3, 0xFF62, 0x0684);
+  BRANCH(!FLAG_Z);
+  AOT_CYCLES(3);
+  if (pc == 0xFF69)
+    goto aot_FF69;
+  goto aot_FF63;
+
+aot_FF63: /* FF63-FF6D */
+  AOT_BEGIN(18);
+  /* FF63: anda #08 */
+  AOT_INSN(0x84, 2, 0xFF64, 0x085F);
+  IMM8(t); a = LOGIC8(a & t);
+  /* FF65: clrb */
+  AOT_INSN(0x5F, 1, 0xFF66, 0xD7CC);
+  b = CLR8();
+  /* FF66: stab cc */
+  AOT_INSN(0xD7, 3, 0xFF67, 0xCC7D);
+  EA_DIR(); (void)LOGIC8(b); WR(ea, b);
+  /* FF68: tst 8a20 */
+  AOT_CYCLES(6);
+  AOT_INSN(0x7D, 4, 0xFF69, 0x8A20);
+  EXT8(t); (void)TEST8(t);
+  AOT_CYCLES(4);
+  AOT_SYNC(8);
+  /* FF6B: staa cb */
+  AOT_INSN(0x97, 3, 0xFF6C, 0xCB39);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FF6D: rts */
+  AOT_CYCLES(3);
+  AOT_INSN(0x39, 5, 0xFF6E, 0xA6FF);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+aot_FF69: /* FF69-FF6D */
+  AOT_BEGIN(10);
+  /* FF69: oraa #20 */
+  AOT_INSN(0x8A, 2, 0xFF6A, 0x2097);
+  IMM8(t); a = LOGIC8(a | t);
+  /* FF6B: staa cb */
+  AOT_INSN(0x97, 3, 0xFF6C, 0xCB39);
+  EA_DIR(); (void)LOGIC8(a); WR(ea, a);
+  /* FF6D: rts */
+  AOT_CYCLES(5);
+  AOT_INSN(0x39, 5, 0xFF6E, 0xA6FF);
+  PULLW(pc); TAKEN();
+  AOT_CYCLES(5);
+  AOT_SYNC(0);
+  AOT_EXIT();
+
+#endif /* AOT_TABLES */
@@ -0,0 +1,156 @@
+/*
+ * bcache.c - runtime block cache
+ *
+ * Between two instructions, dispatch.c accounts for the cycles, runs a
+ * timer event when one is due, stops at the end of the run and looks for
+ * interrupts. None of that can happen within a run of instructions that
+ * ends before the next timer event and the end of the run, and that
+ * touches nothing able to move the timer, raise an interrupt or stop the
+ * run: such a run executes as one superinstruction, its combined cycle
+ * cost checked once at its start.
+ *
+ * Runs start where jumps, calls, returns and taken branches land in ROM,
+ * the starts of the blocks. One is recorded when its address has been
+ * looked up BCACHE_HOT times while its entry was not hit, so the hot ones
+ * stay. A run goes on past branches, ending early when one is taken, and
+ * stops at a jump or before the first instruction that:
+ *
+ *  - writes outside internal RAM, or reads TCSR, FRC, TRCSR or RDR
+ *  - reaches memory through X or SP, whose value is only known when it
+ *    runs
+ *  - may unmask or take an interrupt, or calls out to opfunc.c
+ *
+ * The next instruction starts without the checks too; its own are made.
+ */
+#include "defs.h"
+#include "chip.h"
+#include "memory.h"
+#include "opfunc.h"
+#include "optab.h"
+#include "predecode.h"
+
+#ifdef USE_PROTOTYPES
+#include "bcache.h"
+#endif
+
+struct bcache_block bcache[BCACHE_SIZE];
+int hd6301_block_cache = 1;
+
+/*
+ * bcache_memory - whether a fixed address may be accessed within a run
+ */
+static int bcache_memory(addr, width, write)
+u_int addr, width;
+int write;
+{
+  u_int a;
+
+  for (a = addr; a < addr + width; a++) {
+    if (mem_is_iram(a))
+      continue;
+    if (write)
+      return 0;
+    if (a == TCSR || a == FRC || a == FRC + 1 || a == TRCSR || a == RDR)
+      return 0;
+  }
+  return 1;
+}
+
+/*
+ * bcache_pure - whether the next instruction may follow this one without
+ * the checks, from its pre-decoded entry
+ */
+static int bcache_pure(pd)
+const struct predecode *pd;
+{
+  u_int op = pd->op, low = op & 0x0F;
+  u_int addr, width = 1;
+  int write = 0;
+
+  if (opcodetab[op].op_func == trap)
+    return 0; /* undefined */
+  switch (op & 0xF0) {
+  case 0x20: /* a run goes on if the branch is not taken */
+    return op != 0x20;
+  case 0x60: /* indexed, jmp and jsr included */
+  case 0xA0:
+  case 0xE0:
+    return 0;
+  case 0x70:
+    if (op == 0x7e)
+      return 0; /* jmp */
+    if (op == 0x71 || op == 0x72 || op == 0x75 || op == 0x7b)
+      addr = pd->operand & 0xFF, write = op != 0x7b; /* aim oim eim tim */
+    else
+      addr = pd->operand, write = op != 0x7d;
+    return bcache_memory(addr, 1, write);
+  case 0x90:
+  case 0xD0:
+    addr = pd->operand >> 8;
+    break;
+  case 0xB0:
+  case 0xF0:
+    addr = pd->operand;
+    break;
+  default:
+    switch (op) {
+    case 0x06: /* tap */
+    case 0x0e: /* cli */
+    case 0x19: /* daa */
+    case 0x1a: /* slp */
+    case 0x32: case 0x33: case 0x36: case 0x37: case 0x38: case 0x3c:
+    case 0x39: /* rts */
+    case 0x3b: /* rti */
+    case 0x3e: /* wai */
+    case 0x3f: /* swi */
+    case 0x8d: /* bsr */
+      return 0;
+    }
+    return 1; /* inherent and immediate */
+  }
+  if (low == 0x0D && !(op & 0x40))
+    return 0; /* jsr */
+  if (low == 0x07)
+    write = 1;
+  if (low == 0x03 || low == 0x0C || low == 0x0E)
+    width = 2;
+  if (low == 0x0D || low == 0x0F)
+    width = 2, write = 1;
+  return bcache_memory(addr, width, write);
+}
+
+/*
+ * bcache_fill - record the run starting at addr (ROM) in block
+ *
+ * The instructions it counts are the ones followed by no checks, the
+ * instruction after them ends the run.
+ */
+void bcache_fill(block, addr)
+struct bcache_block *block;
+u_int addr;
+{
+  u_int fast = 0, cycles = 0, next;
+  const struct predecode *pd;
+
+  block->pc = addr;
+  while (fast < BCACHE_MAX_RUN) {
+    pd = &predecode_rom[addr - PREDECODE_ROM_START];
+    next = addr + 1 + opcodetab[pd->op].op_n_operands;
+    if (!bcache_pure(pd) || cycles + pd->cycles > 0xFF ||
+        next - PREDECODE_ROM_START >= PREDECODE_ROM_SIZE - 1)
+      break;
+    cycles += pd->cycles;
+    fast++;
+    addr = next;
+  }
+  block->fast = fast;
+  block->cycles = cycles;
+  block->contention = 0;
+}
+
+/*
+ * bcache_flush - drop all blocks
+ *
+ * For a ROM that has changed, and at a cold reset.
+ */
+void bcache_flush() { memset(bcache, 0, sizeof(bcache)); }
@@ -0,0 +1,40 @@
+/*
+ *  Runtime block cache for the threaded engine
+ */
+#ifndef H6301_BCACHE_H
+#define H6301_BCACHE_H
+
+#include "defs.h"
+
+#if defined(__STDC__) || defined(__cplusplus)
+# define P_(s) s
+#else
+# define P_(s) ()
+#endif
+
+/*
+ * One entry per hot ROM address, direct-mapped. 'fast' instructions from
+ * 'pc' on take 'cycles' cycles between them and need none of the checks
+ * dispatch.c makes between instructions; see bcache.c.
+ */
+struct bcache_block {
+  u_short pc;          /* first instruction, 0 for an empty entry */
+  u_char  fast;        /* instructions that can run as one */
+  u_char  cycles;      /* their cycles */
+  u_short contention;  /* lookups of other addresses since the last hit */
+};
+
+#define BCACHE_SIZE 512  /* entries, a power of two */
+#define BCACHE_HOT 16    /* lookups of an address that evict another */
+#define BCACHE_MAX_RUN 32
+
+#define bcache_entry(pc) (&bcache[((pc) ^ ((pc) >> 9)) & (BCACHE_SIZE - 1)])
+
+extern struct bcache_block bcache[];
+
+/* bcache.c */
+extern void bcache_fill P_((struct bcache_block *block, u_int addr));
+extern void bcache_flush P_((void));
+
+#undef P_
+#endif /* H6301_BCACHE_H */
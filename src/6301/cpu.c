@@ -10,12 +10,14 @@
 #include "reg.h"
 
 struct cpu cpu;
+int cpu_int_check = 1;
 
 cpu_reset ()
 {
   reset ();   /* chip specific reset */
   cpu_setstackmin (cpu_getstackmin ());
   cpu_setncycles (0);
+  cpu_start ();     /* also ends SLP/WAI */
   /*
    * The following suits many CPU's but could also test CPU type
    */
@@ -6,7 +6,12 @@
 
 #include "defs.h"
 
-enum cpu_states {IDLE, RUNNING};
+/*
+ * SLEEPING: after SLP, until an interrupt is requested, masked or not.
+ * WAITING: after WAI, registers already stacked, until an interrupt is
+ * requested with the I flag clear. The timer and the SCI keep running.
+ */
+enum cpu_states {IDLE, RUNNING, SLEEPING, WAITING};
 
 struct cpu {
   /*
@@ -18,6 +23,8 @@ struct cpu {
   } stack;
   COUNTER_VAR ncycles; // can wrap
   enum cpu_states state;
+  int events;         /* HD6301_EVENT_* raised during this run */
+  int event_stop;     /* the ones that end the run */
 
 #if 0
   /* 
@@ -36,6 +43,27 @@ struct cpu {
 
 extern struct cpu cpu;
 
+/*
+ * Interrupt recheck flag
+ *
+ * Set by everything that can raise or unmask an interrupt (timer compare,
+ * TCSR/TRCSR writes, received bytes, TDRE, CLI/TAP/RTI). Engines that don't
+ * poll the interrupt sources before every instruction only look at them
+ * while this is set. Only the core running the 6301 sets it: bytes from
+ * the other core are queued and taken in by sci_rx_schedule() and
+ * sci_event().
+ */
+extern int cpu_int_check;
+
+#define cpu_int_recheck() (cpu_int_check = 1)
+
+/*
+ * Raise an event for hd6301_run_until(). The engines look for the events
+ * that end the run where they look for interrupts.
+ */
+#define cpu_event(e) \
+  (((cpu.events |= (e)) & cpu.event_stop) ? cpu_int_recheck() : 0)
+
 /*
  * Function prototypes (and macros)
  */
@@ -54,7 +82,8 @@ extern struct cpu cpu;
 
 #define cpu_start()   (cpu.state = RUNNING)
 #define cpu_stop()    (cpu.state = IDLE)
-#define cpu_isrunning()   (cpu.state == RUNNING)
+#define cpu_isrunning()   (cpu.state != IDLE)
+#define cpu_isasleep()    (cpu.state >= SLEEPING)
 
 
 #if defined(__STDC__) || defined(__cplusplus)
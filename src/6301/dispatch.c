@@ -0,0 +1,882 @@
+/*
+ * dispatch.c - threaded-code execution engine
+ *
+ * Executes the same instruction set as instr_exec() and opfunc.c, with the
+ * same cycle counts and I/O access order, but from a single run loop:
+ *
+ *  - PC, SP, X, A, B and CCR live in locals for the whole run, and so
+ *    does the cycle count, in 32 bits from the start of the run
+ *  - every handler ends with its own copy of the dispatch sequence
+ *    (computed goto with GCC, a plain switch with other compilers)
+ *  - instructions come pre-decoded from predecode.c, operands included
+ *  - the interrupt sources are only looked at while cpu_int_check is set
+ *  - the wait after SLP and WAI is fast-forwarded, and so are spin loops
+ *    that can only end on a timer event or an incoming byte with
+ *    HD6301_IDLE_SKIP, see IDLE_LOOP()
+ *  - with HD6301_BLOCK_CACHE, runs of instructions at the start of hot
+ *    ROM blocks that need no checks between them execute as one, see
+ *    bcache.c and BCACHE_LOOKUP()
+ *  - with HD6301_ENGINE_AOT, the ROM code translated ahead of time by
+ *    aotgen.c (aotrom.c) runs instead, a basic block at a time, wherever
+ *    it is known; see AOT_BEGIN()
+ *
+ * The locals are written back to 'regs' and 'cpu.ncycles' before every
+ * access that may end up in an internal register handler, and on exit;
+ * 'timer_deadline' is taken again after it.
+ * The debug callstack (callstac.c) is not maintained by this engine.
+ */
+#include "chip.h"
+#include "cpu.h"
+#include "defs.h"
+#include "instr.h"
+#include "ireg.h"
+#include "memory.h"
+#include "optab.h"
+#include "predecode.h"
+#include "reg.h"
+#include "sci.h"
+#include "timer.h"
+
+#ifdef USE_PROTOTYPES
+#include "dispatch.h"
+#endif
+
+#if defined(__GNUC__) && !defined(DISPATCH_USE_SWITCH)
+#define DISPATCH_COMPUTED_GOTO
+#endif
+
+#define DISPATCH_ROM_START PREDECODE_ROM_START
+
+#if HD6301_BLOCK_CACHE
+#define DISPATCH_BCACHE
+#include "bcache.h"
+#endif
+
+#if HD6301_ENGINE == HD6301_ENGINE_AOT
+#define DISPATCH_AOT
+#define AOT_TABLES
+#include "aotrom.c"
+#undef AOT_TABLES
+
+/* The ROM in memory is the one aotrom.c was generated from */
+static int aot_valid;
+#endif
+
+/*
+ * Condition codes
+ *
+ * N and Z are lazy: 'fn' holds a value whose bit 15 is N and 'fz' a value
+ * that is 0 when Z is set, normally just the last result. Loads, stores,
+ * the ALU and the branches that follow them then never touch the CCR
+ * bits. 'ccr' holds H, I, V, C (and bits 6-7, as reg_setccr() stores
+ * them); CCR() merges the two when the full register is needed.
+ */
+#define CCR() \
+  ((ccr & ~(NFLAG | ZFLAG)) | ((fn >> 12) & NFLAG) | (fz ? 0 : ZFLAG))
+#define SET_CCR(value) \
+  (ccr = (value), fn = (ccr & NFLAG) << 12, fz = !(ccr & ZFLAG))
+
+#define NZ8(r) (fz = (r), fn = fz << 8, fz)
+#define NZ16(r) (fz = (r), fn = fz, fz)
+
+#define FLAG_N (fn & 0x8000)
+#define FLAG_Z (!fz)
+
+/*
+ * V, C and H helpers, equivalent to the alu_* functions. They return the
+ * result, N and Z are left to the macros below.
+ */
+static inline u_int dsp_add8(u_int *ccr, u_int v1, u_int v2, u_int carry) {
+  u_int r = v1 + v2 + carry;
+  *ccr = (*ccr & ~(HFLAG | VFLAG | CFLAG)) | ((r >> 8) & CFLAG) |
+         (((v1 ^ v2 ^ r ^ (r >> 1)) >> 6) & VFLAG) |
+         (((v1 ^ v2 ^ r) << 1) & HFLAG);
+  return r & 0xFF;
+}
+
+static inline u_int dsp_sub8(u_int *ccr, u_int v1, u_int v2, u_int carry) {
+  u_int r = v1 - v2 - carry;
+  *ccr = (*ccr & ~(VFLAG | CFLAG)) | ((r >> 8) & CFLAG) |
+         (((v1 ^ v2 ^ r ^ (r >> 1)) >> 6) & VFLAG);
+  return r & 0xFF;
+}
+
+static inline u_int dsp_add16(u_int *ccr, u_int v1, u_int v2) {
+  u_int r = v1 + v2;
+  *ccr = (*ccr & ~(VFLAG | CFLAG)) | ((r >> 16) & CFLAG) |
+         (((v1 ^ v2 ^ r ^ (r >> 1)) >> 14) & VFLAG);
+  return r & 0xFFFF;
+}
+
+static inline u_int dsp_sub16(u_int *ccr, u_int v1, u_int v2) {
+  u_int r = v1 - v2;
+  *ccr = (*ccr & ~(VFLAG | CFLAG)) | ((r >> 16) & CFLAG) |
+         (((v1 ^ v2 ^ r ^ (r >> 1)) >> 14) & VFLAG);
+  return r & 0xFFFF;
+}
+
+/* Shifts: C gets the bit shifted out, V = N ^ C */
+static inline u_int dsp_shl8(u_int *ccr, u_int v, u_int lsbit) {
+  u_int r = ((v << 1) & 0xFF) | (lsbit != 0);
+  *ccr = (*ccr & ~(VFLAG | CFLAG)) | ((v >> 7) & CFLAG) |
+         (((r ^ v) >> 6) & VFLAG);
+  return r;
+}
+
+static inline u_int dsp_shr8(u_int *ccr, u_int v, u_int msbit) {
+  u_int r = (v >> 1) | (msbit ? 0x80 : 0);
+  *ccr = (*ccr & ~(VFLAG | CFLAG)) | (v & CFLAG) |
+         ((((r >> 7) ^ v) << 1) & VFLAG);
+  return r;
+}
+
+static inline u_int dsp_shl16(u_int *ccr, u_int v) {
+  u_int r = (v << 1) & 0xFFFF;
+  *ccr = (*ccr & ~(VFLAG | CFLAG)) | ((v >> 15) & CFLAG) |
+         (((r ^ v) >> 14) & VFLAG);
+  return r;
+}
+
+static inline u_int dsp_shr16(u_int *ccr, u_int v) {
+  /* N is always 0, so V = C */
+  *ccr = (*ccr & ~(VFLAG | CFLAG)) | ((v & 1) ? VFLAG | CFLAG : 0);
+  return v >> 1;
+}
+
+/*
+ * Full flag updates, the value of each is the 8 or 16 bit result; cast to
+ * void where only the flags are wanted
+ */
+#define ADD8(v1, v2, c) (r_ = dsp_add8(&ccr, v1, v2, c), NZ8(r_))
+#define SUB8(v1, v2, c) (r_ = dsp_sub8(&ccr, v1, v2, c), NZ8(r_))
+#define ADD16(v1, v2) (r_ = dsp_add16(&ccr, v1, v2), NZ16(r_))
+#define SUB16(v1, v2) (r_ = dsp_sub16(&ccr, v1, v2), NZ16(r_))
+#define SHL8(v, lsbit) (r_ = dsp_shl8(&ccr, v, lsbit), NZ8(r_))
+#define SHR8(v, msbit) (r_ = dsp_shr8(&ccr, v, msbit), NZ8(r_))
+#define SHL16(v) (r_ = dsp_shl16(&ccr, v), NZ16(r_))
+#define SHR16(v) (r_ = dsp_shr16(&ccr, v), NZ16(r_))
+/* Loads, stores, and, or, eor, bit: V cleared */
+#define LOGIC8(v) (r_ = (v) & 0xFF, ccr &= ~VFLAG, NZ8(r_))
+#define LOGIC16(v) (r_ = (v), ccr &= ~VFLAG, NZ16(r_))
+/* tst: V and C cleared */
+#define TEST8(v) (ccr &= ~(VFLAG | CFLAG), NZ8(v))
+#define CLR8() (ccr &= ~(VFLAG | CFLAG), fn = 0, fz = 0)
+#define COM8(v) (r_ = ~(v) & 0xFF, ccr = (ccr & ~VFLAG) | CFLAG, NZ8(r_))
+#define INC8(v) \
+  (r_ = (v), ccr = (ccr & ~VFLAG) | (r_ == 0x7F ? VFLAG : 0), \
+   NZ8((r_ + 1) & 0xFF))
+#define DEC8(v) \
+  (r_ = (v), ccr = (ccr & ~VFLAG) | (r_ == 0x80 ? VFLAG : 0), \
+   NZ8((r_ - 1) & 0xFF))
+
+/*
+ * Cycles
+ *
+ * 'ncycles' counts from 'base', cpu.ncycles at the start of the run, and
+ * 'deadline' is timer_deadline on the same scale: the checks between
+ * instructions compare 32-bit locals. A run is at most DISPATCH_MAX_RUN
+ * cycles long, see dispatch_run().
+ */
+#define DISPATCH_MAX_RUN 0x40000000
+
+static inline u_int dispatch_deadline(COUNTER_VAR base) {
+  COUNTER_VAR d = timer_deadline - base;
+
+  return d <= 0 ? 0 : d >= 0xFFFFFFFFu ? 0xFFFFFFFFu : (u_int)d;
+}
+
+#define RESCHEDULE() (deadline = dispatch_deadline(base))
+#define TIMER_EVENT(n) (timer_event(base + ncycles, n), RESCHEDULE())
+
+/*
+ * Register write-back for the internal register handlers and opfunc.c,
+ * which may move the deadline: RESCHEDULE() once they return
+ */
+#define SYNC()                                                         \
+  (regs.pc = pc, regs.sp = sp, regs.ix = x, regs.accd.a = a,          \
+   regs.accd.b = b, regs.ccr = CCR(), cpu.ncycles = base + ncycles)
+
+#define LOAD()                                                         \
+  (pc = regs.pc, sp = regs.sp, x = regs.ix, a = regs.accd.a,          \
+   b = regs.accd.b, SET_CCR(regs.ccr))
+
+/*
+ * Memory access: pages with storage are read directly through the page
+ * table and internal RAM is written directly, everything else goes through
+ * the I/O path with the registers written back. The address arguments are
+ * evaluated more than once.
+ */
+#define IS_RAM(addr) mem_is_iram(addr)
+#define IS_ROM(addr) ((u_int)(addr) - DISPATCH_ROM_START < 0x1000u)
+
+#define RD(addr)                                             \
+  ((page = mem_rpage(addr)) ? page[(addr) & MEM_PAGE_MASK]   \
+                            : (SYNC(), IDLE_IO(addr),       \
+                               io_ = mem_getb_io(addr), RESCHEDULE(), io_))
+
+#define WR(addr, value)                      \
+  do {                                       \
+    IDLE_DIRTY();                            \
+    if (IS_RAM(addr)) {                      \
+      mem[addr] = (u_char)(value);           \
+      predecode_ram_write(addr);             \
+    } else {                                 \
+      SYNC();                                \
+      mem_putb(addr, value);                 \
+      RESCHEDULE();                          \
+      if (IS_ROM(addr)) dispatch_rom_write(addr); \
+    }                                        \
+  } while (0)
+
+/* High byte first, like mem_getw()/mem_putw() */
+#define RDW(addr, dst)                                          \
+  do {                                                          \
+    u_int o_ = (addr) & MEM_PAGE_MASK;                          \
+    if ((page = mem_rpage(addr)) && o_ != MEM_PAGE_MASK) {      \
+      dst = (page[o_] << 8) | page[o_ + 1];                     \
+    } else {                                                    \
+      u_int hi_ = RD(addr);                                     \
+      u_int lo_ = RD((addr) + 1);                               \
+      dst = (hi_ << 8) | lo_;                                   \
+    }                                                           \
+  } while (0)
+
+#define WRW(addr, value)               \
+  do {                                 \
+    WR(addr, (value) >> 8);            \
+    WR((addr) + 1, (value) & 0xFF);    \
+  } while (0)
+
+/* SP points to the first free byte */
+#define PUSH(value)               \
+  do {                            \
+    WR(sp, value);                \
+    sp = (sp - 1) & 0xFFFF;       \
+  } while (0)
+
+#define PULL(dst)                 \
+  do {                            \
+    sp = (sp + 1) & 0xFFFF;       \
+    dst = RD(sp);                 \
+  } while (0)
+
+#define PUSHW(value)              \
+  do {                            \
+    PUSH((value) & 0xFF);         \
+    PUSH((value) >> 8);           \
+  } while (0)
+
+#define PULLW(dst)                \
+  do {                            \
+    u_int hi_, lo_;               \
+    PULL(hi_);                    \
+    PULL(lo_);                    \
+    dst = (hi_ << 8) | lo_;       \
+  } while (0)
+
+/*
+ * Operands, from the pre-decoded entry, and effective address
+ */
+#define INCPC(n) (pc = (pc + (n)) & 0xFFFF)
+#define OPND8 (opnd >> 8)
+#define IMM8(dst) (dst = OPND8, INCPC(1))
+#define IMM16(dst) (dst = opnd, INCPC(2))
+#define EA_DIR() (ea = OPND8, INCPC(1))
+#define EA_EXT() (ea = opnd, INCPC(2))
+#define EA_IX() (ea = (OPND8 + x) & 0xFFFF, INCPC(1))
+
+#define DIR8(dst) (EA_DIR(), dst = RD(ea))
+#define EXT8(dst) (EA_EXT(), dst = RD(ea))
+#define IX8(dst) (EA_IX(), dst = RD(ea))
+#define DIR16(dst) do { EA_DIR(); RDW(ea, dst); } while (0)
+#define EXT16(dst) do { EA_EXT(); RDW(ea, dst); } while (0)
+#define IX16(dst) do { EA_IX(); RDW(ea, dst); } while (0)
+
+#define CFLAGV (ccr & CFLAG)
+#define ACCD ((a << 8) | b)
+#define SETD(value) (w = (value), a = (w >> 8) & 0xFF, b = w & 0xFF)
+
+#define BRANCH(cond)                                   \
+  do {                                                 \
+    s_char offs_ = (s_char)OPND8;                      \
+    if (!(cond)) {                                     \
+      INCPC(1);                                        \
+    } else {                                           \
+      if (offs_ < 0) IDLE_LOOP();                      \
+      pc = (pc + 1 + offs_) & 0xFFFF;                  \
+      TAKEN();                                         \
+    }                                                  \
+  } while (0)
+
+/*
+ * Idle loops
+ *
+ * A taken backward branch compares the registers with the ones it saw the
+ * last time it was taken. If they match and nothing in between wrote
+ * memory, called out to opfunc.c, read an input that changes by itself or
+ * got interrupted ('idle_dirty'), the next iteration will be the same
+ * again, and so will every one after it until the next timer or SCI event
+ * or the end of the run. Received bytes are SCI events too: the queue is
+ * only looked at by sci_rx_schedule() at the start of a run, a byte queued
+ * during the run goes into RDR in the next one whatever the 6301 does.
+ * Whole iterations up to the first of those are skipped by moving the
+ * cycle count, FRC follows since it is derived from it.
+ *
+ * Of the registers with a read handler, TCSR and TRCSR only change on
+ * timer events and serial transfers; FRC, RDR and the ports don't count as
+ * steady.
+ *
+ * Apart from waiting for the transmitter, the IKBD ROM spends its time
+ * scanning the keys and ports, which is never steady: on ikbd_bench's
+ * session next to nothing is skipped, while the bookkeeping costs on every
+ * taken backward branch, write and register read. It is only built with
+ * HD6301_IDLE_SKIP.
+ */
+#if HD6301_IDLE_SKIP
+#define IDLE_DIRTY() (idle_dirty = 1)
+#define IDLE_IO(addr) (idle_dirty |= !IO_STEADY(addr))
+
+#define IO_STEADY(addr)                                         \
+  ((addr) >= NIREGS || !ireg_getb_func[addr] || (addr) == TCSR || \
+   (addr) == TRCSR)
+
+#define IDLE_LOOP()                                                      \
+  do {                                                                   \
+    if (!idle_dirty && pc == idle.pc && sp == idle.sp && x == idle.x &&  \
+        ACCD == idle.d && CCR() == idle.ccr)                             \
+      ncycles = dispatch_idle_skip(ncycles, ncycles - idle.ncycles, n,   \
+                                   end, deadline);                       \
+    idle.pc = pc, idle.sp = sp, idle.x = x, idle.d = ACCD;               \
+    idle.ccr = CCR(), idle.ncycles = ncycles;                            \
+    idle_dirty = 0;                                                      \
+  } while (0)
+#else
+#define IDLE_DIRTY() ((void)0)
+#define IDLE_IO(addr) ((void)0)
+#define IDLE_LOOP() ((void)0)
+#endif
+
+/*
+ * Same stacking order as int_stack(), through PUSH() so that stacking
+ * over code in RAM drops its pre-decoded entries
+ */
+#define STACK_REGS()               \
+  do {                             \
+    PUSHW(pc);                     \
+    PUSHW(x);                      \
+    PUSH(a);                       \
+    PUSH(b);                       \
+    PUSH(CCR() | 0xC0);            \
+  } while (0)
+
+#define INTERRUPT(vector)          \
+  do {                             \
+    STACK_REGS();                  \
+    RDW(vector, pc);               \
+    ccr |= IFLAG;                  \
+  } while (0)
+
+/* aim/oim/eim/tim: opcode, immediate, address or offset */
+#define IMM_MEM(addr_expr, op, write)     \
+  do {                                    \
+    u_int imm_ = opnd >> 8;               \
+    ea = opnd & 0xFF;                     \
+    ea = (addr_expr);                     \
+    t = LOGIC8(imm_ op RD(ea));           \
+    if (write) WR(ea, t);                 \
+    INCPC(2);                             \
+  } while (0)
+
+/* Rarely used instructions run the opfunc.c implementation */
+#define OPFUNC(func) \
+  do {               \
+    IDLE_DIRTY();    \
+    SYNC();          \
+    func();          \
+    LOAD();          \
+    RESCHEDULE();    \
+  } while (0)
+
+#ifdef HD6301_STATS
+#define STATS_INSTRUCTION(op)      \
+  (hd6301_stats.instructions++, hd6301_stats.opcodes[op]++)
+#define STATS_INTERRUPT() (hd6301_stats.interrupts++)
+#define STATS_AOT_BLOCK() (hd6301_stats.aot_blocks++)
+#define STATS_AOT_INSTRUCTION() (hd6301_stats.aot_instructions++)
+#define STATS_BLOCK(what) (hd6301_stats.block_##what++)
+#else
+#define STATS_INSTRUCTION(op)
+#define STATS_INTERRUPT()
+#define STATS_AOT_BLOCK()
+#define STATS_AOT_INSTRUCTION()
+#define STATS_BLOCK(what)
+#endif
+
+/*
+ * Block cache
+ *
+ * Looked up where a jump, a call, a return or a taken branch lands in ROM
+ * (TAKEN()), and after the dispatcher's own checks. A run found there goes
+ * ahead when its cycles end before the next timer event and the end of
+ * the run: NEXT skips the checks for its next 'run_left' instructions
+ * unless one of them is a branch taken, the following one gets them
+ * again. An address that keeps missing takes the entry over. Clearing
+ * hd6301_block_cache stops the lookups, and with them the runs.
+ */
+#ifdef DISPATCH_BCACHE
+#define BCACHE_LOOKUP()                                              \
+  do {                                                               \
+    if (!hd6301_block_cache) break;                                  \
+    blk = bcache_entry(pc);                                          \
+    STATS_BLOCK(lookups);                                            \
+    if (blk->pc == pc) {                                             \
+      blk->contention = 0;                                           \
+      if (ncycles + blk->cycles < deadline &&                        \
+          ncycles + blk->cycles < end) {                             \
+        run_left = blk->fast;                                        \
+        STATS_BLOCK(runs);                                           \
+      }                                                              \
+    } else if (++blk->contention >= BCACHE_HOT) {                    \
+      bcache_fill(blk, pc);                                          \
+      STATS_BLOCK(fills);                                            \
+    }                                                                \
+  } while (0)
+
+/* Within a run: straight on to the next instruction */
+#define BCACHE_NEXT()                                                \
+  do {                                                               \
+    if (run_left) {                                                  \
+      run_left--;                                                    \
+      STATS_BLOCK(instructions);                                     \
+      pd = &predecode_rom[pc - DISPATCH_ROM_START];                  \
+      EXECUTE();                                                     \
+    }                                                                \
+  } while (0)
+
+/* The PC has been moved: NEXT, with a lookup, at 'taken' */
+#define TAKEN() goto taken
+#else
+#define BCACHE_LOOKUP()
+#define BCACHE_NEXT()
+#define TAKEN()
+#endif
+
+/*
+ * Translated ROM code
+ *
+ * A block of aotrom.c runs only when none of its instructions can reach a
+ * timer event or the end of the run, which is known from its cycle count
+ * up front: AOT_BEGIN() leaves it to the interpreter otherwise. Within the
+ * block, the cycles of instructions touching nothing but registers, RAM
+ * and ROM are added up and accounted for at once, before anything that
+ * could look at the count. After an access that may have gone to an I/O
+ * handler, or anything that may change the interrupt state, AOT_SYNC()
+ * does what NEXT does, and goes back to the interpreter if a handler
+ * brought the next timer event forward into the rest of the block.
+ */
+#ifdef DISPATCH_AOT
+#define AOT_ROM_WRITE() (aot_valid = 0)
+#define AOT_LOOKUP()                                            \
+  do {                                                          \
+    if (aot_valid && (aot_block = aot_index[pc - DISPATCH_ROM_START])) \
+      goto aot_enter;                                           \
+  } while (0)
+
+#define AOT_BEGIN(cycles)                                       \
+  do {                                                          \
+    if (cpu_int_check) goto check;                              \
+    if (ncycles + (cycles) >= deadline ||                       \
+        ncycles + (cycles) >= end)                              \
+      goto interp;                                              \
+    STATS_AOT_BLOCK();                                          \
+  } while (0)
+
+/* Same state as EXECUTE() leaves, with the operands known */
+#define AOT_INSN(code, cycles, next_pc, operand)                \
+  do {                                                          \
+    op = (code);                                                \
+    n = (cycles);                                               \
+    opnd = (operand);                                           \
+    pc = (next_pc);                                             \
+    STATS_INSTRUCTION(op);                                      \
+    STATS_AOT_INSTRUCTION();                                    \
+  } while (0)
+
+#define AOT_CYCLES(cycles) (ncycles += (cycles))
+
+#define AOT_SYNC(rest)                                          \
+  do {                                                          \
+    if (ncycles >= deadline) {                                  \
+      TIMER_EVENT(n);                                           \
+      IDLE_DIRTY();                                             \
+    }                                                           \
+    if (ncycles >= end || cpu_int_check) goto check;            \
+    if (ncycles + (rest) >= deadline ||                         \
+        ncycles + (rest) >= end)                                \
+      goto interp;                                              \
+  } while (0)
+
+/* To an address with no block: RAM, or a jump computed at run time */
+#define AOT_EXIT()                                              \
+  do {                                                          \
+    if (cpu_int_check) goto check;                              \
+    goto fetch;                                                 \
+  } while (0)
+#else
+#define AOT_ROM_WRITE()
+#define AOT_LOOKUP()
+#endif
+
+/*
+ * Dispatch
+ */
+#ifdef DISPATCH_COMPUTED_GOTO
+#define OP(code, ...) op_##code: __VA_ARGS__; NEXT;
+#define TRAP(code) op_##code: goto op_trap;
+#define JUMP() goto *dispatch_table[op]
+#else
+#define OP(code, ...) case 0x##code: __VA_ARGS__; NEXT;
+#define TRAP(code) case 0x##code: goto op_trap;
+#define JUMP() goto execute
+#endif
+
+#define EXECUTE()                       \
+  do {                                  \
+    op = pd->op;                        \
+    n = pd->cycles;                     \
+    opnd = pd->operand;                 \
+    STATS_INSTRUCTION(op);              \
+    INCPC(1);                           \
+    JUMP();                             \
+  } while (0)
+
+/* Account for the instruction just executed and start the next one */
+#define NEXT                                                    \
+  do {                                                          \
+    ncycles += n;                                               \
+    BCACHE_NEXT();                                              \
+    if (ncycles >= deadline) {                                  \
+      TIMER_EVENT(n);                                           \
+      IDLE_DIRTY();                                             \
+    }                                                           \
+    if (ncycles >= end || cpu_int_check) goto check;            \
+    if ((u_int)(pc - DISPATCH_ROM_START) >= 0xFFF) goto fetch;  \
+    AOT_LOOKUP();                                               \
+    pd = &predecode_rom[pc - DISPATCH_ROM_START];               \
+    EXECUTE();                                                  \
+  } while (0)
+
+#define L16(h)                                                        \
+  &&op_##h##0, &&op_##h##1, &&op_##h##2, &&op_##h##3, &&op_##h##4,    \
+  &&op_##h##5, &&op_##h##6, &&op_##h##7, &&op_##h##8, &&op_##h##9,    \
+  &&op_##h##a, &&op_##h##b, &&op_##h##c, &&op_##h##d, &&op_##h##e,    \
+  &&op_##h##f
+
+#if HD6301_IDLE_SKIP
+/*
+ * dispatch_idle_skip - fast-forward an idle loop
+ *
+ * 'ncycles' is the count before the loop's branch (which takes 'n' more),
+ * 'period' the length of one iteration. Returns the new count, which
+ * leaves the branch ending before both 'deadline' and 'end'.
+ */
+static u_int dispatch_idle_skip(u_int ncycles, u_int period, u_int n,
+                                u_int end, u_int deadline) {
+  u_int limit = end < deadline ? end : deadline;
+  u_int room, skipped;
+
+  if (limit <= ncycles + n) return ncycles;
+  room = limit - (ncycles + n) - 1;
+  if (!period || room < period) return ncycles;
+  skipped = room - room % period;
+  hd6301_skipped.idle_cycles += skipped;
+  return ncycles + skipped;
+}
+#endif
+
+/*
+ * dispatch_rom_build - called once the ROM image is in place, and when it
+ * has been changed behind the CPU's back
+ *
+ * The translated code is only used for the ROM it was generated from.
+ */
+void dispatch_rom_build() {
+#ifdef DISPATCH_AOT
+  u_long hash = 2166136261u; /* FNV-1a, as aotgen.c */
+  u_int addr;
+
+  for (addr = DISPATCH_ROM_START; addr <= 0xFFFF; addr++)
+    hash = ((hash ^ mem_getb(addr)) * 16777619u) & 0xFFFFFFFFu;
+  aot_valid = hash == AOT_ROM_HASH;
+#endif
+#ifdef DISPATCH_BCACHE
+  bcache_flush();
+#endif
+}
+
+/*
+ * dispatch_rom_write - a program has written to the ROM
+ *
+ * The real chip ignores these writes but mem_putb() doesn't.
+ */
+static void dispatch_rom_write(addr)
+u_int addr;
+{
+  predecode_rom_write(addr);
+#ifdef DISPATCH_BCACHE
+  bcache_flush();
+#endif
+  AOT_ROM_WRITE();
+}
+
+/*
+ * dispatch_slice - dispatch_run() for up to DISPATCH_MAX_RUN cycles
+ */
+static u_int dispatch_slice(u_int clocks) {
+#ifdef DISPATCH_COMPUTED_GOTO
+  static const void *const dispatch_table[256] = {
+      L16(0), L16(1), L16(2), L16(3), L16(4), L16(5), L16(6), L16(7),
+      L16(8), L16(9), L16(a), L16(b), L16(c), L16(d), L16(e), L16(f)};
+#endif
+  u_char *const mem = ram;
+  const u_char *page;
+  u_int pc, sp, x, a, b, ccr, fn, fz;
+  const struct predecode *pd;
+  struct predecode uncached;
+  u_int op, opnd, n = 0, ea, t, w, r_, io_;
+#ifdef DISPATCH_BCACHE
+  struct bcache_block *blk;
+  u_int run_left = 0;
+#endif
+#ifdef DISPATCH_AOT
+  u_int aot_block;
+#endif
+#if HD6301_IDLE_SKIP
+  struct {
+    u_int pc, sp, x, d, ccr, ncycles;
+  } idle = {0};
+  u_int idle_dirty = 1;
+#endif
+  const COUNTER_VAR base = cpu.ncycles;
+  u_int ncycles = 0, end = clocks, deadline;
+
+  LOAD();
+  RESCHEDULE();
+  cpu_int_recheck();  // state may have been changed by the caller
+  predecode_ram_flush();
+
+check:
+  IDLE_DIRTY();
+#ifdef DISPATCH_BCACHE
+  run_left = 0;
+#endif
+  if (crashed || ncycles >= end || (cpu.events & cpu.event_stop)) goto out;
+  if (cpu_isasleep()) {
+    /* as instr_exec(), without going through the wait cycle by cycle */
+    u_int vector = int_pending();
+    if (vector && cpu.state == SLEEPING) {
+      cpu_start();
+      cpu_int_recheck();
+    } else if (vector && !(ccr & IFLAG)) {
+      cpu_start();
+      RDW(vector, pc);
+      ccr |= IFLAG;
+      STATS_INTERRUPT();
+      n = INSTR_WAI_WAKE_CYCLES;
+      ncycles += n;
+      if (ncycles >= deadline) TIMER_EVENT(n);
+      goto check;
+    } else {
+      /*
+       * Nothing changes before the next timer or SCI event or the end of
+       * the run. A byte queued before the run is an SCI event, scheduled
+       * by sci_rx_schedule(); one queued during the run only goes into RDR
+       * at the start of the next, and only wakes SLP or WAI there, the
+       * same as a running program first sees it there
+       */
+      u_int next = end < deadline ? end : deadline;
+      hd6301_skipped.sleep_cycles += next - ncycles;
+      ncycles = next;
+      if (ncycles >= deadline) TIMER_EVENT(1);
+      goto check;
+    }
+  }
+  if (cpu_int_check) {
+    // clear first: an interrupt source changed below sets it again
+    cpu_int_check = 0;
+    if (!(ccr & IFLAG)) {
+      u_int vector = 0;
+      if ((iram[TCSR] & OCF) && (iram[TCSR] & EOCI))
+        vector = OCFVECTOR;
+      else if (serial_int())
+        vector = SCIVECTOR;
+      if (vector) {
+        INTERRUPT(vector);
+        STATS_INTERRUPT();
+        n = opcodetab[0x3f].op_n_cycles; /* as instr_exec() */
+        ncycles += n;
+        if (ncycles >= deadline) TIMER_EVENT(n);
+        goto check;
+      }
+    }
+  }
+
+fetch:
+#ifdef DISPATCH_AOT
+  if ((u_int)(pc - DISPATCH_ROM_START) < 0xFFF) AOT_LOOKUP();
+interp:
+#endif
+  if ((u_int)(pc - DISPATCH_ROM_START) < 0xFFF) {
+    BCACHE_LOOKUP();
+    pd = &predecode_rom[pc - DISPATCH_ROM_START];
+  } else if (IS_RAM(pc)) {
+    pd = predecode_ram_entry(pc);
+  } else if (pc >= 0x80 && pc < 0xFFFF) {
+    predecode_decode(&uncached, pc); /* unmapped */
+    pd = &uncached;
+  } else {
+    SYNC();
+    DPRINTF("pc=%x, 6301 emu is hopelessly crashed!\n", pc);
+    crashed = 1;
+    goto out;
+  }
+  EXECUTE();
+
+#ifdef DISPATCH_BCACHE
+taken:
+  ncycles += n;
+  if (ncycles >= deadline) {
+    TIMER_EVENT(n);
+    IDLE_DIRTY();
+  }
+  run_left = 0;
+  if (ncycles >= end || cpu_int_check) goto check;
+  if ((u_int)(pc - DISPATCH_ROM_START) >= 0xFFF) goto fetch;
+  AOT_LOOKUP();
+  BCACHE_LOOKUP();
+  pd = &predecode_rom[pc - DISPATCH_ROM_START];
+  EXECUTE();
+#endif
+
+#ifndef DISPATCH_COMPUTED_GOTO
+execute:
+  switch (op) {
+#endif
+
+#include "dispatch_ops.h"
+
+  op_trap:
+    INTERRUPT(TRAPVECTOR);
+    NEXT;
+
+#ifndef DISPATCH_COMPUTED_GOTO
+  }
+#endif
+
+#ifdef DISPATCH_AOT
+/* the translated blocks follow the PC themselves */
+#undef TAKEN
+#define TAKEN()
+#include "aotrom.c"
+#endif
+
+out:
+  SYNC();
+  return ncycles;
+}
+
+/*
+ * dispatch_run - run for at least 'clocks' cycles
+ *
+ * Equivalent to calling instr_exec() until that many cycles have passed,
+ * or until one of cpu.event_stop has been raised.
+ * Returns the number of cycles actually run.
+ */
+COUNTER_VAR dispatch_run(COUNTER_VAR clocks) {
+  COUNTER_VAR ran = 0, left;
+
+  do {
+    left = clocks - ran;
+    ran += dispatch_slice(left <= 0                 ? 0
+                          : left < DISPATCH_MAX_RUN ? (u_int)left
+                                                    : DISPATCH_MAX_RUN);
+  } while (ran < clocks && !crashed && !(cpu.events & cpu.event_stop));
+  return ran;
+}
+
+#undef SYNC
+#undef RESCHEDULE
+#undef TIMER_EVENT
+#undef LOAD
+#undef IS_RAM
+#undef IS_ROM
+#undef RD
+#undef WR
+#undef RDW
+#undef WRW
+#undef PUSH
+#undef PULL
+#undef PUSHW
+#undef PULLW
+#undef INCPC
+#undef OPND8
+#undef IMM8
+#undef IMM16
+#undef EA_DIR
+#undef EA_EXT
+#undef EA_IX
+#undef DIR8
+#undef EXT8
+#undef IX8
+#undef DIR16
+#undef EXT16
+#undef IX16
+#undef CFLAGV
+#undef CCR
+#undef SET_CCR
+#undef NZ8
+#undef NZ16
+#undef FLAG_N
+#undef FLAG_Z
+#undef ADD8
+#undef SUB8
+#undef ADD16
+#undef SUB16
+#undef SHL8
+#undef SHR8
+#undef SHL16
+#undef SHR16
+#undef LOGIC8
+#undef LOGIC16
+#undef TEST8
+#undef CLR8
+#undef COM8
+#undef INC8
+#undef DEC8
+#undef ACCD
+#undef SETD
+#undef BRANCH
+#undef IO_STEADY
+#undef IDLE_LOOP
+#undef IDLE_DIRTY
+#undef IDLE_IO
+#undef STACK_REGS
+#undef INTERRUPT
+#undef IMM_MEM
+#undef OPFUNC
+#undef OP
+#undef TRAP
+#undef JUMP
+#undef EXECUTE
+#undef NEXT
+#undef L16
+#undef BCACHE_LOOKUP
+#undef BCACHE_NEXT
+#undef TAKEN
+#undef AOT_ROM_WRITE
+#undef AOT_LOOKUP
+#undef AOT_BEGIN
+#undef AOT_INSN
+#undef AOT_CYCLES
+#undef AOT_SYNC
+#undef AOT_EXIT
@@ -0,0 +1,19 @@
+/*
+ *  Threaded-code execution engine
+ */
+#ifndef H6301_DISPATCH_H
+#define H6301_DISPATCH_H
+
+#if defined(__STDC__) || defined(__cplusplus)
+# define P_(s) s
+#else
+# define P_(s) ()
+#endif
+
+
+/* dispatch.c */
+extern COUNTER_VAR dispatch_run P_((COUNTER_VAR clocks));
+extern void dispatch_rom_build P_((void));
+
+#undef P_
+#endif /* H6301_DISPATCH_H */
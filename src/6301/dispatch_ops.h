@@ -0,0 +1,296 @@
+/*
+ * dispatch_ops.h - what each opcode does, for dispatch.c and aotgen.c
+ *
+ * Included where OP(code, body) and TRAP(code) have been defined. The
+ * body is written with the macros of dispatch.c, after the opcode has been
+ * fetched (PC past it, 'opnd' holding the next two bytes, 'n' the cycles)
+ * and before the cycles are accounted. dispatch.c makes a handler of each,
+ * aotgen.c copies them as text into the translated ROM. TAKEN() follows
+ * whatever moves the PC anywhere but to the next instruction.
+ *
+ * Same cycle counts and I/O access order as opfunc.c.
+ */
+
+/* 0x00 */
+OP(00, )                                                /* nop */
+OP(01, )                                                /* nop */
+OP(04, SETD(SHR16(ACCD)))                               /* lsrd */
+OP(05, SETD(SHL16(ACCD)))                               /* asld */
+OP(06, SET_CCR(a); cpu_int_recheck())                   /* tap */
+OP(07, a = CCR() | 0xC0)                                /* tpa */
+OP(08, x = (x + 1) & 0xFFFF; fz = x)                    /* inx */
+OP(09, x = (x - 1) & 0xFFFF; fz = x)                    /* dex */
+OP(0a, ccr &= ~VFLAG)                                   /* clv */
+OP(0b, ccr |= VFLAG)                                    /* sev */
+OP(0c, ccr &= ~CFLAG)                                   /* clc */
+OP(0d, ccr |= CFLAG)                                    /* sec */
+OP(0e, ccr &= ~IFLAG; cpu_int_recheck())                /* cli */
+OP(0f, ccr |= IFLAG)                                    /* sei */
+
+/* 0x10 */
+OP(10, a = SUB8(a, b, 0))                               /* sba */
+OP(11, (void)SUB8(a, b, 0))                             /* cba */
+OP(16, b = LOGIC8(a))                                   /* tab */
+OP(17, a = LOGIC8(b))                                   /* tba */
+OP(18, t = x; x = ACCD; SETD(t))                        /* xgdx */
+OP(19, OPFUNC(daa_inh))                                 /* daa */
+OP(1a, OPFUNC(slp_inh))                                 /* slp */
+OP(1b, a = ADD8(a, b, 0))                               /* aba */
+
+/* 0x20 */
+OP(20, BRANCH(1))                                       /* bra */
+OP(21, BRANCH(0))                                       /* brn */
+OP(22, BRANCH(!(ccr & CFLAG) && !FLAG_Z))               /* bhi */
+OP(23, BRANCH((ccr & CFLAG) || FLAG_Z))                 /* bls */
+OP(24, BRANCH(!(ccr & CFLAG)))                          /* bcc */
+OP(25, BRANCH(ccr & CFLAG))                             /* bcs */
+OP(26, BRANCH(!FLAG_Z))                                 /* bne */
+OP(27, BRANCH(FLAG_Z))                                  /* beq */
+OP(28, BRANCH(!(ccr & VFLAG)))                          /* bvc */
+OP(29, BRANCH(ccr & VFLAG))                             /* bvs */
+OP(2a, BRANCH(!FLAG_N))                                 /* bpl */
+OP(2b, BRANCH(FLAG_N))                                  /* bmi */
+OP(2c, BRANCH(!FLAG_N == !(ccr & VFLAG)))               /* bge */
+OP(2d, BRANCH(!FLAG_N != !(ccr & VFLAG)))               /* blt */
+OP(2e, BRANCH(!FLAG_Z && !FLAG_N == !(ccr & VFLAG)))    /* bgt */
+OP(2f, BRANCH(FLAG_Z || !FLAG_N != !(ccr & VFLAG)))     /* ble */
+
+/* 0x30 */
+OP(30, x = (sp + 1) & 0xFFFF)                           /* tsx */
+OP(31, sp = (sp + 1) & 0xFFFF)                          /* ins */
+OP(32, PULL(a))                                         /* pula */
+OP(33, PULL(b))                                         /* pulb */
+OP(34, sp = (sp - 1) & 0xFFFF)                          /* des */
+OP(35, sp = (x - 1) & 0xFFFF)                           /* txs */
+OP(36, PUSH(a))                                         /* psha */
+OP(37, PUSH(b))                                         /* pshb */
+OP(38, PULLW(x))                                        /* pulx */
+OP(39, PULLW(pc); TAKEN())                              /* rts */
+OP(3a, x = (x + b) & 0xFFFF)                            /* abx */
+OP(3b,                                                  /* rti */
+   PULL(t);
+   SET_CCR(t);
+   PULL(b);
+   PULL(a);
+   PULLW(x);
+   PULLW(pc);
+   cpu_int_recheck();
+   TAKEN())
+OP(3c, PUSHW(x))                                        /* pshx */
+OP(3d,                                                  /* mul */
+   SETD(a * b);
+   ccr = (b & 0x80) ? ccr | CFLAG : ccr & ~CFLAG)
+OP(3e, STACK_REGS(); OPFUNC(wai_wait))                  /* wai, as wai_inh() */
+OP(3f, INTERRUPT(0xFFFC))                               /* swi, as swi_inh() */
+
+/* 0x40 */
+OP(40, a = SUB8(0, a, 0))                               /* nega */
+OP(43, a = COM8(a))                                     /* coma */
+OP(44, a = SHR8(a, 0))                                  /* lsra */
+OP(46, a = SHR8(a, CFLAGV))                             /* rora */
+OP(47, a = SHR8(a, a & 0x80))                           /* asra */
+OP(48, a = SHL8(a, 0))                                  /* lsla */
+OP(49, a = SHL8(a, CFLAGV))                             /* rola */
+OP(4a, a = DEC8(a))                                     /* deca */
+OP(4c, a = INC8(a))                                     /* inca */
+OP(4d, (void)TEST8(a))                                  /* tsta */
+OP(4f, a = CLR8())                                      /* clra */
+
+/* 0x50 */
+OP(50, b = SUB8(0, b, 0))                               /* negb */
+OP(53, b = COM8(b))                                     /* comb */
+OP(54, b = SHR8(b, 0))                                  /* lsrb */
+OP(56, b = SHR8(b, CFLAGV))                             /* rorb */
+OP(57, b = SHR8(b, b & 0x80))                           /* asrb */
+OP(58, b = SHL8(b, 0))                                  /* lslb */
+OP(59, b = SHL8(b, CFLAGV))                             /* rolb */
+OP(5a, b = DEC8(b))                                     /* decb */
+OP(5c, b = INC8(b))                                     /* incb */
+OP(5d, (void)TEST8(b))                                  /* tstb */
+OP(5f, b = CLR8())                                      /* clrb */
+
+/* 0x60, indexed */
+OP(60, IX8(t); t = SUB8(0, t, 0); WR(ea, t))            /* neg */
+OP(61, IMM_MEM(x + ea, &, 1))                           /* aim */
+OP(62, IMM_MEM(x + ea, |, 1))                           /* oim */
+OP(63, IX8(t); t = COM8(t); WR(ea, t))                  /* com */
+OP(64, IX8(t); t = SHR8(t, 0); WR(ea, t))               /* lsr */
+OP(65, IMM_MEM(x + ea, ^, 1))                           /* eim */
+OP(66, IX8(t); t = SHR8(t, CFLAGV); WR(ea, t))          /* ror */
+OP(67, IX8(t); t = SHR8(t, t & 0x80); WR(ea, t))        /* asr */
+OP(68, IX8(t); t = SHL8(t, 0); WR(ea, t))               /* lsl */
+OP(69, IX8(t); t = SHL8(t, CFLAGV); WR(ea, t))          /* rol */
+OP(6a, IX8(t); t = DEC8(t); WR(ea, t))                  /* dec */
+OP(6b, IMM_MEM(x + ea, &, 0))                           /* tim */
+OP(6c, IX8(t); t = INC8(t); WR(ea, t))                  /* inc */
+OP(6d, IX8(t); (void)TEST8(t))                          /* tst */
+OP(6e, EA_IX(); pc = ea; TAKEN())                       /* jmp */
+OP(6f, IX8(t); t = CLR8(); WR(ea, t))                   /* clr */
+
+/* 0x70, extended, direct for the immediate-memory instructions */
+OP(70, EXT8(t); t = SUB8(0, t, 0); WR(ea, t))           /* neg */
+OP(71, IMM_MEM(ea, &, 1))                               /* aim */
+OP(72, IMM_MEM(ea, |, 1))                               /* oim */
+OP(73, EXT8(t); t = COM8(t); WR(ea, t))                 /* com */
+OP(74, EXT8(t); t = SHR8(t, 0); WR(ea, t))              /* lsr */
+OP(75, IMM_MEM(ea, ^, 1))                               /* eim */
+OP(76, EXT8(t); t = SHR8(t, CFLAGV); WR(ea, t))         /* ror */
+OP(77, EXT8(t); t = SHR8(t, t & 0x80); WR(ea, t))       /* asr */
+OP(78, EXT8(t); t = SHL8(t, 0); WR(ea, t))              /* lsl */
+OP(79, EXT8(t); t = SHL8(t, CFLAGV); WR(ea, t))         /* rol */
+OP(7a, EXT8(t); t = DEC8(t); WR(ea, t))                 /* dec */
+OP(7b, IMM_MEM(ea, &, 0))                               /* tim */
+OP(7c, EXT8(t); t = INC8(t); WR(ea, t))                 /* inc */
+OP(7d, EXT8(t); (void)TEST8(t))                         /* tst */
+OP(7e, EA_EXT(); pc = ea; TAKEN())                      /* jmp */
+OP(7f, EXT8(t); t = CLR8(); WR(ea, t))                  /* clr */
+
+/* 0x80, accumulator A immediate */
+OP(80, IMM8(t); a = SUB8(a, t, 0))                      /* suba */
+OP(81, IMM8(t); (void)SUB8(a, t, 0))                    /* cmpa */
+OP(82, IMM8(t); a = SUB8(a, t, CFLAGV))                 /* sbca */
+OP(83, IMM16(w); SETD(SUB16(ACCD, w)))                  /* subd */
+OP(84, IMM8(t); a = LOGIC8(a & t))                      /* anda */
+OP(85, IMM8(t); (void)LOGIC8(a & t))                    /* bita */
+OP(86, IMM8(t); a = LOGIC8(t))                          /* ldaa */
+OP(88, IMM8(t); a = LOGIC8(a ^ t))                      /* eora */
+OP(89, IMM8(t); a = ADD8(a, t, CFLAGV))                 /* adca */
+OP(8a, IMM8(t); a = LOGIC8(a | t))                      /* oraa */
+OP(8b, IMM8(t); a = ADD8(a, t, 0))                      /* adda */
+OP(8c, IMM16(w); (void)SUB16(x, w))                     /* cpx */
+OP(8d,                                                  /* bsr */
+   IMM8(t);
+   ea = (pc + (s_char)t) & 0xFFFF;
+   PUSHW(pc);
+   pc = ea;
+   TAKEN())
+OP(8e, IMM16(w); sp = LOGIC16(w))                       /* lds */
+
+/* 0x90, accumulator A direct */
+OP(90, DIR8(t); a = SUB8(a, t, 0))                      /* suba */
+OP(91, DIR8(t); (void)SUB8(a, t, 0))                    /* cmpa */
+OP(92, DIR8(t); a = SUB8(a, t, CFLAGV))                 /* sbca */
+OP(93, DIR16(w); SETD(SUB16(ACCD, w)))                  /* subd */
+OP(94, DIR8(t); a = LOGIC8(a & t))                      /* anda */
+OP(95, DIR8(t); (void)LOGIC8(a & t))                    /* bita */
+OP(96, DIR8(t); a = LOGIC8(t))                          /* ldaa */
+OP(97, EA_DIR(); (void)LOGIC8(a); WR(ea, a))            /* staa */
+OP(98, DIR8(t); a = LOGIC8(a ^ t))                      /* eora */
+OP(99, DIR8(t); a = ADD8(a, t, CFLAGV))                 /* adca */
+OP(9a, DIR8(t); a = LOGIC8(a | t))                      /* oraa */
+OP(9b, DIR8(t); a = ADD8(a, t, 0))                      /* adda */
+OP(9c, DIR16(w); (void)SUB16(x, w))                     /* cpx */
+OP(9d, EA_DIR(); PUSHW(pc); pc = ea; TAKEN())           /* jsr */
+OP(9e, DIR16(w); sp = LOGIC16(w))                       /* lds */
+OP(9f, EA_DIR(); (void)LOGIC16(sp); WRW(ea, sp))        /* sts */
+
+/* 0xA0, accumulator A indexed */
+OP(a0, IX8(t); a = SUB8(a, t, 0))                       /* suba */
+OP(a1, IX8(t); (void)SUB8(a, t, 0))                     /* cmpa */
+OP(a2, IX8(t); a = SUB8(a, t, CFLAGV))                  /* sbca */
+OP(a3, IX16(w); SETD(SUB16(ACCD, w)))                   /* subd */
+OP(a4, IX8(t); a = LOGIC8(a & t))                       /* anda */
+OP(a5, IX8(t); (void)LOGIC8(a & t))                     /* bita */
+OP(a6, IX8(t); a = LOGIC8(t))                           /* ldaa */
+OP(a7, EA_IX(); (void)LOGIC8(a); WR(ea, a))             /* staa */
+OP(a8, IX8(t); a = LOGIC8(a ^ t))                       /* eora */
+OP(a9, IX8(t); a = ADD8(a, t, CFLAGV))                  /* adca */
+OP(aa, IX8(t); a = LOGIC8(a | t))                       /* oraa */
+OP(ab, IX8(t); a = ADD8(a, t, 0))                       /* adda */
+OP(ac, IX16(w); (void)SUB16(x, w))                      /* cpx */
+OP(ad, EA_IX(); PUSHW(pc); pc = ea; TAKEN())            /* jsr */
+OP(ae, IX16(w); sp = LOGIC16(w))                        /* lds */
+OP(af, EA_IX(); (void)LOGIC16(sp); WRW(ea, sp))         /* sts */
+
+/* 0xB0, accumulator A extended */
+OP(b0, EXT8(t); a = SUB8(a, t, 0))                      /* suba */
+OP(b1, EXT8(t); (void)SUB8(a, t, 0))                    /* cmpa */
+OP(b2, EXT8(t); a = SUB8(a, t, CFLAGV))                 /* sbca */
+OP(b3, EXT16(w); SETD(SUB16(ACCD, w)))                  /* subd */
+OP(b4, EXT8(t); a = LOGIC8(a & t))                      /* anda */
+OP(b5, EXT8(t); (void)LOGIC8(a & t))                    /* bita */
+OP(b6, EXT8(t); a = LOGIC8(t))                          /* ldaa */
+OP(b7, EA_EXT(); (void)LOGIC8(a); WR(ea, a))            /* staa */
+OP(b8, EXT8(t); a = LOGIC8(a ^ t))                      /* eora */
+OP(b9, EXT8(t); a = ADD8(a, t, CFLAGV))                 /* adca */
+OP(ba, EXT8(t); a = LOGIC8(a | t))                      /* oraa */
+OP(bb, EXT8(t); a = ADD8(a, t, 0))                      /* adda */
+OP(bc, EXT16(w); (void)SUB16(x, w))                     /* cpx */
+OP(bd, EA_EXT(); PUSHW(pc); pc = ea; TAKEN())           /* jsr */
+OP(be, EXT16(w); sp = LOGIC16(w))                       /* lds */
+OP(bf, EA_EXT(); (void)LOGIC16(sp); WRW(ea, sp))        /* sts */
+
+/* 0xC0, accumulator B immediate */
+OP(c0, IMM8(t); b = SUB8(b, t, 0))                      /* subb */
+OP(c1, IMM8(t); (void)SUB8(b, t, 0))                    /* cmpb */
+OP(c2, IMM8(t); b = SUB8(b, t, CFLAGV))                 /* sbcb */
+OP(c3, IMM16(w); SETD(ADD16(ACCD, w)))                  /* addd */
+OP(c4, IMM8(t); b = LOGIC8(b & t))                      /* andb */
+OP(c5, IMM8(t); (void)LOGIC8(b & t))                    /* bitb */
+OP(c6, IMM8(t); b = LOGIC8(t))                          /* ldab */
+OP(c8, IMM8(t); b = LOGIC8(b ^ t))                      /* eorb */
+OP(c9, IMM8(t); b = ADD8(b, t, CFLAGV))                 /* adcb */
+OP(ca, IMM8(t); b = LOGIC8(b | t))                      /* orab */
+OP(cb, IMM8(t); b = ADD8(b, t, 0))                      /* addb */
+OP(cc, IMM16(w); SETD(LOGIC16(w)))                      /* ldd */
+OP(ce, IMM16(w); x = LOGIC16(w))                        /* ldx */
+
+/* 0xD0, accumulator B direct */
+OP(d0, DIR8(t); b = SUB8(b, t, 0))                      /* subb */
+OP(d1, DIR8(t); (void)SUB8(b, t, 0))                    /* cmpb */
+OP(d2, DIR8(t); b = SUB8(b, t, CFLAGV))                 /* sbcb */
+OP(d3, DIR16(w); SETD(ADD16(ACCD, w)))                  /* addd */
+OP(d4, DIR8(t); b = LOGIC8(b & t))                      /* andb */
+OP(d5, DIR8(t); (void)LOGIC8(b & t))                    /* bitb */
+OP(d6, DIR8(t); b = LOGIC8(t))                          /* ldab */
+OP(d7, EA_DIR(); (void)LOGIC8(b); WR(ea, b))            /* stab */
+OP(d8, DIR8(t); b = LOGIC8(b ^ t))                      /* eorb */
+OP(d9, DIR8(t); b = ADD8(b, t, CFLAGV))                 /* adcb */
+OP(da, DIR8(t); b = LOGIC8(b | t))                      /* orab */
+OP(db, DIR8(t); b = ADD8(b, t, 0))                      /* addb */
+OP(dc, DIR16(w); SETD(LOGIC16(w)))                      /* ldd */
+OP(dd, EA_DIR(); w = ACCD; (void)LOGIC16(w); WRW(ea, w)) /* std */
+OP(de, DIR16(w); x = LOGIC16(w))                        /* ldx */
+OP(df, EA_DIR(); (void)LOGIC16(x); WRW(ea, x))          /* stx */
+
+/* 0xE0, accumulator B indexed */
+OP(e0, IX8(t); b = SUB8(b, t, 0))                       /* subb */
+OP(e1, IX8(t); (void)SUB8(b, t, 0))                     /* cmpb */
+OP(e2, IX8(t); b = SUB8(b, t, CFLAGV))                  /* sbcb */
+OP(e3, IX16(w); SETD(ADD16(ACCD, w)))                   /* addd */
+OP(e4, IX8(t); b = LOGIC8(b & t))                       /* andb */
+OP(e5, IX8(t); (void)LOGIC8(b & t))                     /* bitb */
+OP(e6, IX8(t); b = LOGIC8(t))                           /* ldab */
+OP(e7, EA_IX(); (void)LOGIC8(b); WR(ea, b))             /* stab */
+OP(e8, IX8(t); b = LOGIC8(b ^ t))                       /* eorb */
+OP(e9, IX8(t); b = ADD8(b, t, CFLAGV))                  /* adcb */
+OP(ea, IX8(t); b = LOGIC8(b | t))                       /* orab */
+OP(eb, IX8(t); b = ADD8(b, t, 0))                       /* addb */
+OP(ec, IX16(w); SETD(LOGIC16(w)))                       /* ldd */
+OP(ed, EA_IX(); w = ACCD; (void)LOGIC16(w); WRW(ea, w)) /* std */
+OP(ee, IX16(w); x = LOGIC16(w))                         /* ldx */
+OP(ef, EA_IX(); (void)LOGIC16(x); WRW(ea, x))           /* stx */
+
+/* 0xF0, accumulator B extended */
+OP(f0, EXT8(t); b = SUB8(b, t, 0))                      /* subb */
+OP(f1, EXT8(t); (void)SUB8(b, t, 0))                    /* cmpb */
+OP(f2, EXT8(t); b = SUB8(b, t, CFLAGV))                 /* sbcb */
+OP(f3, EXT16(w); SETD(ADD16(ACCD, w)))                  /* addd */
+OP(f4, EXT8(t); b = LOGIC8(b & t))                      /* andb */
+OP(f5, EXT8(t); (void)LOGIC8(b & t))                    /* bitb */
+OP(f6, EXT8(t); b = LOGIC8(t))                          /* ldab */
+OP(f7, EA_EXT(); (void)LOGIC8(b); WR(ea, b))            /* stab */
+OP(f8, EXT8(t); b = LOGIC8(b ^ t))                      /* eorb */
+OP(f9, EXT8(t); b = ADD8(b, t, CFLAGV))                 /* adcb */
+OP(fa, EXT8(t); b = LOGIC8(b | t))                      /* orab */
+OP(fb, EXT8(t); b = ADD8(b, t, 0))                      /* addb */
+OP(fc, EXT16(w); SETD(LOGIC16(w)))                      /* ldd */
+OP(fd, EA_EXT(); w = ACCD; (void)LOGIC16(w); WRW(ea, w)) /* std */
+OP(fe, EXT16(w); x = LOGIC16(w))                        /* ldx */
+OP(ff, EA_EXT(); (void)LOGIC16(x); WRW(ea, x))          /* stx */
+
+/* Undefined opcodes: trap() */
+TRAP(02) TRAP(03) TRAP(12) TRAP(13) TRAP(14) TRAP(15) TRAP(1c) TRAP(1d)
+TRAP(1e) TRAP(1f) TRAP(41) TRAP(42) TRAP(45) TRAP(4b) TRAP(4e) TRAP(51)
+TRAP(52) TRAP(55) TRAP(5b) TRAP(5e) TRAP(87) TRAP(8f) TRAP(c7) TRAP(cd)
+TRAP(cf)
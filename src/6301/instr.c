@@ -27,8 +27,22 @@ reset() {
   reg_setiflag(1);
 }
 
+/*
+ * int_pending - vector of the interrupt requested, 0 if none
+ *
+ * In priority order, whatever the I flag.
+ */
+u_int int_pending() {
+  if ((ireg_getb(TCSR) & OCF) && (ireg_getb(TCSR) & EOCI)) return OCFVECTOR;
+  if (serial_int()) return SCIVECTOR;
+  return 0;
+}
+
 /*
  * instr_exec - execute an instruction
+ *
+ * After SLP or WAI, one call is one cycle of waiting until an interrupt
+ * request ends the wait.
  */
 instr_exec() {
   /*
@@ -40,16 +54,38 @@ instr_exec() {
   int interrupted = 0; /* 1 = HW interrupt occured */
 
 #ifndef M6800
+  u_int vector;
+
+  if (cpu_isasleep()) {
+    vector = int_pending();
+    if (vector && cpu.state == SLEEPING) {
+      cpu_start(); /* then as usual, the interrupt may be masked */
+    } else if (vector && !reg_getiflag()) {
+      /* WAI: the registers are on the stack already */
+      cpu_start();
+      reg_setpc(mem_getw(vector));
+      callstack_push(reg_getpc());
+      reg_setiflag(1);
+#ifdef HD6301_STATS
+      hd6301_stats.interrupts++;
+#endif
+      cpu_setncycles(cpu_getncycles() + INSTR_WAI_WAKE_CYCLES);
+      timer_inc(INSTR_WAI_WAKE_CYCLES);
+      return 0;
+    } else {
+      cpu_setncycles(cpu_getncycles() + 1);
+      timer_inc(1);
+      return 0;
+    }
+  }
 
   if (!reg_getiflag()) {
     /*
      * Check for interrupts in priority order
      */
-    if ((ireg_getb(TCSR) & OCF) && (ireg_getb(TCSR) & EOCI)) {
-      int_addr(OCFVECTOR);
-      interrupted = 1;
-    } else if (serial_int()) {
-      int_addr(SCIVECTOR);
+    vector = int_pending();
+    if (vector) {
+      int_addr(vector);
       interrupted = 1;
     }
   }
@@ -69,6 +105,9 @@ instr_exec() {
   if (interrupted) /* Prepare cycle count for register stacking */
   {
     opptr = &opcodetab[0x3f]; /* SWI */
+#ifdef HD6301_STATS
+    hd6301_stats.interrupts++;
+#endif
   } else {
     int pc = reg_getpc();
     if (!(pc >= 0x80 && pc < 0xFFFF))  // eg bad snapshot
@@ -79,6 +118,10 @@ instr_exec() {
     }
 
     opptr = &opcodetab[mem_getb(reg_getpc())];
+#ifdef HD6301_STATS
+    hd6301_stats.instructions++;
+    hd6301_stats.opcodes[opptr->op_value]++;
+#endif
     reg_incpc(1);
     (*opptr->op_func)();
     //    ASSERT(iram[7]!=0xf0);
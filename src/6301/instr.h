@@ -8,7 +8,15 @@
 #endif
 
 
+/*
+ * Cycles from the end of the WAI wait to the first instruction of the
+ * handler: a whole interrupt takes as long as SWI, WAI did the stacking
+ */
+#define INSTR_WAI_WAKE_CYCLES \
+  (opcodetab[0x3f].op_n_cycles - opcodetab[0x3e].op_n_cycles)
+
 extern int reset P_((void));
+extern u_int int_pending P_((void));
 extern int instr_exec P_((void));
 extern int instr_print P_((u_short addr));
 
@@ -53,9 +53,8 @@ static u_char dr4_getb P_((u_int offs));
     To do that we use a look-up table based on doc.
     Note that the first row had to be shifted to the right compared with the
     existing doc.
-    We also use a table with key states (already used in Steem), and a function
-    that builds DR1 bit by bit.
-    It's slow but performance isn't needed for the keyboard.
+    The table is only read at reset, to place the keys (see the key latch
+    below).
 */
 
 /*  go fetch the value in 6301 rom instead of in a fat table!
@@ -90,6 +89,102 @@ BYTE get_scancode(int dr1bit, int column) {
   return val;
 }
 
+/*  Key latch
+    The ROM selects one column every 2 ms and reads DR1 twice, so a key is
+    looked at once every 30 ms. A USB or Bluetooth key can go down and up in
+    less than that and would never be seen. So a change of a key, coming in
+    through hd6301_set_key(), is held until the ROM has read its column; a
+    change coming before that waits, and is applied at the next selection
+    of that column at the earliest, the previous level having been seen.
+    kbd_scan counts column selections, and a column isn't changed between
+    two reads of the same selection, so that both reads see the same keys.
+    A change that has to wait is kept in kbd_flip even if the key goes back
+    meanwhile, so a tap is always seen down and then up.
+
+    Keys are kept by column, a bit per DR1 row, where the ROM tables put
+    them. kbd_pos[] is taken from the ROM at cold reset with get_scancode(),
+    so reading DR1 is an OR of the selected columns.
+*/
+#define KBD_NOKEY 0xFF
+
+static u_char kbd_pos[128];                /* column * 8 + row, or KBD_NOKEY */
+static u_char kbd_level[KBD_COLUMNS];      /* what the ROM sees */
+static u_char kbd_want[KBD_COLUMNS];       /* last levels set */
+static u_char kbd_flip[KBD_COLUMNS];       /* level to change, not done yet */
+static u_char kbd_unseen[KBD_COLUMNS];     /* changed, column not read since */
+static u_int kbd_read_scan[KBD_COLUMNS];   /* selection the column was read in */
+static u_int kbd_scan = 1;                 /* column selections so far */
+static u_int kbd_select = 0;               /* columns of the last DR1 read */
+
+/*
+ * kbd_update - apply the last levels set in a column, except for keys the
+ * ROM hasn't seen yet and in the middle of a selection
+ */
+static void kbd_update(column)
+int column;
+{
+  u_char pending = kbd_flip[column] & ~kbd_unseen[column];
+  if (pending && kbd_read_scan[column] != kbd_scan) {
+    kbd_level[column] ^= pending;
+    kbd_unseen[column] |= pending;
+    // Back, after a tap
+    kbd_flip[column] &= ~pending | (kbd_level[column] ^ kbd_want[column]);
+  }
+}
+
+static void kbd_set(code, down)
+int code, down;
+{
+  int column, row;
+  if (code <= 0 || code >= 128 || kbd_pos[code] == KBD_NOKEY) return;
+  column = kbd_pos[code] >> 3;
+  row = kbd_pos[code] & 7;
+  if (down)
+    kbd_want[column] |= 1 << row;
+  else
+    kbd_want[column] &= ~(1 << row);
+  kbd_flip[column] |= (kbd_level[column] ^ kbd_want[column]) & (1 << row);
+  kbd_update(column);
+}
+
+/*
+ * kbd_read - rows with a key down in the selected columns, DR3 bits 1-7
+ * being columns 0-6 and DR4 bits 0-7 columns 7-14
+ */
+static u_char kbd_read(columns)
+u_int columns;
+{
+  u_char rows = 0;
+  int column;
+  for (column = 0; columns; column++, columns >>= 1) {
+    if (columns & 1) {
+      kbd_update(column);
+      kbd_unseen[column] = 0;
+      kbd_read_scan[column] = kbd_scan;
+      rows |= kbd_level[column];
+    }
+  }
+  return rows;
+}
+
+static void kbd_reset() {
+  int column, dr1bit, code;
+  memset(kbd_pos, KBD_NOKEY, sizeof(kbd_pos));
+  for (column = 0; column < KBD_COLUMNS; column++)
+    for (dr1bit = 0; dr1bit < 8; dr1bit++) {
+      code = get_scancode(dr1bit, column);
+      if (code > 0 && code < 128 && kbd_pos[code] == KBD_NOKEY)
+        kbd_pos[code] = (column << 3) | dr1bit;
+    }
+  memset(kbd_level, 0, sizeof(kbd_level));
+  memset(kbd_want, 0, sizeof(kbd_want));
+  memset(kbd_flip, 0, sizeof(kbd_flip));
+  memset(kbd_unseen, 0, sizeof(kbd_unseen));
+  memset(kbd_read_scan, 0, sizeof(kbd_read_scan));
+  kbd_scan = 1;
+  kbd_select = 0;
+}
+
 /*
 SCAN CODES
 01  Esc     1B  ]             35  /             4F  { NOT USED }
@@ -123,48 +218,22 @@ SCAN CODES
 static u_char dr1_getb(offs)
 u_int offs;
 {
-  u_char value = 0xFF;
   u_char ddr1 = iram[DDR1];
-  u_char ddr3 = iram[DDR3];
-  u_char ddr4 = iram[DDR4];
   u_char dr2 = iram[P2];
-  u_char dr3 = iram[P3];
-  u_char dr4 = iram[P4];
-  int dr1bit;
-  int mask, scancode = -1;
+  u_int select;
   //  ASSERT(offs==P1);
   //  ASSERT(!ddr1); // strong
   //  ASSERT(!(dr2&1)); // strong, asserts at reset?
-  // We make DR1 bit by bit
-  for (dr1bit = 0; dr1bit < 8; dr1bit++) {
-    mask = 1 << dr1bit;
-    // we only consider bits with a corresponding 0 in DDR1
-    if (!(mask & ddr1) && !(dr2 & 1)) {
-      int column, mask2, found = 0;  // 'found' avoids being too slow
-      // test DR3
-      for (column = 0; column < 7 && !found; column++) {
-        mask2 = 1 << (column + 1);
-        scancode = get_scancode(dr1bit, column);
-        if (st_keydown(scancode) && (dr3 & mask2)  // must be set (diode on)
-            && (ddr3 & mask2))
-          found++;
-      }
-      // test DR4
-      for (column = 7; column < 15 && !found; column++) {
-        mask2 = 1 << (column - 7);
-        scancode = get_scancode(dr1bit, column);
-        if (st_keydown(scancode) && (dr4 & mask2)  // must be set (diode on)
-            && (ddr4 & mask2))
-          found++;
-      }
-      if (found) {
-        value &= ~mask;  // clear bit
-        // DPRINTF("Read DR1 %X scancode %x\n",value,scancode);
-      }
-    }
+  if ((dr2 & 1) || ddr1 == 0xFF) return 0xFF;
+  // A column is selected by a set bit (diode on) in both DR and DDR
+  select = ((iram[P3] & iram[DDR3]) >> 1) | ((iram[P4] & iram[DDR4]) << 7);
+  if (select != kbd_select) {
+    kbd_select = select;
+    kbd_scan++;
   }
-  //  ASSERT(value);
-  return value;
+  // Rows with a key down in a selected column are cleared, in the bits
+  // with a corresponding 0 in DDR1
+  return ~(kbd_read(select) & ~ddr1);
 }
 
 /*  DR2 ($03 DDR2: $01)
@@ -277,7 +346,8 @@ u_char value;
  */
 u_char(*ireg_getb_func[NIREGS]) P_((u_int offs)) = {
     /* 0x00 */
-    0, 0, dr1_getb, dr2_getb, 0, 0, 0, dr4_getb, tcsr_getb, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, dr1_getb, dr2_getb, 0, 0, 0, dr4_getb, tcsr_getb, frc_getb,
+    frc_getb, 0, 0, 0, 0, 0,
     /* 0x10 */
     0, trcsr_getb, rdr_getb, 0, 0};
 
@@ -13,6 +13,8 @@
 extern u_int  ireg_start;
 extern u_char iram[];
 
+#define KBD_COLUMNS 15  /* key matrix columns, see ireg.c */
+
 
 #if defined(__STDC__) || defined(__cplusplus)
 # define P_(s) s
@@ -32,6 +32,33 @@
 u_int ram_start; /* 0x0000; */
 u_int ram_end;   /* 0xFFFF; */
 u_char *ram = 0; /* was [65536]; modified for MSDOS compilers */
+
+u_char *mem_read_page[MEM_NPAGES];
+u_char *mem_write_page[MEM_NPAGES];
+static u_char mem_unmapped_read[MEM_PAGE_SIZE];  /* reads as 0xFF */
+static u_char mem_unmapped_write[MEM_PAGE_SIZE]; /* writes are lost */
+
+/*
+ * mem_map - fill the page table for the single-chip mode memory map
+ */
+static void mem_map() {
+  u_int page;
+
+  memset(mem_unmapped_read, 0xFF, sizeof(mem_unmapped_read));
+  for (page = 0; page < MEM_NPAGES; page++) {
+    u_int addr = page << MEM_PAGE_SHIFT;
+    if (addr < 0x80) {  /* internal registers */
+      mem_read_page[page] = mem_write_page[page] = NULL;
+    } else if (addr < 0x100) {  /* internal RAM */
+      mem_read_page[page] = mem_write_page[page] = ram + addr;
+    } else if (addr >= 0xF000) {  /* ROM, after the first 256 bytes */
+      mem_read_page[page] = mem_write_page[page] = ram + addr - 0xF000 + 256;
+    } else {
+      mem_read_page[page] = mem_unmapped_read;
+      mem_write_page[page] = mem_unmapped_write;
+    }
+  }
+}
 /*
  * mem_init - initialize memory area
  */
@@ -54,6 +81,7 @@ u_char *mem_init() {
     ram_start = 0;
     ram_end = MEMSIZE - 1;
     memset(ram, 0, 256);
+    mem_map();
   } else {
     printf("ram already allocated\n");
   }
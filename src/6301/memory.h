@@ -30,10 +30,36 @@ extern u_int ram_end;   /* Last valid RAM address */
 extern u_char *ram;     /* Physical storage for simulated RAM */
 
 /*
- *  mem_getb - called to get a byte from an address
+ * Page table
+ *
+ * The 64K address space is split in 128 byte pages, so that internal RAM
+ * (0x80-0xFF) gets a page of its own. A page points straight at its
+ * backing storage: internal RAM, the ROM image, or for unmapped pages a
+ * page of 0xFF to read from and a scratch page to write to. A NULL page
+ * (only page 0: internal registers and the 0x15-0x7F hole) goes through
+ * mem_getb_io()/mem_putb_io(), as do addresses above 0xFFFF.
+ */
+#define MEM_PAGE_SHIFT 7
+#define MEM_PAGE_SIZE (1 << MEM_PAGE_SHIFT)
+#define MEM_PAGE_MASK (MEM_PAGE_SIZE - 1)
+#define MEM_NPAGES (MEMSIZE >> MEM_PAGE_SHIFT)
+
+extern u_char *mem_read_page[MEM_NPAGES];
+extern u_char *mem_write_page[MEM_NPAGES];
+
+#define mem_rpage(addr) \
+  ((u_int)(addr) < MEMSIZE ? mem_read_page[(u_int)(addr) >> MEM_PAGE_SHIFT] : 0)
+#define mem_wpage(addr) \
+  ((u_int)(addr) < MEMSIZE ? mem_write_page[(u_int)(addr) >> MEM_PAGE_SHIFT] : 0)
+
+/* Internal RAM, where the stack lives */
+#define mem_is_iram(addr) ((u_int)(addr) - 0x80u < 0x80u)
+
+/*
+ *  mem_getb_io - read from a page without storage
  */
 static u_char
-mem_getb(addr)
+mem_getb_io(addr)
 u_int addr;
 {
   int offs = addr - ireg_start;
@@ -57,12 +83,7 @@ u_int addr;
   }
   else if (addr >= ram_start && addr <= ram_end)
   {
-    if (addr >= 0xF000)
-      return ram[addr - 0xF000 + 256];
-    else if (addr < 0x80 || addr >= 256)
-      return 0xff; // error
-    else
-      return ram[addr];
+    return 0xff; // error
   }
   else
   {
@@ -72,21 +93,42 @@ u_int addr;
   }
 }
 
+/*
+ *  mem_getb - called to get a byte from an address
+ */
+static u_char
+mem_getb(addr)
+u_int addr;
+{
+  u_char *page = mem_rpage(addr);
+
+  if (page)
+    return page[addr & MEM_PAGE_MASK];
+  return mem_getb_io(addr);
+}
+
 static u_short
 mem_getw(addr)
 u_int addr;
 {
-  /* Make sure hi byte is accessed first */
-  u_char hi = mem_getb(addr);
-  u_char lo = mem_getb(addr + 1);
-  return (hi << 8) | lo;
+  u_char *page = mem_rpage(addr);
+
+  /* Both bytes in the same page: no side effects, order doesn't matter */
+  if (page && (addr & MEM_PAGE_MASK) != MEM_PAGE_MASK)
+    return (page[addr & MEM_PAGE_MASK] << 8) | page[(addr & MEM_PAGE_MASK) + 1];
+  {
+    /* Make sure hi byte is accessed first */
+    u_char hi = mem_getb(addr);
+    u_char lo = mem_getb(addr + 1);
+    return (hi << 8) | lo;
+  }
 }
 
 /*
- * mem_putb - called to write a byte to an address
+ * mem_putb_io - write to a page without storage
  */
 static void
-    mem_putb(addr, value)
+    mem_putb_io(addr, value)
         u_int addr;
 u_char value;
 {
@@ -108,12 +150,7 @@ u_char value;
   }
   else if (addr >= ram_start && addr <= ram_end)
   {
-    if (addr >= 0xF000)
-      ram[addr - 0xF000 + 256] = value;
-    else if (addr < 0x80 || addr >= 256)
-      ; // error
-    else
-      ram[addr] = value;
+    ; // error
   }
   else
   {
@@ -122,6 +159,22 @@ u_char value;
   }
 }
 
+/*
+ * mem_putb - called to write a byte to an address
+ */
+static void
+    mem_putb(addr, value)
+        u_int addr;
+u_char value;
+{
+  u_char *page = mem_wpage(addr);
+
+  if (page)
+    page[addr & MEM_PAGE_MASK] = value;
+  else
+    mem_putb_io(addr, value);
+}
+
 static void
     mem_putw(addr, value)
         u_int addr;
@@ -131,6 +184,29 @@ u_int value;
   mem_putb(addr + 1, value & 0xFF); /* lo byte */
 }
 
+/*
+ * mem_pushb/mem_pullb - stack access, SP is nearly always in internal RAM
+ */
+static void
+    mem_pushb(addr, value)
+        u_int addr;
+u_char value;
+{
+  if (mem_is_iram(addr))
+    ram[addr] = value;
+  else
+    mem_putb(addr, value);
+}
+
+static u_char
+mem_pullb(addr)
+u_int addr;
+{
+  if (mem_is_iram(addr))
+    return ram[addr];
+  return mem_getb(addr);
+}
+
 #if defined(__STDC__) || defined(__cplusplus)
 #define P_(s) s
 #else
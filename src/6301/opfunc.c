@@ -87,11 +87,11 @@ branch_expr (expr)
 /*
  * Stack operators (SP points to current free stack location)
  */
-pushbyte (value) u_char value;  {mem_putb (reg_postdecsp (1), value);}
+pushbyte (value) u_char value;  {mem_pushb (reg_postdecsp (1), value);}
 pushword (value) u_int value; {pushbyte (value); pushbyte (value >> 8);}
 popbyte ()
 {
-  return (mem_getb (reg_preincsp (1)));
+  return (mem_pullb (reg_preincsp (1)));
 }
 popword ()
 {
@@ -130,16 +130,24 @@ sts_addr (addr)   {mem_putw (addr, alu_bittestword (reg_getsp ()));}
 stx_addr (addr)   {mem_putw (addr, alu_bittestword (reg_getix ()));}
 tst_addr (addr)   {alu_testbyte (mem_getb (addr));}
 /*
- * int_addr - generate interrupt at the given vector address
+ * int_stack - stack the registers for an interrupt
  */
-int_addr (addr)
-  u_int addr;
+int_stack ()
 {
   pushword (reg_getpc ());
   pushword (reg_getix());
   pushbyte (reg_getacca ());
   pushbyte (reg_getaccb ());
   pushbyte (reg_getccr());
+}
+
+/*
+ * int_addr - generate interrupt at the given vector address
+ */
+int_addr (addr)
+  u_int addr;
+{
+  int_stack ();
   reg_setpc (mem_getw (addr));
   callstack_push (reg_getpc ());               /* new subroutine ref. */
   reg_setiflag (1);
@@ -428,13 +436,24 @@ tsta_inh () {alu_testbyte (reg_getacca ());}
 tstb_inh () {alu_testbyte (reg_getaccb ());}
 tsx_inh ()  {reg_setix (reg_getsp () + 1);}
 txs_inh ()  {reg_setsp (reg_getix () - 1);}
+/*
+ * wai_inh - stack the registers and wait, see instr_exec()
+ */
 wai_inh ()
 {
+  int_stack ();
+  wai_wait ();
+}
+
 /*
- *  clock (12);
- *  while (no_interrupts)
- *    clock (1);
+ * wai_wait - the wait of wai_inh(), for the threaded engine, which stacks
+ * the registers itself
  */
+wai_wait ()
+{
+  cpu.state = WAITING;
+  cpu_int_recheck ();
+  cpu_event (HD6301_EVENT_SLEEP);
 }
 
 /*====================================================================*/
@@ -599,10 +618,14 @@ xgdx_inh ()
   reg_setaccd (old_x);
 }
 
+/*
+ * slp_inh - stop until an interrupt request, see instr_exec()
+ */
 slp_inh ()
 {
-  printf("slp_inh\n");
-  /* cpu.state = sleep; */
+  cpu.state = SLEEPING;
+  cpu_int_recheck ();
+  cpu_event (HD6301_EVENT_SLEEP);
 }
 
 
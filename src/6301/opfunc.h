@@ -42,6 +42,7 @@ extern int stab_addr P_((int addr));
 extern int sts_addr P_((int addr));
 extern int stx_addr P_((int addr));
 extern int tst_addr P_((int addr));
+extern int int_stack P_((void));
 extern int int_addr P_((u_int addr));
 extern int aba_inh P_((void));
 extern int adca_imm P_((void));
@@ -241,6 +242,7 @@ extern int tstb_inh P_((void));
 extern int tsx_inh P_((void));
 extern int txs_inh P_((void));
 extern int wai_inh P_((void));
+extern int wai_wait P_((void));
 extern int abx_inh P_((void));
 extern int addd_imm P_((void));
 extern int addd_dir P_((void));
@@ -19,6 +19,7 @@
  */
 
 //     opcode, operand bytes, function name, cycles, debug string
+//     cycles as in the HD6301V1 data sheet, see tests/host/hd6301v1_timing.txt
 
 
 struct opcode opcodetab[256] = {
@@ -26,8 +27,8 @@ struct opcode opcodetab[256] = {
   //{0x00, 0, trap,   0,  "---"},
   {0x00, 0, nop_inh,  1,  "nop0"}, // SS
   {0x01, 0, nop_inh,  1,  "nop"},
-  {0x02, 0, trap,   0,  "---"},
-  {0x03, 0, trap,   0,  "---"},
+  {0x02, 0, trap,   12, "---"},
+  {0x03, 0, trap,   12, "---"},
   {0x04, 0, lsrd_inh, 1,  "lsrd"},
   {0x05, 0, asld_inh, 1,  "asld"},
   {0x06, 0, tap_inh,  1,  "tap"},
@@ -43,20 +44,20 @@ struct opcode opcodetab[256] = {
 
   {0x10, 0, sba_inh,  1,  "sba"},
   {0x11, 0, cba_inh,  1,  "cba"},
-  {0x12, 0, trap,   0,  "---"},
-  {0x13, 0, trap,   0,  "---"},
-  {0x14, 0, trap,   0,  "---"},
-  {0x15, 0, trap,   0,  "---"},
+  {0x12, 0, trap,   12, "---"},
+  {0x13, 0, trap,   12, "---"},
+  {0x14, 0, trap,   12, "---"},
+  {0x15, 0, trap,   12, "---"},
   {0x16, 0, tab_inh,  1,  "tab"},
   {0x17, 0, tba_inh,  1,  "tba"},
   {0x18, 0, xgdx_inh, 2,  "xgdx"},
   {0x19, 0, daa_inh,  2,  "daa"},
   {0x1a, 0, slp_inh,  4,  "slp"},
   {0x1b, 0, aba_inh,  1,  "aba"},
-  {0x1c, 0, trap,   0,  "---"},
-  {0x1d, 0, trap,   0,  "---"},
-  {0x1e, 0, trap,   0,  "---"},
-  {0x1f, 0, trap,   0,  "---"},
+  {0x1c, 0, trap,   12, "---"},
+  {0x1d, 0, trap,   12, "---"},
+  {0x1e, 0, trap,   12, "---"},
+  {0x1f, 0, trap,   12, "---"},
 
   {0x20, 1, bra_rel,  3,  "bra  %02x"},
   {0x21, 1, brn_rel,  3,  "brn  %02x"},
@@ -94,37 +95,37 @@ struct opcode opcodetab[256] = {
   {0x3f, 0, swi_inh,  12, "swi"},
 
   {0x40, 0, nega_inh, 1,  "nega"},
-  {0x41, 0, trap,   0,  "---"},
-  {0x42, 0, trap,   0,  "---"},
+  {0x41, 0, trap,   12, "---"},
+  {0x42, 0, trap,   12, "---"},
   {0x43, 0, coma_inh, 1,  "coma"},
   {0x44, 0, lsra_inh, 1,  "lsra"},
-  {0x45, 0, trap,   0,  "---"},
+  {0x45, 0, trap,   12, "---"},
   {0x46, 0, rora_inh, 1,  "rora"},
   {0x47, 0, asra_inh, 1,  "asra"},
   {0x48, 0, lsla_inh, 1,  "lsla"},
   {0x49, 0, rola_inh, 1,  "rola"},
   {0x4a, 0, deca_inh, 1,  "deca"},
-  {0x4b, 0, trap,   0,  "---"},
+  {0x4b, 0, trap,   12, "---"},
   {0x4c, 0, inca_inh, 1,  "inca"},
   {0x4d, 0, tsta_inh, 1,  "tsta"},
-  {0x4e, 0, trap,   0,  "---"},
+  {0x4e, 0, trap,   12, "---"},
   {0x4f, 0, clra_inh, 1,  "clra"},
 
   {0x50, 0, negb_inh, 1,  "negb"},
-  {0x51, 0, trap,   0,  "---"},
-  {0x52, 0, trap,   0,  "---"},
+  {0x51, 0, trap,   12, "---"},
+  {0x52, 0, trap,   12, "---"},
   {0x53, 0, comb_inh, 1,  "comb"},
   {0x54, 0, lsrb_inh, 1,  "lsrb"},
-  {0x55, 0, trap,   0,  "---"},
+  {0x55, 0, trap,   12, "---"},
   {0x56, 0, rorb_inh, 1,  "rorb"},
   {0x57, 0, asrb_inh, 1,  "asrb"},
   {0x58, 0, lslb_inh, 1,  "lslb"},
   {0x59, 0, rolb_inh, 1,  "rolb"},
   {0x5a, 0, decb_inh, 1,  "decb"},
-  {0x5b, 0, trap,   0,  "---"},
+  {0x5b, 0, trap,   12, "---"},
   {0x5c, 0, incb_inh, 1,  "incb"},
   {0x5d, 0, tstb_inh, 1,  "tstb"},
-  {0x5e, 0, trap,   0,  "---"},
+  {0x5e, 0, trap,   12, "---"},
   {0x5f, 0, clrb_inh, 1,  "clrb"},
 
   {0x60, 1, neg_ind_x,  6,  "neg %02x,x"},
@@ -165,7 +166,7 @@ struct opcode opcodetab[256] = {
 //  {0x7b, 0, tim_dir,  4,  "tim %02x"}, //SS
   {0x7b, 2, tim_dir,  4,  "tim %04x"}, //SS
   {0x7c, 2, inc_ext,  6,  "inc %04x"},
-  {0x7d, 2, tst_ext,  6,  "tst %04x"},
+  {0x7d, 2, tst_ext,  4,  "tst %04x"},
   {0x7e, 2, jmp_ext,  3,  "jmp %04x"},
   {0x7f, 2, clr_ext,  5,  "clr %04x"},
 
@@ -176,7 +177,7 @@ struct opcode opcodetab[256] = {
   {0x84, 1, anda_imm, 2,  "anda #%02x"},
   {0x85, 1, bita_imm, 2,  "bita #%02x"},
   {0x86, 1, ldaa_imm, 2,  "ldaa #%02x"},
-  {0x87, 1, trap,   0,  "---"},
+  {0x87, 1, trap,   12, "---"},
   {0x88, 1, eora_imm, 2,  "eora #%02x"},
   {0x89, 1, adca_imm, 2,  "adca #%02x"},
   {0x8a, 1, oraa_imm, 2,  "oraa #%02x"},
@@ -184,7 +185,7 @@ struct opcode opcodetab[256] = {
   {0x8c, 2, cpx_imm,  3,  "cpx  #%04x"},
   {0x8d, 1, bsr_rel,  5,  "bsr  %02x"},
   {0x8e, 2, lds_imm,  3,  "lds  #%04x"},
-  {0x8f, 0, trap,   0,  "---"},
+  {0x8f, 0, trap,   12, "---"},
 
   {0x90, 1, suba_dir, 3,  "suba %02x"},
   {0x91, 1, cmpa_dir, 3,  "cmpa %02x"},
@@ -245,15 +246,15 @@ struct opcode opcodetab[256] = {
   {0xC4, 1, andb_imm, 2,  "andb #%02x"},
   {0xC5, 1, bitb_imm, 2,  "bitb #%02x"},
   {0xC6, 1, ldab_imm, 2,  "ldab #%02x"},
-  {0xC7, 0, trap,   0,  "---"},
+  {0xC7, 0, trap,   12, "---"},
   {0xC8, 1, eorb_imm, 2,  "eorb #%02x"},
   {0xC9, 1, adcb_imm, 2,  "adcb #%02x"},
   {0xCa, 1, orab_imm, 2,  "orab #%02x"},
   {0xCb, 1, addb_imm, 2,  "addb #%02x"},
   {0xCc, 2, ldd_imm,  3,  "ldd  #%04x"},
-  {0xCd, 0, trap,   0,  "---"},
+  {0xCd, 0, trap,   12, "---"},
   {0xCe, 2, ldx_imm,  3,  "ldx  #%04x"},
-  {0xCf, 0, trap,   0,  "---"},
+  {0xCf, 0, trap,   12, "---"},
 
   {0xD0, 1, subb_dir, 3,  "subb %02x"},
   {0xD1, 1, cmpb_dir, 3,  "cmpb %02x"},
@@ -0,0 +1,91 @@
+/*
+ * predecode.c - pre-decoded instruction cache
+ *
+ * The IKBD ROM is decoded once, when the CPU gets a cold reset (the ROM
+ * image has been copied by then), into one entry per address. Internal RAM,
+ * where custom code uploaded by the ST runs, is decoded on first execution
+ * and an entry is dropped as soon as one of its three bytes is written.
+ *
+ * Only memory without side effects on reads is cached, so fetching the
+ * operand bytes ahead of execution is not visible to the program.
+ */
+#include "defs.h"
+#include "memory.h"
+#include "optab.h"
+
+#ifdef USE_PROTOTYPES
+#include "predecode.h"
+#endif
+
+struct predecode predecode_rom[PREDECODE_ROM_SIZE];
+struct predecode predecode_ram[PREDECODE_RAM_SIZE];
+/* Two extra entries in front so writes to 0x80/0x81 need no clamping */
+u_char predecode_ram_valid[2 + PREDECODE_RAM_SIZE];
+int predecode_ram_used = 0;
+
+/*
+ * predecode_decode - decode the instruction at addr into entry
+ */
+void predecode_decode(entry, addr)
+struct predecode *entry;
+u_int addr;
+{
+  entry->op = mem_getb(addr);
+  entry->cycles = opcodetab[entry->op].op_n_cycles;
+  entry->operand = (mem_getb(addr + 1) << 8) | mem_getb(addr + 2);
+}
+
+/*
+ * predecode_rom_build - decode the whole ROM
+ */
+void predecode_rom_build() {
+  u_int i;
+
+  for (i = 0; i < PREDECODE_ROM_SIZE; i++)
+    predecode_decode(&predecode_rom[i], PREDECODE_ROM_START + i);
+  predecode_ram_flush();
+}
+
+/*
+ * predecode_rom_write - update the entries covering a written ROM byte
+ *
+ * The real chip ignores these writes but mem_putb() doesn't.
+ */
+void predecode_rom_write(addr)
+u_int addr;
+{
+  u_int a;
+
+  for (a = addr - 2; a <= addr; a++)
+    if (a - PREDECODE_ROM_START < PREDECODE_ROM_SIZE)
+      predecode_decode(&predecode_rom[a - PREDECODE_ROM_START], a);
+}
+
+/*
+ * predecode_ram_entry - entry for the instruction at addr (0x80-0xFF)
+ */
+struct predecode *predecode_ram_entry(addr)
+u_int addr;
+{
+  struct predecode *entry = &predecode_ram[addr - PREDECODE_RAM_START];
+  u_char *valid = &predecode_ram_valid[addr - PREDECODE_RAM_START + 2];
+
+  if (!*valid) {
+    predecode_decode(entry, addr);
+    *valid = 1;
+    predecode_ram_used = 1;
+  }
+  return entry;
+}
+
+/*
+ * predecode_ram_flush - drop all RAM entries
+ *
+ * For memory changed behind the CPU's back (snapshots, tests).
+ */
+void predecode_ram_flush() {
+  if (predecode_ram_used) {
+    memset(predecode_ram_valid, 0, sizeof(predecode_ram_valid));
+    predecode_ram_used = 0;
+  }
+}
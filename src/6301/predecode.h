@@ -0,0 +1,55 @@
+/*
+ *  Pre-decoded instructions for the threaded engine
+ */
+#ifndef H6301_PREDECODE_H
+#define H6301_PREDECODE_H
+
+#include "defs.h"
+
+#if defined(__STDC__) || defined(__cplusplus)
+# define P_(s) s
+#else
+# define P_(s) ()
+#endif
+
+/*
+ * One entry per address. The opcode selects the handler, which knows its
+ * addressing mode; the two bytes following the opcode are always fetched,
+ * first byte in the high half of 'operand'.
+ */
+struct predecode {
+  u_char  op;       /* opcode, index of the handler */
+  u_char  cycles;   /* opcodetab[op].op_n_cycles */
+  u_short operand;  /* bytes at addr + 1 and addr + 2 */
+};
+
+#define PREDECODE_ROM_START 0xF000
+#define PREDECODE_ROM_SIZE  0x1000
+#define PREDECODE_RAM_START 0x80
+#define PREDECODE_RAM_SIZE  0x80
+
+extern struct predecode predecode_rom[];
+extern struct predecode predecode_ram[];
+extern u_char predecode_ram_valid[];
+extern int predecode_ram_used;
+
+/*
+ * predecode_ram_write - invalidate the RAM entries covering a written byte
+ */
+#define predecode_ram_write(addr)                                 \
+  do {                                                            \
+    if (predecode_ram_used) {                                     \
+      u_char *valid_ = &predecode_ram_valid[(addr) - PREDECODE_RAM_START + 2]; \
+      valid_[0] = valid_[-1] = valid_[-2] = 0;                    \
+    }                                                             \
+  } while (0)
+
+/* predecode.c */
+extern void predecode_decode P_((struct predecode *entry, u_int addr));
+extern void predecode_rom_build P_((void));
+extern void predecode_rom_write P_((u_int addr));
+extern struct predecode *predecode_ram_entry P_((u_int addr));
+extern void predecode_ram_flush P_((void));
+
+#undef P_
+#endif /* H6301_PREDECODE_H */
@@ -11,6 +11,7 @@
 #include "cpu.h"
 #include "defs.h"
 #include "ireg.h"
+#include "timer.h"
 
 /*
 This part of the emu deals with serial I/O between the 6301 and its CPU, in
@@ -27,6 +28,159 @@ $0013    | B | TDR   | Transmit Data Register                         | W0
 ------------------------------------------------------------------------------
 */
 
+/*
+ * Transmitter
+ *
+ * TDR is double buffered. A byte written to it moves to the shift register
+ * as soon as that is free, which sets TDRE again and puts the byte on the
+ * line (serialp_send()). The shift register then stays busy for ten bit
+ * times at the rate RMCR selects (1280 cycles at E/128, as set by the IKBD
+ * ROM), and a second byte waits in TDR with TDRE clear until then. The ROM
+ * is held back as by the real line, whatever the UART behind
+ * serialp_send() does.
+ *
+ * sci_tx_begin is the cycle at which the last byte went into the shift
+ * register, sci_tx_end the one at which that is free again. While a byte
+ * waits in TDR, the latter is an event for timer.c.
+ */
+COUNTER_VAR sci_tx_begin = 0;
+COUNTER_VAR sci_tx_end = 0;
+
+static const u_short sci_bit_cycles[4] = {16, 128, 1024, 4096};
+
+#define sci_byte_cycles() (10 * sci_bit_cycles[iram[RMCR] & 3])
+
+/*
+ * Wake-up
+ *
+ * WU, set by the ROM, is cleared by the receiver once it has seen ten 1
+ * bits on the line. The line from the ST idles high, so that is a byte
+ * time after WU was set, or after the last byte received if it came in
+ * later. sci_wu_end is that cycle, an event for timer.c while WU is set.
+ */
+COUNTER_VAR sci_wu_end = 0;
+
+/*
+ * Receiver
+ *
+ * Bytes from the ST are queued by sci_rx_put(), on whatever core runs the
+ * serial port, and moved into RDR by the core running the 6301, one byte
+ * time apart as they would come off the line. A byte only goes in once
+ * the previous one has been read, so none is lost to an overrun however
+ * late the queue is looked at. Single producer, single consumer: each
+ * index is written by one side only, the other one just reads it.
+ *
+ * sci_rx_next is the earliest cycle for the next byte into RDR, an event
+ * for timer.c while a byte waits and RDR is free; sci_rx_last is the cycle
+ * the last one went in, at which serialp_received() is told about it.
+ */
+static u_char sci_rx_queue[SCI_RX_QUEUE_SIZE];
+static u_int sci_rx_head = 0; /* written by sci_rx_put() */
+static u_int sci_rx_tail = 0; /* written by the 6301 side */
+COUNTER_VAR sci_rx_next = 0;
+COUNTER_VAR sci_rx_last = 0;
+
+#define sci_rx_pending() \
+  (__atomic_load_n(&sci_rx_head, __ATOMIC_ACQUIRE) != sci_rx_tail)
+
+/*
+ * sci_tx_start - move TDR to the shift register, at cycle 'start'
+ */
+static void sci_tx_start(start)
+COUNTER_VAR start;
+{
+  sci_tx_begin = start;
+  sci_tx_end = start + sci_byte_cycles();
+  serialp_send(ireg_getb(TDR));
+  iram[TRCSR] |= TDRE;
+  cpu_int_recheck();  // TIE may be set
+  cpu_event(HD6301_EVENT_TX);
+}
+
+/*
+ * sci_deadline - next cycle at which the transmitter changes state
+ */
+COUNTER_VAR sci_deadline() {
+  COUNTER_VAR deadline = (iram[TRCSR] & TDRE) ? SCI_NO_DEADLINE : sci_tx_end;
+
+  if (!(iram[TRCSR] & RDRF) && sci_rx_pending() && sci_rx_next < deadline)
+    deadline = sci_rx_next;
+  if ((iram[TRCSR] & WU) && sci_wu_end < deadline) deadline = sci_wu_end;
+  return deadline;
+}
+
+/*
+ * sci_event - called by timer_event() once sci_deadline() is reached
+ */
+void sci_event(now)
+COUNTER_VAR now;
+{
+  if (!(iram[TRCSR] & TDRE) && now >= sci_tx_end) {
+    // the byte went in when the previous one was out, not at 'now'
+    sci_tx_start(sci_tx_end);
+  }
+  if (!(iram[TRCSR] & RDRF) && sci_rx_pending() && now >= sci_rx_next) {
+    u_char byte = sci_rx_queue[sci_rx_tail & (SCI_RX_QUEUE_SIZE - 1)];
+
+    __atomic_store_n(&sci_rx_tail, sci_rx_tail + 1, __ATOMIC_RELEASE);
+    // counted from now, RDR may have been read late
+    sci_rx_last = now;
+    sci_rx_next = now + sci_byte_cycles();
+    sci_in(&byte, 1);
+    serialp_received(byte);
+  }
+  if ((iram[TRCSR] & WU) && now >= sci_wu_end) iram[TRCSR] &= ~WU;
+}
+
+/*
+ * sci_rx_put - queue a byte from the ST, returns 0 if the queue is full
+ */
+int sci_rx_put(byte)
+u_char byte;
+{
+  u_int head = sci_rx_head;
+
+  if (head - __atomic_load_n(&sci_rx_tail, __ATOMIC_ACQUIRE) >=
+      SCI_RX_QUEUE_SIZE)
+    return 0;
+  sci_rx_queue[head & (SCI_RX_QUEUE_SIZE - 1)] = byte;
+  __atomic_store_n(&sci_rx_head, head + 1, __ATOMIC_RELEASE);
+  return 1;
+}
+
+/*
+ * sci_rx_free - room left in the queue, for the producer
+ */
+u_int sci_rx_free() {
+  return SCI_RX_QUEUE_SIZE - (sci_rx_head - __atomic_load_n(&sci_rx_tail,
+                                                             __ATOMIC_ACQUIRE));
+}
+
+/*
+ * sci_rx_queued - bytes waiting for RDR, for either side
+ */
+u_int sci_rx_queued() {
+  return __atomic_load_n(&sci_rx_head, __ATOMIC_ACQUIRE) -
+         __atomic_load_n(&sci_rx_tail, __ATOMIC_ACQUIRE);
+}
+
+/*
+ * sci_rx_schedule - bring the deadline forward for a queued byte, when
+ * RDR is free: at the start of a run, the queue is filled from outside
+ */
+void sci_rx_schedule() {
+  if (!(iram[TRCSR] & RDRF) && sci_rx_pending() && sci_rx_next < timer_deadline)
+    timer_deadline = sci_rx_next;
+}
+
+/*
+ * sci_rx_flush - drop what is queued, on the 6301 side (cold reset)
+ */
+void sci_rx_flush() {
+  __atomic_store_n(&sci_rx_tail, __atomic_load_n(&sci_rx_head, __ATOMIC_ACQUIRE),
+                   __ATOMIC_RELEASE);
+}
+
 /*
  * Pseudo-received data buffer used by rdr_getb() routines
  */
@@ -43,11 +197,15 @@ int nbytes;
   if (iram[TRCSR] & RDRF) {
     DPRINTF("6301 OVR SR %X->%X\n", iram[TRCSR], iram[TRCSR] | ORFE);
     iram[TRCSR] |= ORFE;  // hardware sets overrun bit
+#ifdef HD6301_STATS
+    hd6301_stats.rx_overruns++;
+#endif
   } else {
     ireg_putb(RDR, *s);
     // DPRINTF("6301 RDR %X\n", *s);
   }
   iram[TRCSR] |= RDRF;  // set RDRF
+  cpu_int_recheck();
 }
 
 /*
@@ -77,7 +235,7 @@ reads or writes the status/control register $11 (often).
 */
 
 /*
- * trcsr_getb - always return Transmit Data Reg. Empty = 1
+ * trcsr_getb - TDRE as the transmitter left it, see above
  */
 
 u_char trcsr_getb(offs)
@@ -98,12 +256,18 @@ trcsr_putb(offs, value) u_int offs;
 u_char value;
 {
   //  ASSERT(value&RE); // Receive is never disabled by program
-  if (value & 1) DPRINTF("Set 6301 stand-by\n");
+  if ((value & WU) && !(iram[TRCSR] & WU)) {
+    DPRINTF("Set 6301 stand-by\n");
+    sci_wu_end = (cpu.ncycles > sci_rx_last ? cpu.ncycles : sci_rx_last) +
+                 sci_byte_cycles();
+    if (sci_wu_end < timer_deadline) timer_deadline = sci_wu_end;
+  }
 
   // bits 5-7 of TRCSR can't be set by software
   value &= 0x1F;
   value |= (iram[0x11] & 0xE0);  // add RO bits 5-7
   ireg_putb(TRCSR, value);
+  cpu_int_recheck();  // RIE/TIE may have been set
 }
 
 /*
@@ -125,6 +289,8 @@ u_int offs;
     if (iram[TRCSR] & RDRF) {
       // DPRINTF("6301 (PC %X)\n", reg_getpc());
       iram[TRCSR] &= ~RDRF;
+      cpu_event(HD6301_EVENT_RX);
+      sci_rx_schedule();  // next byte, if one is queued
     }
     if (iram[TRCSR] & ORFE) {
       // DPRINTF("6301 clear OVR\n");
@@ -138,30 +304,21 @@ u_int offs;
 /*
  * tdr_putb - called to output a character
  *
- * Sets global interrupt flag if Tx interrupt is enabled
- * to signalize main loop to execute sci interrupt vector
+ * The byte goes out at once if the shift register is free, else it waits
+ * in TDR with TDRE clear until sci_event(). A byte already waiting is
+ * overwritten, as on the chip.
  */
 
 tdr_putb(offs, value) u_int offs;
 u_char value;
 {
-  u_char trcsr;
-
   ireg_putb(TDR, value);
-  /*
-   * trcsr & TDRE is always non-zero, thus we can
-   * start generating tx int. request immediately
-   */
-
-  trcsr = trcsr_getb(TRCSR);
-
-  /*  Double buffer allows 1 byte waiting in TDR while another is being
-    shifted, but not more.
-    TDRE = 0 while a byte is waiting in TDR.
-*/
   // DPRINTF("6301 TDR %X\n", value);
-  serialp_send(value);
 
-  // Flag a byte as waiting
   iram[TRCSR] &= ~TDRE;
+  if (cpu.ncycles >= sci_tx_end) {
+    sci_tx_start(cpu.ncycles);
+  } else if (sci_tx_end < timer_deadline) {
+    timer_deadline = sci_tx_end;
+  }
 }
@@ -18,6 +18,36 @@
 #define serial_int()\
   (((ireg_getb (TRCSR) & RDRF) && (ireg_getb (TRCSR) & RIE))\
    || ((ireg_getb (TRCSR) & TDRE) && (ireg_getb (TRCSR) & TIE)))
+/*
+ * Cycles at which the byte being sent went into the transmit shift
+ * register and at which that is free again, see sci.c
+ */
+extern COUNTER_VAR sci_tx_begin;
+extern COUNTER_VAR sci_tx_end;
+
+/*
+ * Earliest cycle for the next received byte into RDR, and cycle the last
+ * one went in
+ */
+extern COUNTER_VAR sci_rx_next;
+extern COUNTER_VAR sci_rx_last;
+
+/*
+ * Cycle at which WU clears, see sci.c
+ */
+extern COUNTER_VAR sci_wu_end;
+
+#define SCI_RX_QUEUE_SIZE 512 /* bytes from the ST, power of 2 */
+
+#define SCI_NO_DEADLINE INT64_MAX
+
+extern COUNTER_VAR sci_deadline P_((void));
+extern void sci_event P_((COUNTER_VAR now));
+extern int sci_rx_put P_((u_char byte));
+extern u_int sci_rx_free P_((void));
+extern u_int sci_rx_queued P_((void));
+extern void sci_rx_schedule P_((void));
+extern void sci_rx_flush P_((void));
 extern int sci_in P_((u_char *s, int nbytes));
 extern int sci_print P_((void));
 extern u_char trcsr_getb P_((u_int offs));
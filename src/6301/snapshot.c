@@ -0,0 +1,89 @@
+/*
+ * snapshot.c - save and restore the whole state of the 6301
+ *
+ * For the host tools that run the same stretch on two engines (the
+ * lockstep check in tests/host), only built with HD6301_SNAPSHOT. Between
+ * runs only: neither side of the SCI queue may be in use. Part of 6301.c,
+ * for the static state of the other modules.
+ */
+#include "snapshot.h"
+
+#include <string.h>
+
+#include "dispatch.h"
+#include "predecode.h"
+#include "timer.h"
+
+void snapshot_save(s)
+struct hd6301_snapshot *s;
+{
+  s->regs = regs;
+  s->cpu = cpu;
+  s->crashed = crashed;
+  memcpy(s->ram, ram, SNAPSHOT_RAM_SIZE);
+  memcpy(s->iram, iram, NIREGS);
+  s->timer_epoch = timer_epoch;
+  s->timer_deadline = timer_deadline;
+  s->tcsr_is_read = tcsr_is_read;
+  s->sci_tx_begin = sci_tx_begin;
+  s->sci_tx_end = sci_tx_end;
+  s->sci_wu_end = sci_wu_end;
+  s->sci_rx_next = sci_rx_next;
+  s->sci_rx_last = sci_rx_last;
+  s->sci_rx_head = sci_rx_head;
+  s->sci_rx_tail = sci_rx_tail;
+  memcpy(s->sci_rx_queue, sci_rx_queue, SCI_RX_QUEUE_SIZE);
+  memcpy(s->kbd_pos, kbd_pos, sizeof(kbd_pos));
+  memcpy(s->kbd_level, kbd_level, KBD_COLUMNS);
+  memcpy(s->kbd_want, kbd_want, KBD_COLUMNS);
+  memcpy(s->kbd_flip, kbd_flip, KBD_COLUMNS);
+  memcpy(s->kbd_unseen, kbd_unseen, KBD_COLUMNS);
+  memcpy(s->kbd_read_scan, kbd_read_scan, sizeof(kbd_read_scan));
+  s->kbd_scan = kbd_scan;
+  s->kbd_select = kbd_select;
+  s->mouse_x_counter = mouse_x_counter;
+  s->mouse_y_counter = mouse_y_counter;
+}
+
+void snapshot_load(s)
+const struct hd6301_snapshot *s;
+{
+  // The ROM only changes when a program writes to it, the caches follow
+  int rom_changed =
+      memcmp(ram + 256, s->ram + 256, SNAPSHOT_RAM_SIZE - 256) != 0;
+
+  regs = s->regs;
+  cpu = s->cpu;
+  crashed = s->crashed;
+  memcpy(ram, s->ram, SNAPSHOT_RAM_SIZE);
+  memcpy(iram, s->iram, NIREGS);
+  timer_epoch = s->timer_epoch;
+  timer_deadline = s->timer_deadline;
+  tcsr_is_read = s->tcsr_is_read;
+  sci_tx_begin = s->sci_tx_begin;
+  sci_tx_end = s->sci_tx_end;
+  sci_wu_end = s->sci_wu_end;
+  sci_rx_next = s->sci_rx_next;
+  sci_rx_last = s->sci_rx_last;
+  sci_rx_head = s->sci_rx_head;
+  sci_rx_tail = s->sci_rx_tail;
+  memcpy(sci_rx_queue, s->sci_rx_queue, SCI_RX_QUEUE_SIZE);
+  memcpy(kbd_pos, s->kbd_pos, sizeof(kbd_pos));
+  memcpy(kbd_level, s->kbd_level, KBD_COLUMNS);
+  memcpy(kbd_want, s->kbd_want, KBD_COLUMNS);
+  memcpy(kbd_flip, s->kbd_flip, KBD_COLUMNS);
+  memcpy(kbd_unseen, s->kbd_unseen, KBD_COLUMNS);
+  memcpy(kbd_read_scan, s->kbd_read_scan, sizeof(kbd_read_scan));
+  kbd_scan = s->kbd_scan;
+  kbd_select = s->kbd_select;
+  mouse_x_counter = s->mouse_x_counter;
+  mouse_y_counter = s->mouse_y_counter;
+
+  if (rom_changed) {
+    predecode_rom_build();
+    dispatch_rom_build();
+  } else {
+    predecode_ram_flush();
+  }
+  cpu_int_recheck();
+}
@@ -0,0 +1,58 @@
+/*
+ *  Whole state of the emulated 6301, to run it twice from the same point
+ */
+#ifndef H6301_SNAPSHOT_H
+#define H6301_SNAPSHOT_H
+
+#include "6301.h"
+#include "chip.h"
+#include "cpu.h"
+#include "defs.h"
+#include "ireg.h"
+#include "reg.h"
+#include "sci.h"
+
+#if defined(__STDC__) || defined(__cplusplus)
+# define P_(s) s
+#else
+# define P_(s) ()
+#endif
+
+#define SNAPSHOT_RAM_SIZE (256 + 4096) /* as allocated by mem_init() */
+
+/*
+ * Everything instructions, the timer, the SCI and the key matrix depend
+ * on. Caches derived from memory (pre-decoded and translated code, the
+ * block cache) are not part of it, snapshot_load() rebuilds them when the
+ * ROM differs. The statistics are not either.
+ */
+struct hd6301_snapshot {
+  struct regs regs;
+  struct cpu cpu;
+  int crashed;
+  u_char ram[SNAPSHOT_RAM_SIZE];
+  u_char iram[NIREGS];
+  /* timer.c */
+  COUNTER_VAR timer_epoch;
+  COUNTER_VAR timer_deadline;
+  int tcsr_is_read;
+  /* sci.c */
+  COUNTER_VAR sci_tx_begin, sci_tx_end, sci_wu_end;
+  COUNTER_VAR sci_rx_next, sci_rx_last;
+  u_int sci_rx_head, sci_rx_tail;
+  u_char sci_rx_queue[SCI_RX_QUEUE_SIZE];
+  /* ireg.c, the key matrix */
+  u_char kbd_pos[128];
+  u_char kbd_level[KBD_COLUMNS], kbd_want[KBD_COLUMNS];
+  u_char kbd_flip[KBD_COLUMNS], kbd_unseen[KBD_COLUMNS];
+  u_int kbd_read_scan[KBD_COLUMNS];
+  u_int kbd_scan, kbd_select;
+  unsigned int mouse_x_counter, mouse_y_counter;
+};
+
+/* snapshot.c */
+extern void snapshot_save P_((struct hd6301_snapshot *s));
+extern void snapshot_load P_((const struct hd6301_snapshot *s));
+
+#undef P_
+#endif /* H6301_SNAPSHOT_H */
@@ -6,8 +6,10 @@
  *  Timer functions
  */
 #include "chip.h" /* chip address definitions */
+#include "cpu.h"
 #include "defs.h"
 #include "ireg.h"
+#include "sci.h"
 
 #ifdef USE_PROTOTYPES
 #include "memory.h"
@@ -16,6 +18,51 @@
 
 static int tcsr_is_read = 0;
 
+COUNTER_VAR timer_deadline = 0;
+static COUNTER_VAR timer_epoch = 0; /* cycle count at which FRC was 0 */
+
+#define timer_frc(cycles) ((u_int)((cycles) - timer_epoch) & 0xFFFF)
+
+/*
+ * timer_schedule - set the deadline to the next time FRC hits OCR or 0,
+ * or the SCI transmitter is done with a byte
+ */
+static void timer_schedule(now)
+COUNTER_VAR now;
+{
+  u_int frc = timer_frc(now);
+  u_int to_ocr = (ireg_getw(OCR) - frc) & 0xFFFF;
+  u_int to_wrap = (0x10000 - frc) & 0xFFFF;
+  COUNTER_VAR sci = sci_deadline();
+
+  if (!to_ocr) to_ocr = 0x10000;
+  if (!to_wrap) to_wrap = 0x10000;
+  timer_deadline = now + (to_ocr < to_wrap ? to_ocr : to_wrap);
+  if (sci < timer_deadline) timer_deadline = sci;
+}
+
+/*
+ * timer_sync - store the current FRC value in the internal registers
+ */
+void timer_sync() { ireg_putw(FRC, timer_frc(cpu.ncycles)); }
+
+/*
+ * timer_reload - take FRC and OCR from the internal registers
+ *
+ * After cpu.ncycles or the registers were changed from outside.
+ */
+void timer_reload() {
+  timer_epoch = cpu.ncycles - ireg_getw(FRC);
+  timer_schedule(cpu.ncycles);
+}
+
+u_char frc_getb(offs)
+u_int offs;
+{
+  timer_sync();
+  return ireg_getb(offs);
+}
+
 // TODO? it's possible to write on FRC, see Hitachi doc
 
 u_char tcsr_getb(offs)
@@ -37,6 +84,7 @@ u_char value;
   u_char read_only = (ICF | OCF | TOF);
 
   ireg_putb(TCSR, (ireg_getb(TCSR) & read_only) | (value & ~read_only));
+  cpu_int_recheck();  // EOCI may have been set
 }
 
 /*
@@ -49,6 +97,7 @@ ocr_putb(offs, value) u_int offs;
 u_char value;
 {
   ireg_putb(offs, value);
+  timer_schedule(cpu.ncycles);
   /*
    * Clear OCF if TCSR is read
    */
@@ -59,21 +108,23 @@ u_char value;
 }
 
 /*
- * timer_inc - increment timer, given the number of clock cycles passed
+ * timer_event - called through timer_inc() when the instruction that
+ * took the last ncycles cycles, ending at 'now', reached the deadline
  *
  * 6801 has prescaler of 1
  */
-timer_inc(ncycles) u_int ncycles;
+timer_event(now, ncycles) COUNTER_VAR now;
+u_int ncycles;
 {
   u_int frc_old;    /* Free Running Counter */
   u_short frc_new;  // 16 bit, must overflow
   u_int ocr;        /* Output Compare Register */
 
   /*
-   * Get old and compute new timer value
+   * Get old and new timer value
    */
-  frc_old = ireg_getw(FRC);
-  frc_new = (u_short)(frc_old + ncycles);
+  frc_old = timer_frc(now - ncycles);
+  frc_new = (u_short)timer_frc(now);
 
   /*
    * Check against timer compare registers
@@ -83,10 +134,15 @@ timer_inc(ncycles) u_int ncycles;
   // detect overflow (AFAIK nothing uses it)
   if (frc_old > frc_new) ireg_putb(TCSR, ireg_getb(TCSR) | TOF);
 
-  //  detect output compare
+  //  detect output compare, as timer_inc() always did: an instruction
+  //  taking FRC past OCR and through 0 at once (OCR 0xFFFE, FRC 0xFFFC to
+  //  0x0002) sets no OCF, see engine_test
   if (frc_new >= ocr && (frc_old < ocr || frc_old > frc_new)) {
     ireg_putb(TCSR, ireg_getb(TCSR) | OCF);
     tcsr_is_read = 0;
+    cpu_int_recheck();
   }
-  ireg_putw(FRC, frc_new);
+  if (now >= sci_deadline()) sci_event(now);
+  timer_schedule(now);
+  return 0;
 }
@@ -9,11 +9,28 @@
 #endif
 
 
+/*
+ * FRC isn't stored, it is derived from cpu.ncycles. timer_deadline is the
+ * next cycle count at which FRC reaches OCR or wraps, the only points
+ * where TCSR flags can change, or at which the SCI moves a byte waiting in
+ * TDR to the shift register (sci_deadline()).
+ */
+extern COUNTER_VAR timer_deadline;
+
+/*
+ * timer_inc - account for ncycles just added to cpu.ncycles
+ */
+#define timer_inc(n) \
+  (cpu.ncycles >= timer_deadline ? timer_event(cpu.ncycles, n) : 0)
+
 /* ../../src/arch/h6301/timer.c */
 extern u_char tcsr_getb P_((u_int offs));
 extern int tcsr_putb P_((u_int offs, u_char value));
 extern int ocr_putb P_((u_int offs, u_char value));
-extern int timer_inc P_((u_int ncycles));
+extern u_char frc_getb P_((u_int offs));
+extern int timer_event P_((COUNTER_VAR now, u_int ncycles));
+extern void timer_sync P_((void));
+extern void timer_reload P_((void));
 
 #undef P_
 #endif /* H6301_TIMER_H */
@@ -6,6 +6,7 @@
 
 #include "btstack.h"
 #include "btstack_util.h"
+#include "capture.h"
 #include "gconfig.h"
 #include "joystick.h"
 #include "pico/async_context.h"
@@ -20,6 +21,8 @@ extern "C" {
 #endif
 void hidinput_update_mouse(int16_t dx, int16_t dy, bool left_down,
                            bool right_down);
+void hidinput_changed(void);
+void hidinput_flush(void);
 #ifdef __cplusplus
 }
 #endif
@@ -318,6 +321,7 @@ static void handle_keyboard_report(const uint8_t *report, uint16_t len) {
 
   stkeys_apply_keyboard_report_layout(last_keyboard_keys, normalized_keys, 6,
                                       fixed_modifiers, bt_get_layout());
+  hidinput_changed();
 
   // uint8_t changed_modifiers = fixed_modifiers ^ last_modifiers;
   // if (changed_modifiers != 0) {
@@ -365,6 +369,9 @@ static void handle_keyboard_report(const uint8_t *report, uint16_t len) {
 void btloop_tick(void) {
   absolute_time_t now = get_absolute_time();
 
+  capture_flush();
+  hidinput_flush();
+
   if (absolute_time_diff_us(s_mouse_last_sample, now) >=
       MOUSE_LINE_POLL_INTERVAL_US) {
     s_mouse_last_sample = now;
@@ -644,6 +651,54 @@ static const char *axis_dir(int32_t value, const char *neg, const char *pos) {
   return "center";
 }
 
+#if defined(IKBD_TRACE) && IKBD_TRACE
+// What the controller sent, for the trace: the main axes or the mouse
+// motion in x and y, the rest packed in the data bytes
+static void btloop_capture(uni_controller_class_t klass,
+                           const uni_controller_t *ctl) {
+  uint8_t data[8] = {0};
+  switch (klass) {
+    case UNI_CONTROLLER_CLASS_GAMEPAD: {
+      const uni_gamepad_t *gp = &ctl->gamepad;
+      int16_t rx = (int16_t)gp->axis_rx, ry = (int16_t)gp->axis_ry;
+      data[0] = gp->dpad;
+      data[1] = gp->buttons & 0xff;
+      data[2] = gp->buttons >> 8;
+      data[3] = gp->misc_buttons;
+      data[4] = rx & 0xff;
+      data[5] = (uint16_t)rx >> 8;
+      data[6] = ry & 0xff;
+      data[7] = (uint16_t)ry >> 8;
+      capture_bt_data(klass, gp->axis_x, gp->axis_y, data, 8);
+      break;
+    }
+    case UNI_CONTROLLER_CLASS_MOUSE: {
+      const uni_mouse_t *ms = &ctl->mouse;
+      data[0] = ms->buttons & 0xff;
+      data[1] = ms->buttons >> 8;
+      data[2] = ms->misc_buttons;
+      data[3] = (uint8_t)ms->scroll_wheel;
+      capture_bt_data(klass, ms->delta_x, ms->delta_y, data, 4);
+      break;
+    }
+    case UNI_CONTROLLER_CLASS_KEYBOARD: {
+      const uni_keyboard_t *kb = &ctl->keyboard;
+      data[0] = kb->modifiers;
+      for (size_t i = 0; i < 6 && i < UNI_KEYBOARD_PRESSED_KEYS_MAX; ++i) {
+        data[1 + i] = kb->pressed_keys[i];
+      }
+      capture_bt_data(klass, 0, 0, data, 7);
+      break;
+    }
+    default:
+      capture_bt_data(klass, 0, 0, data, 0);
+      break;
+  }
+}
+#else
+#define btloop_capture(klass, ctl) ((void)0)
+#endif
+
 static void btloop_on_controller_data(uni_hid_device_t *d,
                                       uni_controller_t *ctl) {
   static uint8_t enabled = true;
@@ -673,6 +728,7 @@ static void btloop_on_controller_data(uni_hid_device_t *d,
       no_dis = true;
     }
   }
+  btloop_capture(klass, ctl);
 
   switch (klass) {
     case UNI_CONTROLLER_CLASS_GAMEPAD:
@@ -0,0 +1,141 @@
+#include "capture.h"
+
+#if defined(IKBD_TRACE) && IKBD_TRACE
+
+#include <stdio.h>
+#include <string.h>
+
+#include "6301.h"
+#include "defs.h"
+#include "pico/stdlib.h"
+#include "sci.h"
+
+// Records written per capture_flush() call
+#define CAPTURE_FLUSH_RECORDS 4
+
+static trace_ring_t rings[2];  // one per core
+static trace_codec_t codec;
+static bool header_written = false;
+
+// Core 0 reads the 64-bit count while core 1 updates it
+static uint64_t capture_cycles(void) {
+  uint64_t a, b;
+  do {
+    a = (uint64_t)hd6301_cycles();
+    b = (uint64_t)hd6301_cycles();
+  } while (a != b);
+  return a;
+}
+
+static void capture_put(trace_event_t* ev, uint64_t cycle) {
+  ev->cycle = cycle;
+  ev->time_us = time_us_64();
+  trace_ring_push(&rings[get_core_num()], ev);
+}
+
+void capture_mouse_phase(uint32_t x_reg, uint32_t y_reg) {
+  trace_event_t ev = {.type = TRACE_MOUSE_PHASE,
+                      .x = (int32_t)x_reg,
+                      .y = (int32_t)y_reg};
+  capture_put(&ev, capture_cycles());
+}
+
+void capture_rx(uint8_t data) {
+  trace_event_t ev = {.type = TRACE_RX, .code = data};
+  capture_put(&ev, (uint64_t)sci_rx_last);  // into RDR, as the ROM sees it
+}
+
+void capture_tx(uint8_t data) {
+  trace_event_t ev = {.type = TRACE_TX, .code = data};
+  capture_put(&ev, (uint64_t)sci_tx_begin);  // start bit, as sent
+}
+
+void capture_input(const inputq_event_t* input, int64_t cpu_cycles) {
+  static const uint8_t types[] = {
+      [INPUTQ_KEY] = TRACE_KEY,
+      [INPUTQ_BUTTONS] = TRACE_BUTTONS,
+      [INPUTQ_JOYSTICK] = TRACE_JOYSTICK,
+      [INPUTQ_MOUSE] = TRACE_MOUSE,
+  };
+  if (input->type >= sizeof(types)) return;
+  trace_event_t ev = {.type = types[input->type],
+                      .code = input->code,
+                      .value = input->value,
+                      .x = input->x,
+                      .y = input->y};
+  capture_put(&ev, (uint64_t)cpu_cycles);
+}
+
+void capture_usb_report(uint8_t protocol, const uint8_t* report,
+                        uint16_t len) {
+  trace_event_t ev = {.type = TRACE_USB_REPORT, .code = protocol};
+  ev.len = len < TRACE_MAX_DATA ? (uint8_t)len : TRACE_MAX_DATA;
+  memcpy(ev.data, report, ev.len);
+  capture_put(&ev, capture_cycles());
+}
+
+void capture_bt_data(uint8_t klass, int32_t x, int32_t y, const uint8_t* data,
+                     uint8_t len) {
+  trace_event_t ev = {.type = TRACE_BT_DATA, .code = klass, .x = x, .y = y};
+  ev.len = len < TRACE_MAX_DATA ? len : TRACE_MAX_DATA;
+  memcpy(ev.data, data, ev.len);
+  capture_put(&ev, capture_cycles());
+}
+
+void capture_gpio(uint8_t port, uint8_t fire, uint8_t axis, int x_period,
+                  int y_period) {
+  trace_event_t ev = {.type = TRACE_GPIO,
+                      .code = port,
+                      .value = axis,
+                      .x = x_period,
+                      .y = y_period,
+                      .len = 1};
+  ev.data[0] = fire;
+  capture_put(&ev, capture_cycles());
+}
+
+static size_t put_hex(char* line, size_t n, const uint8_t* bytes,
+                      size_t len) {
+  static const char hex[] = "0123456789ABCDEF";
+  for (size_t i = 0; i < len; i++) {
+    line[n++] = hex[bytes[i] >> 4];
+    line[n++] = hex[bytes[i] & 0x0F];
+  }
+  return n;
+}
+
+void capture_flush(void) {
+  // "IKTR ", two hex digits a byte, newline
+  static char line[5 + 2 * (TRACE_HEADER_SIZE +
+                            CAPTURE_FLUSH_RECORDS * TRACE_MAX_RECORD) +
+                   2];
+  uint8_t bytes[TRACE_MAX_RECORD];
+  size_t n = 5;
+  int records = 0;
+
+  memcpy(line, "IKTR ", 5);
+  if (!header_written) {
+    n = put_hex(line, n, bytes, trace_write_header(bytes));
+    trace_codec_init(&codec);
+    header_written = true;
+  }
+  // Oldest cycle first, from either ring
+  while (records < CAPTURE_FLUSH_RECORDS) {
+    trace_event_t ev0, ev1;
+    bool has0 = trace_ring_peek(&rings[0], &ev0);
+    bool has1 = trace_ring_peek(&rings[1], &ev1);
+    if (!has0 && !has1) break;
+    int core = (!has0 || (has1 && ev1.cycle < ev0.cycle)) ? 1 : 0;
+    size_t len = trace_encode(&codec, core ? &ev1 : &ev0, bytes);
+    trace_ring_pop(&rings[core]);
+    n = put_hex(line, n, bytes, len);
+    records++;
+  }
+  if (n == 5) return;  // nothing to write
+  line[n++] = '\n';
+  line[n] = '\0';
+  // One write, so other debug output can't end up inside the line
+  fputs(line, stderr);
+}
+
+#endif
@@ -1,5 +1,7 @@
 #include "hidinput.h"
 
+#include "6301.h"
+#include "capture.h"
 #include "gconfig.h"
 
 // Atari ST key matrix indices for modifier keys
@@ -17,9 +19,23 @@ _Atomic int16_t pend_dy = 0;
                  ? ~((1 << item->Attributes.BitSize) - 1)          \
                  : 0))
 
-static int mouse_state = 0;
 static uint8_t mouse_buttons_hid = 0;
-static uint8_t joystick_fire_mask = 0;
+
+// Core 0: state last published to core 1
+static inputq_t input_queue;
+static uint32_t published_keys[STKEYS_WORDS];
+static uint8_t published_buttons = 0;
+static uint8_t published_fire = 0;
+static uint8_t published_axis = 0;
+static int published_x_period = 0;
+static int published_y_period = 0;
+// Changes left out of a full queue, for hidinput_flush()
+static bool publish_pending = false;
+
+// Core 1: state the 6301 sees
+static uint8_t st_buttons = 0;
+static uint8_t st_fire = 0;
+static uint8_t st_axis = 0;
 
 static const char* hidinput_get_usb_layout(void) {
   SettingsConfigEntry* entry =
@@ -201,6 +217,7 @@ void tuh_hid_unmount_cb(uint8_t dev_addr, uint8_t instance) {
 void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance,
                                 const uint8_t* report, uint16_t len) {
   uint8_t const itf_protocol = tuh_hid_interface_protocol(dev_addr, instance);
+  capture_usb_report(itf_protocol, report, len);
 
   switch (itf_protocol) {
     case HID_ITF_PROTOCOL_KEYBOARD: {
@@ -241,7 +258,7 @@ void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance,
               0;
           uint8_t st = stkeys_translate_hid(layout, prev_code, &shift_active,
                                             &alt_active, &ctrl_active);
-          if (st) key_states[st] = 0;
+          if (st) stkeys_set(st, 0);
         }
       }
 
@@ -260,22 +277,16 @@ void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance,
              (KEYBOARD_MODIFIER_LEFTCTRL | KEYBOARD_MODIFIER_RIGHTCTRL)) != 0;
         uint8_t st = stkeys_translate_hid(layout, cur_code, &shift_active,
                                           &alt_active, &ctrl_active);
-        if (st) key_states[st] = 1;
+        if (st) stkeys_set(st, 1);
       }
 
       // Handle modifier keys (set every time)
-      key_states[ATARI_LSHIFT] =
-          (cur->modifier & KEYBOARD_MODIFIER_LEFTSHIFT) ? 1 : 0;
-      key_states[ATARI_RSHIFT] =
-          (cur->modifier & KEYBOARD_MODIFIER_RIGHTSHIFT) ? 1 : 0;
-      key_states[ATARI_CTRL] = ((cur->modifier & KEYBOARD_MODIFIER_LEFTCTRL) ||
-                                (cur->modifier & KEYBOARD_MODIFIER_RIGHTCTRL))
-                                   ? 1
-                                   : 0;
-      key_states[ATARI_ALT] = ((cur->modifier & KEYBOARD_MODIFIER_LEFTALT) ||
-                               (cur->modifier & KEYBOARD_MODIFIER_RIGHTALT))
-                                  ? 1
-                                  : 0;
+      stkeys_set(ATARI_LSHIFT, cur->modifier & KEYBOARD_MODIFIER_LEFTSHIFT);
+      stkeys_set(ATARI_RSHIFT, cur->modifier & KEYBOARD_MODIFIER_RIGHTSHIFT);
+      stkeys_set(ATARI_CTRL, cur->modifier & (KEYBOARD_MODIFIER_LEFTCTRL |
+                                              KEYBOARD_MODIFIER_RIGHTCTRL));
+      stkeys_set(ATARI_ALT, cur->modifier & (KEYBOARD_MODIFIER_LEFTALT |
+                                             KEYBOARD_MODIFIER_RIGHTALT));
 
       // Save as previous for next time
       if (len >= sizeof(hid_keyboard_report_t)) {
@@ -284,6 +295,7 @@ void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance,
         // Fallback: clear prev if length unexpected
         memset(&prev_kbd_report, 0, sizeof(prev_kbd_report));
       }
+      hidinput_changed();
       break;
     }
     case HID_ITF_PROTOCOL_MOUSE: {
@@ -354,37 +366,100 @@ void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance,
   }
 }
 
-unsigned char st_keydown(const unsigned char code) {
-  if (code > 0 && code < 128) {
-    // if (key_states[code] && code) {
-    //   DPRINTF("st_keydown: code=%u state=%u\r\n", code, key_states[code]);
-    // }
-    return key_states[code];
-  }
-  return 0;
+int st_mouse_buttons() {
+  // The joystick fire buttons share the lines with the mouse buttons
+  return st_buttons | (st_fire & 0x03);
 }
 
-int st_mouse_buttons() {
-  int other_bits = mouse_state & ~0x03;
-  return other_bits | mouse_buttons_hid | joystick_fire_mask;
+unsigned char st_joystick() { return st_axis; }
+
+// Bumped by core 0 on every input change, read by core 1
+static volatile uint32_t input_changes = 0;
+
+static bool publish(uint64_t now, inputq_type_t type, uint8_t code,
+                    uint8_t value, int x, int y) {
+  inputq_event_t ev = {.time_us = now,
+                       .type = (uint8_t)type,
+                       .code = code,
+                       .value = value,
+                       .x = x,
+                       .y = y};
+  return inputq_push(&input_queue, &ev);
 }
 
-unsigned char st_joystick() {
-  uint8_t fire_state;
-  uint8_t axis_state;
-  joystick_get_state(&fire_state, &axis_state);
-  uint8_t fire_bits = fire_state & 0x03;
-  joystick_fire_mask |= fire_bits;
-  if ((fire_bits & 0x01) == 0) {
-    joystick_fire_mask &= (uint8_t)~0x01;
+void hidinput_changed(void) {
+  uint64_t now = time_us_64();
+
+  // cleared once everything is published
+  publish_pending = true;
+
+  // Whatever changed together gets the same capture time
+  for (int word = 0; word < STKEYS_WORDS; word++) {
+    uint32_t keys =
+        atomic_load_explicit(&key_states[word], memory_order_relaxed);
+    uint32_t changed = keys ^ published_keys[word];
+    while (changed) {
+      uint32_t bit = changed & -changed;
+      uint8_t code = (uint8_t)(word * 32 + __builtin_ctz(changed));
+      uint8_t down = (keys & bit) ? 1 : 0;
+      if (!publish(now, INPUTQ_KEY, code, down, 0, 0)) goto full;
+      published_keys[word] ^= bit;
+      changed ^= bit;
+    }
+  }
+  if (mouse_buttons_hid != published_buttons) {
+    if (!publish(now, INPUTQ_BUTTONS, mouse_buttons_hid, 0, 0, 0)) goto full;
+    published_buttons = mouse_buttons_hid;
   }
-  if ((fire_bits & 0x02) == 0) {
-    joystick_fire_mask &= (uint8_t)~0x02;
+  uint8_t fire, axis;
+  joystick_get_state(&fire, &axis);
+  if (fire != published_fire || axis != published_axis) {
+    if (!publish(now, INPUTQ_JOYSTICK, fire, axis, 0, 0)) goto full;
+    published_fire = fire;
+    published_axis = axis;
   }
+  int x_period, y_period;
+  mouse_get_periods(&x_period, &y_period);
+  if (x_period != published_x_period || y_period != published_y_period) {
+    if (!publish(now, INPUTQ_MOUSE, 0, 0, x_period, y_period)) goto full;
+    published_x_period = x_period;
+    published_y_period = y_period;
+  }
+  publish_pending = false;
+full:
+  input_changes++;
+  __sev();
+}
 
-  int other_bits = mouse_state & ~0x03;
-  mouse_state = other_bits | mouse_buttons_hid | joystick_fire_mask;
-  return axis_state;
+void hidinput_flush(void) {
+  if (publish_pending && inputq_count(&input_queue) < INPUTQ_SIZE)
+    hidinput_changed();
+}
+
+uint32_t hidinput_changes(void) { return input_changes; }
+
+inputq_t* hidinput_queue(void) { return &input_queue; }
+
+void hidinput_apply(const inputq_event_t* ev, int64_t cpu_cycles) {
+  capture_input(ev, cpu_cycles);
+  switch (ev->type) {
+    case INPUTQ_KEY:
+      // Held by the core until the ROM has scanned it
+      hd6301_set_key(ev->code, ev->value);
+      break;
+    case INPUTQ_BUTTONS:
+      st_buttons = ev->code & 0x03;
+      break;
+    case INPUTQ_JOYSTICK:
+      st_fire = ev->code;
+      st_axis = ev->value;
+      break;
+    case INPUTQ_MOUSE:
+      mouse_set_periods(cpu_cycles, ev->x, ev->y);
+      break;
+    default:
+      break;
+  }
 }
 
 int st_mouse_enabled() {
@@ -397,9 +472,8 @@ void hidinput_update_mouse(int16_t dx, int16_t dy, bool left_down,
   if (right_down) new_btns |= 0x01;
   if (left_down) new_btns |= 0x02;
 
-  int other_bits = mouse_state & ~0x03;
   mouse_buttons_hid = (uint8_t)(new_btns & 0x03);
-  mouse_state = other_bits | mouse_buttons_hid | joystick_fire_mask;
 
   mouse_set_speed(dx, dy);
+  hidinput_changed();
 }
@@ -0,0 +1,65 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdint.h>
+
+#include "inputq.h"
+#include "trace.h"
+
+/*
+ * Session capture for the record/replay trace of trace.h, built in with
+ * IKBD_TRACE=1 (a debug build, the trace goes out on the debug UART).
+ *
+ * The hooks stamp an event with the emulated cycle and the real time and
+ * put it in the ring of the core they run on. capture_flush(), from the
+ * core 0 loop, writes what the rings hold as lines of hex:
+ *
+ *   IKTR <header and records>
+ *
+ * which tests/host/src/replay.c picks out of a log of the debug output.
+ * Without IKBD_TRACE the hooks compile to nothing.
+ */
+
+#if defined(IKBD_TRACE) && IKBD_TRACE
+
+// Core 0: the phase mouse_init() gave the quadrature registers
+void capture_mouse_phase(uint32_t x_reg, uint32_t y_reg);
+
+// Core 1: a byte from the ST, as the SCI takes it into RDR, from
+// serialp_received()
+void capture_rx(uint8_t data);
+
+// Core 1: a byte to the ST, from serialp_send()
+void capture_tx(uint8_t data);
+
+// Core 1: an input event, as hidinput_apply() makes it visible to the 6301
+void capture_input(const inputq_event_t* ev, int64_t cpu_cycles);
+
+// Core 0: where the input came from
+void capture_usb_report(uint8_t protocol, const uint8_t* report,
+                        uint16_t len);
+void capture_bt_data(uint8_t klass, int32_t x, int32_t y, const uint8_t* data,
+                     uint8_t len);
+void capture_gpio(uint8_t port, uint8_t fire, uint8_t axis, int x_period,
+                  int y_period);
+
+/**
+ * Core 0: write out what the rings hold, a few records at a time so the
+ * loop isn't held up.
+ */
+void capture_flush(void);
+
+#else
+
+#define capture_mouse_phase(x_reg, y_reg) ((void)0)
+#define capture_rx(data) ((void)0)
+#define capture_tx(data) ((void)0)
+#define capture_input(ev, cpu_cycles) ((void)0)
+#define capture_usb_report(protocol, report, len) ((void)0)
+#define capture_bt_data(klass, x, y, data, len) ((void)0)
+#define capture_gpio(port, fire, axis, x_period, y_period) ((void)0)
+#define capture_flush() ((void)0)
+
+#endif
+
+#endif  // CAPTURE_H
@@ -7,6 +7,7 @@
 
 #include "bsp/board.h"
 #include "debug.h"
+#include "inputq.h"
 #include "joystick.h"
 #include "mouse.h"
 #include "pico/stdlib.h"
@@ -16,11 +17,11 @@
 extern _Atomic int16_t pend_dx;
 extern _Atomic int16_t pend_dy;
 
-/**
- * Return the key states of the given Atari ST keyboard scancode. The scancode
- * must be in the range 0-127
+/*
+ * The st_*() functions are called by the 6301 on core 1 and return the
+ * state made of the events applied by hidinput_apply(), not what core 0
+ * is working on.
  */
-unsigned char st_keydown(const unsigned char code);
 
 /**
  * Return the current state of the mouse buttons
@@ -40,6 +41,37 @@ int st_mouse_enabled();
 void hidinput_update_mouse(int16_t dx, int16_t dy, bool left_down,
                            bool right_down);
 
+/**
+ * Core 0: publish what changed in key_states[], the mouse and the joysticks
+ * since the last call as timestamped events for core 1, and wake it up so
+ * it runs the ROM in short slices while the reports go out. What doesn't
+ * fit in the queue stays pending for hidinput_flush().
+ */
+void hidinput_changed(void);
+
+/**
+ * Core 0 loop: publish what hidinput_changed() left pending once core 1
+ * has made room in the queue, so a burst can't leave the last change
+ * (typically a key release) waiting for unrelated input.
+ */
+void hidinput_flush(void);
+
+/**
+ * Number of hidinput_changed() calls so far. Core 1 compares it with the
+ * value it saw last.
+ */
+uint32_t hidinput_changes(void);
+
+/**
+ * Core 1: the events published by hidinput_changed(), oldest first.
+ */
+inputq_t* hidinput_queue(void);
+
+/**
+ * Core 1: make an event visible to the 6301, at emulated cycle 'cpu_cycles'.
+ */
+void hidinput_apply(const inputq_event_t* ev, int64_t cpu_cycles);
+
 // ---- HID interface info ring (for TinyUSB host HID interfaces) ----
 // Stores recently seen HID interface infos along with the device address.
 // Ring overwrites the oldest entry when full.
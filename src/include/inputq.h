@@ -0,0 +1,78 @@
+#ifndef INPUTQ_H
+#define INPUTQ_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Input events from core 0 (USB, Bluetooth, GPIO) to the 6301 on core 1.
+ *
+ * Every change of what the ROM can see goes through the queue with the
+ * time it was captured at, and core 1 applies it when emulated time gets
+ * there. A press and release both landing between two matrix scans, or a
+ * burst run after core 1 was held up, are seen in order and at the right
+ * cycles instead of collapsing into the last state.
+ *
+ * Single producer, single consumer, no lock: the head is only written by
+ * the producer and the tail by the consumer, each with release ordering so
+ * the other side sees the slot contents before the index. The SIO FIFO
+ * would hold 8 words at most and is taken by the multicore lockout used
+ * for flash writes.
+ *
+ * No Pico dependencies, so the queue can be stress tested on the host.
+ */
+
+#define INPUTQ_SIZE 64  // power of 2
+
+typedef enum {
+  INPUTQ_KEY,       // code: ST scancode, value: 1 down, 0 up
+  INPUTQ_BUTTONS,   // code: mouse buttons, bit 1 left, bit 0 right
+  INPUTQ_JOYSTICK,  // code: fire bits, value: axes of both ports
+  INPUTQ_MOUSE,     // x, y: microseconds per quadrature step, signed, 0 stop
+} inputq_type_t;
+
+typedef struct {
+  uint64_t time_us;  // when the change was captured
+  uint8_t type;      // inputq_type_t
+  uint8_t code;
+  uint8_t value;
+  int32_t x;
+  int32_t y;
+} inputq_event_t;
+
+typedef struct {
+  inputq_event_t events[INPUTQ_SIZE];
+  _Atomic uint32_t head;  // next slot to write, producer only
+  _Atomic uint32_t tail;  // next slot to read, consumer only
+  uint32_t full;          // pushes refused, producer only
+} inputq_t;
+
+/**
+ * Empty the queue. Neither side may be using it.
+ */
+void inputq_init(inputq_t* q);
+
+/**
+ * Producer: append an event. Returns false, and counts it, if the queue is
+ * full; the caller keeps the change and tries again later.
+ */
+bool inputq_push(inputq_t* q, const inputq_event_t* ev);
+
+/**
+ * Consumer: copy the oldest event without removing it. Returns false if
+ * the queue is empty.
+ */
+bool inputq_peek(inputq_t* q, inputq_event_t* ev);
+
+/**
+ * Consumer: remove the oldest event, after inputq_peek() returned it.
+ */
+void inputq_pop(inputq_t* q);
+
+/**
+ * Number of events queued, from either side.
+ */
+uint32_t inputq_count(inputq_t* q);
+
+#endif  // INPUTQ_H
@@ -5,8 +5,14 @@
 
 #include "pico/stdlib.h"
 
+// Core 1: quadrature registers at an emulated cycle, and speed changes
+// applied at one
 void mouse_tick(int64_t cpu_cycles, int* x_counter, int* y_counter);
+void mouse_set_periods(int64_t cpu_cycles, int x_period, int y_period);
+
+// Core 0: speed from HID reports, as microseconds per quadrature step
 void mouse_set_speed(int x, int y);
+void mouse_get_periods(int* x_period, int* y_period);
 void mouse_update(void);
 void mouse_init(void);
 
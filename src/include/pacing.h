@@ -0,0 +1,88 @@
+#ifndef PACING_H
+#define PACING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Real-time pacing of the emulated HD6301 (1 cycle = 1 us at 1 MHz).
+ *
+ * Emulated time is tracked against the real clock since pacing_init(), so a
+ * late slice is made up for by running more cycles in the following ones
+ * instead of being lost. Catching up happens in bursts of at most
+ * max_burst cycles; a backlog larger than max_backlog (core 1 stalled, e.g.
+ * during a flash write) is dropped and counted.
+ *
+ * Slices can be adaptive: after pacing_set_adaptive(), a call to
+ * pacing_activity() (a byte came in or went out, input changed) switches to
+ * short slices for the next 'hold' cycles, so what the 6301 does reaches
+ * the outside world with little delay. Once things are quiet again the
+ * loop goes back to the long 'slice' and sleeps most of the time.
+ *
+ * No Pico dependencies: the caller passes the time in, so the maths can be
+ * driven by a virtual clock on the host.
+ */
+
+typedef struct {
+  // Configuration
+  uint32_t slice;        // cycles run per slice when on time (and quiet)
+  uint32_t short_slice;  // cycles run per slice when active, 0 if fixed
+  uint32_t hold;         // cycles slices stay short after some activity
+  uint32_t max_burst;    // most cycles run in one slice when behind
+  uint32_t max_backlog;  // backlog above which cycles are dropped
+
+  // State
+  uint64_t base_us;   // real time at which emulated time started
+  uint64_t emulated;  // cycles run, plus the dropped ones
+  uint64_t active_until;  // emulated time up to which slices are short
+
+  // Counters, for whoever wants to look (core 0, debug output)
+  uint64_t slices;          // slices run
+  uint64_t short_slices;    // slices run while active
+  uint64_t catchup_slices;  // slices longer than the current slice
+  uint64_t catchup_cycles;  // cycles run above the current slice in those
+  uint64_t dropped_cycles;  // backlog given up
+  uint32_t lag;             // cycles behind real time at the last check
+  uint32_t max_slip;        // largest lag seen
+} pacing_t;
+
+/**
+ * Start pacing at real time 'now_us'.
+ */
+void pacing_init(pacing_t* p, uint64_t now_us, uint32_t slice,
+                 uint32_t max_burst, uint32_t max_backlog);
+
+/**
+ * Use 'short_slice' instead of 'slice' for 'hold' cycles after each call to
+ * pacing_activity(). A 'short_slice' of 0 goes back to fixed slices.
+ */
+void pacing_set_adaptive(pacing_t* p, uint32_t short_slice, uint32_t hold);
+
+/**
+ * Something happened the outside world waits on: keep slices short.
+ */
+void pacing_activity(pacing_t* p);
+
+/**
+ * Cycles per slice at the moment, short or long.
+ */
+uint32_t pacing_slice(const pacing_t* p);
+
+/**
+ * Number of cycles to run at real time 'now_us': 0 while less than a slice
+ * is due, a slice when on time, up to max_burst when behind.
+ */
+uint32_t pacing_due(pacing_t* p, uint64_t now_us);
+
+/**
+ * Account for cycles run, which may be a few more than pacing_due() asked
+ * for since instructions aren't split.
+ */
+void pacing_ran(pacing_t* p, uint64_t cycles);
+
+/**
+ * Real time at which the next slice is due, to sleep until.
+ */
+uint64_t pacing_next_us(const pacing_t* p);
+
+#endif  // PACING_H
@@ -18,8 +18,29 @@
 
 void serialp_open(void);
 void serialp_close(void);
+
+/**
+ * Queue a byte for the UART, from the HD6301 SCI on core 1. Never blocks:
+ * the byte goes out by serialp_tx_pump(), which the core 1 loop calls
+ * often enough to keep the UART busy.
+ */
 void serialp_send(const unsigned char data);
 
+/**
+ * Called by the HD6301 SCI on core 1 as a byte from the ST goes into RDR,
+ * at cycle sci_rx_last. Only the session capture looks at it.
+ */
+void serialp_received(const unsigned char data);
+
+/**
+ * Pass queued bytes to the UART as long as it takes them, without waiting.
+ */
+void serialp_tx_pump(void);
+
+// Bytes queued, and bytes lost to a full queue
+uint16_t serialp_tx_pending(void);
+uint32_t serialp_tx_dropped(void);
+
 // RX ring buffer helpers
 uint16_t rx_available(void);
 bool rx_buffer_get(uint8_t *data);
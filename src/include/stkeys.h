@@ -20,6 +20,7 @@
 #ifndef STKEYS_H
 #define STKEYS_H
 
+#include <stdatomic.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -40,7 +41,24 @@ extern const unsigned char stkeys_lookup_hid_fr[128];
 extern const unsigned char stkeys_lookup_hid_it[128];
 extern const unsigned char stkeys_lookup_hid_us[128];
 extern const unsigned char stkeys_lookup_hid_es[128];
-extern unsigned char key_states[128];
+
+// Keys down, a bit per ST scancode: bit code % 32 of word code / 32. Each
+// change is a single atomic operation, so the USB and Bluetooth handlers
+// and hidinput_changed() can't lose one another's updates.
+#define STKEYS_WORDS 4
+extern _Atomic uint32_t key_states[STKEYS_WORDS];
+
+static inline void stkeys_set(uint8_t code, bool down) {
+  if (code >= 128) return;
+  uint32_t bit = 1u << (code & 31);
+  if (down) {
+    atomic_fetch_or_explicit(&key_states[code >> 5], bit,
+                             memory_order_relaxed);
+  } else {
+    atomic_fetch_and_explicit(&key_states[code >> 5], ~bit,
+                              memory_order_relaxed);
+  }
+}
 
 void stkeys_apply_keyboard_report_layout(const uint8_t* prev_keys,
                                          const uint8_t* cur_keys,
@@ -0,0 +1,150 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Record of an IKBD session, to replay it off the device.
+ *
+ * Everything that reaches the 6301 from outside is an event with the
+ * emulated cycle and the real time (us since boot) it happened at: the
+ * bytes from the ST as the SCI takes them into RDR, the input changes as
+ * core 1 applies them and the mouse phase mouse_init() picked. Replaying
+ * those at the same cycles on the host build of the core gives the same
+ * run, whose bytes to the ST can be checked against the recorded ones.
+ * The USB reports, Bluetooth controller data and GPIO readings the input
+ * came from are recorded too, to see what a device actually sent;
+ * replaying ignores them.
+ *
+ * Each core fills a ring of its own (single producer, single consumer,
+ * as inputq.h) and core 0 encodes what the rings hold, oldest cycle
+ * first. The encoding starts with a header:
+ *
+ *   'I' 'K' 'T' 'R', version, 3 bytes of 0
+ *
+ * followed by records:
+ *
+ *   type, cycle delta, us delta, then the fields of the type in the order
+ *   code, value, x, y, data (trace_fields[])
+ *
+ * The deltas are from the previous record and, with x and y, are zigzag
+ * varints (7 bits a byte, low first, 0x80 set on all but the last byte):
+ * core 0 reads a cycle count core 1 may be ahead of, so they can be
+ * negative. code and value are a byte each, data a length byte and as many
+ * bytes.
+ *
+ * No Pico dependencies, so traces can be read and made on the host.
+ */
+
+#define TRACE_VERSION 1
+#define TRACE_HEADER_SIZE 8
+#define TRACE_MAX_DATA 16
+// Type, two 64-bit and two 32-bit varints, code, value, length and data
+#define TRACE_MAX_RECORD (1 + 2 * 10 + 2 * 5 + 3 + TRACE_MAX_DATA)
+#define TRACE_RING_SIZE 128  // power of 2
+
+typedef enum {
+  TRACE_MOUSE_PHASE,  // x, y: mouse quadrature registers
+  TRACE_RX,           // code: byte from the ST, cycle it went into RDR
+  TRACE_TX,           // code: byte to the ST, cycle of its start bit
+  TRACE_KEY,          // code: ST scancode, value: 1 down, 0 up
+  TRACE_BUTTONS,      // code: mouse buttons, bit 1 left, bit 0 right
+  TRACE_JOYSTICK,     // code: fire bits, value: axes of both ports
+  TRACE_MOUSE,        // x, y: cycles per quadrature step, signed, 0 stop
+  TRACE_USB_REPORT,   // code: interface protocol, data: report
+  TRACE_BT_DATA,      // code: controller class, x, y, data: see btloop.c
+  TRACE_GPIO,         // code: port, value: axes, x, y: mouse periods,
+                      // data: fire bits
+  TRACE_LOST,         // x: events dropped before this one, ring full
+  TRACE_TYPES
+} trace_type_t;
+
+// Fields of each type
+#define TRACE_CODE 0x01
+#define TRACE_VALUE 0x02
+#define TRACE_X 0x04
+#define TRACE_Y 0x08
+#define TRACE_DATA 0x10
+extern const uint8_t trace_fields[TRACE_TYPES];
+
+typedef struct {
+  uint64_t cycle;    // emulated cycle
+  uint64_t time_us;  // real time
+  uint8_t type;      // trace_type_t
+  uint8_t code;
+  uint8_t value;
+  uint8_t len;  // bytes in data
+  int32_t x;
+  int32_t y;
+  uint8_t data[TRACE_MAX_DATA];
+} trace_event_t;
+
+typedef struct {
+  trace_event_t events[TRACE_RING_SIZE];
+  _Atomic uint32_t head;  // next slot to write, producer only
+  _Atomic uint32_t tail;  // next slot to read, consumer only
+  uint32_t lost;          // events dropped since the last TRACE_LOST
+} trace_ring_t;
+
+// Cycle and time of the previous record, for the deltas
+typedef struct {
+  uint64_t cycle;
+  uint64_t time_us;
+} trace_codec_t;
+
+/**
+ * Empty the ring. Neither side may be using it.
+ */
+void trace_ring_init(trace_ring_t* r);
+
+/**
+ * Producer: append an event. When the ring is full the event is dropped
+ * and counted, and the next one that fits is preceded by a TRACE_LOST
+ * event with the count.
+ */
+void trace_ring_push(trace_ring_t* r, const trace_event_t* ev);
+
+/**
+ * Consumer: copy the oldest event without removing it. Returns false if
+ * the ring is empty.
+ */
+bool trace_ring_peek(trace_ring_t* r, trace_event_t* ev);
+
+/**
+ * Consumer: remove the oldest event, after trace_ring_peek() returned it.
+ */
+void trace_ring_pop(trace_ring_t* r);
+
+/**
+ * Start encoding or decoding a trace, from cycle 0 and time 0.
+ */
+void trace_codec_init(trace_codec_t* c);
+
+/**
+ * Write the header to 'out', TRACE_HEADER_SIZE bytes.
+ */
+size_t trace_write_header(uint8_t* out);
+
+/**
+ * Check the header at 'in', of 'len' bytes. Returns the size of the
+ * header, or 0 if it is not one this version reads.
+ */
+size_t trace_read_header(const uint8_t* in, size_t len);
+
+/**
+ * Encode an event into 'out', which has room for TRACE_MAX_RECORD bytes.
+ * Returns the bytes written.
+ */
+size_t trace_encode(trace_codec_t* c, const trace_event_t* ev, uint8_t* out);
+
+/**
+ * Decode the record at 'in', of at most 'len' bytes. Returns the bytes it
+ * took, or 0 if it is cut short or not valid.
+ */
+size_t trace_decode(trace_codec_t* c, const uint8_t* in, size_t len,
+                    trace_event_t* ev);
+
+#endif  // TRACE_H
@@ -0,0 +1,43 @@
+#include "inputq.h"
+
+#include <string.h>
+
+void inputq_init(inputq_t* q) {
+  memset(q->events, 0, sizeof(q->events));
+  atomic_store_explicit(&q->head, 0, memory_order_relaxed);
+  atomic_store_explicit(&q->tail, 0, memory_order_relaxed);
+  q->full = 0;
+}
+
+bool inputq_push(inputq_t* q, const inputq_event_t* ev) {
+  uint32_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+  uint32_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+  if (head - tail >= INPUTQ_SIZE) {
+    q->full++;
+    return false;
+  }
+  q->events[head & (INPUTQ_SIZE - 1)] = *ev;
+  atomic_store_explicit(&q->head, head + 1, memory_order_release);
+  return true;
+}
+
+bool inputq_peek(inputq_t* q, inputq_event_t* ev) {
+  uint32_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+  uint32_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+  if (head == tail) {
+    return false;
+  }
+  *ev = q->events[tail & (INPUTQ_SIZE - 1)];
+  return true;
+}
+
+void inputq_pop(inputq_t* q) {
+  uint32_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+  atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+}
+
+uint32_t inputq_count(inputq_t* q) {
+  uint32_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+  uint32_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+  return head - tail;
+}
@@ -1,6 +1,8 @@
 #include "joystick.h"
 
+#include "capture.h"
 #include "debug.h"
+#include "hidinput.h"
 #include "mouse.h"
 
 #define JOY_GPIO_INIT(io)    \
@@ -52,6 +54,7 @@ void joystick_init() {
 void joystick_update(uint8_t port) {
   uint8_t prev_axis = axis_state;
   uint8_t prev_fire = fire_state;
+  bool periods_changed = false;
   uint8_t axis_tmp = 0;
   uint8_t button = 0;
   switch (port) {
@@ -162,8 +165,13 @@ void joystick_update(uint8_t port) {
 
       // Send speed every sample; when there are no edges, sx/sy will
       // naturally decay toward zero via smoothing (or be exactly zero
-      // if SMOOTH_SHIFT == 0).
+      // if SMOOTH_SHIFT == 0). Core 1 only hears about actual changes,
+      // once for the periods and the buttons together.
+      int old_x_period, old_y_period, x_period, y_period;
+      mouse_get_periods(&old_x_period, &old_y_period);
       mouse_set_speed(sx, sy);
+      mouse_get_periods(&x_period, &y_period);
+      periods_changed = x_period != old_x_period || y_period != old_y_period;
       break;
     }
     case 3:  // Parse USB joystick report → feed IKBD joystick
@@ -176,6 +184,15 @@ void joystick_update(uint8_t port) {
       return;
   }
 
+  if (periods_changed || axis_state != prev_axis || fire_state != prev_fire) {
+#if defined(IKBD_TRACE) && IKBD_TRACE
+    int x_period, y_period;
+    mouse_get_periods(&x_period, &y_period);
+    capture_gpio(port, fire_state, axis_state, x_period, y_period);
+#endif
+    hidinput_changed();
+  }
+
   // if (axis_state != prev_axis || fire_state != prev_fire) {
   //   DPRINTF("Joystick port %u state changed: axis=0x%02x fire=0x%02x\n",
   //   port,
@@ -187,6 +204,7 @@ void joystick_set_state(uint8_t fire_state_arg, uint8_t axis_state_arg) {
   if (usb_joystick_port == 1) {
     fire_state = fire_state_arg >> 1;
     axis_state = axis_state_arg << 4;
+    hidinput_changed();
   }
 }
 
@@ -3,13 +3,16 @@
 
 #include "6301.h"
 #include "HD6301V1ST.h"
+#include "capture.h"
 #if COMPUTER_TARGET_BT
 #include "btloop.h"
 #endif
 #include "debug.h"
 #include "gconfig.h"
 #include "hardware/clocks.h"
+#include "hidinput.h"
 #include "nativeloop.h"
+#include "pacing.h"
 #include "pico/btstack_flash_bank.h"
 #include "pico/cyw43_arch.h"
 #include "pico/flash.h"
@@ -21,8 +24,6 @@
 #include "usbloop.h"
 #endif
 
-// ~1.28 ms per byte at 7812.5 baud (10 bits)
-#define IKBD_BYTE_US 800
 #define IKBD_RESET_SEQ_FIRST_BYTE 0x80
 #define IKBD_RESET_SEQ_SECOND_BYTE 0x01
 #define IKBD_CMD_SET_TOD 0x1b
@@ -33,7 +34,17 @@
 #define IKBD_TOD_MINUTE 0x00
 #define IKBD_TOD_SECOND 0x00
 #define IKBD_ROMBASE 256
-#define IKBD_CYCLES_PER_LOOP 1000
+// Core 1 runs the 6301 in slices of 1 ms while nothing happens, and of
+// 200 us for 50 ms after a byte came in or went out or the input changed
+// (the ROM can take a few scans to report a key), so what it sends reaches
+// the ST without waiting for the end of a long slice
+#define IKBD_QUIET_SLICE_CYCLES 1000
+#define IKBD_ACTIVE_SLICE_CYCLES 200
+#define IKBD_ACTIVE_HOLD_CYCLES 50000
+// Catching up after core 1 was held up: 4 ms at once at most, and give up
+// on anything beyond 100 ms
+#define IKBD_MAX_BURST_CYCLES 4000
+#define IKBD_MAX_BACKLOG_CYCLES 100000
 
 #define KEYBOARD_MODE_NATIVE 0
 #define KEYBOARD_MODE_USB 1
@@ -45,6 +56,10 @@ static uint64_t ikbd_first_reset_sequence_us = 0;
 static bool ikbd_waiting_for_reset_sequence = false;
 static bool ikbd_reset_sequence_recorded = false;
 
+// Hardware alarm waking core 1 up for the next slice. Claimed by core 0
+// before multicore_launch_core1(), so core 1 never has to claim it.
+static int core1_alarm = -1;
+
 static inline void jump_to_booster_app() {
   // Disable the LEDs before leaving
   gpio_put(KBD_ATARI_OUT_3V3_GPIO, 0);
@@ -89,11 +104,10 @@ static uint64_t get_first_reset_sequence_cb(void) {
  * it to the HD6301
  */
 static inline void handle_rx_from_st() {
-  // First ensure the 6301 SCI can accept data
-  if (!hd6301_sci_busy() && (rx_available() > 0)) {
-    // Drain all currently available bytes into the 6301
+  // Bytes are queued for core 1, the SCI takes them in one byte time apart
+  if (hd6301_rx_free() > 0 && (rx_available() > 0)) {
     unsigned char data;
-    while (rx_buffer_get(&data)) {
+    while (hd6301_rx_free() > 0 && rx_buffer_get(&data)) {
       if (!ikbd_reset_sequence_recorded) {
         if (!ikbd_waiting_for_reset_sequence) {
           ikbd_waiting_for_reset_sequence = (data == IKBD_RESET_SEQ_FIRST_BYTE);
@@ -112,9 +126,10 @@ static inline void handle_rx_from_st() {
         }
       }
       DPRINTF("ST -> 6301 %02X\n", data);
-      // sleep_us(IKBD_BYTE_US);  // Small delay to avoid overwhelming the 6301
       hd6301_receive_byte(data);
     }
+    // Core 1 may be sleeping through a long slice
+    __sev();
   }
 }
 
@@ -137,6 +152,7 @@ void toogle_ikbd_source_cb(void) {
 
   // Stop core 1 if switching to native keyboard mode
   if (!atari_state) {
+    hardware_alarm_cancel(core1_alarm);
     multicore_reset_core1();
   }
 }
@@ -200,6 +216,55 @@ static int get_keyboard_mode_from_settings(void) {
   return (int)parsed;
 }
 
+// Emulated time against real time, counters readable from core 0
+static pacing_t ikbd_pacing;
+
+// Set by core1_alarm, on core 1
+static volatile bool core1_alarm_fired = false;
+
+static void core1_alarm_callback(uint alarm_num) { core1_alarm_fired = true; }
+
+// Input changes seen by core 1 so far
+static uint32_t core1_input_changes = 0;
+
+// Anything the 6301 should react to quickly
+static bool core1_activity(void) {
+  return hd6301_sci_busy() || rx_available() > 0 ||
+         hidinput_changes() != core1_input_changes;
+}
+
+// Sleep until 'us', or until core 0 hands the 6301 a byte or new input. A
+// byte the ROM hasn't read yet doesn't count, it would keep core 1 spinning.
+static void core1_sleep_until(uint64_t us) {
+  bool sci_busy = hd6301_sci_busy();
+  core1_alarm_fired = false;
+  // true if the time has passed already
+  if (hardware_alarm_set_target(core1_alarm, from_us_since_boot(us))) {
+    return;
+  }
+  while (!core1_alarm_fired && hd6301_sci_busy() == sci_busy &&
+         hidinput_changes() == core1_input_changes) {
+    __wfe();
+  }
+}
+
+// Apply the input events captured up to real time 'now_us', which emulated
+// time has reached. Returns the cycles to run before the next one is due,
+// at most 'left'.
+static COUNTER_VAR core1_apply_input(uint64_t now_us, COUNTER_VAR left) {
+  inputq_t* q = hidinput_queue();
+  inputq_event_t ev;
+  while (inputq_peek(q, &ev)) {
+    if (ev.time_us > now_us) {
+      uint64_t until = ev.time_us - now_us;
+      return until < (uint64_t)left ? (COUNTER_VAR)until : left;
+    }
+    hidinput_apply(&ev, hd6301_cycles());
+    inputq_pop(q);
+  }
+  return left;
+}
+
 static void core1_entry() {
   flash_safe_execute_core_init();
 
@@ -231,18 +296,43 @@ static void core1_entry() {
 
   // Main loop in the HD6301 core
   DPRINTF("Entering HD6301 core loop...\n");
+  // on this core: the alarm's IRQ goes to the core setting the callback
+  hardware_alarm_set_callback(core1_alarm, core1_alarm_callback);
+  pacing_init(&ikbd_pacing, time_us_64(), IKBD_QUIET_SLICE_CYCLES,
+              IKBD_MAX_BURST_CYCLES, IKBD_MAX_BACKLOG_CYCLES);
+  pacing_set_adaptive(&ikbd_pacing, IKBD_ACTIVE_SLICE_CYCLES,
+                      IKBD_ACTIVE_HOLD_CYCLES);
   while (true) {
-    static uint64_t last_run_us = 0;
-    uint64_t now_us = time_us_64();
-    if (last_run_us == 0) {
-      last_run_us = now_us;
+    // The UART takes a byte per byte time, whatever the slice length
+    serialp_tx_pump();
+    if (core1_activity()) {
+      core1_input_changes = hidinput_changes();
+      pacing_activity(&ikbd_pacing);
     }
-    uint64_t delta_us = now_us - last_run_us;
-    if (delta_us >= IKBD_CYCLES_PER_LOOP) {
-      last_run_us = now_us;
-      hd6301_run_clocks(IKBD_CYCLES_PER_LOOP);
-      hd6301_tx_empty(1);
+    uint32_t due = pacing_due(&ikbd_pacing, time_us_64());
+    if (!due) {
+      // Bytes from core 0 go straight into the SCI and wake core 1 up
+      core1_sleep_until(pacing_next_us(&ikbd_pacing));
+      continue;
+    }
+    // Real time this slice starts at, as far as emulated time is concerned
+    uint64_t slice_us = ikbd_pacing.base_us + ikbd_pacing.emulated;
+    COUNTER_VAR left = due;
+    while (left > 0) {
+      COUNTER_VAR ran;
+      // Input changes go in at the cycle matching their capture time
+      COUNTER_VAR run = core1_apply_input(slice_us + (due - left), left);
+      int status = hd6301_run_until(run, HD6301_EVENT_TX, &ran);
+      left -= ran;
+      if (status & HD6301_EVENT_CRASH) break;
+      // The SCI sets TDRE by itself once the byte is shifted out
+      if (status & HD6301_EVENT_TX) {
+        serialp_tx_pump();
+        pacing_activity(&ikbd_pacing);
+      }
     }
+    // A crashed CPU doesn't run, its clock still does
+    pacing_ran(&ikbd_pacing, left > 0 ? due : due - left);
   }
 }
 
@@ -364,6 +454,7 @@ int main() {
   // the flash writes silently failed. Keep Core 1 active when relying on
   // BTStack TLV storage.
   DPRINTF("Starting HD6301 core...\n");
+  core1_alarm = hardware_alarm_claim_unused(true);
   multicore_launch_core1(core1_entry);
 
   // Configure the input pins KBD RESET and BD0SEL0000
@@ -4,7 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "capture.h"
 #include "debug.h"
+#include "hidinput.h"
 #include "pico/time.h"
 
 // --- Constants (from the working version) ---
@@ -27,11 +29,15 @@
 static absolute_time_t last_input_us;
 
 // --- Internal state ---
-static volatile int x_period_us = 0;  // signed: sign = direction
-static volatile int y_period_us = 0;
+// Core 0: speed from the HID reports, published through hidinput_changed()
+static int x_period_us = 0;  // signed: sign = direction
+static int y_period_us = 0;
 
-static absolute_time_t last_x_us;
-static absolute_time_t last_y_us;
+// Core 1: quadrature the 6301 sees, stepped in emulated cycles (1 us each)
+static int st_x_period = 0;
+static int st_y_period = 0;
+static int64_t last_x_cycle = 0;
+static int64_t last_y_cycle = 0;
 
 static uint32_t x_reg;
 static uint32_t y_reg;
@@ -52,11 +58,11 @@ int mouse_get_sensitivity() { return mouse_sensitivity; }
 // --- Helpers: 32-bit rotates ---
 static inline uint32_t rotl32(uint32_t v, unsigned s) {
   s &= 31;
-  return (v << s) | (v >> (32 - s));
+  return s ? (v << s) | (v >> (32 - s)) : v;
 }
 static inline uint32_t rotr32(uint32_t v, unsigned s) {
   s &= 31;
-  return (v >> s) | (v << (32 - s));
+  return s ? (v >> s) | (v << (32 - s)) : v;
 }
 
 // --- Period mapping (same logic as set_speed_internal) ---
@@ -80,8 +86,9 @@ void mouse_init(void) {
   // Randomize starting phase (matches the working code’s idea)
   x_reg = rotl32(x_reg, rand() & 15);
   y_reg = rotl32(y_reg, rand() & 15);
+  capture_mouse_phase(x_reg, y_reg);
 
-  last_x_us = last_y_us = last_input_us = get_absolute_time();
+  last_input_us = get_absolute_time();
 }
 
 // ganancia lineal por sensibilidad 0..9
@@ -132,44 +139,64 @@ void mouse_set_speed(int x, int y) {
   last_input_us = get_absolute_time();
 }
 
-// Call this periodically (your main loop or timer). It advances the quadrature
-// when the per-axis period elapses. (This is your old AtariSTMouse::update()).
+// Call this periodically from the core 0 loop. The quadrature itself is
+// stepped on core 1 (mouse_tick()), this only stops a mouse gone quiet.
 void mouse_update(void) {
   absolute_time_t now = get_absolute_time();
 
   // If no fresh HID in a while, force stop (prevents residual creep)
-  if (absolute_time_diff_us(last_input_us, now) > IDLE_TIMEOUT_US) {
+  if (absolute_time_diff_us(last_input_us, now) > IDLE_TIMEOUT_US &&
+      (x_period_us || y_period_us)) {
     x_period_us = 0;
     y_period_us = 0;
+    hidinput_changed();
   }
+}
 
-  if (x_period_us != 0) {
-    int step = (x_period_us > 0) ? x_period_us : -x_period_us;
-    absolute_time_t due = delayed_by_us(last_x_us, step);
-    if (time_reached(due)) {
-      last_x_us = now;
-      x_reg = (x_period_us > 0) ? rotr32(x_reg, 1) : rotl32(x_reg, 1);
-    }
-  } else {
-    // If stopped, keep the schedule anchored to "now"
-    last_x_us = now;
-  }
+void mouse_get_periods(int* x_period, int* y_period) {
+  *x_period = x_period_us;
+  *y_period = y_period_us;
+}
 
-  if (y_period_us != 0) {
-    int step = (y_period_us > 0) ? y_period_us : -y_period_us;
-    absolute_time_t due = delayed_by_us(last_y_us, step);
-    if (time_reached(due)) {
-      last_y_us = now;
-      y_reg = (y_period_us > 0) ? rotr32(y_reg, 1) : rotl32(y_reg, 1);
-    }
+// Steps due on one axis up to emulated cycle 'now'
+static void mouse_advance_axis(int64_t now, int period, int64_t* last,
+                               uint32_t* reg) {
+  if (period == 0) {
+    *last = now;  // if stopped, keep the schedule anchored to "now"
+    return;
+  }
+  int step = period > 0 ? period : -period;
+  int64_t elapsed = now - *last;
+  if (elapsed < step) return;  // DR4 is mostly read faster than it steps
+  unsigned s = 1;
+  if (elapsed < 2 * (int64_t)step) {
+    *last += step;
   } else {
-    last_y_us = now;
+    // Several steps behind, after a long gap between reads. A 32-bit
+    // divide, on the RP2040's hardware divider, covers over an hour of it.
+    int64_t steps = elapsed <= UINT32_MAX
+                        ? (int64_t)((uint32_t)elapsed / (uint32_t)step)
+                        : elapsed / step;
+    *last += steps * step;
+    // The pattern repeats every 4 bits
+    s = (unsigned)(steps & 3);
   }
+  *reg = (period > 0) ? rotr32(*reg, s) : rotl32(*reg, s);
+}
+
+void mouse_set_periods(int64_t cpu_cycles, int x_period, int y_period) {
+  // Steps at the old speed up to now
+  mouse_advance_axis(cpu_cycles, st_x_period, &last_x_cycle, &x_reg);
+  mouse_advance_axis(cpu_cycles, st_y_period, &last_y_cycle, &y_reg);
+  st_x_period = x_period;
+  st_y_period = y_period;
 }
 
 // IKBD 6301 emulator calls this to read the current quadrature registers.
 // dr4_getb() will mask with &3 and place X on bits[1:0], Y on bits[3:2].
-void mouse_tick(int64_t /*cpu_cycles*/, int* x_counter, int* y_counter) {
+void mouse_tick(int64_t cpu_cycles, int* x_counter, int* y_counter) {
+  mouse_advance_axis(cpu_cycles, st_x_period, &last_x_cycle, &x_reg);
+  mouse_advance_axis(cpu_cycles, st_y_period, &last_y_cycle, &y_reg);
   *x_counter = (int)x_reg;
   *y_counter = (int)y_reg;
 }
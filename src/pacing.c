@@ -0,0 +1,69 @@
+#include "pacing.h"
+
+#include <string.h>
+
+void pacing_init(pacing_t* p, uint64_t now_us, uint32_t slice,
+                 uint32_t max_burst, uint32_t max_backlog) {
+  memset(p, 0, sizeof(*p));
+  p->slice = slice;
+  p->max_burst = max_burst < slice ? slice : max_burst;
+  p->max_backlog = max_backlog < p->max_burst ? p->max_burst : max_backlog;
+  p->base_us = now_us;
+}
+
+void pacing_set_adaptive(pacing_t* p, uint32_t short_slice, uint32_t hold) {
+  p->short_slice = short_slice < p->slice ? short_slice : 0;
+  p->hold = hold;
+  p->active_until = 0;
+}
+
+void pacing_activity(pacing_t* p) {
+  p->active_until = p->emulated + p->hold;
+}
+
+uint32_t pacing_slice(const pacing_t* p) {
+  if (p->short_slice && p->emulated < p->active_until) {
+    return p->short_slice;
+  }
+  return p->slice;
+}
+
+uint32_t pacing_due(pacing_t* p, uint64_t now_us) {
+  uint64_t real = now_us - p->base_us;
+  uint32_t slice = pacing_slice(p);
+  if (real < p->emulated + slice) {
+    p->lag = 0;
+    return 0;
+  }
+
+  uint64_t behind = real - p->emulated;
+  if (behind > p->max_backlog) {
+    // Too far behind to catch up without a long burst of stale input
+    p->dropped_cycles += behind - p->max_backlog;
+    p->emulated += behind - p->max_backlog;
+    behind = p->max_backlog;
+  }
+  p->lag = (uint32_t)(behind - slice);
+  if (p->lag > p->max_slip) {
+    p->max_slip = p->lag;
+  }
+
+  uint32_t run = behind < p->max_burst ? (uint32_t)behind : p->max_burst;
+  if (run > slice) {
+    p->catchup_slices++;
+    p->catchup_cycles += run - slice;
+  }
+  if (slice != p->slice) {
+    p->short_slices++;
+  }
+  return run;
+}
+
+void pacing_ran(pacing_t* p, uint64_t cycles) {
+  p->emulated += cycles;
+  p->slices++;
+}
+
+uint64_t pacing_next_us(const pacing_t* p) {
+  return p->base_us + p->emulated + pacing_slice(p);
+}
@@ -1,5 +1,7 @@
 #include "serialp.h"
 
+#include "capture.h"
+
 #define UART_IRQ UART1_IRQ
 
 // Buffer for received data
@@ -26,6 +28,14 @@ bool rx_buffer_get(uint8_t *data) {
 
 uint16_t rx_available(void) { return (rx_head - rx_tail) & 0xFF; }
 
+// Buffer for data to send, filled and drained by core 1. The 6301 sends at
+// the line rate, so it only holds what a slice run faster than real time
+// produces before the UART can take it.
+static uint8_t tx_buffer[256];
+static uint16_t tx_head = 0;
+static uint16_t tx_tail = 0;
+static uint32_t tx_dropped = 0;
+
 // ISR for UART receive
 static void on_uart_irq(void) {
   // Check if this is an RX interrupt
@@ -79,6 +89,8 @@ void serialp_open(void) {
   // // Reset buffer
   rx_head = 0;
   rx_tail = 0;
+  tx_head = 0;
+  tx_tail = 0;
 
   // // Set up interrupt handler for UART
   irq_set_exclusive_handler(UART_IRQ, on_uart_irq);
@@ -100,7 +112,27 @@ void serialp_close(void) {
 
 void serialp_send(const unsigned char data) {
   DPRINTF("6301 -> ST 0x%02X\n", data);
-  // Write the byte and wait until the UART finishes transmitting it.
-  // At 7812 baud this is safe and ensures the bit actually leaves the pin.
-  uart_putc_raw(UART_DEVICE, data);
+  capture_tx(data);
+  uint16_t next_head = (tx_head + 1) & 0xFF;
+  if (next_head == tx_tail) {
+    tx_dropped++;  // UART not serviced for 256 byte times
+    return;
+  }
+  tx_buffer[tx_head] = data;
+  tx_head = next_head;
+  serialp_tx_pump();
 }
+
+void serialp_received(const unsigned char data) { capture_rx(data); }
+
+void serialp_tx_pump(void) {
+  // Never waits: the UART takes a byte only once the previous one is out
+  while (tx_head != tx_tail && uart_is_writable(UART_DEVICE)) {
+    uart_putc_raw(UART_DEVICE, tx_buffer[tx_tail]);
+    tx_tail = (tx_tail + 1) & 0xFF;
+  }
+}
+
+uint16_t serialp_tx_pending(void) { return (tx_head - tx_tail) & 0xFF; }
+
+uint32_t serialp_tx_dropped(void) { return tx_dropped; }
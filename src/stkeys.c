@@ -6,7 +6,7 @@
 #include "debug.h"
 #include "tusb.h"
 
-unsigned char key_states[128] = {0};
+_Atomic uint32_t key_states[STKEYS_WORDS];
 
 static uint8_t stkeys_translate_hid_table(const unsigned char* lookup,
                                           uint8_t hid_code) {
@@ -140,7 +140,7 @@ void stkeys_apply_keyboard_report_layout(const uint8_t* prev_keys,
       uint8_t st = stkeys_translate_hid(layout, prev_code, &shift_active,
                                         &alt_active, &ctrl_active);
       if (st) {
-        key_states[st] = 0;
+        stkeys_set(st, 0);
       }
     }
   }
@@ -154,39 +154,31 @@ void stkeys_apply_keyboard_report_layout(const uint8_t* prev_keys,
     uint8_t st = stkeys_translate_hid(layout, cur_code, &shift_active,
                                       &alt_active, &ctrl_active);
     if (st) {
-      key_states[st] = 1;
+      stkeys_set(st, 1);
     }
   }
 
   if (shift_active) {
     (void)shift_active;
-    key_states[ATARI_LSHIFT] =
-        (modifiers & KEYBOARD_MODIFIER_LEFTSHIFT) ? 1 : 0;
-    key_states[ATARI_RSHIFT] =
-        (modifiers & KEYBOARD_MODIFIER_RIGHTSHIFT) ? 1 : 0;
+    stkeys_set(ATARI_LSHIFT, modifiers & KEYBOARD_MODIFIER_LEFTSHIFT);
+    stkeys_set(ATARI_RSHIFT, modifiers & KEYBOARD_MODIFIER_RIGHTSHIFT);
   } else {
-    key_states[ATARI_LSHIFT] = 0;
-    key_states[ATARI_RSHIFT] = 0;
+    stkeys_set(ATARI_LSHIFT, 0);
+    stkeys_set(ATARI_RSHIFT, 0);
   }
 
   if (alt_active) {
     (void)alt_active;
-    key_states[ATARI_ALT] =
-        (modifiers & (KEYBOARD_MODIFIER_LEFTALT | KEYBOARD_MODIFIER_RIGHTALT))
-            ? 1
-            : 0;
+    stkeys_set(ATARI_ALT, modifiers & (KEYBOARD_MODIFIER_LEFTALT |
+                                       KEYBOARD_MODIFIER_RIGHTALT));
   } else {
-    key_states[ATARI_ALT] = 0;
+    stkeys_set(ATARI_ALT, 0);
   }
 
-  key_states[ATARI_CTRL] =
-      (modifiers & (KEYBOARD_MODIFIER_LEFTCTRL | KEYBOARD_MODIFIER_RIGHTCTRL))
-          ? 1
-          : 0;
-  key_states[ATARI_ALT] =
-      (modifiers & (KEYBOARD_MODIFIER_LEFTALT | KEYBOARD_MODIFIER_RIGHTALT))
-          ? 1
-          : 0;
+  stkeys_set(ATARI_CTRL, modifiers & (KEYBOARD_MODIFIER_LEFTCTRL |
+                                      KEYBOARD_MODIFIER_RIGHTCTRL));
+  stkeys_set(ATARI_ALT, modifiers & (KEYBOARD_MODIFIER_LEFTALT |
+                                     KEYBOARD_MODIFIER_RIGHTALT));
 }
 
 const unsigned char stkeys_lookup_hid_it[128] = {
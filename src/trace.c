@@ -0,0 +1,174 @@
+#include "trace.h"
+
+#include <string.h>
+
+static const uint8_t trace_magic[4] = {'I', 'K', 'T', 'R'};
+
+const uint8_t trace_fields[TRACE_TYPES] = {
+    [TRACE_MOUSE_PHASE] = TRACE_X | TRACE_Y,
+    [TRACE_RX] = TRACE_CODE,
+    [TRACE_TX] = TRACE_CODE,
+    [TRACE_KEY] = TRACE_CODE | TRACE_VALUE,
+    [TRACE_BUTTONS] = TRACE_CODE,
+    [TRACE_JOYSTICK] = TRACE_CODE | TRACE_VALUE,
+    [TRACE_MOUSE] = TRACE_X | TRACE_Y,
+    [TRACE_USB_REPORT] = TRACE_CODE | TRACE_DATA,
+    [TRACE_BT_DATA] = TRACE_CODE | TRACE_X | TRACE_Y | TRACE_DATA,
+    [TRACE_GPIO] = TRACE_CODE | TRACE_VALUE | TRACE_X | TRACE_Y | TRACE_DATA,
+    [TRACE_LOST] = TRACE_X,
+};
+
+void trace_ring_init(trace_ring_t* r) {
+  memset(r->events, 0, sizeof(r->events));
+  atomic_store_explicit(&r->head, 0, memory_order_relaxed);
+  atomic_store_explicit(&r->tail, 0, memory_order_relaxed);
+  r->lost = 0;
+}
+
+void trace_ring_push(trace_ring_t* r, const trace_event_t* ev) {
+  uint32_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+  uint32_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+  uint32_t needed = r->lost ? 2 : 1;
+  if (head - tail + needed > TRACE_RING_SIZE) {
+    r->lost++;
+    return;
+  }
+  if (r->lost) {
+    trace_event_t* lost = &r->events[head & (TRACE_RING_SIZE - 1)];
+    memset(lost, 0, sizeof(*lost));
+    lost->cycle = ev->cycle;
+    lost->time_us = ev->time_us;
+    lost->type = TRACE_LOST;
+    lost->x = (int32_t)r->lost;
+    r->lost = 0;
+    head++;
+  }
+  r->events[head & (TRACE_RING_SIZE - 1)] = *ev;
+  atomic_store_explicit(&r->head, head + 1, memory_order_release);
+}
+
+bool trace_ring_peek(trace_ring_t* r, trace_event_t* ev) {
+  uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+  uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+  if (head == tail) {
+    return false;
+  }
+  *ev = r->events[tail & (TRACE_RING_SIZE - 1)];
+  return true;
+}
+
+void trace_ring_pop(trace_ring_t* r) {
+  uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+  atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+}
+
+void trace_codec_init(trace_codec_t* c) {
+  c->cycle = 0;
+  c->time_us = 0;
+}
+
+size_t trace_write_header(uint8_t* out) {
+  memcpy(out, trace_magic, sizeof(trace_magic));
+  out[4] = TRACE_VERSION;
+  out[5] = out[6] = out[7] = 0;
+  return TRACE_HEADER_SIZE;
+}
+
+size_t trace_read_header(const uint8_t* in, size_t len) {
+  if (len < TRACE_HEADER_SIZE || memcmp(in, trace_magic, sizeof(trace_magic)) ||
+      in[4] != TRACE_VERSION) {
+    return 0;
+  }
+  return TRACE_HEADER_SIZE;
+}
+
+static size_t put_varint(uint8_t* out, int64_t value) {
+  uint64_t v = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);  // zigzag
+  size_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = (uint8_t)v;
+  return n;
+}
+
+// Returns the bytes taken, 0 if cut short or longer than 10 bytes
+static size_t get_varint(const uint8_t* in, size_t len, int64_t* value) {
+  uint64_t v = 0;
+  for (size_t n = 0; n < len && n < 10; n++) {
+    v |= (uint64_t)(in[n] & 0x7F) << (7 * n);
+    if (!(in[n] & 0x80)) {
+      *value = (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+      return n + 1;
+    }
+  }
+  return 0;
+}
+
+size_t trace_encode(trace_codec_t* c, const trace_event_t* ev, uint8_t* out) {
+  uint8_t fields = ev->type < TRACE_TYPES ? trace_fields[ev->type] : 0;
+  size_t n = 0;
+
+  out[n++] = ev->type;
+  n += put_varint(out + n, (int64_t)(ev->cycle - c->cycle));
+  n += put_varint(out + n, (int64_t)(ev->time_us - c->time_us));
+  c->cycle = ev->cycle;
+  c->time_us = ev->time_us;
+  if (fields & TRACE_CODE) out[n++] = ev->code;
+  if (fields & TRACE_VALUE) out[n++] = ev->value;
+  if (fields & TRACE_X) n += put_varint(out + n, ev->x);
+  if (fields & TRACE_Y) n += put_varint(out + n, ev->y);
+  if (fields & TRACE_DATA) {
+    uint8_t len = ev->len < TRACE_MAX_DATA ? ev->len : TRACE_MAX_DATA;
+    out[n++] = len;
+    memcpy(out + n, ev->data, len);
+    n += len;
+  }
+  return n;
+}
+
+size_t trace_decode(trace_codec_t* c, const uint8_t* in, size_t len,
+                    trace_event_t* ev) {
+  size_t n = 0, k;
+  int64_t v;
+
+  memset(ev, 0, sizeof(*ev));
+  if (!len || in[0] >= TRACE_TYPES) return 0;
+  ev->type = in[n++];
+  uint8_t fields = trace_fields[ev->type];
+
+  if (!(k = get_varint(in + n, len - n, &v))) return 0;
+  n += k;
+  ev->cycle = c->cycle + (uint64_t)v;
+  if (!(k = get_varint(in + n, len - n, &v))) return 0;
+  n += k;
+  ev->time_us = c->time_us + (uint64_t)v;
+  if (fields & TRACE_CODE) {
+    if (n >= len) return 0;
+    ev->code = in[n++];
+  }
+  if (fields & TRACE_VALUE) {
+    if (n >= len) return 0;
+    ev->value = in[n++];
+  }
+  if (fields & TRACE_X) {
+    if (!(k = get_varint(in + n, len - n, &v))) return 0;
+    n += k;
+    ev->x = (int32_t)v;
+  }
+  if (fields & TRACE_Y) {
+    if (!(k = get_varint(in + n, len - n, &v))) return 0;
+    n += k;
+    ev->y = (int32_t)v;
+  }
+  if (fields & TRACE_DATA) {
+    if (n >= len || in[n] > TRACE_MAX_DATA || len - n - 1 < in[n]) return 0;
+    ev->len = in[n++];
+    memcpy(ev->data, in + n, ev->len);
+    n += ev->len;
+  }
+  c->cycle = ev->cycle;
+  c->time_us = ev->time_us;
+  return n;
+}
@@ -1,5 +1,7 @@
 #include "usbloop.h"
 
+#include "capture.h"
+
 // Provided by main.c
 void launch_config_cb(void);
 
@@ -109,6 +111,8 @@ int main_usb_loop(int prev_reset_state, int prev_config_state,
     if (handle_rx) {
       handle_rx();
     }
+    capture_flush();
+    hidinput_flush();
 
     if (absolute_time_diff_us(original_mouse_sampling_ms, tm) >=
         ORIGINAL_MOUSE_LINE_POLL_INTERVAL_US) {
@@ -0,0 +1,49 @@
+#ifndef IKBD_HW_H
+#define IKBD_HW_H
+
+#include <stdint.h>
+
+#include "mc6850.h"
+
+/*
+ * The ST hardware the tests use: the keyboard ACIA at 0xFFFFFC00 and the
+ * 200 Hz system timer. The host build (tests/host) has its own version of
+ * this header, running the same tests against a model of both.
+ */
+
+#define ACIA_BASE 0xFFFFFC00u
+struct ACIA_INTERFACE {
+  unsigned char control; /* read=status, write=control */
+  unsigned char dummy1;
+  unsigned char data;
+  unsigned char dummy2;
+};
+
+#define acia_interface (*(volatile struct ACIA_INTERFACE*)ACIA_BASE)
+
+static inline uint8_t acia_status(void) { return acia_interface.control; }
+
+static inline uint8_t acia_read_data(void) { return acia_interface.data; }
+
+static inline void acia_write_control(uint8_t value) {
+  acia_interface.control = value;
+}
+
+static inline void acia_write_data(uint8_t value) {
+  acia_interface.data = value;
+}
+
+#define HZ200_ADDR 0x4BAu
+static volatile uint32_t* const hz200 = (volatile uint32_t*)HZ200_ADDR;
+
+/* stable read (prevents tearing while the longword is being updated) */
+static inline uint32_t read_hz200(void) {
+  uint32_t a, b;
+  do {
+    a = *hz200;
+    b = *hz200;
+  } while (a != b);
+  return a;
+}
+
+#endif  // IKBD_HW_H
@@ -0,0 +1,27 @@
+#ifndef MC6850_H
+#define MC6850_H
+
+/*
+ * MC6850 ACIA register bits, for the keyboard ACIA of the ST. Shared with
+ * the host model of it in tests/host.
+ */
+
+// NOTE: These control values MUST match the MC6850 encoding and your machine
+// setup. If these are wrong, takeover will break the IKBD stream.
+#define IKBD_ACIA_CTRL_MASTER_RESET 0x03 /* typical 6850 master reset */
+#define IKBD_ACIA_CTRL_POLLING 0x16      /* /64 + 8N1 + RX IRQ off */
+#define IKBD_ACIA_CTRL_TOS_LIKE 0x96     /* /64 + 8N1 + RX IRQ on  */
+
+#define ACIA_CR_DIVIDE_MASK 0x03 /* 00 /1, 01 /16, 10 /64, 11 reset */
+#define ACIA_CR_WORD_MASK 0x1C   /* data bits, parity and stop bits */
+#define ACIA_CR_WORD_8N1 0x14
+#define ACIA_CR_RIE (1u << 7) /* RX interrupt enable */
+
+#define ACIA_SR_RDRF (1u << 0) /* RX data register full */
+#define ACIA_SR_TDRE (1u << 1) /* TX data register empty */
+#define ACIA_SR_FE (1u << 4)   /* framing error */
+#define ACIA_SR_OVRN (1u << 5) /* overrun */
+#define ACIA_SR_PE (1u << 6)   /* parity error */
+#define ACIA_SR_IRQ (1u << 7)  /* interrupt request */
+
+#endif  // MC6850_H
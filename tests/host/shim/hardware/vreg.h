@@ -0,0 +1,9 @@
+/*
+ * Host stand-in for the Pico SDK voltage regulator header.
+ */
+#ifndef HOST_HARDWARE_VREG_H
+#define HOST_HARDWARE_VREG_H
+
+#define VREG_VOLTAGE_1_20 13
+
+#endif  // HOST_HARDWARE_VREG_H
@@ -0,0 +1,21 @@
+/*
+ * Host stand-in for hidinput.h.
+ *
+ * The HD6301 core only needs the st_* accessors used by the DR2/DR4
+ * port handlers in ireg.c; keys are set with hd6301_set_key(). They are
+ * implemented by tests/host/src/hostio.c. src/mouse.c also calls
+ * hidinput_changed(), which mouse_test provides.
+ */
+#ifndef HIDINPUT_H
+#define HIDINPUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+int st_mouse_buttons();
+unsigned char st_joystick();
+int st_mouse_enabled();
+
+void hidinput_changed(void);
+
+#endif  // HIDINPUT_H
@@ -0,0 +1,20 @@
+/*
+ * Host stand-in for mouse.h. mouse_tick() is the one of
+ * tests/host/src/hostio.c, except in mouse_test, which builds the
+ * firmware's src/mouse.c.
+ */
+#ifndef MOUSE_H
+#define MOUSE_H
+
+#include <stdint.h>
+
+void mouse_tick(int64_t cpu_cycles, int* x_counter, int* y_counter);
+
+// src/mouse.c only
+void mouse_set_periods(int64_t cpu_cycles, int x_period, int y_period);
+void mouse_set_speed(int x, int y);
+void mouse_get_periods(int* x_period, int* y_period);
+void mouse_update(void);
+void mouse_init(void);
+
+#endif  // MOUSE_H
@@ -0,0 +1,13 @@
+/*
+ * Host stand-in for the Pico SDK stdlib header.
+ *
+ * Only what the HD6301 core pulls in transitively through debug.h and
+ * constants.h is provided here.
+ */
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#endif  // HOST_PICO_STDLIB_H
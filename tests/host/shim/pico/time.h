@@ -0,0 +1,19 @@
+/*
+ * Host stand-in for the Pico SDK time header, for src/mouse.c. The time is
+ * whatever get_absolute_time() of the test returns.
+ */
+#ifndef HOST_PICO_TIME_H
+#define HOST_PICO_TIME_H
+
+#include <stdint.h>
+
+typedef uint64_t absolute_time_t;
+
+absolute_time_t get_absolute_time(void);
+
+static inline int64_t absolute_time_diff_us(absolute_time_t from,
+                                            absolute_time_t to) {
+  return (int64_t)(to - from);
+}
+
+#endif  // HOST_PICO_TIME_H
@@ -0,0 +1,14 @@
+/*
+ * Host stand-in for serialp.h. See tests/host/src/hostio.c.
+ */
+#ifndef SERIALP_H
+#define SERIALP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "6301/6301.h"
+
+void serialp_send(const unsigned char data);
+
+#endif  // SERIALP_H
@@ -0,0 +1,240 @@
+/*
+ * HD6301 host benchmark
+ *
+ * Boots the real IKBD ROM on the host-built core and drives it with a
+ * synthetic but representative workload: a reset, keys going up and down,
+ * the mouse moving and the joystick changing. Reports how fast the core
+ * emulates compared with the 1 MHz of the real chip, and which opcodes
+ * dominate the run.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "hostio.h"
+#include "reg.h"
+
+#define BENCH_DEFAULT_SECONDS 10
+#define BENCH_DEFAULT_TOP 20
+#define BENCH_INPUT_PERIOD_MS 20
+
+static const uint8_t bench_keys[] = {0x1E, 0x30, 0x2E, 0x20, 0x39, 0x1C};
+
+static double now_seconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static int compare_opcodes(const void* a, const void* b) {
+  COUNTER_VAR ca = hd6301_stats.opcodes[*(const int*)a];
+  COUNTER_VAR cb = hd6301_stats.opcodes[*(const int*)b];
+  return (ca < cb) - (ca > cb);
+}
+
+static void usage(const char* name) {
+  printf("Usage: %s [-s seconds] [-t top] [-e engine]\n", name);
+  printf("  -s  emulated seconds to run (default %d)\n",
+         BENCH_DEFAULT_SECONDS);
+  printf("  -t  number of opcodes to list, 0 for all (default %d)\n",
+         BENCH_DEFAULT_TOP);
+  printf("  -e  'reference' to run instr_exec() per instruction instead of\n");
+  printf("      hd6301_run_until() (default), 'shadow' to run both and\n");
+  printf("      compare them every 1000 instructions\n");
+}
+
+// One input step every BENCH_INPUT_PERIOD_MS of emulated time
+static void bench_input_step(int step) {
+  int nkeys = (int)sizeof(bench_keys);
+  hostio_set_key(bench_keys[step % nkeys], (step / nkeys) % 2 == 0);
+  switch (step % 4) {
+    case 0:
+      hostio_set_mouse_period(700, 0);
+      break;
+    case 1:
+      hostio_set_mouse_period(0, -900);
+      break;
+    case 2:
+      hostio_set_mouse_period(-1500, 1500);
+      break;
+    default:
+      hostio_set_mouse_period(0, 0);
+      break;
+  }
+  hostio_set_mouse_buttons((step % 16) == 0 ? 2 : 0);
+  hostio_set_joystick((step % 10) < 5 ? 0x10 : 0x00);
+}
+
+// Boots the ROM and runs the workload for 'seconds' of emulated time, with
+// the statistics counting from the boot. Returns the wall time it took, or
+// -1 if the core could not be initialised.
+static double bench_pass(int seconds, int* tx_bytes, int64_t* cycles) {
+  if (!hostio_boot()) {
+    return -1;
+  }
+  hd6301_stats_reset();
+
+  static const uint8_t reset_cmd[] = {0x80, 0x01};
+  hostio_rx_put_buf(reset_cmd, sizeof(reset_cmd));
+
+  int64_t total = (int64_t)seconds * HOSTIO_CYCLES_PER_SECOND;
+  int64_t step_cycles = (int64_t)BENCH_INPUT_PERIOD_MS * HOSTIO_CYCLES_PER_MS;
+  int64_t start_cycles = cpu.ncycles;
+  int step = 0;
+
+  *tx_bytes = 0;
+  double wall_start = now_seconds();
+  while (!crashed && cpu.ncycles - start_cycles < total) {
+    bench_input_step(step++);
+    hostio_run(step_cycles);
+    *tx_bytes += hostio_tx_count();
+    hostio_tx_clear();
+  }
+  double wall = now_seconds() - wall_start;
+
+  *cycles = cpu.ncycles - start_cycles;
+  return wall;
+}
+
+int main(int argc, char* argv[]) {
+  int seconds = BENCH_DEFAULT_SECONDS;
+  int top = BENCH_DEFAULT_TOP;
+  // hd6301_run_until(), the engine this build was made with
+  const char* built = hostio_engines[HOSTIO_ENGINES - 1].name;
+  const char* engine = built;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      seconds = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      top = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-e") && i + 1 < argc) {
+      engine = argv[++i];
+      if (!strcmp(engine, "reference")) {
+        hostio_set_runner(hostio_run_reference);
+      } else if (!strcmp(engine, "shadow")) {
+        hostio_shadow_config(NULL, 0);
+        hostio_set_runner(hostio_run_shadow);
+      } else if (!strcmp(engine, "default") || !strcmp(engine, built)) {
+        engine = built;
+      } else {
+        usage(argv[0]);
+        return 1;
+      }
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (seconds <= 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  int tx_bytes = 0;
+  int64_t cycles = 0;
+#if HD6301_BLOCK_CACHE
+  // The same workload with the block cache off first, for its speedup
+  double wall_uncached = 0;
+  if (engine == built) {
+    hd6301_block_cache = 0;
+    wall_uncached = bench_pass(seconds, &tx_bytes, &cycles);
+    hostio_shutdown();
+    hd6301_block_cache = 1;
+    if (wall_uncached < 0) {
+      printf("Failed to initialise HD6301\n");
+      return 1;
+    }
+  }
+#endif
+  double wall = bench_pass(seconds, &tx_bytes, &cycles);
+  if (wall < 0) {
+    printf("Failed to initialise HD6301\n");
+    return 1;
+  }
+
+  double emulated = (double)cycles / HOSTIO_CYCLES_PER_SECOND;
+  double hz = wall > 0 ? (double)cycles / wall : 0;
+  double ips = wall > 0 ? (double)hd6301_stats.instructions / wall : 0;
+
+  printf("HD6301 host benchmark (%s engine)\n", engine);
+  printf("Emulated time   : %.3f s (%lld cycles)\n", emulated,
+         (long long)cycles);
+  printf("Wall time       : %.3f s\n", wall);
+  printf("Emulated speed  : %.2f MHz (%.1fx real time)\n", hz / 1e6,
+         hz / HOSTIO_CYCLES_PER_SECOND);
+  printf("Instructions    : %lld (%.2f MIPS, %.2f cycles/instr)\n",
+         (long long)hd6301_stats.instructions, ips / 1e6,
+         hd6301_stats.instructions
+             ? (double)cycles / (double)hd6301_stats.instructions
+             : 0.0);
+  printf("Interrupts      : %lld\n", (long long)hd6301_stats.interrupts);
+  if (!strcmp(engine, "shadow")) {
+    printf("Shadow checked  : %lld instructions%s\n",
+           (long long)hostio_shadow_checked(),
+           hostio_shadow_diverged() ? ", diverged" : "");
+  }
+  printf("Idle skipped    : %lld cycles (%.1f%%)\n",
+         (long long)(hd6301_skipped.idle_cycles + hd6301_skipped.sleep_cycles),
+         cycles ? 100.0 *
+                      (double)(hd6301_skipped.idle_cycles +
+                               hd6301_skipped.sleep_cycles) /
+                      (double)cycles
+                : 0.0);
+  printf("Translated ROM  : %lld instructions (%.1f%%) in %lld blocks\n",
+         (long long)hd6301_stats.aot_instructions,
+         hd6301_stats.instructions
+             ? 100.0 * (double)hd6301_stats.aot_instructions /
+                   (double)hd6301_stats.instructions
+             : 0.0,
+         (long long)hd6301_stats.aot_blocks);
+  printf("Block cache     : %.1f%% of %lld lookups hit, %lld fills\n",
+         hd6301_stats.block_lookups
+             ? 100.0 * (double)hd6301_stats.block_runs /
+                   (double)hd6301_stats.block_lookups
+             : 0.0,
+         (long long)hd6301_stats.block_lookups,
+         (long long)hd6301_stats.block_fills);
+  printf("Block runs      : %lld instructions unchecked (%.1f%%), %.2f per run\n",
+         (long long)hd6301_stats.block_instructions,
+         hd6301_stats.instructions
+             ? 100.0 * (double)hd6301_stats.block_instructions /
+                   (double)hd6301_stats.instructions
+             : 0.0,
+         hd6301_stats.block_runs ? (double)hd6301_stats.block_instructions /
+                                       (double)hd6301_stats.block_runs
+                                 : 0.0);
+#if HD6301_BLOCK_CACHE
+  if (wall_uncached > 0 && wall > 0) {
+    printf("Block speedup   : %.2fx (%.2f MHz with the cache off)\n",
+           wall_uncached / wall, (double)cycles / wall_uncached / 1e6);
+  }
+#endif
+  printf("Bytes sent      : %d\n", tx_bytes);
+  if (crashed) {
+    printf("CPU crashed at PC %04X\n", reg_getpc());
+  }
+
+  int order[256];
+  for (int i = 0; i < 256; i++) order[i] = i;
+  qsort(order, 256, sizeof(order[0]), compare_opcodes);
+
+  printf("\nOpcode  Mnemonic          Count         %%\n");
+  for (int i = 0; i < 256; i++) {
+    int op = order[i];
+    COUNTER_VAR n = hd6301_stats.opcodes[op];
+    if (n == 0 || (top > 0 && i >= top)) break;
+    char mnemonic[16];
+    snprintf(mnemonic, sizeof(mnemonic), "%s", hd6301_opcode_mnemonic(op));
+    char* space = strchr(mnemonic, ' ');
+    if (space) *space = '\0';
+    printf("  %02X    %-10s %12lld  %6.2f\n", op, mnemonic, (long long)n,
+           100.0 * (double)n / (double)hd6301_stats.instructions);
+  }
+
+  hostio_shutdown();
+  return crashed ? 1 : 0;
+}
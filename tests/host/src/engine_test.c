@@ -0,0 +1,682 @@
+/*
+ * HD6301 engine equivalence test
+ *
+ * Checks that the threaded engine (dispatch_run) behaves exactly like the
+ * reference one (instr_exec):
+ *
+ *  - every defined opcode is single-stepped from many random register and
+ *    operand combinations on both engines, comparing registers, cycles,
+ *    internal registers and memory afterwards
+ *  - the same for every flag-setting opcode followed by a flag reader,
+ *    which checks the threaded engine's lazy condition codes against the
+ *    eager ones of alu.c
+ *  - spin loops waiting on the timer or the serial port, and SLP and WAI,
+ *    which the threaded engine fast-forwards, run for long stretches
+ *  - WAI stacking the registers over code in RAM that runs next
+ *  - hd6301_run_until() stopping on the same instruction for each event
+ *  - OCF with OCR near 0xFFFF, set after the same instruction as the
+ *    original timer_inc() set it, wrap or not
+ *  - a hot ROM loop moving the timer's next event into its own path,
+ *    which a block cache run must not step over (HD6301_BLOCK_CACHE)
+ *  - the IKBD ROM is run through a command and input script on both
+ *    engines, comparing every byte sent (and the cycle it was sent at) and
+ *    the final CPU state
+ *
+ * Built three times: engine_test_aot runs the same checks with the ROM
+ * code translated ahead of time (aotrom.c), which the ROM script goes
+ * through, and engine_test_bcache with the block cache (bcache.c) in the
+ * threaded engine.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "chip.h"
+#include "cpu.h"
+#include "dispatch.h"
+#include "host_test.h"
+#include "hostio.h"
+#include "instr.h"
+#include "optab.h"
+#include "ireg.h"
+#include "predecode.h"
+#include "reg.h"
+#include "sci.h"
+#include "timer.h"
+
+#define RAM_SIZE (256 + 4096)  // as allocated by mem_init()
+#define TRIALS_PER_OPCODE 2000
+#define TRIALS_PER_PAIR 40
+#define SCRIPT_STEP_MS 20
+#define SCRIPT_STEPS 250
+
+extern u_char* ram;
+
+struct snapshot {
+  struct regs regs;
+  COUNTER_VAR ncycles;
+  enum cpu_states state;
+  COUNTER_VAR sci_tx_begin, sci_tx_end;
+  u_char ram[RAM_SIZE];
+  u_char iram[NIREGS];
+};
+
+static void snapshot_take(struct snapshot* s) {
+  timer_sync();
+  s->regs = regs;
+  s->ncycles = cpu.ncycles;
+  s->state = cpu.state;
+  s->sci_tx_begin = sci_tx_begin;
+  s->sci_tx_end = sci_tx_end;
+  memcpy(s->ram, ram, RAM_SIZE);
+  memcpy(s->iram, iram, NIREGS);
+}
+
+static void snapshot_restore(const struct snapshot* s) {
+  // mem_putb() lets the program write to ROM, the threaded engine keeps
+  // its pre-decoded copy and block cache in step and stops using the
+  // translated ROM, a restore has to rebuild all three
+  int rom_changed = memcmp(ram + 256, s->ram + 256, RAM_SIZE - 256) != 0;
+  regs = s->regs;
+  cpu.ncycles = s->ncycles;
+  cpu.state = s->state;
+  sci_tx_begin = s->sci_tx_begin;
+  sci_tx_end = s->sci_tx_end;
+  memcpy(ram, s->ram, RAM_SIZE);
+  memcpy(iram, s->iram, NIREGS);
+  timer_reload();
+  if (rom_changed) {
+    predecode_rom_build();
+    dispatch_rom_build();
+  }
+}
+
+// Returns a description of the first difference, or NULL
+static const char* snapshot_diff(const struct snapshot* a,
+                                 const struct snapshot* b) {
+  static char what[64];
+  if (a->regs.accd.a != b->regs.accd.a) return "A";
+  if (a->regs.accd.b != b->regs.accd.b) return "B";
+  if (a->regs.ix != b->regs.ix) return "X";
+  if (a->regs.sp != b->regs.sp) return "SP";
+  if (a->regs.pc != b->regs.pc) return "PC";
+  if ((a->regs.ccr | 0xC0) != (b->regs.ccr | 0xC0)) return "CCR";
+  if (a->ncycles != b->ncycles) return "cycles";
+  if (a->state != b->state) return "SLP/WAI state";
+  if (a->sci_tx_begin != b->sci_tx_begin || a->sci_tx_end != b->sci_tx_end) {
+    return "SCI transmitter";
+  }
+  for (int i = 0; i < NIREGS; i++) {
+    if (a->iram[i] != b->iram[i]) {
+      snprintf(what, sizeof(what), "internal register %02X", i);
+      return what;
+    }
+  }
+  for (int i = 0; i < RAM_SIZE; i++) {
+    if (a->ram[i] != b->ram[i]) {
+      snprintf(what, sizeof(what), "memory at %04X",
+               i < 256 ? i : i - 256 + 0xF000);
+      return what;
+    }
+  }
+  return NULL;
+}
+
+static int opcode_defined(int op) {
+  static const uint8_t undefined[] = {
+      0x02, 0x03, 0x12, 0x13, 0x14, 0x15, 0x1C, 0x1D,
+      0x1E, 0x1F, 0x41, 0x42, 0x45, 0x4B, 0x4E, 0x51, 0x52,
+      0x55, 0x5B, 0x5E, 0x87, 0x8F, 0xC7, 0xCD, 0xCF};
+  for (size_t i = 0; i < sizeof(undefined); i++) {
+    if (undefined[i] == op) return 0;
+  }
+  return 1;
+}
+
+// Random registers and internal RAM contents, PC at 0x80. Half the
+// trials point X into internal RAM so that indexed writes have a visible
+// effect.
+static void random_state(int trial) {
+  for (int i = 0x80; i < 0x100; i++) ram[i] = (u_char)rand();
+  regs.accd.a = rand() & 0xFF;
+  regs.accd.b = rand() & 0xFF;
+  regs.ix = (trial & 1) ? 0x80 + (rand() & 0x3F) : (rand() & 0xFFFF);
+  regs.sp = 0xC0 + (rand() & 0x3F);
+  regs.ccr = (rand() & 0xFF) | IFLAG;  // no interrupt in the way
+  regs.pc = 0x80;
+}
+
+// Run the current state for 'clocks' cycles on both engines, the same way
+// hd6301_run_clocks() would, and compare. Returns 0 on a difference.
+static int compare_engines(COUNTER_VAR clocks, const char* what) {
+  static struct snapshot start, ref, thr;
+
+  crashed = 0;
+  snapshot_take(&start);
+  while (!crashed && cpu.ncycles - start.ncycles < clocks) {
+    instr_exec();
+  }
+  snapshot_take(&ref);
+
+  snapshot_restore(&start);
+  crashed = 0;
+  dispatch_run(clocks);
+  snapshot_take(&thr);
+
+  const char* diff = snapshot_diff(&ref, &thr);
+  if (!diff) return 1;
+  printf("FAIL %s: %s differs\n", what, diff);
+  printf("  code %02X %02X %02X %02X, A=%02X B=%02X X=%04X SP=%04X CCR=%02X\n",
+         start.ram[0x80], start.ram[0x81], start.ram[0x82], start.ram[0x83],
+         start.regs.accd.a, start.regs.accd.b, start.regs.ix, start.regs.sp,
+         start.regs.ccr);
+  failures++;
+  return 0;
+}
+
+// Every opcode on its own
+static void test_opcodes(void) {
+  static struct snapshot base;
+  snapshot_take(&base);
+  srand(1);
+
+  for (int op = 0; op < 256; op++) {
+    // Undefined opcodes trap, run them a few times only
+    int trials = opcode_defined(op) ? TRIALS_PER_OPCODE : 16;
+    char what[64];
+    snprintf(what, sizeof(what), "opcode %02X (%s)", op,
+             opcodetab[op].op_mnemonic);
+    for (int trial = 0; trial < trials; trial++) {
+      snapshot_restore(&base);
+      random_state(trial);
+      ram[0x80] = (u_char)op;
+      if (!compare_engines(1, what)) break;
+    }
+  }
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+// Every flag-setting opcode followed by an instruction that reads the
+// flags, so that condition codes carried from one instruction to the next
+// are checked and not only the CCR stored at the end of a run
+static void test_flag_pairs(void) {
+  static const uint8_t readers[] = {
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B,
+      0x2C, 0x2D, 0x2E, 0x2F,  // branches
+      0x07,                    // tpa
+      0x19,                    // daa
+      0x3F,                    // swi, stacks CCR
+      0x46, 0x49,              // rora, rola
+      0x82, 0x89,              // sbca, adca
+      0x08,                    // inx, only changes Z
+  };
+  static struct snapshot base;
+  snapshot_take(&base);
+  srand(2);
+
+  for (int op = 0; op < 256; op++) {
+    if (!opcode_defined(op)) continue;
+    int next = 0x80 + 1 + opcodetab[op].op_n_operands;
+    for (size_t r = 0; r < sizeof(readers); r++) {
+      char what[64];
+      snprintf(what, sizeof(what), "opcode %02X then %02X", op, readers[r]);
+      for (int trial = 0; trial < TRIALS_PER_PAIR; trial++) {
+        snapshot_restore(&base);
+        random_state(trial);
+        ram[0x80] = (u_char)op;
+        ram[next] = readers[r];
+        // one cycle into the second instruction
+        if (!compare_engines(opcodetab[op].op_n_cycles + 1, what)) break;
+      }
+    }
+  }
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+// Spin loops in internal RAM, all with interrupts masked and followed by
+// a branch to itself
+static const struct {
+  const char* what;
+  uint8_t code[12];
+  int fast_forward;  // skipped with HD6301_IDLE_SKIP while it waits
+} idle_loops[] = {
+    {"wait for OCF", {0x7B, 0x40, 0x08, 0x27, 0xFB, 0x20, 0xFE}, 1},
+    {"wait for RDRF", {0x7B, 0x80, 0x11, 0x27, 0xFB, 0x20, 0xFE}, 1},
+    // two bytes sent, the second one waits for the first to be shifted out
+    {"wait for TDRE",
+     {0x97, 0x13, 0x97, 0x13, 0x7B, 0x20, 0x11, 0x27, 0xFB, 0x20, 0xFE}, 1},
+    {"poll FRC", {0x96, 0x09, 0x81, 0x40, 0x26, 0xFA, 0x20, 0xFE}, 0},
+    {"count down", {0x4A, 0x26, 0xFD, 0x20, 0xFE}, 0},
+};
+
+// Idle-loop fast-forward: the loop has to end on the same cycle, with the
+// same state, as when every iteration is run
+static void test_idle_loops(void) {
+  static struct snapshot base;
+  snapshot_take(&base);
+  srand(3);
+
+  for (size_t i = 0; i < sizeof(idle_loops) / sizeof(idle_loops[0]); i++) {
+    for (int trial = 0; trial < 20; trial++) {
+      snapshot_restore(&base);
+      random_state(trial);
+      memcpy(&ram[0x80], idle_loops[i].code, sizeof(idle_loops[i].code));
+      iram[TCSR] &= ~(OCF | TOF);
+      iram[OCR] = rand() & 0xFF;
+      iram[OCR + 1] = rand() & 0xFF;
+      timer_reload();
+
+      COUNTER_VAR idle = hd6301_skipped.idle_cycles;
+      if (!compare_engines(20000 + rand() % 50000, idle_loops[i].what)) break;
+      // a byte arriving while the loop runs, then the rest of the loop
+      uint8_t byte = (uint8_t)rand();
+      sci_in(&byte, 1);
+      if (!compare_engines(1000 + rand() % 5000, idle_loops[i].what)) break;
+
+#if HD6301_IDLE_SKIP
+      if (idle_loops[i].fast_forward && hd6301_skipped.idle_cycles == idle) {
+        printf("FAIL %s: not fast-forwarded\n", idle_loops[i].what);
+        failures++;
+        break;
+      }
+#else
+      (void)idle;
+#endif
+    }
+  }
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+// SLP and WAI in internal RAM, followed by a branch to itself
+static const struct {
+  const char* what;
+  uint8_t code[4];
+  int iflag;   // I flag while stopped
+  int enable;  // interrupt enables set in TCSR and TRCSR
+} sleep_cases[] = {
+    {"wai, timer", {0x3E, 0x20, 0xFE}, 0, EOCI},
+    {"wai, serial", {0x3E, 0x20, 0xFE}, 0, RIE},
+    {"wai, masked", {0x3E, 0x20, 0xFE}, 1, EOCI | RIE},
+    {"slp, timer", {0x1A, 0x20, 0xFE}, 0, EOCI},
+    {"slp, masked timer", {0x1A, 0x20, 0xFE}, 1, EOCI},
+    {"slp, masked serial", {0x1A, 0x20, 0xFE}, 1, RIE},
+};
+
+// The threaded engine skips the wait after SLP and WAI in one go, the
+// reference one cycle at a time
+static void test_sleep(void) {
+  static struct snapshot base;
+  snapshot_take(&base);
+  srand(4);
+
+  for (size_t i = 0; i < sizeof(sleep_cases) / sizeof(sleep_cases[0]); i++) {
+    for (int trial = 0; trial < 20; trial++) {
+      snapshot_restore(&base);
+      random_state(trial);
+      if (!sleep_cases[i].iflag) regs.ccr &= ~IFLAG;
+      memcpy(&ram[0x80], sleep_cases[i].code, sizeof(sleep_cases[i].code));
+      iram[TCSR] = sleep_cases[i].enable & EOCI;
+      iram[TRCSR] = TDRE | (sleep_cases[i].enable & RIE);
+      iram[OCR] = rand() & 0xFF;
+      iram[OCR + 1] = rand() & 0xFF;
+      timer_reload();
+
+      COUNTER_VAR slept = hd6301_skipped.sleep_cycles;
+      if (!compare_engines(20000 + rand() % 50000, sleep_cases[i].what)) break;
+      uint8_t byte = (uint8_t)rand();
+      sci_in(&byte, 1);
+      if (!compare_engines(1000 + rand() % 5000, sleep_cases[i].what)) break;
+
+      if (hd6301_skipped.sleep_cycles == slept) {
+        printf("FAIL %s: wait not skipped\n", sleep_cases[i].what);
+        failures++;
+        break;
+      }
+    }
+  }
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+// WAI stacking the registers over code in internal RAM that has already
+// run, and the interrupt then going there: the threaded engine has to
+// drop its pre-decoded copy of what the stacking overwrote
+static void test_wai_stack(void) {
+  static const uint8_t code[] = {
+      0x7E, 0x00, 0xAA,  // 0080 jmp 00AA
+  };
+  static const uint8_t stale[] = {
+      0x7E, 0x00, 0xC0,  // 00AA jmp 00C0, then B, A and X high stacked
+  };
+  static const uint8_t wait[] = {
+      0x8E, 0x00, 0xAF,  // 00C0 lds #00AF
+      0xC6, 0x7E,        //      ldab #7E
+      0x4F,              //      clra
+      0xCE, 0xD0, 0x00,  //      ldx #D000
+      0x0E,              //      cli
+      0x3E,              //      wai
+      0x20, 0xFE,        //      bra *
+  };
+  static const uint8_t done[] = {
+      0x86, 0x01,  // 00D0 ldaa #1
+      0x97, 0xB0,  //      staa 00B0
+      0x20, 0xFE,  //      bra *
+  };
+  static struct snapshot base;
+  snapshot_take(&base);
+
+  random_state(0);
+  memcpy(&ram[0x80], code, sizeof(code));
+  memcpy(&ram[0xAA], stale, sizeof(stale));
+  memcpy(&ram[0xC0], wait, sizeof(wait));
+  memcpy(&ram[0xD0], done, sizeof(done));
+  ram[0xB0] = 0;
+  ram[256 + 0xFF4] = 0x00;  // output compare vector, FFF4
+  ram[256 + 0xFF5] = 0xAA;
+  predecode_rom_build();
+  dispatch_rom_build();
+  // the output compare a while after the wai
+  u_int ocr = ((iram[FRC] << 8 | iram[FRC + 1]) + 40) & 0xFFFF;
+  iram[OCR] = ocr >> 8;
+  iram[OCR + 1] = ocr & 0xFF;
+  iram[TCSR] = EOCI;
+  timer_reload();
+  if (compare_engines(2000, "wai over pre-decoded code") && ram[0xB0] != 1) {
+    printf("FAIL wai over pre-decoded code: the handler did not run\n");
+    failures++;
+  }
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+static int run_threaded(int64_t cycles, int events, int64_t* ran) {
+  int64_t start = cpu.ncycles;
+  hd6301_run_clocks(0);  // start-up and wake-up handling only
+  cpu.events = 0;
+  cpu.event_stop = events;
+  dispatch_run(cycles);
+  cpu.event_stop = 0;
+  *ran = cpu.ncycles - start;
+  return (cpu.events & events) | (crashed ? HD6301_EVENT_CRASH : 0);
+}
+
+// hd6301_run_until() stops after the instruction raising an event, on both
+// engines: a received byte read, one byte sent, then SLP
+static void test_run_until(void) {
+  static const uint8_t code[] = {
+      0x96, 0x11,  // ldaa TRCSR
+      0x96, 0x12,  // ldaa RDR
+      0x97, 0x13,  // staa TDR
+      0x1A,        // slp
+      0x20, 0xFE,  // bra *
+  };
+  static const int expected[] = {HD6301_EVENT_RX, HD6301_EVENT_TX,
+                                 HD6301_EVENT_SLEEP, 0};
+  static const hostio_runner_t runners[] = {hostio_run_reference,
+                                            run_threaded};
+  const int events = HD6301_EVENT_TX | HD6301_EVENT_RX | HD6301_EVENT_SLEEP;
+  static struct snapshot base, start, results[2];
+  int64_t ran[2][4];
+  snapshot_take(&base);
+  srand(5);
+
+  random_state(0);
+  memcpy(&ram[0x80], code, sizeof(code));
+  iram[TRCSR] = TDRE;
+  uint8_t byte = 0x5A;
+  sci_in(&byte, 1);
+  snapshot_take(&start);
+
+  for (int r = 0; r < 2; r++) {
+    snapshot_restore(&start);
+    for (int step = 0; step < 4; step++) {
+      int status = runners[r](100, events, &ran[r][step]);
+      if (status != expected[step]) {
+        printf("FAIL run_until (%s): step %d returned %02X, not %02X\n",
+               r ? "threaded" : "reference", step, status, expected[step]);
+        failures++;
+        break;
+      }
+    }
+    snapshot_take(&results[r]);
+  }
+  if (memcmp(ran[0], ran[1], sizeof(ran[0]))) {
+    printf("FAIL run_until: cycle counts differ\n");
+    failures++;
+  }
+  const char* diff = snapshot_diff(&results[0], &results[1]);
+  if (diff) {
+    printf("FAIL run_until: %s differs\n", diff);
+    failures++;
+  }
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+// OCR near 0xFFFF and FRC running up to it through instructions of 1 and
+// 7 cycles. OCF has to follow the original per-instruction test of
+// timer_inc(): an instruction taking FRC past OCR and through 0 at once
+// sets none. Checked after every instruction on the reference engine,
+// then the threaded one has to end up the same.
+static void test_ocr_wrap(void) {
+  static const uint8_t code[] = {
+      0x3D,        // 0080 mul
+      0x01,        // 0081 nop
+      0x3D,        // 0082 mul
+      0x01,        // 0083 nop
+      0x01,        // 0084 nop
+      0x20, 0xF9,  // 0085 bra 0080
+  };
+  static struct snapshot base, start;
+  int missed = 0;
+  snapshot_take(&base);
+  srand(7);
+
+  for (int trial = 0; trial < 200; trial++) {
+    char what[64];
+    u_int ocr = 0xFFF0 + rand() % 16;
+    u_int frc = (ocr - rand() % 40) & 0xFFFF;
+    snprintf(what, sizeof(what), "OCR %04X, FRC from %04X", ocr, frc);
+    snapshot_restore(&base);
+    random_state(trial);
+    memcpy(&ram[0x80], code, sizeof(code));
+    iram[TCSR] &= ~(OCF | TOF);
+    iram[OCR] = ocr >> 8;
+    iram[OCR + 1] = ocr & 0xFF;
+    iram[FRC] = frc >> 8;
+    iram[FRC + 1] = frc & 0xFF;
+    timer_reload();
+    snapshot_take(&start);
+
+    COUNTER_VAR end = cpu.ncycles + 100;
+    while (cpu.ncycles < end) {
+      timer_sync();
+      u_int frc_old = ireg_getw(FRC);
+      int ocf = (iram[TCSR] & OCF) != 0;
+      instr_exec();
+      timer_sync();
+      u_int frc_new = ireg_getw(FRC);
+      int hit = frc_new >= ocr && (frc_old < ocr || frc_old > frc_new);
+      if (!ocf && !hit && frc_old < ocr && frc_old > frc_new) missed++;
+      if (((iram[TCSR] & OCF) != 0) != (ocf || hit)) {
+        printf("FAIL %s: OCF %s with FRC %04X to %04X\n", what,
+               hit ? "not set" : "set", frc_old, frc_new);
+        failures++;
+        break;
+      }
+    }
+
+    snapshot_restore(&start);
+    if (!compare_engines(100, what)) break;
+  }
+  CHECK(missed > 0, "OCR wrap: no instruction took FRC past OCR through 0");
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+// A loop in ROM, hot enough for the block cache, setting OCR a few cycles
+// ahead of FRC and counting the times it then sees OCF
+static void test_block_cache(void) {
+  static const uint8_t code[] = {
+      0xC3, 0x00, 0x00,  // FE00 addd #k
+      0xDD, 0x0B,        // FE03 std OCR
+      0x01, 0x01, 0x01,  // FE05 nop nop nop nop
+      0x01,              //
+      0x7B, 0x40, 0x08,  // FE09 tim #OCF,TCSR
+      0x27, 0x03,        // FE0C beq FE11
+      0x7C, 0x00, 0x80,  // FE0E inc 0080
+      0xDC, 0x09,        // FE11 ldd FRC
+      0x20, 0xEB,        // FE13 bra FE00
+  };
+  static struct snapshot base;
+  snapshot_take(&base);
+  srand(6);
+
+  for (int trial = 0; trial < 40; trial++) {
+    char what[64];
+    int k = 1 + trial % 20;
+    snprintf(what, sizeof(what), "block cache, OCR at FRC+%d", k);
+    snapshot_restore(&base);
+    random_state(trial);
+    memcpy(&ram[256 + 0xE00], code, sizeof(code));
+    ram[256 + 0xE02] = (u_char)k;
+    predecode_rom_build();
+    dispatch_rom_build();
+    regs.pc = 0xFE00;
+    ram[0x80] = 0;
+#if HD6301_BLOCK_CACHE
+    COUNTER_VAR runs = hd6301_stats.block_runs;
+#endif
+    if (!compare_engines(5000 + rand() % 5000, what)) break;
+#if HD6301_BLOCK_CACHE
+    if (hd6301_stats.block_runs == runs) {
+      printf("FAIL %s: no block cache runs\n", what);
+      failures++;
+      break;
+    }
+#endif
+  }
+  snapshot_restore(&base);
+  crashed = 0;
+}
+
+// Command, input step it is sent at
+static const struct {
+  int step;
+  uint8_t bytes[6];
+  int len;
+} script_commands[] = {
+    {0, {0x80, 0x01}, 2},                   // reset
+    {10, {0x08}, 1},                        // relative mouse
+    {40, {0x09, 0x01, 0x40, 0x00, 0xC8}, 5},// absolute mouse 320x200
+    {60, {0x0D}, 1},                        // interrogate mouse position
+    {80, {0x87}, 1},                        // mouse button action status
+    {100, {0x14}, 1},                       // joystick event reporting
+    {130, {0x16}, 1},                       // interrogate joystick
+    {150, {0x1C}, 1},                       // interrogate time of day
+    {170, {0x0A, 0x05, 0x05}, 3},           // mouse keycode mode
+    {200, {0x08}, 1},                       // back to relative mouse
+    {220, {0x13}, 1},                       // pause output
+    {230, {0x11}, 1},                       // resume
+};
+
+static void script_input_step(int step) {
+  static const uint8_t keys[] = {0x1E, 0x30, 0x2E, 0x20, 0x39, 0x48};
+  int nkeys = (int)sizeof(keys);
+  hostio_set_key(keys[step % nkeys], (step / nkeys) % 2 == 0);
+  static const int periods[][2] = {
+      {700, 0}, {0, -900}, {-1500, 1500}, {0, 0}, {333, 333}};
+  hostio_set_mouse_period(periods[step % 5][0], periods[step % 5][1]);
+  hostio_set_mouse_buttons((step % 12) < 3 ? 2 : (step % 12) < 5 ? 1 : 0);
+  hostio_set_joystick((step % 14) < 7 ? 0x11 : 0x00);
+  for (size_t i = 0; i < sizeof(script_commands) / sizeof(script_commands[0]);
+       i++) {
+    if (script_commands[i].step == step) {
+      hostio_rx_put_buf(script_commands[i].bytes, script_commands[i].len);
+    }
+  }
+}
+
+static int run_script(hostio_runner_t runner, struct tx_log* log,
+                      struct snapshot* end) {
+  if (!hostio_boot()) {
+    printf("FAIL could not initialise the HD6301\n");
+    return 0;
+  }
+  hostio_set_runner(runner);
+  log->count = 0;
+  for (int step = 0; step < SCRIPT_STEPS && !crashed; step++) {
+    script_input_step(step);
+    hostio_run((int64_t)SCRIPT_STEP_MS * HOSTIO_CYCLES_PER_MS);
+    tx_collect(log);
+  }
+  snapshot_take(end);
+  int ok = !crashed;
+  hostio_set_runner(NULL);
+  hostio_shutdown();
+  return ok;
+}
+
+
+static void test_rom_script(void) {
+  static struct tx_log ref_log, thr_log;
+  static struct snapshot ref_end, thr_end;
+
+  if (!run_script(hostio_run_reference, &ref_log, &ref_end) ||
+      !run_script(run_threaded, &thr_log, &thr_end)) {
+    printf("FAIL ROM script crashed the CPU\n");
+    failures++;
+    return;
+  }
+  if (ref_log.count < 100) {
+    printf("FAIL ROM script only produced %d bytes\n", ref_log.count);
+    failures++;
+  }
+  if (ref_log.count != thr_log.count) {
+    printf("FAIL ROM script sent %d bytes on the reference engine, %d on the "
+           "threaded one\n",
+           ref_log.count, thr_log.count);
+    failures++;
+  }
+  int n = ref_log.count < thr_log.count ? ref_log.count : thr_log.count;
+  for (int i = 0; i < n; i++) {
+    if (ref_log.data[i] != thr_log.data[i] ||
+        ref_log.cycle[i] != thr_log.cycle[i]) {
+      printf("FAIL ROM script byte %d: %02X at %lld vs %02X at %lld\n", i,
+             ref_log.data[i], (long long)ref_log.cycle[i], thr_log.data[i],
+             (long long)thr_log.cycle[i]);
+      failures++;
+      break;
+    }
+  }
+  const char* diff = snapshot_diff(&ref_end, &thr_end);
+  if (diff) {
+    printf("FAIL ROM script final state: %s differs\n", diff);
+    failures++;
+  }
+  printf("ROM script: %d bytes sent\n", ref_log.count);
+}
+
+int main(void) {
+  if (!hostio_boot()) {
+    printf("Failed to initialise HD6301\n");
+    return 1;
+  }
+  test_opcodes();
+  test_flag_pairs();
+  test_idle_loops();
+  test_sleep();
+  test_wai_stack();
+  test_run_until();
+  test_ocr_wrap();
+  test_block_cache();
+  hostio_shutdown();
+
+  test_rom_script();
+
+  return test_result();
+}
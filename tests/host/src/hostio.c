@@ -0,0 +1,305 @@
+#include "hostio.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "HD6301V1ST.h"
+#include "cpu.h"
+#include "instr.h"
+#include "sci.h"
+
+#define IKBD_ROMBASE 256
+#define MOUSE_PHASE_MASK 0x33333333u
+
+// --- Input state ---
+static uint8_t joystick_axis = 0;
+static int mouse_buttons = 0;
+
+static uint32_t x_reg = MOUSE_PHASE_MASK;
+static uint32_t y_reg = MOUSE_PHASE_MASK;
+static int x_period = 0;
+static int y_period = 0;
+static int64_t last_x_cycle = 0;
+static int64_t last_y_cycle = 0;
+static hostio_poll_hook_t poll_hook = NULL;
+
+// --- Serial queues ---
+static uint8_t rx_buffer[HOSTIO_RX_CAPACITY];
+static int rx_head = 0;
+static int rx_tail = 0;
+
+static struct {
+  uint8_t data;
+  int64_t cycle;
+} tx_buffer[HOSTIO_TX_CAPACITY];
+static int tx_head = 0;
+static int tx_tail = 0;
+
+// Bytes the SCI took into RDR
+static struct {
+  uint8_t data;
+  int64_t cycle;
+} taken_buffer[HOSTIO_RX_CAPACITY];
+static int taken_head = 0;
+static int taken_tail = 0;
+
+static hostio_runner_t runner = hd6301_run_until;
+
+static inline uint32_t rotl32(uint32_t v, unsigned s) {
+  s &= 31;
+  return s ? (v << s) | (v >> (32 - s)) : v;
+}
+
+static inline uint32_t rotr32(uint32_t v, unsigned s) {
+  s &= 31;
+  return s ? (v >> s) | (v << (32 - s)) : v;
+}
+
+// --- Stand-ins called by the HD6301 core ---
+
+void serialp_send(const unsigned char data) {
+  int next = (tx_head + 1) % HOSTIO_TX_CAPACITY;
+  if (next == tx_tail) {
+    tx_tail = (tx_tail + 1) % HOSTIO_TX_CAPACITY;  // drop the oldest
+  }
+  tx_buffer[tx_head].data = data;
+  tx_buffer[tx_head].cycle = sci_tx_begin;  // start bit
+  tx_head = next;
+}
+
+void serialp_received(const unsigned char data) {
+  int next = (taken_head + 1) % HOSTIO_RX_CAPACITY;
+  if (next == taken_tail) {
+    taken_tail = (taken_tail + 1) % HOSTIO_RX_CAPACITY;  // drop the oldest
+  }
+  taken_buffer[taken_head].data = data;
+  taken_buffer[taken_head].cycle = sci_rx_last;
+  taken_head = next;
+}
+
+int st_mouse_buttons() { return mouse_buttons; }
+
+unsigned char st_joystick() { return joystick_axis; }
+
+int st_mouse_enabled() { return 1; }
+
+static void advance_axis(int64_t now, int period, int64_t* last,
+                         uint32_t* reg) {
+  if (period == 0) {
+    *last = now;
+    return;
+  }
+  int step = period > 0 ? period : -period;
+  while (now - *last >= step) {
+    *last += step;
+    *reg = (period > 0) ? rotr32(*reg, 1) : rotl32(*reg, 1);
+  }
+}
+
+void mouse_tick(int64_t cpu_cycles, int* x_counter, int* y_counter) {
+  if (poll_hook) poll_hook(cpu_cycles);
+  advance_axis(cpu_cycles, x_period, &last_x_cycle, &x_reg);
+  advance_axis(cpu_cycles, y_period, &last_y_cycle, &y_reg);
+  *x_counter = (int)x_reg;
+  *y_counter = (int)y_reg;
+}
+
+// --- Driver ---
+
+bool hostio_boot(void) {
+  joystick_axis = 0;
+  mouse_buttons = 0;
+  x_reg = y_reg = MOUSE_PHASE_MASK;
+  x_period = y_period = 0;
+  last_x_cycle = last_y_cycle = 0;
+  rx_head = rx_tail = 0;
+  tx_head = tx_tail = 0;
+  taken_head = taken_tail = 0;
+
+  // Same sequence as core1_entry()
+  BYTE* pram = hd6301_init();
+  if (!pram) {
+    return false;
+  }
+  memcpy(pram + IKBD_ROMBASE, rom_HD6301V1ST_img, rom_HD6301V1ST_img_len);
+  srand(0);  // mouse phase randomisation in hd6301_reset()
+  hd6301_reset(1);
+  return true;
+}
+
+void hostio_shutdown(void) { hd6301_destroy(); }
+
+void hostio_run(int64_t cycles) {
+  int64_t target = cpu.ncycles + cycles;
+  while (!crashed && cpu.ncycles < target) {
+    // As handle_rx_from_st() does, the SCI paces them
+    while (rx_head != rx_tail && hd6301_receive_byte(rx_buffer[rx_tail])) {
+      rx_tail = (rx_tail + 1) % HOSTIO_RX_CAPACITY;
+    }
+    int64_t ran;
+    runner(HOSTIO_CYCLES_PER_SLICE, 0, &ran);
+  }
+}
+
+void hostio_set_runner(hostio_runner_t run) {
+  runner = run ? run : hd6301_run_until;
+}
+
+int hostio_run_reference(int64_t cycles, int events, int64_t* ran) {
+  int64_t start = cpu.ncycles;
+  hd6301_run_clocks(0);  // start-up and wake-up handling only
+  cpu.events = 0;
+  cpu.event_stop = events;
+  while (!crashed && cpu.ncycles - start < cycles &&
+         !(cpu.events & events)) {
+    instr_exec();
+  }
+  cpu.event_stop = 0;
+  *ran = cpu.ncycles - start;
+  return (cpu.events & events) | (crashed ? HD6301_EVENT_CRASH : 0);
+}
+
+#if HD6301_ENGINE == HD6301_ENGINE_AOT
+#define BUILT_ENGINE "aot"
+#elif HD6301_BLOCK_CACHE
+#define BUILT_ENGINE "bcache"
+#else
+#define BUILT_ENGINE "threaded"
+#endif
+
+const hostio_engine_t hostio_engines[HOSTIO_ENGINES] = {
+    {"reference", hostio_run_reference},
+    {BUILT_ENGINE, hd6301_run_until},
+};
+
+void hostio_state_save(hostio_state_t* s) {
+  s->joystick_axis = joystick_axis;
+  s->mouse_buttons = mouse_buttons;
+  s->x_reg = x_reg;
+  s->y_reg = y_reg;
+  s->x_period = x_period;
+  s->y_period = y_period;
+  s->last_x_cycle = last_x_cycle;
+  s->last_y_cycle = last_y_cycle;
+  s->rx_head = rx_head;
+  s->rx_tail = rx_tail;
+  s->tx_head = tx_head;
+  s->tx_tail = tx_tail;
+  s->taken_head = taken_head;
+  s->taken_tail = taken_tail;
+}
+
+// The queues keep their contents, bytes sent since are written again
+void hostio_state_load(const hostio_state_t* s) {
+  joystick_axis = s->joystick_axis;
+  mouse_buttons = s->mouse_buttons;
+  x_reg = s->x_reg;
+  y_reg = s->y_reg;
+  x_period = s->x_period;
+  y_period = s->y_period;
+  last_x_cycle = s->last_x_cycle;
+  last_y_cycle = s->last_y_cycle;
+  rx_head = s->rx_head;
+  rx_tail = s->rx_tail;
+  tx_head = s->tx_head;
+  tx_tail = s->tx_tail;
+  taken_head = s->taken_head;
+  taken_tail = s->taken_tail;
+}
+
+int hostio_tx_since(const hostio_state_t* s, uint8_t* data, int64_t* cycle,
+                    int max) {
+  int n = 0;
+  for (int i = s->tx_head; i != tx_head && n < max;
+       i = (i + 1) % HOSTIO_TX_CAPACITY, n++) {
+    data[n] = tx_buffer[i].data;
+    cycle[n] = tx_buffer[i].cycle;
+  }
+  return n;
+}
+
+bool hostio_rx_put(uint8_t data) {
+  int next = (rx_head + 1) % HOSTIO_RX_CAPACITY;
+  if (next == rx_tail) {
+    return false;
+  }
+  rx_buffer[rx_head] = data;
+  rx_head = next;
+  return true;
+}
+
+void hostio_rx_put_buf(const uint8_t* data, int len) {
+  for (int i = 0; i < len; i++) {
+    hostio_rx_put(data[i]);
+  }
+}
+
+bool hostio_rx_get(uint8_t* data) {
+  if (rx_head == rx_tail) {
+    return false;
+  }
+  *data = rx_buffer[rx_tail];
+  rx_tail = (rx_tail + 1) % HOSTIO_RX_CAPACITY;
+  return true;
+}
+
+int hostio_rx_pending(void) {
+  return (rx_head - rx_tail + HOSTIO_RX_CAPACITY) % HOSTIO_RX_CAPACITY;
+}
+
+bool hostio_rx_put_at(uint8_t data, int64_t cycle) {
+  if (!hd6301_receive_byte(data)) {
+    return false;
+  }
+  sci_rx_next = cycle;
+  return true;
+}
+
+bool hostio_rx_taken(uint8_t* data, int64_t* cycle) {
+  if (taken_head == taken_tail) {
+    return false;
+  }
+  if (data) *data = taken_buffer[taken_tail].data;
+  if (cycle) *cycle = taken_buffer[taken_tail].cycle;
+  taken_tail = (taken_tail + 1) % HOSTIO_RX_CAPACITY;
+  return true;
+}
+
+int hostio_tx_count(void) {
+  return (tx_head - tx_tail + HOSTIO_TX_CAPACITY) % HOSTIO_TX_CAPACITY;
+}
+
+bool hostio_tx_get(uint8_t* data, int64_t* cycle) {
+  if (tx_head == tx_tail) {
+    return false;
+  }
+  if (data) *data = tx_buffer[tx_tail].data;
+  if (cycle) *cycle = tx_buffer[tx_tail].cycle;
+  tx_tail = (tx_tail + 1) % HOSTIO_TX_CAPACITY;
+  return true;
+}
+
+void hostio_tx_clear(void) { tx_tail = tx_head; }
+
+void hostio_set_poll_hook(hostio_poll_hook_t hook) { poll_hook = hook; }
+
+void hostio_set_key(uint8_t scancode, bool down) {
+  hd6301_set_key(scancode, down);
+}
+
+void hostio_set_joystick(uint8_t axis_state) { joystick_axis = axis_state; }
+
+void hostio_set_mouse_buttons(int buttons) { mouse_buttons = buttons; }
+
+void hostio_set_mouse_period(int x_cycles, int y_cycles) {
+  advance_axis(cpu.ncycles, x_period, &last_x_cycle, &x_reg);
+  advance_axis(cpu.ncycles, y_period, &last_y_cycle, &y_reg);
+  x_period = x_cycles;
+  y_period = y_cycles;
+}
+
+void hostio_set_mouse_phase(uint32_t x, uint32_t y) {
+  x_reg = x;
+  y_reg = y;
+}
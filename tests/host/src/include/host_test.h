@@ -0,0 +1,57 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hostio.h"
+
+/*
+ * What the host tests have in common, each test being one executable: the
+ * failure count, CHECK() and the last line, and for those that run the
+ * ROM, the bytes it sent. The engines to run each case on are
+ * hostio_engines[].
+ */
+
+#define HOST_TEST_MAX_TX 8192
+
+static int failures = 0;
+
+// Counts a failure and prints it, the message given as to printf()
+#define CHECK(cond, ...)   \
+  do {                     \
+    if (!(cond)) {         \
+      printf("FAIL ");     \
+      printf(__VA_ARGS__); \
+      printf("\n");        \
+      failures++;          \
+    }                      \
+  } while (0)
+
+// Prints the outcome, returns the exit status
+static inline int test_result(void) {
+  printf("%s\n", failures ? "FAILED" : "OK");
+  return failures ? 1 : 0;
+}
+
+// Bytes sent by the ROM, with the cycle of their start bits
+struct tx_log {
+  int count;
+  uint8_t data[HOST_TEST_MAX_TX];
+  int64_t cycle[HOST_TEST_MAX_TX];
+};
+
+// Adds what the ROM sent since the last call to 'log', as much as fits
+static inline void tx_collect(struct tx_log* log) {
+  uint8_t data;
+  int64_t cycle;
+  while (hostio_tx_get(&data, &cycle)) {
+    if (log->count < HOST_TEST_MAX_TX) {
+      log->data[log->count] = data;
+      log->cycle[log->count] = cycle;
+      log->count++;
+    }
+  }
+}
+
+#endif  // HOST_TEST_H
@@ -0,0 +1,151 @@
+#ifndef HOSTIO_H
+#define HOSTIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Host stand-ins for the firmware modules the HD6301 core talks to
+ * (serialp_send, serialp_received, st_joystick, st_mouse_buttons and
+ * mouse_tick),
+ * plus a small driver that runs the core the same way core1_entry() does.
+ */
+
+// HD6301 clock in the ST: 4 MHz crystal / 4
+#define HOSTIO_CYCLES_PER_SECOND 1000000
+#define HOSTIO_CYCLES_PER_MS (HOSTIO_CYCLES_PER_SECOND / 1000)
+
+// Slice length of hostio_run(), core1_entry() in src/main.c runs slices of
+// this length when nothing happens and shorter ones when something does
+#define HOSTIO_CYCLES_PER_SLICE 1000
+
+#define HOSTIO_TX_CAPACITY 4096
+#define HOSTIO_RX_CAPACITY 256
+
+/**
+ * Allocate the 6301, load rom_HD6301V1ST_img and perform a cold reset.
+ * Returns false if the core could not be allocated.
+ */
+bool hostio_boot(void);
+
+/**
+ * Release the core allocated by hostio_boot().
+ */
+void hostio_shutdown(void);
+
+/**
+ * Run the core for at least the given number of cycles, in slices of
+ * HOSTIO_CYCLES_PER_SLICE. Pending RX bytes are queued for the SCI
+ * before each slice, which takes them in one byte time apart. Bytes sent
+ * take the time the SCI needs to shift them out, as on the real chip.
+ */
+void hostio_run(int64_t cycles);
+
+/**
+ * Function hostio_run() uses to run the core, with the arguments and
+ * result of hd6301_run_until(). Defaults to hd6301_run_until(), i.e. the
+ * engine the core was built with. NULL restores the default.
+ */
+typedef int (*hostio_runner_t)(int64_t cycles, int events, int64_t* ran);
+void hostio_set_runner(hostio_runner_t runner);
+
+/**
+ * Runner executing one instr_exec() call per instruction, whatever engine
+ * hd6301_run_until() uses. Reference for the faster engines.
+ */
+int hostio_run_reference(int64_t cycles, int events, int64_t* ran);
+
+/**
+ * The engines the tests run each case on: the reference first, then the
+ * one the core was built with (hd6301_run_until()).
+ */
+typedef struct {
+  const char* name;
+  hostio_runner_t run;
+} hostio_engine_t;
+#define HOSTIO_ENGINES 2
+extern const hostio_engine_t hostio_engines[HOSTIO_ENGINES];
+
+/**
+ * Runner checking an engine against instr_exec() in lockstep (shadow.c).
+ * Each stretch of up to 'every' instructions is run by the reference, then
+ * again from the same state by 'engine' (hd6301_run_until() if NULL), and
+ * the CPU, iram, RAM, timer, SCI and key matrix state and the bytes sent
+ * are compared. At the first difference the stretch is stepped one
+ * instruction at a time to find where it starts, the two states and the
+ * last instructions are printed, and the core stops as crashed.
+ */
+void hostio_shadow_config(hostio_runner_t engine, int every);
+int hostio_run_shadow(int64_t cycles, int events, int64_t* ran);
+// Whether hostio_run_shadow() stopped the core, and instructions checked
+bool hostio_shadow_diverged(void);
+int64_t hostio_shadow_checked(void);
+
+/**
+ * State of the stand-ins (inputs, mouse registers, serial queues), to run
+ * the same stretch twice along with the core's (src/6301/snapshot.h).
+ */
+typedef struct {
+  uint8_t joystick_axis;
+  int mouse_buttons;
+  uint32_t x_reg, y_reg;
+  int x_period, y_period;
+  int64_t last_x_cycle, last_y_cycle;
+  int rx_head, rx_tail;
+  int tx_head, tx_tail;
+  int taken_head, taken_tail;
+} hostio_state_t;
+void hostio_state_save(hostio_state_t* s);
+void hostio_state_load(const hostio_state_t* s);
+// Bytes sent since 's' was saved, oldest first, up to 'max'
+int hostio_tx_since(const hostio_state_t* s, uint8_t* data, int64_t* cycle,
+                    int max);
+
+// Bytes from the ST to the 6301
+bool hostio_rx_put(uint8_t data);
+void hostio_rx_put_buf(const uint8_t* data, int len);
+// Next byte for drivers feeding the SCI themselves instead of hostio_run()
+bool hostio_rx_get(uint8_t* data);
+int hostio_rx_pending(void);
+
+/**
+ * Queue a byte for the SCI to take into RDR at 'cycle', as a trace
+ * recorded it, instead of a byte time after the previous one. The previous
+ * one has to be in RDR already.
+ */
+bool hostio_rx_put_at(uint8_t data, int64_t cycle);
+
+// Bytes the SCI took into RDR, with the cycle they went in at
+bool hostio_rx_taken(uint8_t* data, int64_t* cycle);
+
+// Bytes from the 6301 to the ST, with the cycle count at which they were sent
+int hostio_tx_count(void);
+bool hostio_tx_get(uint8_t* data, int64_t* cycle);
+void hostio_tx_clear(void);
+
+// Input state seen by the ROM, keys through hd6301_set_key()
+void hostio_set_key(uint8_t scancode, bool down);
+void hostio_set_joystick(uint8_t axis_state);
+void hostio_set_mouse_buttons(int buttons);
+
+/**
+ * Set the quadrature edge period of each mouse axis in CPU cycles. The sign
+ * gives the direction, 0 stops the axis. As mouse_set_periods() in the
+ * firmware, the steps due at the old period are taken first.
+ */
+void hostio_set_mouse_period(int x_cycles, int y_cycles);
+
+/**
+ * Set the quadrature registers, as mouse_init() randomises them.
+ */
+void hostio_set_mouse_phase(uint32_t x_reg, uint32_t y_reg);
+
+/**
+ * Function called with the cycle count each time the ROM reads the mouse
+ * port, which it does all the time: for core 0 to act while core 1 is in
+ * the middle of a run. NULL for none.
+ */
+typedef void (*hostio_poll_hook_t)(int64_t cycle);
+void hostio_set_poll_hook(hostio_poll_hook_t hook);
+
+#endif  // HOSTIO_H
@@ -0,0 +1,22 @@
+#ifndef IKBD_HW_H
+#define IKBD_HW_H
+
+#include <stdint.h>
+
+#include "mc6850.h"
+
+/*
+ * Host version of tests/atarist/src/include/ikbd_hw.h, for the ST tests
+ * built against the emulator: the keyboard ACIA and the 200 Hz timer are
+ * the models of st_host.c. Each access takes the ST some time, during which
+ * the emulated IKBD runs.
+ */
+
+uint8_t acia_status(void);
+uint8_t acia_read_data(void);
+void acia_write_control(uint8_t value);
+void acia_write_data(uint8_t value);
+
+uint32_t read_hz200(void);
+
+#endif  // IKBD_HW_H
@@ -0,0 +1,40 @@
+#ifndef ST_HOST_H
+#define ST_HOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The ST side of the serial link on the host, for the tests of
+ * tests/atarist: an MC6850 ACIA and the 200 Hz timer (ikbd_hw.h), on a
+ * virtual clock. The IKBD is the emulator run by the core 1 loop of
+ * src/main.c with its real-time pacing (pacing.c), each byte taking its
+ * time on the line both ways. Nothing waits for real time.
+ */
+
+typedef struct {
+  int ns_per_cycle;  // real time core 1 takes per emulated cycle
+  int wake_ns;       // and per wake-up
+  int hz200_ppm;     // 200 Hz timer against the IKBD clock, parts per million
+} st_host_config_t;
+
+/**
+ * Boot the emulator as core1_entry() does, time of day seeded, and start
+ * the virtual clock at 0 with the ACIA set up as TOS leaves it.
+ */
+bool st_host_boot(const st_host_config_t* config);
+
+void st_host_shutdown(void);
+
+/**
+ * Let 'us' of ST time pass, e.g. for TOS to boot.
+ */
+void st_host_wait(uint64_t us);
+
+/**
+ * Print the virtual time elapsed, the traffic both ways and the pacing
+ * counters.
+ */
+void st_host_report(void);
+
+#endif  // ST_HOST_H
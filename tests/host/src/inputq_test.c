@@ -0,0 +1,128 @@
+/*
+ * Input event queue test
+ *
+ * Drives src/inputq.c the way the firmware does, with a producer thread
+ * standing in for core 0 and a consumer thread for core 1. The producer
+ * pushes numbered events with increasing timestamps, retrying while the
+ * queue is full; the consumer checks that every one arrives once, in
+ * order and intact. Also checks the edge cases on one thread: empty, full,
+ * wrapping round.
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_test.h"
+#include "inputq.h"
+
+#define STRESS_EVENTS 2000000
+
+static inputq_t queue;
+
+// Every field derived from the sequence number, to catch torn slots
+static void make_event(uint32_t seq, inputq_event_t* ev) {
+  ev->time_us = 1000000ull + seq * 3ull;
+  ev->type = (uint8_t)(seq % 4);
+  ev->code = (uint8_t)(seq * 7);
+  ev->value = (uint8_t)(seq >> 8);
+  ev->x = (int32_t)seq;
+  ev->y = -(int32_t)seq;
+}
+
+static bool check_event(uint32_t seq, const inputq_event_t* ev) {
+  inputq_event_t want;
+  make_event(seq, &want);
+  return ev->time_us == want.time_us && ev->type == want.type &&
+         ev->code == want.code && ev->value == want.value && ev->x == want.x &&
+         ev->y == want.y;
+}
+
+static void test_single_thread(void) {
+  inputq_event_t ev;
+  inputq_init(&queue);
+  CHECK(!inputq_peek(&queue, &ev), "empty: peek returned an event");
+  CHECK(inputq_count(&queue) == 0, "empty: count %u", inputq_count(&queue));
+
+  // Several times round the ring, filling it up each time
+  uint32_t pushed = 0, popped = 0;
+  for (int round = 0; round < 5; round++) {
+    while (true) {
+      make_event(pushed, &ev);
+      if (!inputq_push(&queue, &ev)) break;
+      pushed++;
+    }
+    CHECK(inputq_count(&queue) == INPUTQ_SIZE, "full: count %u",
+          inputq_count(&queue));
+    // Take some out, not all
+    for (int i = 0; i < INPUTQ_SIZE / 2 + round; i++) {
+      CHECK(inputq_peek(&queue, &ev) && check_event(popped, &ev),
+            "round %d: event %u wrong", round, popped);
+      inputq_pop(&queue);
+      popped++;
+    }
+  }
+  CHECK(queue.full == 5, "full: %u pushes refused", queue.full);
+  while (inputq_peek(&queue, &ev)) {
+    CHECK(check_event(popped, &ev), "drain: event %u wrong", popped);
+    inputq_pop(&queue);
+    popped++;
+  }
+  CHECK(popped == pushed, "drain: %u of %u events", popped, pushed);
+}
+
+static void* producer(void* arg) {
+  (void)arg;
+  inputq_event_t ev;
+  for (uint32_t seq = 0; seq < STRESS_EVENTS; seq++) {
+    make_event(seq, &ev);
+    // Core 0 keeps the change and publishes it later
+    while (!inputq_push(&queue, &ev)) sched_yield();
+  }
+  return NULL;
+}
+
+static void* consumer(void* arg) {
+  uint32_t* bad = arg;
+  inputq_event_t ev;
+  uint32_t seq = 0;
+  uint64_t last_time = 0;
+  while (seq < STRESS_EVENTS) {
+    if (!inputq_peek(&queue, &ev)) {
+      sched_yield();
+      continue;
+    }
+    if (!check_event(seq, &ev) || ev.time_us < last_time) {
+      if (!*bad) printf("FAIL stress: event %u wrong\n", seq);
+      (*bad)++;
+    }
+    last_time = ev.time_us;
+    inputq_pop(&queue);
+    seq++;
+  }
+  return NULL;
+}
+
+static void test_stress(void) {
+  pthread_t prod, cons;
+  uint32_t bad = 0;
+  inputq_init(&queue);
+  if (pthread_create(&cons, NULL, consumer, &bad) ||
+      pthread_create(&prod, NULL, producer, NULL)) {
+    CHECK(0, "stress: could not start threads");
+    return;
+  }
+  pthread_join(prod, NULL);
+  pthread_join(cons, NULL);
+  CHECK(bad == 0, "stress: %u events wrong", bad);
+  CHECK(inputq_count(&queue) == 0, "stress: %u events left",
+        inputq_count(&queue));
+  printf("stress: %d events, queue full %u times\n", STRESS_EVENTS,
+         queue.full);
+}
+
+int main(void) {
+  test_single_thread();
+  test_stress();
+  return test_result();
+}
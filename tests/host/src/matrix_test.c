@@ -0,0 +1,163 @@
+/*
+ * HD6301 keyboard matrix test
+ *
+ * The IKBD ROM selects one column every 2 ms, so it looks at a key once
+ * in about 30 ms. A press shorter than that, as a USB or Bluetooth
+ * keyboard reports for a quick tap, used to be missed whenever it fell
+ * between two reads of its column. The matrix holds every change until
+ * the column has been read. Checks, on both engines:
+ *
+ *  - taps of 1 to 5 ms, at phases all along the scan, each give a make
+ *    and a break code, in order
+ *  - a key held down for longer gives one make and one break, as before
+ *
+ * DR1 is made from key bitmaps by column. For random sets of keys and
+ * random port settings, it has to be the same, bit for bit, as building
+ * it a row and a column at a time from the ROM tables, as it used to be.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "chip.h"
+#include "host_test.h"
+#include "hostio.h"
+#include "ireg.h"
+
+#define TAPS 20
+#define KEY 0x1E  // A
+#define MATRICES 20000
+
+BYTE get_scancode(int dr1bit, int column);
+
+// Bytes sent since the last call
+static const uint8_t* get_tx(int* count) {
+  static struct tx_log log;
+  log.count = 0;
+  tx_collect(&log);
+  *count = log.count;
+  return log.data;
+}
+
+static bool boot(int e) {
+  if (!hostio_boot()) {
+    CHECK(0, "could not initialise the HD6301");
+    return false;
+  }
+  hostio_set_runner(hostio_engines[e].run);
+  hostio_run(500 * HOSTIO_CYCLES_PER_MS);  // power-up byte
+  hostio_tx_clear();
+  return true;
+}
+
+static void shutdown(void) {
+  hostio_set_runner(NULL);
+  hostio_shutdown();
+}
+
+static void test_taps(int e) {
+  if (!boot(e)) return;
+  for (int i = 0; i < TAPS; i++) {
+    int down_us = 1000 + (i % 5) * 1000;
+    // Not a multiple of the scan, so the taps land all along it
+    int up_us = 97000 + i * 1300;
+    hostio_set_key(KEY, true);
+    hostio_run(down_us);
+    hostio_set_key(KEY, false);
+    hostio_run(up_us);
+  }
+  int count;
+  const uint8_t* data = get_tx(&count);
+  CHECK(count == 2 * TAPS, "taps (%s): %d bytes for %d taps",
+        hostio_engines[e].name, count, TAPS);
+  for (int i = 0; i + 1 < count; i += 2) {
+    if (data[i] != KEY || data[i + 1] != (KEY | 0x80)) {
+      CHECK(0, "taps (%s): tap %d gave %02X %02X", hostio_engines[e].name,
+            i / 2, data[i], data[i + 1]);
+      break;
+    }
+  }
+  shutdown();
+}
+
+static void test_hold(int e) {
+  if (!boot(e)) return;
+  hostio_set_key(KEY, true);
+  hostio_run(200 * HOSTIO_CYCLES_PER_MS);
+  hostio_set_key(KEY, false);
+  hostio_run(100 * HOSTIO_CYCLES_PER_MS);
+  int count;
+  const uint8_t* data = get_tx(&count);
+  CHECK(count == 2 && data[0] == KEY && data[1] == (KEY | 0x80),
+        "hold (%s): %d bytes, %02X %02X", hostio_engines[e].name, count,
+        data[0], data[1]);
+  shutdown();
+}
+
+// DR1 as dr1_getb() used to make it, for the keys in 'down'
+static uint8_t reference_dr1(const uint8_t* down) {
+  uint8_t value = 0xFF;
+  uint8_t ddr1 = iram[DDR1], ddr3 = iram[DDR3], ddr4 = iram[DDR4];
+  uint8_t dr2 = iram[P2], dr3 = iram[P3], dr4 = iram[P4];
+  for (int dr1bit = 0; dr1bit < 8; dr1bit++) {
+    int mask = 1 << dr1bit, found = 0;
+    if ((mask & ddr1) || (dr2 & 1)) continue;
+    for (int column = 0; column < 15 && !found; column++) {
+      int selected = column < 7 ? dr3 & ddr3 & (1 << (column + 1))
+                                : dr4 & ddr4 & (1 << (column - 7));
+      int code = get_scancode(dr1bit, column);
+      if (selected && code > 0 && code < 128 && down[code]) found++;
+    }
+    if (found) value &= ~mask;
+  }
+  return value;
+}
+
+static void test_random_matrices(void) {
+  static uint8_t down[128];
+  if (!hostio_boot()) {
+    CHECK(0, "random matrices: could not initialise the HD6301");
+    return;
+  }
+  srand(6301);
+  for (int i = 0; i < MATRICES; i++) {
+    // Fresh latch, so every key set is seen at once
+    hd6301_reset(1);
+    int density = 1 + rand() % 16;
+    for (int code = 1; code < 128; code++) {
+      down[code] = rand() % 64 < density;
+      if (down[code]) hostio_set_key((uint8_t)code, true);
+    }
+    // Mostly what the ROM does: all of DDR1 in, one column selected
+    iram[DDR1] = rand() % 4 ? 0 : (uint8_t)rand();
+    iram[P2] = rand() % 8 ? 0 : 1;
+    iram[DDR3] = (uint8_t)rand();
+    iram[DDR4] = (uint8_t)rand();
+    if (rand() % 2) {
+      int column = rand() % 15;
+      iram[P3] = column < 7 ? 1 << (column + 1) : 0;
+      iram[P4] = column < 7 ? 0 : 1 << (column - 7);
+    } else {
+      iram[P3] = (uint8_t)rand();
+      iram[P4] = (uint8_t)rand();
+    }
+    uint8_t want = reference_dr1(down);
+    uint8_t got = ireg_getb_func[P1](P1);
+    if (got != want) {
+      CHECK(0, "random matrices: matrix %d, DR1 %02X instead of %02X", i, got,
+            want);
+      break;
+    }
+  }
+  hostio_shutdown();
+}
+
+int main(void) {
+  test_random_matrices();
+  for (int e = 0; e < HOSTIO_ENGINES; e++) {
+    test_taps(e);
+    test_hold(e);
+  }
+  return test_result();
+}
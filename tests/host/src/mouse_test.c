@@ -0,0 +1,158 @@
+/*
+ * Mouse quadrature test
+ *
+ * Drives mouse_tick() and mouse_set_periods() of the firmware's src/mouse.c
+ * directly, as dr4_getb() and hidinput_apply() call them on core 1, and
+ * checks the X and Y registers after every read against stepping them one
+ * period at a time, as hostio.c does:
+ *
+ *  - reads closer together than a step, the usual case
+ *  - reads one, two and more steps apart
+ *  - gaps of more than 2^32 cycles
+ *  - periods changed or stopped between reads, both directions
+ */
+#include <stdint.h>
+#include <stdio.h>
+
+#include "host_test.h"
+#include "mouse.h"
+#include "pico/time.h"
+
+#define READS 200000
+#define LONG_GAP (((int64_t)1 << 32) + 12345)
+
+// Stand-ins for what src/mouse.c calls on core 0
+absolute_time_t get_absolute_time(void) { return 0; }
+
+void hidinput_changed(void) {}
+
+struct axis {
+  int period;
+  int64_t last;
+  uint32_t reg;
+};
+
+static uint32_t random_state = 0x2545F491u;
+
+static uint32_t random32(void) {
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+static uint32_t rotl32(uint32_t v, unsigned s) {
+  s &= 31;
+  return s ? (v << s) | (v >> (32 - s)) : v;
+}
+
+static uint32_t rotr32(uint32_t v, unsigned s) {
+  s &= 31;
+  return s ? (v >> s) | (v << (32 - s)) : v;
+}
+
+// One step at a time, up to 'now'
+static void reference_advance(struct axis* a, int64_t now) {
+  if (a->period == 0) {
+    a->last = now;
+    return;
+  }
+  int step = a->period > 0 ? a->period : -a->period;
+  while (now - a->last >= step) {
+    a->last += step;
+    a->reg = a->period > 0 ? rotr32(a->reg, 1) : rotl32(a->reg, 1);
+  }
+}
+
+static void set_periods(struct axis* x, struct axis* y, int64_t now,
+                        int x_period, int y_period) {
+  reference_advance(x, now);
+  reference_advance(y, now);
+  x->period = x_period;
+  y->period = y_period;
+  mouse_set_periods(now, x_period, y_period);
+}
+
+// Reads at 'now', false if a register differs from the reference
+static bool check_read(const char* what, struct axis* x, struct axis* y,
+                       int64_t now) {
+  int x_counter, y_counter;
+  mouse_tick(now, &x_counter, &y_counter);
+  reference_advance(x, now);
+  reference_advance(y, now);
+  if ((uint32_t)x_counter == x->reg && (uint32_t)y_counter == y->reg) {
+    return true;
+  }
+  CHECK(0, "%s: at cycle %lld, X %08X Y %08X, expected %08X %08X", what,
+        (long long)now, (uint32_t)x_counter, (uint32_t)y_counter, x->reg,
+        y->reg);
+  return false;
+}
+
+// Gap to the next read: mostly under a step, sometimes a few steps
+static int64_t next_gap(int period) {
+  int step = period > 0 ? period : (period < 0 ? -period : 1000);
+  switch (random32() % 8) {
+    case 0: return step + (int64_t)(random32() % step);
+    case 1: return (int64_t)step * (2 + random32() % 6) + random32() % step;
+    default: return 1 + random32() % step;
+  }
+}
+
+static int random_period(void) {
+  static const int periods[] = {650, 651, 1000, 1333, 4096, 100000, 1};
+  int p = periods[random32() % (sizeof(periods) / sizeof(periods[0]))];
+  switch (random32() % 4) {
+    case 0: return 0;
+    case 1: return -p;
+    default: return p;
+  }
+}
+
+static void test_reads(void) {
+  struct axis x = {0}, y = {0};
+  int x_counter, y_counter;
+  int64_t now = 0;
+
+  mouse_init();
+  mouse_set_periods(now, 0, 0);
+  mouse_tick(now, &x_counter, &y_counter);
+  x.reg = (uint32_t)x_counter;
+  y.reg = (uint32_t)y_counter;
+
+  set_periods(&x, &y, now, 650, -1000);
+  for (int i = 0; i < READS; i++) {
+    now += next_gap(x.period);
+    if (!check_read("reads", &x, &y, now)) return;
+    if (random32() % 64 == 0) {
+      now += random32() % 50;
+      set_periods(&x, &y, now, random_period(), random_period());
+    }
+  }
+}
+
+static void test_long_gaps(void) {
+  static const int periods[][2] = {{650, -650}, {-1333, 4096}, {100000, -651}};
+  struct axis x = {0}, y = {0};
+  int x_counter, y_counter;
+  int64_t now = 1000;
+
+  mouse_set_periods(now, 0, 0);
+  mouse_tick(now, &x_counter, &y_counter);
+  x.reg = (uint32_t)x_counter;
+  y.reg = (uint32_t)y_counter;
+
+  for (size_t i = 0; i < sizeof(periods) / sizeof(periods[0]); i++) {
+    set_periods(&x, &y, now, periods[i][0], periods[i][1]);
+    now += LONG_GAP + (int64_t)i;
+    if (!check_read("long gap", &x, &y, now)) return;
+    now += 1;
+    if (!check_read("after a long gap", &x, &y, now)) return;
+  }
+}
+
+int main(void) {
+  test_reads();
+  test_long_gaps();
+  return test_result();
+}
@@ -0,0 +1,191 @@
+/*
+ * Pacing scheduler test
+ *
+ * Drives src/pacing.c with a virtual clock, the way core1_entry() uses it:
+ * sleep until the next slice is due, wake up a bit late, run what is due
+ * (a few cycles more, instructions aren't split), repeat. Checks that
+ * emulated time keeps up with real time on average, that catching up after
+ * a stall is done in bounded bursts, and that stalls too long to catch up
+ * are dropped and counted. Adaptive slicing: short slices for a while
+ * after some activity, long ones otherwise.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host_test.h"
+#include "pacing.h"
+
+#define SLICE 1000
+#define MAX_BURST 4000
+#define MAX_BACKLOG 100000
+
+struct sim {
+  pacing_t p;
+  uint64_t now_us;
+  uint32_t biggest_run;
+  int us_per_kcycle;  // real time the emulator takes per 1000 cycles
+};
+
+static void sim_init(struct sim* s, int us_per_kcycle) {
+  s->now_us = 123456;  // arbitrary boot time
+  s->biggest_run = 0;
+  s->us_per_kcycle = us_per_kcycle;
+  pacing_init(&s->p, s->now_us, SLICE, MAX_BURST, MAX_BACKLOG);
+}
+
+// Run the loop until real time has advanced by 'us'
+static void sim_run(struct sim* s, uint64_t us) {
+  uint64_t end = s->now_us + us;
+  while (s->now_us < end) {
+    uint32_t due = pacing_due(&s->p, s->now_us);
+    if (!due) {
+      uint64_t next = pacing_next_us(&s->p);
+      s->now_us = (next > s->now_us ? next : s->now_us) + rand() % 30;
+      continue;
+    }
+    if (due > s->biggest_run) s->biggest_run = due;
+    uint32_t ran = due + rand() % 12;
+    pacing_ran(&s->p, ran);
+    s->now_us += (uint64_t)ran * s->us_per_kcycle / 1000;
+  }
+}
+
+// Cycles emulated time is behind real time
+static int64_t sim_behind(const struct sim* s) {
+  return (int64_t)(s->now_us - s->p.base_us) - (int64_t)s->p.emulated;
+}
+
+static void test_steady(void) {
+  struct sim s;
+  sim_init(&s, 100);
+  sim_run(&s, 10 * 1000000);
+  int64_t behind = sim_behind(&s);
+  CHECK(behind > -100 && behind < SLICE + 100,
+        "steady: %lld cycles behind after 10 s", (long long)behind);
+  CHECK(s.p.dropped_cycles == 0, "steady: dropped %llu cycles",
+        (unsigned long long)s.p.dropped_cycles);
+  CHECK(s.biggest_run <= SLICE + 100, "steady: ran %u cycles at once",
+        s.biggest_run);
+  CHECK(s.p.max_slip < 100, "steady: slipped by %u", s.p.max_slip);
+}
+
+static void test_stall(void) {
+  struct sim s;
+  sim_init(&s, 100);
+  sim_run(&s, 1000000);
+  s.now_us += 50000;  // core 1 held up for 50 ms
+  sim_run(&s, 1000000);
+  int64_t behind = sim_behind(&s);
+  CHECK(behind > -100 && behind < SLICE + 100,
+        "stall: %lld cycles behind after catching up", (long long)behind);
+  CHECK(s.biggest_run == MAX_BURST, "stall: largest burst %u", s.biggest_run);
+  CHECK(s.p.catchup_cycles >= 50000, "stall: caught up %llu cycles",
+        (unsigned long long)s.p.catchup_cycles);
+  CHECK(s.p.max_slip >= 50000 - SLICE, "stall: max slip %u", s.p.max_slip);
+  CHECK(s.p.dropped_cycles == 0, "stall: dropped %llu cycles",
+        (unsigned long long)s.p.dropped_cycles);
+}
+
+static void test_long_stall(void) {
+  struct sim s;
+  sim_init(&s, 100);
+  sim_run(&s, 1000000);
+  s.now_us += 2000000;  // 2 s: more than the backlog allowed
+  sim_run(&s, 1000000);
+  int64_t behind = sim_behind(&s);
+  CHECK(behind > -100 && behind < SLICE + 100,
+        "long stall: %lld cycles behind after catching up", (long long)behind);
+  uint64_t dropped = s.p.dropped_cycles;
+  CHECK(dropped > 2000000 - MAX_BACKLOG - 2 * SLICE &&
+            dropped <= 2000000 - MAX_BACKLOG + 2 * SLICE,
+        "long stall: dropped %llu cycles", (unsigned long long)dropped);
+  CHECK(s.p.max_slip <= MAX_BACKLOG, "long stall: max slip %u",
+        s.p.max_slip);
+}
+
+// Emulating slower than real time: bursts stay bounded, the excess goes
+static void test_overload(void) {
+  struct sim s;
+  sim_init(&s, 1200);
+  sim_run(&s, 5 * 1000000);
+  CHECK(s.biggest_run <= MAX_BURST, "overload: ran %u cycles at once",
+        s.biggest_run);
+  CHECK(s.p.dropped_cycles > 0, "overload: nothing dropped");
+  CHECK(sim_behind(&s) <= MAX_BACKLOG + MAX_BURST,
+        "overload: %lld cycles behind", (long long)sim_behind(&s));
+}
+
+static void test_early(void) {
+  pacing_t p;
+  pacing_init(&p, 1000, SLICE, MAX_BURST, MAX_BACKLOG);
+  CHECK(pacing_due(&p, 1000) == 0, "early: due at start");
+  CHECK(pacing_due(&p, 1999) == 0, "early: due before a slice");
+  CHECK(pacing_next_us(&p) == 2000, "early: next slice at %llu",
+        (unsigned long long)pacing_next_us(&p));
+  CHECK(pacing_due(&p, 2000) == SLICE, "early: not due on time");
+  pacing_ran(&p, SLICE + 3);
+  CHECK(pacing_next_us(&p) == 3003, "early: next slice at %llu",
+        (unsigned long long)pacing_next_us(&p));
+}
+
+static void test_adaptive(void) {
+  pacing_t p;
+  pacing_init(&p, 0, SLICE, MAX_BURST, MAX_BACKLOG);
+  pacing_set_adaptive(&p, SLICE / 10, 5 * SLICE);
+  CHECK(pacing_slice(&p) == SLICE, "adaptive: short slices before activity");
+  CHECK(pacing_due(&p, SLICE / 10) == 0, "adaptive: due while quiet");
+
+  // A byte at 250 us: what is owed runs at once, then short slices
+  pacing_activity(&p);
+  CHECK(pacing_due(&p, 250) == 250, "adaptive: owed cycles not run");
+  pacing_ran(&p, 250);
+  CHECK(pacing_next_us(&p) == 250 + SLICE / 10, "adaptive: next slice at %llu",
+        (unsigned long long)pacing_next_us(&p));
+  uint64_t now = 250;
+  while (pacing_slice(&p) != SLICE) {
+    now = pacing_next_us(&p);
+    uint32_t due = pacing_due(&p, now);
+    CHECK(due == SLICE / 10, "adaptive: ran %u cycles in a short slice", due);
+    pacing_ran(&p, due);
+    if (now > 10 * SLICE) break;
+  }
+  // The slice that crosses the end of the hold still is a short one
+  CHECK(p.emulated == 5 * SLICE + 50, "adaptive: short slices until %llu",
+        (unsigned long long)p.emulated);
+  CHECK(p.short_slices == 1 + 48, "adaptive: %llu short slices",
+        (unsigned long long)p.short_slices);
+
+  // A simulated run keeps up the same way
+  struct sim s;
+  sim_init(&s, 100);
+  pacing_set_adaptive(&s.p, SLICE / 10, 5 * SLICE);
+  for (int i = 0; i < 100; i++) {
+    pacing_activity(&s.p);
+    sim_run(&s, 3 * 5 * SLICE);
+  }
+  int64_t behind = sim_behind(&s);
+  CHECK(behind > -100 && behind < SLICE + 100,
+        "adaptive: %lld cycles behind", (long long)behind);
+  // Late wake-ups make short slices a bit longer than asked
+  CHECK(s.p.short_slices >= 100 * 30 && s.p.short_slices <= 100 * 50,
+        "adaptive: %llu short slices", (unsigned long long)s.p.short_slices);
+  CHECK(s.p.slices - s.p.short_slices >= 100 * 9,
+        "adaptive: %llu long slices",
+        (unsigned long long)(s.p.slices - s.p.short_slices));
+
+  // Back to fixed slices
+  pacing_set_adaptive(&s.p, 0, 0);
+  pacing_activity(&s.p);
+  CHECK(pacing_slice(&s.p) == SLICE, "adaptive: still short after reset");
+}
+
+int main(void) {
+  srand(1);
+  test_early();
+  test_steady();
+  test_stall();
+  test_long_stall();
+  test_overload();
+  test_adaptive();
+  return test_result();
+}
@@ -0,0 +1,452 @@
+/*
+ * IKBD protocol conformance and latency test
+ *
+ * Runs the IKBD ROM through the commands of the ST side of the protocol,
+ * on the reference engine (instr_exec) and the one the core was built
+ * with, and checks the bytes of each reply and how long it took to come,
+ * in emulated cycles:
+ *
+ *  - the power-up byte and reset (0x80 0x01)
+ *  - setting and reading the time of day (0x1B, 0x1C)
+ *  - relative, absolute and keycode mouse modes (0x08, 0x09, 0x0A),
+ *    the absolute position read with 0x0D
+ *  - joystick event, interrogation and monitoring modes (0x14, 0x15 with
+ *    0x16, 0x17)
+ *  - pausing and resuming output (0x13, 0x11)
+ *  - loading code into the 6301's RAM, reading it back and running it
+ *    (0x20, 0x21, 0x22)
+ *
+ * A latency is from the cycle the command is queued, its own bytes on
+ * the line included, to the start bit of the first byte of the reply.
+ * Each has a budget, with room over what the ROM takes (300 ms for a reset,
+ * as tests/atarist checks on the ST). Both engines have to send the same
+ * bytes at the same cycles, so a reply that comes a cycle earlier or
+ * later on one of them fails as well.
+ *
+ * The engines are the reference one (instr_exec()) and the one the core
+ * was built with: the threaded engine in protocol_test, the ROM translated
+ * ahead of time in protocol_test_aot, the threaded engine with the block
+ * cache in protocol_test_bcache.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "host_test.h"
+#include "hostio.h"
+
+#define MAX_REPLY 256
+#define MAX_CASES 32
+#define MS HOSTIO_CYCLES_PER_MS
+
+// Bytes sent by the ROM since the last call, with the cycle of their
+// start bits
+struct reply {
+  int count;
+  uint8_t data[MAX_REPLY];
+  int64_t cycle[MAX_REPLY];
+};
+
+// Everything an engine sent, to compare the engines
+static struct tx_log sent[HOSTIO_ENGINES];
+
+// Latency of each case, to print
+static struct {
+  const char* name;
+  int64_t cycles;
+} latency[HOSTIO_ENGINES][MAX_CASES];
+static int cases[HOSTIO_ENGINES];
+
+static int e;  // engine under test
+static int64_t queued;  // cycle the last command was queued at
+
+static void send(const uint8_t* cmd, int len) {
+  queued = (int64_t)cpu.ncycles;
+  hostio_rx_put_buf(cmd, len);
+}
+
+#define SEND(...)                          \
+  do {                                     \
+    const uint8_t cmd_[] = {__VA_ARGS__};  \
+    send(cmd_, (int)sizeof(cmd_));         \
+  } while (0)
+
+static void run_ms(int ms) { hostio_run((int64_t)ms * MS); }
+
+// Runs 'ms' milliseconds and takes what was sent
+static void collect(struct reply* r, int ms) {
+  int from = sent[e].count;
+
+  run_ms(ms);
+  tx_collect(&sent[e]);
+  r->count = 0;
+  for (int i = from; i < sent[e].count && r->count < MAX_REPLY; i++) {
+    r->data[r->count] = sent[e].data[i];
+    r->cycle[r->count++] = sent[e].cycle[i];
+  }
+}
+
+static void print_reply(const struct reply* r) {
+  for (int i = 0; i < r->count && i < 16; i++) printf(" %02X", r->data[i]);
+  printf("%s\n", r->count > 16 ? " ..." : "");
+}
+
+// The reply has to be 'expected', exactly
+static bool expect(const char* name, const struct reply* r,
+                   const uint8_t* expected, int len) {
+  if (r->count == len && (!len || !memcmp(r->data, expected, len)))
+    return true;
+  CHECK(0, "%s (%s): %d bytes, expected %d:", name, hostio_engines[e].name,
+        r->count, len);
+  print_reply(r);
+  return false;
+}
+
+#define EXPECT(name, r, ...)                                \
+  do {                                                      \
+    const uint8_t expected_[] = {__VA_ARGS__};              \
+    expect(name, r, expected_, (int)sizeof(expected_));     \
+  } while (0)
+
+#define EXPECT_NOTHING(name, r) expect(name, r, NULL, 0)
+
+// The first byte of the reply within 'budget_ms' of 'from'
+static void check_latency(const char* name, const struct reply* r,
+                          int64_t from, int budget_ms) {
+  if (!r->count) {
+    CHECK(0, "%s (%s): no reply", name, hostio_engines[e].name);
+    return;
+  }
+  int64_t cycles = r->cycle[0] - from;
+  CHECK(cycles > 0 && cycles <= (int64_t)budget_ms * MS,
+        "%s (%s): reply after %.2f ms, budget %d ms", name,
+        hostio_engines[e].name, (double)cycles / MS, budget_ms);
+  if (cases[e] < MAX_CASES) {
+    latency[e][cases[e]].name = name;
+    latency[e][cases[e]++].cycles = cycles;
+  }
+}
+
+// Sum of the X or Y deltas of relative mouse packets
+static int mouse_sum(const struct reply* r, int axis) {
+  int sum = 0;
+  for (int i = 0; i + 2 < r->count; i += 3) {
+    CHECK((r->data[i] & 0xFC) == 0xF8, "mouse (%s): header %02X",
+          hostio_engines[e].name, r->data[i]);
+    sum += (int8_t)r->data[i + 1 + axis];
+  }
+  return sum;
+}
+
+static void test_reset(void) {
+  struct reply r;
+
+  // the power-up byte, from the cold reset of hostio_boot()
+  collect(&r, 500);
+  EXPECT("power-up", &r, 0xF1);
+  check_latency("power-up", &r, 0, 300);
+
+  SEND(0x80, 0x01);
+  collect(&r, 500);
+  EXPECT("reset", &r, 0xF1);
+  check_latency("reset", &r, queued, 300);
+}
+
+static void test_tod(void) {
+  struct reply r;
+
+  SEND(0x1C);
+  collect(&r, 50);
+  EXPECT("time of day after reset", &r, 0xFC, 0, 0, 0, 0, 0, 0);
+
+  SEND(0x1B, 0x87, 0x06, 0x15, 0x23, 0x59, 0x58);
+  collect(&r, 50);
+  EXPECT_NOTHING("set time of day", &r);
+
+  SEND(0x1C);
+  collect(&r, 50);
+  EXPECT("time of day", &r, 0xFC, 0x87, 0x06, 0x15, 0x23, 0x59, 0x58);
+  check_latency("time of day", &r, queued, 10);
+
+  // the ROM's clock runs on, over midnight
+  run_ms(2500);
+  SEND(0x1C);
+  collect(&r, 50);
+  EXPECT("time of day, 2.6 s later", &r, 0xFC, 0x87, 0x06, 0x16, 0x00, 0x00,
+         0x00);
+}
+
+static void test_relative_mouse(void) {
+  struct reply r;
+
+  SEND(0x08);
+  collect(&r, 50);
+  EXPECT_NOTHING("relative mouse", &r);
+
+  // 50 edges right, the ROM reports them a few at a time
+  int64_t start = (int64_t)cpu.ncycles;
+  hostio_set_mouse_period(2000, 0);
+  run_ms(100);
+  hostio_set_mouse_period(0, 0);
+  collect(&r, 50);
+  check_latency("mouse motion", &r, start, 15);
+  int dx = mouse_sum(&r, 0), dy = mouse_sum(&r, 1);
+  CHECK(dx >= 45 && dx <= 50 && !dy, "mouse (%s): moved %d, %d for 50, 0",
+        hostio_engines[e].name, dx, dy);
+
+  // and 50 up
+  hostio_set_mouse_period(0, -2000);
+  run_ms(100);
+  hostio_set_mouse_period(0, 0);
+  collect(&r, 50);
+  dx = mouse_sum(&r, 0);
+  dy = mouse_sum(&r, 1);
+  CHECK(!dx && dy >= -50 && dy <= -45, "mouse (%s): moved %d, %d for 0, -50",
+        hostio_engines[e].name, dx, dy);
+
+  // buttons, right then left
+  start = (int64_t)cpu.ncycles;
+  hostio_set_mouse_buttons(1);
+  collect(&r, 30);
+  EXPECT("right button", &r, 0xF9, 0, 0);
+  check_latency("mouse button", &r, start, 20);
+  hostio_set_mouse_buttons(0);
+  collect(&r, 30);
+  EXPECT("right button up", &r, 0xF8, 0, 0);
+  hostio_set_mouse_buttons(2);
+  collect(&r, 30);
+  EXPECT("left button", &r, 0xFA, 0, 0);
+  hostio_set_mouse_buttons(0);
+  collect(&r, 30);
+  EXPECT("left button up", &r, 0xF8, 0, 0);
+}
+
+static void test_absolute_mouse(void) {
+  struct reply r;
+
+  // 320 x 200, at the origin
+  SEND(0x09, 0x01, 0x40, 0x00, 0xC8);
+  collect(&r, 50);
+  EXPECT_NOTHING("absolute mouse", &r);
+
+  SEND(0x0D);
+  collect(&r, 50);
+  EXPECT("absolute position", &r, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00);
+  check_latency("absolute position", &r, queued, 10);
+
+  // 25 edges right, nothing sent until asked
+  hostio_set_mouse_period(2000, 0);
+  run_ms(50);
+  hostio_set_mouse_period(0, 0);
+  collect(&r, 20);
+  EXPECT_NOTHING("absolute motion", &r);
+  SEND(0x0D);
+  collect(&r, 50);
+  CHECK(r.count == 6 && r.data[0] == 0xF7 && r.data[2] == 0 &&
+            r.data[3] >= 22 && r.data[3] <= 25 && !r.data[4] && !r.data[5],
+        "absolute position (%s): %d bytes, %02X %02X%02X %02X%02X",
+        hostio_engines[e].name, r.count, r.data[0], r.data[2], r.data[3],
+        r.data[4], r.data[5]);
+
+  // up stops at the edge
+  hostio_set_mouse_period(0, -2000);
+  run_ms(50);
+  hostio_set_mouse_period(0, 0);
+  SEND(0x0D);
+  collect(&r, 50);
+  CHECK(r.count == 6 && !r.data[4] && !r.data[5],
+        "absolute position (%s): Y %02X%02X past the top",
+        hostio_engines[e].name, r.data[4], r.data[5]);
+}
+
+static void test_keycode_mouse(void) {
+  struct reply r;
+
+  // a key code for each edge
+  SEND(0x0A, 0x01, 0x01);
+  collect(&r, 50);
+  EXPECT_NOTHING("keycode mouse", &r);
+
+  int64_t start = (int64_t)cpu.ncycles;
+  hostio_set_mouse_period(5000, 0);
+  run_ms(50);
+  hostio_set_mouse_period(0, 0);
+  collect(&r, 50);
+  check_latency("mouse key codes", &r, start, 15);
+  CHECK(r.count >= 16 && r.count <= 20 && !(r.count & 1),
+        "keycode mouse (%s): %d bytes for 10 edges", hostio_engines[e].name,
+        r.count);
+  for (int i = 0; i + 1 < r.count; i += 2) {
+    if (r.data[i] != 0x4D || r.data[i + 1] != 0xCD) {
+      CHECK(0, "keycode mouse (%s): %02X %02X, expected 4D CD",
+            hostio_engines[e].name, r.data[i], r.data[i + 1]);
+      break;
+    }
+  }
+
+  SEND(0x08);
+  collect(&r, 50);
+  EXPECT_NOTHING("back to relative mouse", &r);
+}
+
+static void test_joystick(void) {
+  struct reply r;
+
+  // The mouse is on joystick port 0, which reports its phase bits
+  SEND(0x14);
+  collect(&r, 50);
+  CHECK(r.count == 2 && r.data[0] == 0xFE,
+        "joystick events (%s): %d bytes, %02X", hostio_engines[e].name, r.count,
+        r.data[0]);
+
+  int64_t start = (int64_t)cpu.ncycles;
+  hostio_set_joystick(0x10);  // joystick 1 up
+  collect(&r, 50);
+  EXPECT("joystick up", &r, 0xFF, 0x01);
+  check_latency("joystick event", &r, start, 10);
+  hostio_set_joystick(0x00);
+  collect(&r, 50);
+  EXPECT("joystick released", &r, 0xFF, 0x00);
+
+  SEND(0x15);
+  collect(&r, 50);
+  EXPECT_NOTHING("joystick interrogation", &r);
+  hostio_set_joystick(0x80);  // right
+  collect(&r, 50);
+  EXPECT_NOTHING("joystick moved, not asked", &r);
+  SEND(0x16);
+  collect(&r, 50);
+  CHECK(r.count == 3 && r.data[0] == 0xFD && r.data[2] == 0x08,
+        "joystick interrogate (%s): %d bytes, %02X .. %02X",
+        hostio_engines[e].name, r.count, r.data[0], r.data[2]);
+  check_latency("joystick interrogate", &r, queued, 10);
+  hostio_set_joystick(0x00);
+
+  // Two bytes every 'rate' hundredths of a second. The ROM counts them
+  // with a delay loop that comes to about 11.2 ms.
+  const int rate = 5;
+  SEND(0x17, rate);
+  collect(&r, 500);
+  int packets = r.count / 2;
+  CHECK(packets >= 6 && !(r.count & 1),
+        "joystick monitoring (%s): %d bytes in 500 ms", hostio_engines[e].name,
+        r.count);
+  for (int i = 1; i < packets; i++) {
+    int64_t interval = r.cycle[2 * i] - r.cycle[2 * i - 2];
+    if (interval < rate * 10 * MS || interval > rate * 12 * MS) {
+      CHECK(0, "joystick monitoring (%s): %.2f ms between packets, rate %d",
+            hostio_engines[e].name, (double)interval / MS, rate);
+      break;
+    }
+  }
+  // monitoring takes no other command than a reset
+  SEND(0x80, 0x01);
+  collect(&r, 500);
+  CHECK(r.count >= 1 && r.data[r.count - 1] == 0xF1,
+        "reset out of joystick monitoring (%s): %d bytes",
+        hostio_engines[e].name, r.count);
+}
+
+static void test_pause(void) {
+  struct reply r;
+
+  SEND(0x13);
+  collect(&r, 50);
+  EXPECT_NOTHING("pause", &r);
+
+  hostio_set_key(0x1E, true);
+  run_ms(50);
+  hostio_set_key(0x1E, false);
+  collect(&r, 50);
+  EXPECT_NOTHING("key while paused", &r);
+
+  SEND(0x11);
+  collect(&r, 50);
+  EXPECT("resume", &r, 0x1E, 0x9E);
+  check_latency("resume", &r, queued, 10);
+
+  int64_t start = (int64_t)cpu.ncycles;
+  hostio_set_key(0x1E, true);
+  collect(&r, 50);
+  EXPECT("key", &r, 0x1E);
+  check_latency("key", &r, start, 40);
+  hostio_set_key(0x1E, false);
+  collect(&r, 50);
+  EXPECT("key up", &r, 0x9E);
+}
+
+static void test_memory(void) {
+  struct reply r;
+
+  // ldaa #$A5; staa TDR; rts, into free RAM. The ROM takes the byte after
+  // the data as part of the command, a pad has to follow.
+  SEND(0x20, 0x00, 0x94, 0x05, 0x86, 0xA5, 0x97, 0x13, 0x39, 0x00);
+  collect(&r, 50);
+  EXPECT_NOTHING("memory load", &r);
+
+  SEND(0x21, 0x00, 0x94);
+  collect(&r, 50);
+  EXPECT("memory read", &r, 0xF6, 0x20, 0x86, 0xA5, 0x97, 0x13, 0x39, 0x00);
+  check_latency("memory read", &r, queued, 10);
+
+  SEND(0x22, 0x00, 0x94);
+  collect(&r, 50);
+  EXPECT("execute", &r, 0xA5);
+  check_latency("execute", &r, queued, 10);
+
+  // the ROM goes on as before
+  SEND(0x1C);
+  collect(&r, 50);
+  CHECK(r.count == 7 && r.data[0] == 0xFC,
+        "time of day after execute (%s): %d bytes", hostio_engines[e].name,
+        r.count);
+}
+
+static void test_engine(void) {
+  if (!hostio_boot()) {
+    CHECK(0, "could not initialise the HD6301");
+    return;
+  }
+  hostio_set_runner(hostio_engines[e].run);
+  test_reset();
+  test_tod();
+  test_relative_mouse();
+  test_absolute_mouse();
+  test_keycode_mouse();
+  test_joystick();
+  test_pause();
+  test_memory();
+  hostio_set_runner(NULL);
+  hostio_shutdown();
+}
+
+int main(void) {
+  for (e = 0; e < HOSTIO_ENGINES; e++) test_engine();
+
+  int same = sent[0].count == sent[1].count;
+  for (int i = 0; same && i < sent[0].count; i++) {
+    if (sent[0].data[i] != sent[1].data[i] ||
+        sent[0].cycle[i] != sent[1].cycle[i]) {
+      CHECK(0, "byte %d: %s sent %02X at %lld, %s %02X at %lld", i,
+            hostio_engines[0].name, sent[0].data[i],
+            (long long)sent[0].cycle[i], hostio_engines[1].name,
+            sent[1].data[i], (long long)sent[1].cycle[i]);
+      same = 0;
+    }
+  }
+  CHECK(sent[0].count == sent[1].count, "%s sent %d bytes, %s %d",
+        hostio_engines[0].name, sent[0].count, hostio_engines[1].name,
+        sent[1].count);
+
+  printf("%-22s %10s %10s\n", "latency (ms)", hostio_engines[0].name,
+         hostio_engines[1].name);
+  for (int i = 0; i < cases[0] && i < cases[1]; i++) {
+    printf("%-22s %10.2f %10.2f\n", latency[0][i].name,
+           (double)latency[0][i].cycles / MS,
+           (double)latency[1][i].cycles / MS);
+  }
+
+  return test_result();
+}
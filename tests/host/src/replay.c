@@ -0,0 +1,379 @@
+/*
+ * IKBD session replay
+ *
+ * Feeds a trace (src/include/trace.h) to the host build of the core: the
+ * bytes from the ST, the input changes and the mouse phase at the cycles
+ * they were recorded at. The bytes the ROM sends are checked against the
+ * ones in the trace, the first difference is shown with what led to it.
+ *
+ * The trace is either the binary encoding or a log of the debug output of
+ * a firmware built with IKBD_TRACE=1, whose "IKTR" lines hold it.
+ *
+ * Nothing waits for real time, so a replay also measures the core on a
+ * real session: the time it took is reported against the emulated time.
+ *
+ * Usage: ikbd_replay [-e reference|shadow] [-c every] [-n repeats] [-s] [-v]
+ *                    <trace>
+ *   -e reference  run instr_exec() instead of the engine built in
+ *   -e shadow     run both and compare them (shadow.c), stopping at the
+ *                 first instruction where the engine differs
+ *   -c every      instructions between two shadow comparisons (1000)
+ *   -n repeats    replay that many times, for timing
+ *   -s            the bytes have to be sent at the recorded cycles too
+ *   -v            list the events as they are replayed
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "hostio.h"
+#include "trace.h"
+
+// Emulated time run after the last event, for bytes recorded a little
+// early to come out
+#define TAIL_CYCLES (10 * HOSTIO_CYCLES_PER_MS)
+#define CONTEXT 8  // events shown before a difference
+
+static const char* const type_name[TRACE_TYPES] = {
+    "mouse-phase", "rx",       "tx",   "key",  "buttons", "joystick",
+    "mouse",       "usb",      "bt",   "gpio", "lost",
+};
+
+static trace_event_t* events;
+static int n_events;
+
+static struct {
+  uint8_t data;
+  int64_t cycle;
+}* sent;
+static int n_sent, max_sent;
+
+static int verbose = 0;
+
+static double now_s(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint8_t* read_file(const char* path, size_t* size) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  long len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t* buf = malloc(len > 0 ? len : 1);
+  if (!buf || fread(buf, 1, len, f) != (size_t)len) {
+    perror(path);
+    free(buf);
+    fclose(f);
+    return NULL;
+  }
+  fclose(f);
+  *size = (size_t)len;
+  return buf;
+}
+
+static int hex_digit(int c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+// The bytes of the "IKTR" lines of a log, in place. Returns their count.
+static size_t extract_log(uint8_t* buf, size_t size) {
+  size_t in = 0, out = 0;
+  while (in < size) {
+    size_t end = in;
+    while (end < size && buf[end] != '\n') end++;
+    const char* line = (const char*)&buf[in];
+    if (end - in > 5 && !memcmp(line, "IKTR ", 5)) {
+      for (size_t i = in + 5; i + 1 < end; i += 2) {
+        int hi = hex_digit(buf[i]), lo = hex_digit(buf[i + 1]);
+        if (hi < 0 || lo < 0) break;  // \r, or a cut line
+        buf[out++] = (uint8_t)(hi << 4 | lo);
+      }
+    }
+    in = end + 1;
+  }
+  return out;
+}
+
+// In cycle order, keeping the recorded order of events at the same cycle.
+// The device merges the cores' events by cycle already, only the ones of
+// core 0 can be a little late: it reads a count core 1 may have gone past.
+static void sort_by_cycle(void) {
+  for (int i = 1; i < n_events; i++) {
+    trace_event_t ev = events[i];
+    int j = i;
+    while (j > 0 && events[j - 1].cycle > ev.cycle) {
+      events[j] = events[j - 1];
+      j--;
+    }
+    events[j] = ev;
+  }
+}
+
+static bool load_trace(const char* path) {
+  size_t size;
+  uint8_t* buf = read_file(path, &size);
+  if (!buf) return false;
+  size_t pos = trace_read_header(buf, size);
+  if (!pos) {
+    size = extract_log(buf, size);
+    pos = trace_read_header(buf, size);
+  }
+  if (!pos) {
+    printf("%s: not a trace, nor a log with one\n", path);
+    free(buf);
+    return false;
+  }
+
+  int max_events = 1024;
+  events = malloc(max_events * sizeof(*events));
+  trace_codec_t codec;
+  trace_codec_init(&codec);
+  while (pos < size) {
+    if (n_events == max_events) {
+      max_events *= 2;
+      events = realloc(events, max_events * sizeof(*events));
+    }
+    size_t len = trace_decode(&codec, buf + pos, size - pos, &events[n_events]);
+    if (!len) {
+      printf("%s: bad record at byte %zu, %zu bytes left unread\n", path, pos,
+             size - pos);
+      break;
+    }
+    pos += len;
+    n_events++;
+  }
+  free(buf);
+  sort_by_cycle();
+  return true;
+}
+
+static void print_event(const trace_event_t* ev) {
+  printf("  %12llu cycles %12llu us  %-11s", (unsigned long long)ev->cycle,
+         (unsigned long long)ev->time_us,
+         ev->type < TRACE_TYPES ? type_name[ev->type] : "?");
+  uint8_t fields = ev->type < TRACE_TYPES ? trace_fields[ev->type] : 0;
+  if (fields & TRACE_CODE) printf(" %02X", ev->code);
+  if (fields & TRACE_VALUE) printf(" %02X", ev->value);
+  if (fields & TRACE_X) printf(" %ld", (long)ev->x);
+  if (fields & TRACE_Y) printf(" %ld", (long)ev->y);
+  if (fields & TRACE_DATA) {
+    printf(" [");
+    for (int i = 0; i < ev->len; i++) printf(i ? " %02X" : "%02X", ev->data[i]);
+    printf("]");
+  }
+  printf("\n");
+}
+
+static void take_sent(void) {
+  uint8_t data;
+  int64_t cycle;
+  while (hostio_tx_get(&data, &cycle)) {
+    if (n_sent == max_sent) {
+      max_sent = max_sent ? 2 * max_sent : 1024;
+      sent = realloc(sent, max_sent * sizeof(*sent));
+    }
+    sent[n_sent].data = data;
+    sent[n_sent++].cycle = cycle;
+  }
+}
+
+static void run_to(hostio_runner_t run, int64_t cycle) {
+  while (!crashed && (int64_t)cpu.ncycles < cycle) {
+    int64_t ran;
+    run(cycle - (int64_t)cpu.ncycles, 0, &ran);
+  }
+  take_sent();
+}
+
+// One replay, returns the emulated cycles it ran
+static int64_t replay(hostio_runner_t run) {
+  uint8_t buttons = 0, fire = 0;
+  int lost = 0;
+  int rx = -1;  // byte from the ST queued last
+
+  n_sent = 0;
+  if (!hostio_boot()) {
+    printf("Failed to initialise HD6301\n");
+    exit(1);
+  }
+  for (int i = 0; i < n_events; i++) {
+    const trace_event_t* ev = &events[i];
+    // A byte from the ST is recorded as it went into RDR. It is queued as
+    // soon as the one before is in, to go in at the first instruction
+    // boundary from its cycle on, where the device took it.
+    if (rx < i) {
+      for (rx = i; rx < n_events && events[rx].type != TRACE_RX; rx++) {
+      }
+      if (rx < n_events) {
+        hostio_rx_put_at(events[rx].code, (int64_t)events[rx].cycle);
+      }
+    }
+    run_to(run, (int64_t)ev->cycle);
+    if (verbose) print_event(ev);
+    switch (ev->type) {
+      case TRACE_MOUSE_PHASE:
+        hostio_set_mouse_phase((uint32_t)ev->x, (uint32_t)ev->y);
+        break;
+      case TRACE_RX:  // queued above
+        break;
+      case TRACE_KEY:
+        hostio_set_key(ev->code, ev->value);
+        break;
+      case TRACE_BUTTONS:
+        buttons = ev->code & 0x03;
+        hostio_set_mouse_buttons(buttons | (fire & 0x03));
+        break;
+      case TRACE_JOYSTICK:
+        // The joystick fire buttons share the lines with the mouse buttons
+        fire = ev->code;
+        hostio_set_mouse_buttons(buttons | (fire & 0x03));
+        hostio_set_joystick(ev->value);
+        break;
+      case TRACE_MOUSE:
+        hostio_set_mouse_period(ev->x, ev->y);
+        break;
+      case TRACE_LOST:
+        lost += ev->x;
+        break;
+      default:  // sent, or where the input came from
+        break;
+    }
+  }
+  run_to(run, (n_events ? (int64_t)events[n_events - 1].cycle : 0) +
+                  TAIL_CYCLES);
+  int64_t cycles = (int64_t)cpu.ncycles;
+  hostio_shutdown();
+  if (lost) {
+    printf("%d events were lost on the device, the replay may differ\n",
+           lost);
+  }
+  return cycles;
+}
+
+// The events around the n-th byte sent
+static void show_context(int n) {
+  int tx = 0, i;
+  for (i = 0; i < n_events; i++) {
+    if (events[i].type == TRACE_TX && tx++ == n) break;
+  }
+  int from = i > CONTEXT ? i - CONTEXT : 0;
+  for (int j = from; j <= i && j < n_events; j++) print_event(&events[j]);
+}
+
+// Bytes sent against the TX events. Returns the number of differences.
+static int compare(int strict) {
+  int expected = 0, differences = 0;
+  int64_t max_skew = 0;
+
+  for (int i = 0; i < n_events; i++) {
+    const trace_event_t* ev = &events[i];
+    if (ev->type != TRACE_TX) continue;
+    if (expected >= n_sent) {
+      if (!differences++) {
+        printf("byte %d: %02X at %llu was not sent\n", expected, ev->code,
+               (unsigned long long)ev->cycle);
+        show_context(expected);
+      }
+    } else {
+      int64_t skew = sent[expected].cycle - (int64_t)ev->cycle;
+      if (skew < 0) skew = -skew;
+      if (skew > max_skew) max_skew = skew;
+      if (sent[expected].data != ev->code || (strict && skew)) {
+        if (!differences++) {
+          printf("byte %d: sent %02X at %lld, recorded %02X at %llu\n",
+                 expected, sent[expected].data,
+                 (long long)sent[expected].cycle, ev->code,
+                 (unsigned long long)ev->cycle);
+          show_context(expected);
+        }
+      }
+    }
+    expected++;
+  }
+  // A byte started after the last event may just be past the end of the
+  // recording
+  int64_t end = n_events ? (int64_t)events[n_events - 1].cycle : 0;
+  if (n_sent > expected && sent[expected].cycle <= end) {
+    if (!differences++) {
+      printf("byte %d: %02X at %lld sent, not recorded\n", expected,
+             sent[expected].data, (long long)sent[expected].cycle);
+    }
+  }
+  printf("%d bytes recorded, %d sent, %d differences, %lld cycles apart at "
+         "most\n",
+         expected, n_sent, differences, (long long)max_skew);
+  return differences;
+}
+
+int main(int argc, char** argv) {
+  hostio_runner_t run = hd6301_run_until;
+  const char* engine = "built-in";
+  int repeats = 1, strict = 0, every = 0;
+  int opt;
+
+  for (opt = 1; opt < argc && argv[opt][0] == '-'; opt++) {
+    if (!strcmp(argv[opt], "-e") && opt + 1 < argc) {
+      engine = argv[++opt];
+      if (!strcmp(engine, "reference")) {
+        run = hostio_run_reference;
+      } else if (!strcmp(engine, "shadow")) {
+        run = hostio_run_shadow;
+      } else if (strcmp(engine, "built-in")) {
+        printf("Unknown engine '%s'\n", engine);
+        return 2;
+      }
+    } else if (!strcmp(argv[opt], "-c") && opt + 1 < argc) {
+      every = atoi(argv[++opt]);
+    } else if (!strcmp(argv[opt], "-n") && opt + 1 < argc) {
+      repeats = atoi(argv[++opt]);
+    } else if (!strcmp(argv[opt], "-s")) {
+      strict = 1;
+    } else if (!strcmp(argv[opt], "-v")) {
+      verbose = 1;
+    } else {
+      break;
+    }
+  }
+  if (opt != argc - 1 || repeats < 1) {
+    printf("Usage: %s [-e reference|shadow] [-c every] [-n repeats] [-s] [-v] "
+           "<trace>\n",
+           argv[0]);
+    return 2;
+  }
+  if (!load_trace(argv[opt])) return 1;
+
+  int64_t cycles = 0;
+  double start = now_s();
+  for (int i = 0; i < repeats; i++) {
+    hostio_shadow_config(NULL, every);
+    cycles = replay(run);
+    verbose = 0;
+  }
+  double elapsed = now_s() - start;
+
+  double emulated = (double)cycles / HOSTIO_CYCLES_PER_SECOND;
+  printf("%d events, %.2f s emulated, %s engine: %.1f ms a replay, %.0fx "
+         "real time\n",
+         n_events, emulated, engine, elapsed * 1000 / repeats,
+         emulated * repeats / elapsed);
+  if (run == hostio_run_shadow) {
+    printf("%lld instructions checked against instr_exec(), %s\n",
+           (long long)hostio_shadow_checked(),
+           hostio_shadow_diverged() ? "diverged" : "no divergence");
+  }
+  int differences = compare(strict);
+  printf("%s\n", differences ? "DIFFERENT" : "SAME");
+  return differences || hostio_shadow_diverged() ? 1 : 0;
+}
@@ -0,0 +1,303 @@
+/*
+ * HD6301 serial port test
+ *
+ * TDRE has to follow the SCI shift register, not whatever the UART behind
+ * serialp_send() does: a byte takes ten bit times on the line (1280 cycles
+ * at the E/128 rate the IKBD ROM selects) and the next one can only go once
+ * it is out. Checks, on both engines:
+ *
+ *  - a program sending as fast as TDRE lets it gets its bytes out exactly
+ *    one byte time apart, on the same cycles whatever the engine, and
+ *    with HD6301_IDLE_SKIP (sci_test_idle) the wait for TDRE is
+ *    fast-forwarded
+ *  - the IKBD ROM's multi-byte replies are spaced by at least a byte time,
+ *    so a UART running at the same rate never has more than one byte
+ *    waiting
+ *
+ * and for the receiver, that a long burst of commands queued at once (as
+ * core 0 does after a long slice) goes into RDR one byte time apart, with
+ * no overrun, and reaches the ROM intact, and that the wake-up bit the ROM
+ * sets clears a byte time of idle line later, however the run is sliced.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "6301.h"
+#include "chip.h"
+#include "cpu.h"
+#include "dispatch.h"
+#include "host_test.h"
+#include "hostio.h"
+#include "ireg.h"
+#include "reg.h"
+#include "sci.h"
+#include "timer.h"
+
+#define BYTE_CYCLES 1280  // 10 bits at E/128
+#define FLOOD_BYTES 100
+#define LOAD_BYTES 200
+#define MAX_RX 256
+
+extern u_char* ram;
+
+// Same bytes on the same cycles
+static void compare_logs(const char* what, const struct tx_log* a,
+                         const struct tx_log* b) {
+  CHECK(a->count == b->count, "%s: %d bytes sent against %d", what,
+        a->count, b->count);
+  for (int i = 0; i < a->count && i < b->count; i++) {
+    if (a->data[i] != b->data[i] || a->cycle[i] != b->cycle[i]) {
+      CHECK(0, "%s: byte %d is %02X at %lld against %02X at %lld", what, i,
+            a->data[i], (long long)a->cycle[i], b->data[i],
+            (long long)b->cycle[i]);
+      break;
+    }
+  }
+}
+
+// Counts bytes in TDR, TDRE polled, interrupts masked
+static void test_flood(void) {
+  static const uint8_t code[] = {
+      0xD6, 0x11,  // ldab TRCSR
+      0xC5, 0x20,  // bitb #TDRE
+      0x27, 0xFA,  // beq  *-4
+      0x4C,        // inca
+      0x97, 0x13,  // staa TDR
+      0x20, 0xF5,  // bra  start
+  };
+  static struct tx_log logs[HOSTIO_ENGINES];
+
+  for (int e = 0; e < HOSTIO_ENGINES; e++) {
+    if (!hostio_boot()) {
+      CHECK(0, "flood: could not initialise the HD6301");
+      return;
+    }
+    hostio_set_runner(hostio_engines[e].run);
+    memcpy(&ram[0x80], code, sizeof(code));
+    regs.pc = 0x80;
+    regs.ccr |= IFLAG;
+    regs.accd.a = 0;
+    iram[RMCR] = 0x05;
+    iram[TRCSR] = TE | TDRE;
+    timer_reload();
+
+    hd6301_stats_reset();
+    // Whole slices, ending before the next byte is due
+    hostio_run((FLOOD_BYTES - 1) * BYTE_CYCLES + 100);
+    struct tx_log* log = &logs[e];
+    log->count = 0;
+    tx_collect(log);
+    CHECK(log->count == FLOOD_BYTES, "flood (%s): %d bytes sent",
+          hostio_engines[e].name, log->count);
+    for (int i = 1; i < log->count; i++) {
+      if (log->data[i] != (uint8_t)(log->data[i - 1] + 1) ||
+          log->cycle[i] - log->cycle[i - 1] != BYTE_CYCLES) {
+        CHECK(0, "flood (%s): byte %d is %02X, %lld cycles after %02X",
+              hostio_engines[e].name, i, log->data[i],
+              (long long)(log->cycle[i] - log->cycle[i - 1]),
+              log->data[i - 1]);
+        break;
+      }
+    }
+#if HD6301_IDLE_SKIP
+    if (e == 1) {
+      CHECK(hd6301_skipped.idle_cycles > (FLOOD_BYTES / 2) * BYTE_CYCLES,
+            "flood: wait for TDRE not fast-forwarded (%lld cycles)",
+            (long long)hd6301_skipped.idle_cycles);
+    }
+#endif
+    hostio_set_runner(NULL);
+    hostio_shutdown();
+  }
+  compare_logs("flood", &logs[0], &logs[1]);
+}
+
+// The ROM's reply to a command, 'expected' bytes starting with 'header'
+static void test_reply(const char* what, uint8_t command, uint8_t header,
+                       int expected) {
+  static struct tx_log logs[HOSTIO_ENGINES];
+
+  for (int e = 0; e < HOSTIO_ENGINES; e++) {
+    if (!hostio_boot()) {
+      CHECK(0, "%s: could not initialise the HD6301", what);
+      return;
+    }
+    hostio_set_runner(hostio_engines[e].run);
+    hostio_run(500 * HOSTIO_CYCLES_PER_MS);  // power-up byte
+    hostio_tx_clear();
+    hostio_rx_put(command);
+    hostio_run(100 * HOSTIO_CYCLES_PER_MS);
+    struct tx_log* log = &logs[e];
+    log->count = 0;
+    tx_collect(log);
+
+    CHECK(log->count == expected && log->data[0] == header,
+          "%s (%s): %d bytes, starting with %02X", what, hostio_engines[e].name,
+          log->count, log->data[0]);
+    // A UART at the same rate, taking a byte every BYTE_CYCLES
+    int64_t uart_free = 0;
+    int most_waiting = 0;
+    for (int i = 0; i < log->count; i++) {
+      int waiting = log->cycle[i] < uart_free ? 1 : 0;
+      if (waiting > most_waiting) most_waiting = waiting;
+      uart_free = (log->cycle[i] > uart_free ? log->cycle[i] : uart_free) +
+                  BYTE_CYCLES;
+      if (i > 0 && log->cycle[i] - log->cycle[i - 1] < BYTE_CYCLES) {
+        CHECK(0, "%s (%s): byte %d only %lld cycles after the previous one",
+              what, hostio_engines[e].name, i,
+              (long long)(log->cycle[i] - log->cycle[i - 1]));
+      }
+    }
+    CHECK(most_waiting == 0, "%s (%s): bytes piled up in the UART", what,
+          hostio_engines[e].name);
+    hostio_set_runner(NULL);
+    hostio_shutdown();
+  }
+  compare_logs(what, &logs[0], &logs[1]);
+}
+
+// Memory load of LOAD_BYTES (to unmapped space, the ROM just counts them),
+// set the time of day, read it back
+static void test_rx_stream(void) {
+  static const uint8_t tod[] = {0x87, 0x06, 0x15, 0x12, 0x34, 0x56};
+  static uint8_t burst[MAX_RX];
+  static int64_t delivered[HOSTIO_ENGINES][MAX_RX];
+  int len = 0, count[HOSTIO_ENGINES] = {0};
+
+  burst[len++] = 0x20;  // memory load
+  burst[len++] = 0x40;
+  burst[len++] = 0x00;
+  burst[len++] = LOAD_BYTES;
+  for (int i = 0; i < LOAD_BYTES; i++) burst[len++] = (uint8_t)(0xA5 ^ i);
+  burst[len++] = 0x1B;  // set time of day
+  memcpy(&burst[len], tod, sizeof(tod));
+  len += sizeof(tod);
+  burst[len++] = 0x1C;  // interrogate time of day
+
+  for (int e = 0; e < HOSTIO_ENGINES; e++) {
+    if (!hostio_boot()) {
+      CHECK(0, "rx stream: could not initialise the HD6301");
+      return;
+    }
+    hostio_set_runner(hostio_engines[e].run);
+    hostio_run(500 * HOSTIO_CYCLES_PER_MS);  // power-up byte
+    hostio_tx_clear();
+    hd6301_stats_reset();
+
+    // All at once, the SCI spaces them
+    for (int i = 0; i < len; i++) {
+      CHECK(hd6301_receive_byte(burst[i]), "rx stream: queue full at %d", i);
+    }
+    int64_t left = (int64_t)len * BYTE_CYCLES + 100 * HOSTIO_CYCLES_PER_MS;
+    while (left > 0 && !crashed) {
+      int64_t ran;
+      int status = hostio_engines[e].run(left, HD6301_EVENT_RX, &ran);
+      left -= ran;
+      if ((status & HD6301_EVENT_RX) && count[e] < MAX_RX) {
+        delivered[e][count[e]++] = sci_rx_last;
+      }
+    }
+    static struct tx_log reply;
+    reply.count = 0;
+    tx_collect(&reply);
+
+    CHECK(!crashed, "rx stream (%s): crashed", hostio_engines[e].name);
+    CHECK(hd6301_stats.rx_overruns == 0, "rx stream (%s): %lld overruns",
+          hostio_engines[e].name, (long long)hd6301_stats.rx_overruns);
+    CHECK(count[e] == len, "rx stream (%s): %d of %d bytes read",
+          hostio_engines[e].name, count[e], len);
+    for (int i = 1; i < count[e]; i++) {
+      int64_t gap = delivered[e][i] - delivered[e][i - 1];
+      if (gap < BYTE_CYCLES) {
+        CHECK(0, "rx stream (%s): byte %d into RDR %lld cycles after the "
+              "previous one", hostio_engines[e].name, i, (long long)gap);
+        break;
+      }
+    }
+    // At the line rate, not held up much longer by the ROM
+    if (count[e] > 1) {
+      int64_t took = delivered[e][count[e] - 1] - delivered[e][0];
+      CHECK(took < (int64_t)(count[e] - 1) * BYTE_CYCLES * 11 / 10,
+            "rx stream (%s): %d bytes took %lld cycles", hostio_engines[e].name,
+            count[e], (long long)took);
+    }
+    // Every byte got through if the time set is the time read
+    CHECK(reply.count == 7 && reply.data[0] == 0xFC &&
+              !memcmp(&reply.data[1], tod, sizeof(tod) - 1) &&
+              (reply.data[6] == tod[5] || reply.data[6] == tod[5] + 1),
+          "rx stream (%s): time of day not read back (%d bytes)",
+          hostio_engines[e].name, reply.count);
+    hostio_set_runner(NULL);
+    hostio_shutdown();
+  }
+  CHECK(count[0] == count[1] &&
+            !memcmp(delivered[0], delivered[1], count[0] * sizeof(int64_t)),
+        "rx stream: bytes went into RDR on different cycles");
+}
+
+// Sets WU and counts its polls of TRCSR until WU clears, interrupts masked.
+// Run in slices of every length in 'slices', the clear has to come after
+// the same number of polls, a byte time after WU was set.
+static void test_wake_up(void) {
+  static const uint8_t code[] = {
+      0x96, 0x11,        // ldaa TRCSR
+      0x8A, 0x01,        // oraa #WU
+      0x97, 0x11,        // staa TRCSR
+      0xCE, 0x00, 0x00,  // ldx  #0
+      0x08,              // inx
+      0xD6, 0x11,        // ldab TRCSR
+      0xC5, 0x01,        // bitb #WU
+      0x26, 0xF9,        // bne  *-7
+      0xDF, 0xA0,        // stx  $A0
+      0x20, 0xFE,        // bra  *
+  };
+  static const int slices[] = {1, 7, 64, 1000, 4 * BYTE_CYCLES};
+  const int poll_cycles = 9;  // inx, ldab, bitb, bne
+  int first_polls = -1;
+
+  for (int e = 0; e < HOSTIO_ENGINES; e++) {
+    for (size_t s = 0; s < sizeof(slices) / sizeof(slices[0]); s++) {
+      if (!hostio_boot()) {
+        CHECK(0, "wake-up: could not initialise the HD6301");
+        return;
+      }
+      hostio_set_runner(hostio_engines[e].run);
+      memcpy(&ram[0x80], code, sizeof(code));
+      ram[0xA0] = ram[0xA1] = 0xFF;
+      regs.pc = 0x80;
+      regs.ccr |= IFLAG;
+      iram[RMCR] = 0x05;
+      iram[TRCSR] = TE | RE | TDRE;
+      timer_reload();
+
+      for (int64_t left = 3 * BYTE_CYCLES; left > 0 && !crashed;) {
+        int64_t ran;
+        hostio_engines[e].run(left < slices[s] ? left : slices[s], 0, &ran);
+        left -= ran;
+      }
+      int polls = ram[0xA0] << 8 | ram[0xA1];
+      CHECK(!(iram[TRCSR] & WU), "wake-up (%s, slices of %d): WU still set",
+            hostio_engines[e].name, slices[s]);
+      CHECK(polls * poll_cycles >= BYTE_CYCLES - poll_cycles &&
+                polls * poll_cycles <= BYTE_CYCLES + poll_cycles,
+            "wake-up (%s, slices of %d): WU cleared after %d polls, a byte "
+            "time is %d",
+            hostio_engines[e].name, slices[s], polls,
+            BYTE_CYCLES / poll_cycles);
+      if (first_polls < 0) first_polls = polls;
+      CHECK(polls == first_polls,
+            "wake-up (%s, slices of %d): %d polls, %d in the first run",
+            hostio_engines[e].name, slices[s], polls, first_polls);
+      hostio_shutdown();
+    }
+  }
+}
+
+int main(void) {
+  test_flood();
+  test_rx_stream();
+  test_wake_up();
+  test_reply("interrogate time of day", 0x1C, 0xFC, 7);
+  test_reply("interrogate joystick", 0x16, 0xFD, 3);
+  return test_result();
+}
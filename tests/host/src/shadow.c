@@ -0,0 +1,281 @@
+/*
+ * Lockstep check of an engine against instr_exec()
+ *
+ * Each stretch is run twice from the same state: by the reference, one
+ * instr_exec() call per instruction, then by the engine under test for the
+ * same number of cycles. Everything the next instructions could depend on
+ * is compared, so the first stretch that differs holds the instruction
+ * that went wrong; it is then run again one instruction at a time to find
+ * it.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "hostio.h"
+#include "instr.h"
+#include "reg.h"
+#include "snapshot.h"
+#include "timer.h"
+
+#define SHADOW_DEFAULT_EVERY 1000
+#define SHADOW_HISTORY 16   // instructions shown before a divergence
+#define SHADOW_MAX_TX 64    // bytes sent in one stretch
+#define SHADOW_MAX_DIFFS 16 // memory locations listed
+
+extern u_char* ram;
+
+struct shadow_state {
+  struct hd6301_snapshot core;
+  hostio_state_t io;
+  int tx_count;
+  uint8_t tx_data[SHADOW_MAX_TX];
+  int64_t tx_cycle[SHADOW_MAX_TX];
+};
+
+static hostio_runner_t engine = hd6301_run_until;
+static int every = SHADOW_DEFAULT_EVERY;
+static bool diverged = false;
+static int64_t checked = 0;
+
+static struct shadow_state start, ref, test;
+
+static struct {
+  uint16_t pc;
+  int opcode;
+  int64_t cycle;
+} history[SHADOW_HISTORY];
+static int64_t history_count = 0;
+
+void hostio_shadow_config(hostio_runner_t run, int n) {
+  engine = run ? run : hd6301_run_until;
+  every = n > 0 ? n : SHADOW_DEFAULT_EVERY;
+  diverged = false;
+  checked = 0;
+  history_count = 0;
+}
+
+bool hostio_shadow_diverged(void) { return diverged; }
+
+int64_t hostio_shadow_checked(void) { return checked; }
+
+static void state_save(struct shadow_state* s, const hostio_state_t* since) {
+  timer_sync();
+  snapshot_save(&s->core);
+  hostio_state_save(&s->io);
+  s->tx_count = since ? hostio_tx_since(since, s->tx_data, s->tx_cycle,
+                                        SHADOW_MAX_TX)
+                      : 0;
+}
+
+static void state_load(const struct shadow_state* s) {
+  snapshot_load(&s->core);
+  hostio_state_load(&s->io);
+}
+
+// Code byte at 'pc' without going through the internal registers
+static int code_byte(uint16_t pc) {
+  if (pc >= 0xF000) return ram[pc - 0xF000 + 256];
+  if (pc >= 0x80 && pc < 0x100) return ram[pc];
+  return -1;
+}
+
+// Up to 'max' instructions as hostio_run_reference() runs them, stopping
+// at cycle 'end' or on one of 'events'. Returns how many were run.
+static int run_reference(int64_t end, int events, int max) {
+#ifdef HD6301_STATS
+  // Only the engine under test counts
+  static struct hd6301_stats stats;
+  stats = hd6301_stats;
+#endif
+  int n = 0;
+  hd6301_run_clocks(0);
+  cpu.events = 0;
+  cpu.event_stop = events;
+  while (n < max && !crashed && cpu.ncycles < end &&
+         !(cpu.events & events)) {
+    if (cpu.state == RUNNING) {
+      int i = (int)(history_count++ % SHADOW_HISTORY);
+      history[i].pc = reg_getpc();
+      history[i].opcode = code_byte(reg_getpc());
+      history[i].cycle = cpu.ncycles;
+    }
+    instr_exec();
+    n++;
+  }
+  cpu.event_stop = 0;
+#ifdef HD6301_STATS
+  hd6301_stats = stats;
+#endif
+  return n;
+}
+
+static void run_engine(const struct shadow_state* target, int events) {
+  int64_t ran;
+  engine(target->core.cpu.ncycles - cpu.ncycles, events, &ran);
+}
+
+#define DIFF(name, field, fmt)                                             \
+  if (a->field != b->field) {                                              \
+    if (print) printf("  %-14s " fmt "  " fmt "\n", name,                  \
+                      (long long)a->field, (long long)b->field);           \
+    n++;                                                                   \
+  }
+
+// Number of differences between the reference and the engine, listed if
+// 'print'
+static int state_diff(const struct shadow_state* ra,
+                      const struct shadow_state* rb, bool print) {
+  const struct hd6301_snapshot* a = &ra->core;
+  const struct hd6301_snapshot* b = &rb->core;
+  int n = 0;
+  if (print) printf("  %-14s %-8s  %s\n", "", "instr", "engine");
+  DIFF("A", regs.accd.a, "%8llX")
+  DIFF("B", regs.accd.b, "%8llX")
+  DIFF("X", regs.ix, "%8llX")
+  DIFF("SP", regs.sp, "%8llX")
+  DIFF("PC", regs.pc, "%8llX")
+  if ((a->regs.ccr | 0xC0) != (b->regs.ccr | 0xC0)) {
+    if (print) printf("  %-14s %8X  %8X\n", "CCR", a->regs.ccr | 0xC0,
+                      b->regs.ccr | 0xC0);
+    n++;
+  }
+  DIFF("cycles", cpu.ncycles, "%8lld")
+  DIFF("SLP/WAI state", cpu.state, "%8lld")
+  DIFF("crashed", crashed, "%8lld")
+  DIFF("tcsr_is_read", tcsr_is_read, "%8lld")
+  DIFF("sci_tx_begin", sci_tx_begin, "%8lld")
+  DIFF("sci_tx_end", sci_tx_end, "%8lld")
+  DIFF("sci_wu_end", sci_wu_end, "%8lld")
+  DIFF("sci_rx_next", sci_rx_next, "%8lld")
+  DIFF("sci_rx_last", sci_rx_last, "%8lld")
+  DIFF("sci_rx_tail", sci_rx_tail, "%8lld")
+  DIFF("kbd_scan", kbd_scan, "%8lld")
+  DIFF("kbd_select", kbd_select, "%8lld")
+  DIFF("mouse_x", mouse_x_counter, "%8llX")
+  DIFF("mouse_y", mouse_y_counter, "%8llX")
+  if (memcmp(a->kbd_level, b->kbd_level, KBD_COLUMNS) ||
+      memcmp(a->kbd_flip, b->kbd_flip, KBD_COLUMNS) ||
+      memcmp(a->kbd_unseen, b->kbd_unseen, KBD_COLUMNS) ||
+      memcmp(a->kbd_read_scan, b->kbd_read_scan, sizeof(a->kbd_read_scan))) {
+    if (print) printf("  key matrix scan state\n");
+    n++;
+  }
+
+  int listed = 0;
+  for (int i = 0; i < NIREGS; i++) {
+    if (a->iram[i] != b->iram[i]) {
+      if (print && listed++ < SHADOW_MAX_DIFFS) {
+        printf("  ireg %02X        %8X  %8X\n", i, a->iram[i], b->iram[i]);
+      }
+      n++;
+    }
+  }
+  for (int i = 0; i < SNAPSHOT_RAM_SIZE; i++) {
+    if (a->ram[i] != b->ram[i]) {
+      if (print && listed++ < SHADOW_MAX_DIFFS) {
+        printf("  mem %04X       %8X  %8X\n", i < 256 ? i : i - 256 + 0xF000,
+               a->ram[i], b->ram[i]);
+      }
+      n++;
+    }
+  }
+
+  if (ra->tx_count != rb->tx_count) {
+    if (print) printf("  %-14s %8d  %8d\n", "bytes sent", ra->tx_count,
+                      rb->tx_count);
+    n++;
+  }
+  for (int i = 0; i < ra->tx_count && i < rb->tx_count; i++) {
+    if (ra->tx_data[i] != rb->tx_data[i] ||
+        ra->tx_cycle[i] != rb->tx_cycle[i]) {
+      if (print) printf("  sent %-9d %02X @%-5lld  %02X @%lld\n", i,
+                        ra->tx_data[i], (long long)ra->tx_cycle[i],
+                        rb->tx_data[i], (long long)rb->tx_cycle[i]);
+      n++;
+    }
+  }
+  const hostio_state_t* ia = &ra->io;
+  const hostio_state_t* ib = &rb->io;
+  if (ia->x_reg != ib->x_reg || ia->y_reg != ib->y_reg ||
+      ia->last_x_cycle != ib->last_x_cycle ||
+      ia->last_y_cycle != ib->last_y_cycle) {
+    if (print) printf("  mouse stand-in state\n");
+    n++;
+  }
+  return n;
+}
+#undef DIFF
+
+static void report(const struct shadow_state* a, const struct shadow_state* b) {
+  printf("shadow: engine diverged from instr_exec() at cycle %lld, after "
+         "%lld instructions checked\n",
+         (long long)a->core.cpu.ncycles, (long long)checked);
+  state_diff(a, b, true);
+  printf("  last instructions (instr_exec):\n");
+  int64_t first =
+      history_count > SHADOW_HISTORY ? history_count - SHADOW_HISTORY : 0;
+  for (int64_t i = first; i < history_count; i++) {
+    const int h = (int)(i % SHADOW_HISTORY);
+    if (history[h].opcode < 0) {
+      printf("    %10lld  %04X  ??\n", (long long)history[h].cycle,
+             history[h].pc);
+    } else {
+      // Mnemonic only, the operand is a format in the opcode table
+      const char* mnemonic = hd6301_opcode_mnemonic(history[h].opcode);
+      printf("    %10lld  %04X  %02X  %.*s\n", (long long)history[h].cycle,
+             history[h].pc, history[h].opcode,
+             (int)strcspn(mnemonic, " "), mnemonic);
+    }
+  }
+}
+
+// The stretch from 'start' differed after 'count' instructions: step it
+// again one instruction at a time, running the engine from the start to
+// each boundary, until the states differ
+static void localize(int count, int events, int64_t history_start) {
+  static struct shadow_state step;
+  history_count = history_start;
+  state_load(&start);
+  for (int i = 1; i <= count; i++) {
+    if (i > 1) state_load(&step);
+    run_reference(start.core.cpu.ncycles + 0x7FFFFFFF, events, 1);
+    state_save(&step, &start.io);
+    ref = step;
+
+    state_load(&start);
+    run_engine(&ref, events);
+    state_save(&test, &start.io);
+    if (state_diff(&ref, &test, false)) break;
+    checked++;
+  }
+  report(&ref, &test);
+}
+
+int hostio_run_shadow(int64_t cycles, int events, int64_t* ran) {
+  int64_t begin = cpu.ncycles;
+  int status = 0;
+
+  while (!crashed && cpu.ncycles - begin < cycles && !status) {
+    int64_t history_start = history_count;
+    state_save(&start, NULL);
+    int n = run_reference(begin + cycles, events, every);
+    if (n == 0) break;
+    status = cpu.events & events;
+    state_save(&ref, &start.io);
+
+    state_load(&start);
+    run_engine(&ref, events);
+    state_save(&test, &start.io);
+    if (state_diff(&ref, &test, false)) {
+      localize(n, events, history_start);
+      diverged = true;
+      crashed = 1;
+      break;
+    }
+    checked += n;
+  }
+  *ran = cpu.ncycles - begin;
+  return status | (crashed ? HD6301_EVENT_CRASH : 0);
+}
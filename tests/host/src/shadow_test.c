@@ -0,0 +1,169 @@
+/*
+ * Lockstep shadow check test
+ *
+ * Runs the IKBD ROM through a command and input script under
+ * hostio_run_shadow(), which checks the engine the core was built with
+ * against instr_exec():
+ *
+ *  - after every instruction for the reset and the first mouse reports,
+ *    then every 97 instructions for the whole script; neither may diverge,
+ *    and the bytes sent have to be those of a run on the engine alone
+ *  - with a runner that corrupts A once a run ends past a given cycle,
+ *    the divergence has to be found, on the first instruction ending
+ *    there, and stop the core
+ *
+ * shadow_test checks the threaded engine, shadow_test_aot the ROM
+ * translated ahead of time and shadow_test_bcache the threaded engine with
+ * the block cache.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "host_test.h"
+#include "hostio.h"
+#include "instr.h"
+#include "reg.h"
+
+#define SCRIPT_STEP_MS 20
+#define SCRIPT_STEPS 150
+#define STEP_BY_STEP_STEPS 10
+#define FAULT_CYCLE 60000
+
+// Commands, keys, mouse movement and the joystick, one step every
+// SCRIPT_STEP_MS
+static void script_step(int step) {
+  static const uint8_t reset[] = {0x80, 0x01};
+  static const uint8_t set_time[] = {0x1B, 0x26, 0x10, 0x17, 0x12, 0x00, 0x00};
+  static const uint8_t get_time[] = {0x1C};
+  static const uint8_t absolute[] = {0x09, 0x01, 0x40, 0x00, 0xC8};
+  static const uint8_t read_absolute[] = {0x0D};
+  static const uint8_t relative[] = {0x08};
+  static const uint8_t joy_interrogate[] = {0x15, 0x16};
+  static const uint8_t joy_events[] = {0x14};
+
+  switch (step) {
+    case 0: hostio_rx_put_buf(reset, sizeof(reset)); break;
+    case 20: hostio_rx_put_buf(set_time, sizeof(set_time)); break;
+    case 30: hostio_rx_put_buf(get_time, sizeof(get_time)); break;
+    case 40: hostio_rx_put_buf(absolute, sizeof(absolute)); break;
+    case 60: hostio_rx_put_buf(read_absolute, sizeof(read_absolute)); break;
+    case 70: hostio_rx_put_buf(relative, sizeof(relative)); break;
+    case 100:
+      hostio_rx_put_buf(joy_interrogate, sizeof(joy_interrogate));
+      break;
+    case 120: hostio_rx_put_buf(joy_events, sizeof(joy_events)); break;
+    default: break;
+  }
+  if (step >= 5) {
+    hostio_set_key(0x1E + step % 8, (step / 2) % 2 == 0);
+    hostio_set_mouse_period(step % 3 ? 900 : -1300, step % 5 ? -700 : 0);
+    hostio_set_mouse_buttons((step / 7) % 2 ? 1 : 0);
+    hostio_set_joystick((step / 9) % 2 ? 0x81 : 0x00);
+  }
+}
+
+static int run_script(hostio_runner_t runner, struct tx_log* log) {
+  memset(log, 0, sizeof(*log));
+  if (!hostio_boot()) {
+    CHECK(0, "could not initialise the HD6301");
+    return 0;
+  }
+  hostio_set_mouse_phase(0x33333333u, 0x33333333u);
+  for (int step = 0; step < SCRIPT_STEPS && !crashed; step++) {
+    if (step == STEP_BY_STEP_STEPS) hostio_shadow_config(NULL, 97);
+    script_step(step);
+    hostio_set_runner(runner);
+    hostio_run((int64_t)SCRIPT_STEP_MS * HOSTIO_CYCLES_PER_MS);
+    tx_collect(log);
+  }
+  hostio_set_runner(NULL);
+  int ok = !crashed;
+  hostio_shutdown();
+  return ok;
+}
+
+static void test_script(void) {
+  static struct tx_log alone, shadow;
+  run_script(hd6301_run_until, &alone);
+
+  hostio_shadow_config(NULL, 1);
+  int ok = run_script(hostio_run_shadow, &shadow);
+  CHECK(ok && !hostio_shadow_diverged(), "script: the engine diverged");
+  CHECK(hostio_shadow_checked() > 100000,
+        "script: only %lld instructions checked",
+        (long long)hostio_shadow_checked());
+  CHECK(alone.count > 50, "script: only %d bytes sent", alone.count);
+  CHECK(alone.count == shadow.count,
+        "script: %d bytes sent alone, %d under the shadow check",
+        alone.count, shadow.count);
+  for (int i = 0; i < alone.count && i < shadow.count; i++) {
+    if (alone.data[i] != shadow.data[i] || alone.cycle[i] != shadow.cycle[i]) {
+      CHECK(0, "script: byte %d is %02X at %lld alone, %02X at %lld", i,
+            alone.data[i], (long long)alone.cycle[i], shadow.data[i],
+            (long long)shadow.cycle[i]);
+      break;
+    }
+  }
+  printf("script: %lld instructions checked, %d bytes sent\n",
+         (long long)hostio_shadow_checked(), shadow.count);
+}
+
+// The engine, with A corrupted once a run ends at FAULT_CYCLE or later
+static int faulty_engine(int64_t cycles, int events, int64_t* ran) {
+  int result = hd6301_run_until(cycles, events, ran);
+  if (cpu.ncycles >= FAULT_CYCLE) regs.accd.a ^= 0x01;
+  return result;
+}
+
+// instr_exec() calls that end before FAULT_CYCLE, counted as
+// hostio_run_shadow() counts them
+static int64_t reference_count;
+
+static int counting_reference(int64_t cycles, int events, int64_t* ran) {
+  int64_t start = cpu.ncycles;
+  hd6301_run_clocks(0);
+  while (!crashed && cpu.ncycles - start < cycles) {
+    instr_exec();
+    if (cpu.ncycles < FAULT_CYCLE) reference_count++;
+  }
+  *ran = cpu.ncycles - start;
+  (void)events;
+  return 0;
+}
+
+static void test_fault(void) {
+  static const uint8_t reset[] = {0x80, 0x01};
+  int64_t run = 2 * FAULT_CYCLE;
+
+  hostio_boot();
+  hostio_rx_put_buf(reset, sizeof(reset));
+  reference_count = 0;
+  hostio_set_runner(counting_reference);
+  hostio_run(run);
+  hostio_shutdown();
+
+  hostio_boot();
+  hostio_rx_put_buf(reset, sizeof(reset));
+  hostio_shadow_config(faulty_engine, 500);
+  hostio_set_runner(hostio_run_shadow);
+  hostio_run(run);
+  hostio_set_runner(NULL);
+  CHECK(hostio_shadow_diverged() && crashed,
+        "fault: not found, %lld instructions checked",
+        (long long)hostio_shadow_checked());
+  CHECK(cpu.ncycles < run, "fault: the core ran on to cycle %lld",
+        (long long)cpu.ncycles);
+  CHECK(hostio_shadow_checked() == reference_count,
+        "fault: found after %lld instructions, not %lld",
+        (long long)hostio_shadow_checked(), (long long)reference_count);
+  hostio_shutdown();
+}
+
+int main(void) {
+  test_script();
+  test_fault();
+  return test_result();
+}
@@ -0,0 +1,269 @@
+/*
+ * Slice length benchmark
+ *
+ * Runs the real IKBD ROM under the core 1 loop of src/main.c, with a
+ * virtual real-time clock instead of the Pico timer, once with the fixed
+ * 1 ms slices the loop used to run and once with adaptive slices. At random
+ * times keys go up and down and the ST sends joystick interrogations, with
+ * a quiet pause now and then.
+ *
+ * The latency measured is how late each byte the 6301 sends reaches the
+ * UART compared with when a real chip would have sent it, i.e. how far
+ * emulated time was behind real time at that point. Core 1 is modelled as
+ * taking a given real time per emulated cycle plus a fixed cost per
+ * wake-up, which gives its busy time.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "hostio.h"
+#include "pacing.h"
+
+#define SLICE_BENCH_DEFAULT_SECONDS 20
+// Core 1 emulating 4 times faster than the real chip
+#define SLICE_BENCH_DEFAULT_NS_PER_CYCLE 250
+#define SLICE_BENCH_DEFAULT_WAKE_NS 2000
+#define SLICE_BENCH_BOOT_US 500000
+// Keys have to stay down long enough for the ROM to scan them
+#define SLICE_BENCH_MIN_GAP_US 20000
+#define SLICE_BENCH_MAX_GAP_US 60000
+// Now and then nobody touches anything for a while
+#define SLICE_BENCH_PAUSE_ONE_IN 20
+#define SLICE_BENCH_PAUSE_US 2000000
+
+// core1_entry() in src/main.c, before and after adaptive slicing
+#define FIXED_SLICE_CYCLES 1000
+#define QUIET_SLICE_CYCLES 1000
+#define ACTIVE_SLICE_CYCLES 200
+#define ACTIVE_HOLD_CYCLES 50000
+#define MAX_BURST_CYCLES 4000
+#define MAX_BACKLOG_CYCLES 100000
+
+#define IKBD_CMD_JOYSTICK_INTERROGATE 0x16
+#define IKBD_JOYSTICK_REPORT 0xFD
+
+static const uint8_t bench_keys[] = {0x1E, 0x30, 0x2E, 0x20, 0x39, 0x1C};
+
+struct samples {
+  int64_t* us;
+  int n;
+  int size;
+};
+
+struct loop {
+  bool adaptive;
+  int ns_per_cycle;
+  int wake_ns;
+
+  pacing_t p;
+  uint64_t now_ns;  // virtual real time
+  uint64_t busy_ns;
+  uint64_t wakeups;
+  uint32_t input_changes;  // hidinput_changes() of the model
+  uint32_t input_seen;
+
+  // Interrogations not answered yet, all should be
+  int unanswered;
+  struct samples bytes;
+};
+
+static int compare_int64(const void* a, const void* b) {
+  int64_t x = *(const int64_t*)a, y = *(const int64_t*)b;
+  return (x > y) - (x < y);
+}
+
+static void usage(const char* name) {
+  printf("Usage: %s [-s seconds] [-c ns] [-w ns]\n", name);
+  printf("  -s  seconds to run each loop for (default %d)\n",
+         SLICE_BENCH_DEFAULT_SECONDS);
+  printf("  -c  real time core 1 takes per emulated cycle (default %d ns)\n",
+         SLICE_BENCH_DEFAULT_NS_PER_CYCLE);
+  printf("  -w  real time core 1 takes per wake-up (default %d ns)\n",
+         SLICE_BENCH_DEFAULT_WAKE_NS);
+}
+
+static void samples_add(struct samples* s, int64_t us) {
+  if (s->n < s->size) {
+    s->us[s->n++] = us;
+  }
+}
+
+// After sorting
+static int64_t samples_percentile(const struct samples* s, int percent) {
+  return s->n ? s->us[(int64_t)s->n * percent / 100] : 0;
+}
+
+static bool loop_activity(const struct loop* l) {
+  return hd6301_sci_busy() || hostio_rx_pending() > 0 ||
+         l->input_changes != l->input_seen;
+}
+
+// Bytes sent during the slice that started at real time 'start_ns', at
+// cycle 'start' and emulated time 'emulated'
+static void loop_collect_tx(struct loop* l, uint64_t start_ns, int64_t start,
+                            uint64_t emulated) {
+  uint8_t data;
+  int64_t cycle;
+  while (hostio_tx_get(&data, &cycle)) {
+    uint64_t sent_ns = start_ns + (cycle - start) * l->ns_per_cycle;
+    uint64_t due_ns = (l->p.base_us + emulated + (cycle - start)) * 1000;
+    samples_add(&l->bytes, ((int64_t)sent_ns - (int64_t)due_ns) / 1000);
+    if (data == IKBD_JOYSTICK_REPORT) l->unanswered--;
+  }
+}
+
+// Core 0: the ST or the user does something at the current time
+static void loop_stimulus(struct loop* l, int step) {
+  if (step % 3 == 2) {
+    l->unanswered++;
+    hostio_rx_put(IKBD_CMD_JOYSTICK_INTERROGATE);
+  } else {
+    // One key down at a time, the ROM ignores ghosting combinations
+    int nkeys = (int)sizeof(bench_keys);
+    int key = step - step / 3;
+    hostio_set_key(bench_keys[key / 2 % nkeys], key % 2 == 0);
+    l->input_changes++;
+  }
+}
+
+// The core 1 loop of src/main.c, until 'end_ns' of virtual time
+static void loop_run(struct loop* l, uint64_t end_ns, bool stimuli) {
+  int step = 0;
+  uint64_t next_stimulus_ns =
+      stimuli ? l->now_ns + SLICE_BENCH_MIN_GAP_US * 1000ull : end_ns;
+  while (l->now_ns < end_ns && !crashed) {
+    if (l->now_ns >= next_stimulus_ns) {
+      loop_stimulus(l, step++);
+      int gap_us = SLICE_BENCH_MIN_GAP_US +
+                   rand() % (SLICE_BENCH_MAX_GAP_US - SLICE_BENCH_MIN_GAP_US);
+      if (rand() % SLICE_BENCH_PAUSE_ONE_IN == 0) {
+        gap_us += SLICE_BENCH_PAUSE_US;
+      }
+      next_stimulus_ns = l->now_ns + 1000ull * gap_us;
+    }
+    // Core 0 queues bytes from the ST for the SCI as they come
+    uint8_t data;
+    while (hd6301_rx_free() > 0 && hostio_rx_get(&data)) {
+      hd6301_receive_byte(data);
+    }
+
+    if (l->adaptive && loop_activity(l)) {
+      l->input_seen = l->input_changes;
+      pacing_activity(&l->p);
+    }
+    uint32_t due = pacing_due(&l->p, l->now_ns / 1000);
+    if (!due) {
+      uint64_t wake_ns = pacing_next_us(&l->p) * 1000;
+      // The adaptive loop is woken up by core 0 as well
+      if (l->adaptive && next_stimulus_ns < wake_ns) {
+        wake_ns = next_stimulus_ns;
+      }
+      l->now_ns = wake_ns > l->now_ns ? wake_ns : l->now_ns;
+      l->now_ns += l->wake_ns;
+      l->busy_ns += l->wake_ns;
+      l->wakeups++;
+      continue;
+    }
+
+    uint64_t start_ns = l->now_ns;
+    int64_t start = cpu.ncycles;
+    int64_t left = due;
+    while (left > 0) {
+      int64_t ran;
+      int status = hd6301_run_until(left, HD6301_EVENT_TX, &ran);
+      left -= ran;
+      if (status & HD6301_EVENT_CRASH) break;
+      if ((status & HD6301_EVENT_TX) && l->adaptive) {
+        pacing_activity(&l->p);
+      }
+    }
+    loop_collect_tx(l, start_ns, start, l->p.emulated);
+    uint64_t run_ns = (uint64_t)(cpu.ncycles - start) * l->ns_per_cycle;
+    l->now_ns += run_ns;
+    l->busy_ns += run_ns;
+    pacing_ran(&l->p, left > 0 ? due : due - left);
+  }
+}
+
+static bool loop_bench(struct loop* l, int seconds) {
+  if (!hostio_boot()) {
+    printf("Failed to allocate the HD6301\n");
+    return false;
+  }
+  srand(1);
+  l->now_ns = 0;
+  pacing_init(&l->p, 0, l->adaptive ? QUIET_SLICE_CYCLES : FIXED_SLICE_CYCLES,
+              MAX_BURST_CYCLES, MAX_BACKLOG_CYCLES);
+  if (l->adaptive) {
+    pacing_set_adaptive(&l->p, ACTIVE_SLICE_CYCLES, ACTIVE_HOLD_CYCLES);
+  }
+
+  // Let the ROM boot and send its power-up byte
+  loop_run(l, SLICE_BENCH_BOOT_US * 1000ull, false);
+  hostio_tx_clear();
+  uint64_t start_ns = l->now_ns;
+  l->busy_ns = 0;
+  l->wakeups = 0;
+  loop_run(l, start_ns + seconds * 1000000000ull, true);
+
+  qsort(l->bytes.us, l->bytes.n, sizeof(int64_t), compare_int64);
+  double elapsed_ns = (double)(l->now_ns - start_ns);
+  printf("%-9s %6d %8lld %8lld %8lld %8.2f%% %10.0f %s\n",
+         l->adaptive ? "adaptive" : "fixed", l->bytes.n,
+         (long long)samples_percentile(&l->bytes, 50),
+         (long long)samples_percentile(&l->bytes, 99),
+         (long long)(l->bytes.n ? l->bytes.us[l->bytes.n - 1] : 0),
+         100.0 * (double)l->busy_ns / elapsed_ns,
+         (double)l->wakeups * 1e9 / elapsed_ns, crashed ? "CRASHED" : "");
+  // The last interrogation may still be on its way
+  bool ok = !crashed && l->bytes.n > 0 && l->unanswered <= 1;
+  hostio_shutdown();
+  return ok;
+}
+
+int main(int argc, char* argv[]) {
+  int seconds = SLICE_BENCH_DEFAULT_SECONDS;
+  int ns_per_cycle = SLICE_BENCH_DEFAULT_NS_PER_CYCLE;
+  int wake_ns = SLICE_BENCH_DEFAULT_WAKE_NS;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      seconds = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      ns_per_cycle = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-w") && i + 1 < argc) {
+      wake_ns = atoi(argv[++i]);
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (seconds <= 0 || ns_per_cycle <= 0 || wake_ns < 0) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  printf("%d s per loop, %d ns per cycle, %d ns per wake-up\n", seconds,
+         ns_per_cycle, wake_ns);
+  printf("%-9s %6s %8s %8s %8s %9s %10s\n", "Slices", "Bytes", "p50 us",
+         "p99 us", "max us", "Busy", "Wakeups/s");
+  int stimuli = seconds * (1000000 / SLICE_BENCH_MIN_GAP_US) + 1;
+  bool ok = true;
+  for (int adaptive = 0; adaptive <= 1; adaptive++) {
+    struct loop l;
+    memset(&l, 0, sizeof(l));
+    l.adaptive = adaptive;
+    l.ns_per_cycle = ns_per_cycle;
+    l.wake_ns = wake_ns;
+    // At most a 3 byte report per stimulus
+    l.bytes.size = 3 * stimuli;
+    l.bytes.us = calloc(l.bytes.size, sizeof(int64_t));
+    if (!l.bytes.us) return 1;
+    if (!loop_bench(&l, seconds)) ok = false;
+    free(l.bytes.us);
+  }
+  return ok ? 0 : 1;
+}
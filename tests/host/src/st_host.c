@@ -0,0 +1,280 @@
+/*
+ * ST side of the serial link on the host: an MC6850 ACIA, the 200 Hz
+ * timer and the core 1 loop running the emulator, on one virtual clock
+ *
+ * Every access the ST makes to the ACIA or the timer takes it some time.
+ * Before the access sees anything, core 1 is brought up to that time, one
+ * step of its loop at a time: either a slice of the length pacing.c asks
+ * for, taking ns_per_cycle per emulated cycle, or a sleep until the next
+ * slice is due or core 0 hands it a byte. A byte takes a frame time on the
+ * line in each direction, from the ACIA's shift register to the Pico's
+ * UART and back.
+ */
+#include "st_host.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "hostio.h"
+#include "ikbd_hw.h"
+#include "pacing.h"
+
+// core1_entry() in src/main.c
+#define QUIET_SLICE_CYCLES 1000
+#define ACTIVE_SLICE_CYCLES 200
+#define ACTIVE_HOLD_CYCLES 50000
+#define MAX_BURST_CYCLES 4000
+#define MAX_BACKLOG_CYCLES 100000
+
+// Time of day core1_entry() seeds, 1 January 1990
+static const uint8_t seed_tod[] = {0x1B, 0x90, 0x01, 0x01, 0x00, 0x00, 0x00};
+
+// The keyboard ACIA is clocked at 500 kHz, /64 gives the IKBD's 7812.5 baud
+#define ACIA_CLOCK_HZ 500000
+#define LINE_BAUD 7812
+#define LINE_FRAME_NS (10ull * 1000000000ull * 64 / ACIA_CLOCK_HZ)
+
+// What an access takes the 68000, E clock synchronisation included
+#define ACIA_ACCESS_NS 2000
+#define HZ200_READ_NS 1000
+
+#define LINE_SIZE 256
+
+// Bytes on the wire, with the time their stop bit is in
+struct line {
+  uint8_t data[LINE_SIZE];
+  uint64_t end_ns[LINE_SIZE];
+  int head, tail;
+  uint64_t free_ns;  // end of the last frame
+  uint64_t bytes;
+};
+
+static st_host_config_t config;
+
+static uint64_t st_ns;     // ST time
+static uint64_t core1_ns;  // time of the next step of core 1
+static bool core1_asleep;
+static pacing_t pacing;
+static struct line to_ikbd, to_st;
+
+// ACIA registers
+static uint8_t acia_control;
+static uint8_t acia_sr;
+static uint8_t acia_rdr;
+static uint64_t tdr_start_ns;  // TDR holds a byte until then
+static uint64_t overruns, tdr_overwrites;
+
+static double wall_start;
+
+static double now_seconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static bool line_empty(const struct line* l) { return l->head == l->tail; }
+
+// Send a byte whose frame starts at 'start_ns' or once the line is free;
+// returns the time it starts
+static uint64_t line_put(struct line* l, uint8_t data, uint64_t start_ns) {
+  int next = (l->head + 1) % LINE_SIZE;
+  if (start_ns < l->free_ns) start_ns = l->free_ns;
+  if (next == l->tail) return start_ns;  // more than the test ever sends
+  l->data[l->head] = data;
+  l->end_ns[l->head] = start_ns + LINE_FRAME_NS;
+  l->free_ns = start_ns + LINE_FRAME_NS;
+  l->head = next;
+  l->bytes++;
+  return start_ns;
+}
+
+// Next byte whose stop bit is in by 'ns'
+static bool line_get(struct line* l, uint64_t ns, uint8_t* data) {
+  if (line_empty(l) || l->end_ns[l->tail] > ns) return false;
+  *data = l->data[l->tail];
+  l->tail = (l->tail + 1) % LINE_SIZE;
+  return true;
+}
+
+// The ACIA is in step with the IKBD: /64, 8 data bits, no parity, 1 stop
+static bool acia_format_ok(void) {
+  return (acia_control & ACIA_CR_DIVIDE_MASK) == 0x02 &&
+         (acia_control & ACIA_CR_WORD_MASK) == ACIA_CR_WORD_8N1;
+}
+
+static bool acia_in_reset(void) {
+  return (acia_control & ACIA_CR_DIVIDE_MASK) == ACIA_CR_DIVIDE_MASK;
+}
+
+// --- Core 1 ---
+
+static void core1_step(void) {
+  // Core 0 hands over the bytes from the ST as the UART gets them
+  bool received = false;
+  uint8_t data;
+  while (hd6301_rx_free() > 0 && line_get(&to_ikbd, core1_ns, &data)) {
+    hd6301_receive_byte(data);
+    received = true;
+  }
+  if (received || hd6301_sci_busy()) pacing_activity(&pacing);
+
+  uint32_t due = pacing_due(&pacing, core1_ns / 1000);
+  if (!due) {
+    uint64_t wake_ns = pacing_next_us(&pacing) * 1000;
+    if (!line_empty(&to_ikbd) && to_ikbd.end_ns[to_ikbd.tail] < wake_ns) {
+      wake_ns = to_ikbd.end_ns[to_ikbd.tail];
+    }
+    core1_ns = (wake_ns > core1_ns ? wake_ns : core1_ns) + config.wake_ns;
+    core1_asleep = true;
+    return;
+  }
+  core1_asleep = false;
+
+  int64_t start = cpu.ncycles;
+  int64_t left = due;
+  while (left > 0) {
+    int64_t ran;
+    int status = hd6301_run_until(left, HD6301_EVENT_TX, &ran);
+    left -= ran;
+    if (status & HD6301_EVENT_CRASH) break;
+    if (status & HD6301_EVENT_TX) pacing_activity(&pacing);
+  }
+  // serialp_tx_pump(): each byte goes to the UART when the SCI sends it
+  int64_t cycle;
+  while (hostio_tx_get(&data, &cycle)) {
+    int64_t offset = cycle > start ? cycle - start : 0;
+    line_put(&to_st, data, core1_ns + (uint64_t)offset * config.ns_per_cycle);
+  }
+  core1_ns += (uint64_t)(cpu.ncycles - start) * config.ns_per_cycle;
+  pacing_ran(&pacing, left > 0 ? due : due - left);
+}
+
+// --- ST ---
+
+// Let the ST spend 'ns', then take in what reached the ACIA meanwhile
+static void st_spend(uint64_t ns) {
+  st_ns += ns;
+  while (core1_ns <= st_ns) core1_step();
+
+  uint8_t data;
+  while (line_get(&to_st, st_ns, &data)) {
+    if (acia_in_reset()) continue;
+    if (acia_sr & ACIA_SR_RDRF) {
+      acia_sr |= ACIA_SR_OVRN;  // the new byte is lost
+      overruns++;
+      continue;
+    }
+    acia_rdr = data;
+    acia_sr |= ACIA_SR_RDRF;
+    if (!acia_format_ok()) acia_sr |= ACIA_SR_FE;
+  }
+}
+
+uint8_t acia_status(void) {
+  st_spend(ACIA_ACCESS_NS);
+  if (acia_in_reset()) return 0;
+  uint8_t sr = acia_sr;
+  if (st_ns >= tdr_start_ns) sr |= ACIA_SR_TDRE;
+  if ((acia_control & ACIA_CR_RIE) &&
+      (sr & (ACIA_SR_RDRF | ACIA_SR_OVRN))) {
+    sr |= ACIA_SR_IRQ;
+  }
+  return sr;
+}
+
+uint8_t acia_read_data(void) {
+  st_spend(ACIA_ACCESS_NS);
+  acia_sr &= ~(ACIA_SR_RDRF | ACIA_SR_OVRN | ACIA_SR_FE);
+  return acia_rdr;
+}
+
+void acia_write_control(uint8_t value) {
+  st_spend(ACIA_ACCESS_NS);
+  acia_control = value;
+  if (acia_in_reset()) {
+    acia_sr = 0;
+    tdr_start_ns = 0;
+  }
+}
+
+void acia_write_data(uint8_t value) {
+  st_spend(ACIA_ACCESS_NS);
+  if (acia_in_reset() || !acia_format_ok()) return;  // garbage to the IKBD
+  if (st_ns < tdr_start_ns) {
+    // TDR still full: the byte waiting in it is replaced
+    to_ikbd.data[(to_ikbd.head + LINE_SIZE - 1) % LINE_SIZE] = value;
+    tdr_overwrites++;
+    return;
+  }
+  tdr_start_ns = line_put(&to_ikbd, value, st_ns);
+  // Core 0 wakes core 1 up when the byte is in
+  uint64_t in_ns = to_ikbd.end_ns[(to_ikbd.head + LINE_SIZE - 1) % LINE_SIZE];
+  if (core1_asleep && in_ns + config.wake_ns < core1_ns) {
+    core1_ns = in_ns + config.wake_ns;
+  }
+}
+
+uint32_t read_hz200(void) {
+  st_spend(HZ200_READ_NS);
+  uint64_t us = st_ns / 1000;
+  return (uint32_t)(us * (uint64_t)(1000000 + config.hz200_ppm) /
+                    5000000000ull);
+}
+
+// --- Driver ---
+
+bool st_host_boot(const st_host_config_t* c) {
+  config = *c;
+  if (!hostio_boot()) return false;
+
+  st_ns = 0;
+  core1_ns = 0;
+  core1_asleep = false;
+  memset(&to_ikbd, 0, sizeof(to_ikbd));
+  memset(&to_st, 0, sizeof(to_st));
+  acia_control = IKBD_ACIA_CTRL_TOS_LIKE;
+  acia_sr = 0;
+  acia_rdr = 0;
+  tdr_start_ns = 0;
+  overruns = tdr_overwrites = 0;
+
+  // Straight from core 0, not on the line
+  for (size_t i = 0; i < sizeof(seed_tod); i++) {
+    to_ikbd.data[to_ikbd.head] = seed_tod[i];
+    to_ikbd.end_ns[to_ikbd.head] = 0;
+    to_ikbd.head++;
+  }
+  pacing_init(&pacing, 0, QUIET_SLICE_CYCLES, MAX_BURST_CYCLES,
+              MAX_BACKLOG_CYCLES);
+  pacing_set_adaptive(&pacing, ACTIVE_SLICE_CYCLES, ACTIVE_HOLD_CYCLES);
+  wall_start = now_seconds();
+  return true;
+}
+
+void st_host_shutdown(void) { hostio_shutdown(); }
+
+void st_host_wait(uint64_t us) {
+  uint64_t end = st_ns + us * 1000;
+  while (st_ns < end) st_spend(ACIA_ACCESS_NS);
+}
+
+void st_host_report(void) {
+  double wall = now_seconds() - wall_start;
+  double emulated = (double)st_ns / 1e9;
+  printf("ST time         : %.3f s, in %.3f s (%.0fx real time)\n", emulated,
+         wall, wall > 0 ? emulated / wall : 0.0);
+  printf("Line            : %d baud, %llu bytes to the IKBD, %llu back\n",
+         LINE_BAUD, (unsigned long long)to_ikbd.bytes,
+         (unsigned long long)to_st.bytes);
+  printf("ACIA            : %llu overruns, %llu bytes written over TDR\n",
+         (unsigned long long)overruns, (unsigned long long)tdr_overwrites);
+  printf("Core 1          : %d ns/cycle, %llu slices (%llu short), %llu "
+         "cycles dropped, %u us behind at most\n",
+         config.ns_per_cycle, (unsigned long long)pacing.slices,
+         (unsigned long long)pacing.short_slices,
+         (unsigned long long)pacing.dropped_cycles, pacing.max_slip);
+  if (crashed) printf("CPU crashed at cycle %lld\n", (long long)cpu.ncycles);
+}
@@ -0,0 +1,110 @@
+/*
+ * Atari ST timing tests on the host
+ *
+ * Runs tests/atarist/src/timing_tests.c, the source the ST build uses,
+ * against the emulator: its ACIA and 200 Hz timer accesses go to the
+ * models of st_host.c, the IKBD is the ROM run by the core 1 loop with
+ * real-time pacing. Checks, as on a real ST, that a reset is answered
+ * within 300 ms, that the time of day reads back as BCD and that it drifts
+ * by 10 ticks of 5 ms at most over 60 s, in well under a second.
+ *
+ * Usage: st_timing [-c ns] [-w ns] [-p ppm]
+ *   -c  real time core 1 takes per emulated cycle (default 250 ns); above
+ *       1000 it cannot keep up and the time of day falls behind
+ *   -w  real time core 1 takes per wake-up (default 2000 ns)
+ *   -p  error of the ST's 200 Hz timer, in parts per million (default 0)
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "st_host.h"
+#include "test_runner.h"
+#include "timing_tests.h"
+
+#define ST_DEFAULT_NS_PER_CYCLE 250
+#define ST_DEFAULT_WAKE_NS 2000
+// TOS has long set the time of day when a program can run
+#define ST_BOOT_US 1000000
+
+static int failures = 0;
+
+// --- test_runner.h, the screen being stdout ---
+
+void print(const char* fmt, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  va_end(args);
+  // The progress spinner is for a screen
+  if (strchr(buffer, '\b')) return;
+  for (char* p = buffer; *p; p++) {
+    if (*p != '\r') putchar(*p);
+  }
+}
+
+void open_log(void) {}
+
+void close_log(void) {}
+
+void assert_result(const char* test, int result, int expected) {
+  if (result == expected) {
+    print("[ OK ] %s\r\n", test);
+  } else {
+    print("[FAIL] %s (R: %d, E: %d)\r\n", test, result, expected);
+    failures++;
+  }
+}
+
+void press_key(char* message) { (void)message; }
+
+static void usage(const char* name) {
+  printf("Usage: %s [-c ns] [-w ns] [-p ppm]\n", name);
+  printf("  -c  real time core 1 takes per emulated cycle (default %d ns)\n",
+         ST_DEFAULT_NS_PER_CYCLE);
+  printf("  -w  real time core 1 takes per wake-up (default %d ns)\n",
+         ST_DEFAULT_WAKE_NS);
+  printf("  -p  error of the ST's 200 Hz timer, in ppm (default 0)\n");
+}
+
+int main(int argc, char* argv[]) {
+  st_host_config_t config = {
+      .ns_per_cycle = ST_DEFAULT_NS_PER_CYCLE,
+      .wake_ns = ST_DEFAULT_WAKE_NS,
+      .hz200_ppm = 0,
+  };
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      config.ns_per_cycle = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-w") && i + 1 < argc) {
+      config.wake_ns = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+      config.hz200_ppm = atoi(argv[++i]);
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (config.ns_per_cycle <= 0 || config.wake_ns < 0) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  if (!st_host_boot(&config)) {
+    printf("Failed to initialise HD6301\n");
+    return 1;
+  }
+  st_host_wait(ST_BOOT_US);
+  run_timing_tests(FALSE);
+  st_host_report();
+  st_host_shutdown();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("st_timing: all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,280 @@
+/*
+ * HD6301 instruction timing test
+ *
+ * Checks the cycle counts of the core against the data sheet figures in
+ * hd6301v1_timing.txt, on the reference engine (instr_exec) and the one
+ * the core was built with (dispatch_run):
+ *
+ *  - every opcode, in internal RAM, with each combination of the N, Z,
+ *    V and C flags so that branches are seen both taken and not taken;
+ *    the PC has to end up past the bytes the table gives, unless the
+ *    instruction jumps
+ *  - the interrupt sequence, on its own and when the timer's request
+ *    comes in at each cycle of an instruction, which has to finish first
+ *  - the way out of WAI and SLP
+ *
+ * Usage: timing_test <table>
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "chip.h"
+#include "cpu.h"
+#include "dispatch.h"
+#include "host_test.h"
+#include "hostio.h"
+#include "instr.h"
+#include "ireg.h"
+#include "optab.h"
+#include "reg.h"
+#include "timer.h"
+
+#define CODE 0x80    // where the instruction under test goes
+#define DATA 0xA0    // its memory operand
+#define STACK 0xF0
+#define MAX_STEPS 64
+#define ROM 0xF000   // ram + 256 on, as allocated by mem_init()
+
+extern u_char* ram;
+
+struct timing {
+  int defined;  // a line for this opcode was read
+  char mnemonic[8];
+  char mode[8];
+  int bytes;  // 0 for undefined opcodes
+  int cycles;
+};
+
+static struct timing timing[256];
+static int interrupt_cycles = -1, wai_wake_cycles = -1, slp_wake_cycles = -1;
+
+enum engine { ENGINE_REFERENCE, ENGINE_BUILT, ENGINES };
+static const char* const engine_name[ENGINES] = {"reference", "built-in"};
+
+static int read_table(const char* path) {
+  char line[256], name[32], mnemonic[8], mode[8], bytes[8];
+  int op, cycles, lines = 0;
+  FILE* f = fopen(path, "r");
+
+  if (!f) {
+    perror(path);
+    return 0;
+  }
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#' || line[0] == '\n') continue;
+    lines++;
+    if (sscanf(line, "%x %7s %7s %7s %d", &op, mnemonic, mode, bytes,
+               &cycles) == 5 &&
+        op >= 0 && op < 256) {
+      CHECK(!timing[op].defined, "table: opcode %02X twice", op);
+      timing[op].defined = 1;
+      strcpy(timing[op].mnemonic, mnemonic);
+      strcpy(timing[op].mode, mode);
+      timing[op].bytes = strcmp(mode, "-") ? atoi(bytes) : 0;
+      timing[op].cycles = cycles;
+    } else if (sscanf(line, "%31s %d", name, &cycles) == 2) {
+      if (!strcmp(name, "interrupt")) {
+        interrupt_cycles = cycles;
+      } else if (!strcmp(name, "wai-wake")) {
+        wai_wake_cycles = cycles;
+      } else if (!strcmp(name, "slp-wake")) {
+        slp_wake_cycles = cycles;
+      } else {
+        CHECK(0, "table: unknown line '%s'", name);
+      }
+    } else {
+      CHECK(0, "table: can't read line %d", lines);
+    }
+  }
+  fclose(f);
+  for (op = 0; op < 256; op++) {
+    CHECK(timing[op].defined, "table: no line for opcode %02X", op);
+  }
+  CHECK(interrupt_cycles >= 0 && wai_wake_cycles >= 0 && slp_wake_cycles >= 0,
+        "table: an event is missing");
+  return !failures;
+}
+
+// One instruction, or one cycle of waiting after SLP or WAI, or the entry
+// into an interrupt handler. Returns the cycles it took.
+static int step(enum engine engine) {
+  COUNTER_VAR start = cpu.ncycles;
+
+  crashed = 0;
+  if (engine == ENGINE_REFERENCE)
+    instr_exec();
+  else
+    dispatch_run(1);
+  return (int)(cpu.ncycles - start);
+}
+
+// Registers and memory for an instruction at CODE, interrupts masked and
+// the timer out of the way. Operands point at DATA in every mode, return
+// addresses on the stack at CODE.
+static void setup(int op, int flags) {
+  static const u_char stacked[] = {0xD0, 0x00, 0x00, 0x00,
+                                   DATA, CODE >> 8, CODE & 0xFF};
+  const char* mode = timing[op].mode;
+
+  memset(&ram[0x80], 0, 0x80);
+  memcpy(&ram[STACK + 1], stacked, sizeof(stacked));
+  ram[CODE] = (u_char)op;
+  if (!strcmp(mode, "dir")) {
+    if (timing[op].bytes == 3) {  // aim/oim/eim/tim: mask, then address
+      ram[CODE + 1] = 0x55;
+      ram[CODE + 2] = DATA;
+    } else {
+      ram[CODE + 1] = DATA;
+    }
+  } else if (!strcmp(mode, "ind")) {
+    if (timing[op].bytes == 3) {
+      ram[CODE + 1] = 0x55;
+      ram[CODE + 2] = DATA - 0x90;
+    } else {
+      ram[CODE + 1] = DATA - 0x90;
+    }
+  } else if (!strcmp(mode, "ext")) {
+    ram[CODE + 1] = 0x00;
+    ram[CODE + 2] = DATA;
+  } else if (!strcmp(mode, "imm")) {
+    ram[CODE + 1] = 0x12;
+    ram[CODE + 2] = 0x34;
+  }  // rel: offset 0, taken or not the next instruction is the same
+  ram[DATA] = 0x81;
+  ram[DATA + 1] = 0x42;
+
+  regs.accd.a = 0x5A;
+  regs.accd.b = 0x3C;
+  regs.ix = 0x90;
+  regs.sp = STACK;
+  regs.pc = CODE;
+  regs.ccr = 0xC0 | IFLAG | flags;
+  cpu_start();
+  iram[TCSR] = 0;
+  iram[TRCSR] = TDRE;
+  timer_reload();
+}
+
+// Opcodes that move the PC somewhere else than the next instruction
+static int jumps(int op) {
+  return !timing[op].bytes || op == 0x39 || op == 0x3B || op == 0x3F ||
+         op == 0x6E || op == 0x7E || op == 0x9D || op == 0xAD || op == 0xBD;
+}
+
+static void test_opcodes(enum engine engine) {
+  for (int op = 0; op < 256; op++) {
+    for (int flags = 0; flags < 16; flags++) {  // N, Z, V, C
+      setup(op, flags);
+      int cycles = step(engine);
+      if (cycles != timing[op].cycles) {
+        CHECK(0, "%s: %02X %s %s takes %d cycles (optab.c %d), table %d",
+              engine_name[engine], op, timing[op].mnemonic, timing[op].mode,
+              cycles, opcodetab[op].op_n_cycles, timing[op].cycles);
+        break;
+      }
+      if (!jumps(op) && reg_getpc() != CODE + timing[op].bytes) {
+        CHECK(0, "%s: %02X %s %s ends at %04X, table %d bytes",
+              engine_name[engine], op, timing[op].mnemonic, timing[op].mode,
+              reg_getpc(), timing[op].bytes);
+        break;
+      }
+    }
+  }
+}
+
+// The timer's output compare request 'delay' cycles from now, with the
+// interrupt enabled
+static void request_in(int delay) {
+  timer_sync();
+  u_int ocr = (ireg_getw(FRC) + delay) & 0xFFFF;
+  iram[OCR] = ocr >> 8;
+  iram[OCR + 1] = ocr & 0xFF;
+  iram[TCSR] = EOCI;
+  timer_reload();
+}
+
+// Steps until the first instruction of the timer's handler, returns the
+// cycles from 'start', or -1 if it was never reached
+static int run_to_handler(enum engine engine, COUNTER_VAR start) {
+  const u_char* vector = &ram[256 + OCFVECTOR - ROM];
+  u_int handler = (vector[0] << 8) | vector[1];
+
+  for (int i = 0; i < MAX_STEPS; i++) {
+    step(engine);
+    if (reg_getpc() == handler) return (int)(cpu.ncycles - start);
+  }
+  return -1;
+}
+
+static void test_interrupts(enum engine engine) {
+  const int mul = timing[0x3D].cycles;
+
+  // a request already waiting: nothing but the interrupt sequence
+  setup(0x01, 0);
+  regs.ccr &= ~IFLAG;
+  request_in(1);
+  step(engine);  // nop, the request comes in
+  COUNTER_VAR start = cpu.ncycles;
+  int cycles = run_to_handler(engine, start);
+  CHECK(cycles == interrupt_cycles, "%s: interrupt takes %d cycles, table %d",
+        engine_name[engine], cycles, interrupt_cycles);
+  CHECK(reg_getsp() == STACK - 7, "%s: interrupt stacked %d bytes",
+        engine_name[engine], STACK - reg_getsp());
+
+  // the request at each cycle of a mul: it finishes first
+  for (int delay = 1; delay <= 2 * mul; delay++) {
+    setup(0x3D, 0);
+    memset(&ram[CODE], 0x3D, 4);
+    regs.ccr &= ~IFLAG;
+    start = cpu.ncycles;
+    request_in(delay);
+    int expected = (delay + mul - 1) / mul * mul + interrupt_cycles;
+    cycles = run_to_handler(engine, start);
+    CHECK(cycles == expected,
+          "%s: request %d cycles into mul, handler after %d cycles, "
+          "expected %d",
+          engine_name[engine], delay, cycles, expected);
+  }
+
+  // out of WAI and SLP, the request after the instruction
+  for (int delay = 20; delay <= 22; delay++) {
+    setup(0x3E, 0);
+    regs.ccr &= ~IFLAG;
+    start = cpu.ncycles;
+    request_in(delay);
+    cycles = run_to_handler(engine, start);
+    CHECK(cycles == delay + wai_wake_cycles,
+          "%s: out of WAI %d cycles after the request, table %d",
+          engine_name[engine], cycles - delay, wai_wake_cycles);
+
+    setup(0x1A, 0);
+    regs.ccr &= ~IFLAG;
+    start = cpu.ncycles;
+    request_in(delay);
+    cycles = run_to_handler(engine, start);
+    CHECK(cycles == delay + slp_wake_cycles,
+          "%s: out of SLP %d cycles after the request, table %d",
+          engine_name[engine], cycles - delay, slp_wake_cycles);
+  }
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    printf("Usage: %s <table>\n", argv[0]);
+    return 2;
+  }
+  if (!read_table(argv[1])) return 1;
+  if (!hostio_boot()) {
+    printf("Failed to initialise HD6301\n");
+    return 1;
+  }
+  for (int engine = 0; engine < ENGINES; engine++) {
+    test_opcodes(engine);
+    test_interrupts(engine);
+  }
+  hostio_shutdown();
+
+  return test_result();
+}
@@ -0,0 +1,402 @@
+/*
+ * Record/replay trace format test
+ *
+ * Checks the encoding of src/include/trace.h: every event type through
+ * trace_encode() and trace_decode(), negative deltas and the largest
+ * values, records cut short, and the TRACE_LOST event of a full ring.
+ *
+ * Then records a session on the host build of the core, the way capture.c
+ * does on the device: the mouse phase, key, button, joystick and mouse
+ * changes at slice boundaries, the bytes from the ST with the cycle they
+ * went into RDR, and the bytes sent with the cycle of their start bit. One
+ * byte from the ST is queued in the middle of a run, as core 0 does while
+ * core 1 runs, which only the cycle it went in at replays right. The trace
+ * goes to the first argument in
+ * the binary encoding and to the second as a log of debug output with
+ * "IKTR" lines among others, for ikbd_replay to check both (the replay
+ * and replay_log tests).
+ *
+ * Usage: trace_test [<binary trace> <log>]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "cpu.h"
+#include "host_test.h"
+#include "hostio.h"
+#include "trace.h"
+
+#define MS HOSTIO_CYCLES_PER_MS
+#define MAX_EVENTS 4096
+#define LOG_LINE_BYTES 23  // odd, so records are split across lines
+
+static bool same_event(const trace_event_t* a, const trace_event_t* b) {
+  uint8_t fields = trace_fields[a->type];
+  return a->type == b->type && a->cycle == b->cycle &&
+         a->time_us == b->time_us &&
+         (!(fields & TRACE_CODE) || a->code == b->code) &&
+         (!(fields & TRACE_VALUE) || a->value == b->value) &&
+         (!(fields & TRACE_X) || a->x == b->x) &&
+         (!(fields & TRACE_Y) || a->y == b->y) &&
+         (!(fields & TRACE_DATA) ||
+          (a->len == b->len && !memcmp(a->data, b->data, a->len)));
+}
+
+static void test_codec(void) {
+  trace_event_t events[2 * TRACE_TYPES];
+  int n = 0;
+
+  // One of each type, then one of each again going back in time, with the
+  // largest fields
+  for (int pass = 0; pass < 2; pass++) {
+    for (int type = 0; type < TRACE_TYPES; type++) {
+      trace_event_t* ev = &events[n++];
+      memset(ev, 0, sizeof(*ev));
+      ev->type = (uint8_t)type;
+      if (!pass) {
+        ev->cycle = 1000u * (type + 1);
+        ev->time_us = 7u * (type + 1);
+        ev->code = (uint8_t)(0x10 + type);
+        ev->value = (uint8_t)(0x80 | type);
+        ev->x = -type;
+        ev->y = 1000 * type;
+        ev->len = (uint8_t)(type % 4);
+      } else {
+        ev->cycle = type & 1 ? UINT64_MAX - type : 5000u - type;
+        ev->time_us = type & 1 ? 0 : UINT64_MAX;
+        ev->code = 0xFF;
+        ev->value = 0xFF;
+        ev->x = type & 1 ? INT32_MIN : INT32_MAX;
+        ev->y = type & 1 ? INT32_MAX : INT32_MIN;
+        ev->len = TRACE_MAX_DATA;
+      }
+      for (int i = 0; i < ev->len; i++) ev->data[i] = (uint8_t)(type * 16 + i);
+    }
+  }
+
+  uint8_t buf[2 * TRACE_TYPES * TRACE_MAX_RECORD];
+  size_t len = 0;
+  trace_codec_t enc, dec;
+  trace_codec_init(&enc);
+  for (int i = 0; i < n; i++) {
+    size_t k = trace_encode(&enc, &events[i], buf + len);
+    CHECK(k > 0 && k <= TRACE_MAX_RECORD, "record %d: %zu bytes", i, k);
+    len += k;
+  }
+
+  trace_codec_init(&dec);
+  size_t pos = 0;
+  for (int i = 0; i < n; i++) {
+    trace_event_t ev;
+    size_t k = trace_decode(&dec, buf + pos, len - pos, &ev);
+    CHECK(k > 0, "record %d: not decoded", i);
+    if (!k) return;
+    CHECK(same_event(&ev, &events[i]), "record %d (type %d): decoded wrong",
+          i, events[i].type);
+    pos += k;
+  }
+  CHECK(pos == len, "%zu bytes decoded of %zu", pos, len);
+
+  // Every prefix of a record is cut short
+  for (int i = 0; i < n; i++) {
+    trace_codec_t c;
+    trace_codec_init(&c);
+    uint8_t rec[TRACE_MAX_RECORD];
+    size_t k = trace_encode(&c, &events[i], rec);
+    for (size_t cut = 0; cut < k; cut++) {
+      trace_event_t ev;
+      trace_codec_init(&c);
+      CHECK(!trace_decode(&c, rec, cut, &ev),
+            "record %d: %zu of %zu bytes decoded", i, cut, k);
+    }
+  }
+
+  // Unknown type, data longer than an event holds, varint too long
+  trace_event_t ev;
+  trace_codec_t c;
+  const uint8_t bad_type[] = {TRACE_TYPES, 0, 0};
+  const uint8_t bad_len[] = {TRACE_USB_REPORT, 0, 0, 0, TRACE_MAX_DATA + 1};
+  uint8_t bad_varint[12] = {TRACE_RX};
+  memset(bad_varint + 1, 0x80, 11);
+  trace_codec_init(&c);
+  CHECK(!trace_decode(&c, bad_type, sizeof(bad_type), &ev), "unknown type");
+  CHECK(!trace_decode(&c, bad_len, sizeof(bad_len), &ev), "data too long");
+  CHECK(!trace_decode(&c, bad_varint, sizeof(bad_varint), &ev),
+        "varint too long");
+
+  uint8_t header[TRACE_HEADER_SIZE];
+  CHECK(trace_write_header(header) == TRACE_HEADER_SIZE, "header size");
+  CHECK(trace_read_header(header, sizeof(header)) == TRACE_HEADER_SIZE,
+        "header not read back");
+  CHECK(!trace_read_header(header, sizeof(header) - 1), "short header read");
+  header[4]++;
+  CHECK(!trace_read_header(header, sizeof(header)), "other version read");
+}
+
+static void test_ring(void) {
+  static trace_ring_t ring;
+  trace_event_t ev = {.type = TRACE_RX};
+  int pushed = TRACE_RING_SIZE + 10;
+
+  trace_ring_init(&ring);
+  for (int i = 0; i < pushed; i++) {
+    ev.cycle = (uint64_t)i;
+    trace_ring_push(&ring, &ev);
+  }
+  // Make room for two: the LOST event and the next one
+  trace_event_t out;
+  for (int i = 0; i < 2; i++) {
+    CHECK(trace_ring_peek(&ring, &out) && out.cycle == (uint64_t)i,
+          "ring event %d", i);
+    trace_ring_pop(&ring);
+  }
+  ev.cycle = 1000;
+  trace_ring_push(&ring, &ev);
+
+  int count = 0;
+  while (trace_ring_peek(&ring, &out)) {
+    trace_ring_pop(&ring);
+    count++;
+    if (count == TRACE_RING_SIZE - 1) {
+      CHECK(out.type == TRACE_LOST && out.x == pushed - TRACE_RING_SIZE &&
+                out.cycle == 1000,
+            "LOST event: type %d, %ld lost at %llu", out.type, (long)out.x,
+            (unsigned long long)out.cycle);
+    }
+  }
+  CHECK(count == TRACE_RING_SIZE, "%d events in the ring", count);
+  CHECK(out.type == TRACE_RX && out.cycle == 1000, "last event");
+}
+
+// Recording of a session
+static trace_event_t session[MAX_EVENTS];
+static int n_session = 0;
+
+static void record(uint8_t type, uint8_t code, uint8_t value, int32_t x,
+                   int32_t y) {
+  if (n_session == MAX_EVENTS) return;
+  trace_event_t* ev = &session[n_session++];
+  memset(ev, 0, sizeof(*ev));
+  ev->cycle = (uint64_t)cpu.ncycles;
+  ev->time_us = ev->cycle;  // 1 MHz
+  ev->type = type;
+  ev->code = code;
+  ev->value = value;
+  ev->x = x;
+  ev->y = y;
+}
+
+static void record_sent(void) {
+  uint8_t data;
+  int64_t cycle;
+  while (hostio_tx_get(&data, &cycle) && n_session < MAX_EVENTS) {
+    record(TRACE_TX, data, 0, 0, 0);
+    session[n_session - 1].cycle = (uint64_t)cycle;
+    session[n_session - 1].time_us = (uint64_t)cycle;
+  }
+}
+
+static void record_taken(void) {
+  uint8_t data;
+  int64_t cycle;
+  while (hostio_rx_taken(&data, &cycle) && n_session < MAX_EVENTS) {
+    record(TRACE_RX, data, 0, 0, 0);
+    session[n_session - 1].cycle = (uint64_t)cycle;
+    session[n_session - 1].time_us = (uint64_t)cycle;
+  }
+}
+
+static void rx(uint8_t data) { hd6301_receive_byte(data); }
+
+// Time of day again, queued in the middle of a run as core 0 does while
+// core 1 runs: it goes into RDR at the next slice, and the reply follows
+#define MID_RUN_CYCLE (730 * MS + HOSTIO_CYCLES_PER_SLICE / 2)
+static int64_t queued = -1;
+
+static void mid_run(int64_t cycle) {
+  if (queued < 0 && cycle >= MID_RUN_CYCLE) {
+    queued = cycle;
+    rx(0x1C);
+  }
+}
+
+// What happens at each ms of the session, applied at the first slice
+// boundary at or after it
+static void script(int ms) {
+  static const uint8_t report[] = {0x00, 0x00, 0x04, 0, 0, 0, 0, 0};
+  switch (ms) {
+    case 50:  // reset
+      rx(0x80);
+      rx(0x01);
+      break;
+    case 200:  // 'A', with the USB report it came from
+      record(TRACE_USB_REPORT, 1, 0, 0, 0);
+      session[n_session - 1].len = sizeof(report);
+      memcpy(session[n_session - 1].data, report, sizeof(report));
+      record(TRACE_KEY, 0x1E, 1, 0, 0);
+      hostio_set_key(0x1E, true);
+      break;
+    case 260:
+      record(TRACE_KEY, 0x1E, 0, 0, 0);
+      hostio_set_key(0x1E, false);
+      break;
+    case 300:
+      record(TRACE_MOUSE, 0, 0, 600, -900);
+      hostio_set_mouse_period(600, -900);
+      break;
+    case 340:
+      record(TRACE_MOUSE, 0, 0, -1500, 0);
+      hostio_set_mouse_period(-1500, 0);
+      break;
+    case 380:
+      record(TRACE_MOUSE, 0, 0, 0, 0);
+      hostio_set_mouse_period(0, 0);
+      break;
+    case 420:  // left button
+      record(TRACE_BUTTONS, 0x02, 0, 0, 0);
+      hostio_set_mouse_buttons(0x02);
+      break;
+    case 470:
+      record(TRACE_BUTTONS, 0x00, 0, 0, 0);
+      hostio_set_mouse_buttons(0x00);
+      break;
+    case 500:  // joystick event mode, then up on port 1
+      rx(0x14);
+      break;
+    case 560:
+      record(TRACE_JOYSTICK, 0, 0x10, 0, 0);
+      hostio_set_joystick(0x10);
+      break;
+    case 620:
+      record(TRACE_JOYSTICK, 0, 0x00, 0, 0);
+      hostio_set_joystick(0x00);
+      break;
+    case 680:  // back to the mouse, and the time of day
+      rx(0x08);
+      rx(0x1C);
+      break;
+    case 760:
+      record(TRACE_MOUSE, 0, 0, -700, 700);
+      hostio_set_mouse_period(-700, 700);
+      break;
+    case 800:
+      record(TRACE_MOUSE, 0, 0, 0, 0);
+      hostio_set_mouse_period(0, 0);
+      break;
+  }
+}
+
+static bool record_session(void) {
+  if (!hostio_boot()) {
+    printf("Failed to initialise HD6301\n");
+    return false;
+  }
+  record(TRACE_MOUSE_PHASE, 0, 0, 0x3333CCCC, 0x0F0F0F0F);
+  hostio_set_mouse_phase(0x3333CCCC, 0x0F0F0F0F);
+  hostio_set_poll_hook(mid_run);
+
+  int ms = 0;
+  while ((int64_t)cpu.ncycles < 1000 * MS) {
+    int64_t ran;
+    hd6301_run_until(HOSTIO_CYCLES_PER_SLICE, 0, &ran);
+    record_sent();
+    record_taken();
+    while (ms * MS <= (int64_t)cpu.ncycles) script(ms++);
+  }
+  hostio_set_poll_hook(NULL);
+  hostio_shutdown();
+
+  int sent = 0, taken = 0;
+  for (int i = 0; i < n_session; i++) {
+    sent += session[i].type == TRACE_TX;
+    taken += session[i].type == TRACE_RX;
+  }
+  printf("session: %d events, %d bytes sent, %d received\n", n_session, sent,
+         taken);
+  CHECK(n_session < MAX_EVENTS, "session too long");
+  CHECK(sent > 10, "only %d bytes sent", sent);
+  CHECK(queued >= 0, "no byte queued in the middle of a run");
+  CHECK(taken == 6, "%d bytes received of 6", taken);
+  return true;
+}
+
+static size_t encode_session(uint8_t* buf) {
+  trace_codec_t c;
+  size_t len = trace_write_header(buf);
+  trace_codec_init(&c);
+  for (int i = 0; i < n_session; i++) {
+    len += trace_encode(&c, &session[i], buf + len);
+  }
+  return len;
+}
+
+static void check_decodes(const uint8_t* buf, size_t len) {
+  size_t pos = trace_read_header(buf, len);
+  trace_codec_t c;
+  trace_codec_init(&c);
+  int i = 0;
+  CHECK(pos == TRACE_HEADER_SIZE, "session header");
+  while (pos && pos < len && i < n_session) {
+    trace_event_t ev;
+    size_t k = trace_decode(&c, buf + pos, len - pos, &ev);
+    CHECK(k && same_event(&ev, &session[i]), "session event %d", i);
+    if (!k) return;
+    pos += k;
+    i++;
+  }
+  CHECK(i == n_session && pos == len, "%d session events decoded of %d", i,
+        n_session);
+}
+
+static bool write_binary(const char* path, const uint8_t* buf, size_t len) {
+  FILE* f = fopen(path, "wb");
+  if (!f || fwrite(buf, 1, len, f) != len) {
+    perror(path);
+    if (f) fclose(f);
+    return false;
+  }
+  return !fclose(f);
+}
+
+// As the debug UART would have it: other output between the trace lines,
+// some ending in \r\n
+static bool write_log(const char* path, const uint8_t* buf, size_t len) {
+  FILE* f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  fprintf(f, "Booting rp2-ikbd\nST -> 6301 80\n");
+  for (size_t pos = 0, line = 0; pos < len; pos += LOG_LINE_BYTES, line++) {
+    fprintf(f, "IKTR ");
+    for (size_t i = pos; i < pos + LOG_LINE_BYTES && i < len; i++) {
+      fprintf(f, "%02X", buf[i]);
+    }
+    fprintf(f, line % 3 ? "\n" : "\r\n");
+    if (line % 5 == 2) fprintf(f, "6301 -> ST F1\nIKTR\n");
+  }
+  fprintf(f, "done\n");
+  return !fclose(f);
+}
+
+int main(int argc, char** argv) {
+  test_codec();
+  test_ring();
+
+  if (record_session()) {
+    static uint8_t buf[TRACE_HEADER_SIZE + MAX_EVENTS * TRACE_MAX_RECORD];
+    size_t len = encode_session(buf);
+    printf("trace: %zu bytes\n", len);
+    check_decodes(buf, len);
+    if (argc > 2) {
+      CHECK(write_binary(argv[1], buf, len), "writing %s", argv[1]);
+      CHECK(write_log(argv[2], buf, len), "writing %s", argv[2]);
+    }
+  } else {
+    failures++;
+  }
+
+  return test_result();
+}
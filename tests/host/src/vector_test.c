@@ -0,0 +1,491 @@
+/*
+ * HD6301 golden vector test
+ *
+ * hd6301_vectors.txt holds, for every opcode, single instructions run from
+ * random registers, flags and memory, with the state they left: registers,
+ * CCR, the memory they wrote, cycles and whether SLP or WAI stopped the
+ * CPU. This checks the reference engine (instr_exec) and the one the core
+ * was built with (hd6301_run_until) against each of them, so a rewrite of
+ * opfunc.c, alu.c or an engine is held to what the instructions did when
+ * the file was made, not only to another engine of the same tree.
+ *
+ * With -g the vectors are made instead, on the reference engine. For each
+ * random state every byte of internal RAM is changed in turn to see which
+ * ones the instruction reads and writes; the vector keeps those, the
+ * others are 0. Operands are kept in internal RAM (0080-00FF) and the
+ * stack at 00C0-00F0, interrupts are off. The internal registers, the
+ * interrupt sequence and the timer and serial events are engine_test's and
+ * timing_test's.
+ *
+ * The engine built in is the threaded one in all three builds: the ROM
+ * translated ahead of time (vector_test_aot) and the block cache
+ * (vector_test_bcache) only cover ROM code, and the vectors run from
+ * internal RAM, which those two builds have to hand back to it. Regenerate
+ * the file with 'cmake --build build-host --target vectors' after a
+ * deliberate change.
+ *
+ * Usage: vector_test <vectors>
+ *        vector_test -g <vectors>
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "6301.h"
+#include "chip.h"
+#include "cpu.h"
+#include "dispatch.h"
+#include "host_test.h"
+#include "hostio.h"
+#include "instr.h"
+#include "ireg.h"
+#include "opfunc.h"
+#include "optab.h"
+#include "predecode.h"
+#include "reg.h"
+#include "sci.h"
+#include "timer.h"
+
+#define VECTORS_VERSION 1
+#define PER_OPCODE 12
+#define PER_UNDEFINED 2
+#define MAX_VECTORS (256 * PER_OPCODE)
+#define MAX_RETRIES 100
+#define CODE 0x80     // where the instruction goes
+#define IRAM 0x80     // internal RAM, 0080-00FF
+#define IRAM_SIZE 0x80
+#define RAM_SIZE (256 + 4096)  // as allocated by mem_init()
+
+extern u_char* ram;
+
+static const char* const state_name[] = {"idle", "run", "slp", "wai"};
+
+struct state {
+  u_char a, b;
+  u_short x, sp, pc;
+  u_char ccr;
+  int state;  // enum cpu_states
+  int cycles;
+  u_char mem[IRAM_SIZE];
+};
+
+struct vector {
+  int op;
+  struct state before, after;
+  u_char read[IRAM_SIZE];   // before.mem[i] is part of the vector
+  u_char wrote[IRAM_SIZE];  // after.mem[i] is
+};
+
+static struct vector vectors[MAX_VECTORS];
+static int n_vectors;
+
+// Memory and internal registers after hostio_boot()
+static u_char boot_ram[RAM_SIZE];
+static u_char boot_iram[NIREGS];
+
+// --- Running one instruction ---
+
+static void state_load(const struct state* s) {
+  // Changing operands while making vectors can write anywhere, the ROM
+  // included, which the threaded engine keeps pre-decoded
+  if (memcmp(ram + 256, boot_ram + 256, RAM_SIZE - 256)) {
+    memcpy(ram + 256, boot_ram + 256, RAM_SIZE - 256);
+    predecode_rom_build();
+    dispatch_rom_build();
+  }
+  memcpy(ram, boot_ram, 256);
+  memcpy(iram, boot_iram, NIREGS);
+  sci_tx_begin = sci_tx_end = cpu.ncycles;
+  regs.accd.a = s->a;
+  regs.accd.b = s->b;
+  regs.ix = s->x;
+  regs.sp = s->sp;
+  regs.pc = s->pc;
+  regs.ccr = s->ccr | 0xC0;
+  cpu.state = RUNNING;
+  memcpy(&ram[IRAM], s->mem, IRAM_SIZE);
+  crashed = 0;
+  timer_reload();
+}
+
+static void state_take(struct state* s, COUNTER_VAR start) {
+  s->a = regs.accd.a;
+  s->b = regs.accd.b;
+  s->x = regs.ix;
+  s->sp = regs.sp;
+  s->pc = regs.pc;
+  s->ccr = regs.ccr | 0xC0;
+  s->state = cpu.state;
+  s->cycles = (int)(cpu.ncycles - start);
+  memcpy(s->mem, &ram[IRAM], IRAM_SIZE);
+}
+
+static void step(hostio_runner_t run, const struct state* before,
+                 struct state* after) {
+  int64_t ran;
+  state_load(before);
+  COUNTER_VAR start = cpu.ncycles;
+  run(1, 0, &ran);
+  state_take(after, start);
+}
+
+static int same_regs(const struct state* a, const struct state* b) {
+  return a->a == b->a && a->b == b->b && a->x == b->x && a->sp == b->sp &&
+         a->pc == b->pc && a->ccr == b->ccr && a->state == b->state &&
+         a->cycles == b->cycles;
+}
+
+// The state a vector starts from: what it read, 0 elsewhere
+static void vector_before(const struct vector* v, struct state* s) {
+  *s = v->before;
+  for (int i = 0; i < IRAM_SIZE; i++) {
+    if (!v->read[i]) s->mem[i] = 0;
+  }
+}
+
+// The state it has to end in
+static void vector_after(const struct vector* v, struct state* s) {
+  struct state before;
+  vector_before(v, &before);
+  *s = v->after;
+  for (int i = 0; i < IRAM_SIZE; i++) {
+    if (!v->wrote[i]) s->mem[i] = before.mem[i];
+  }
+}
+
+// Returns a description of the first difference, or NULL
+static const char* state_diff(const struct state* want,
+                              const struct state* got) {
+  static char what[32];
+  if (want->a != got->a) return "A";
+  if (want->b != got->b) return "B";
+  if (want->x != got->x) return "X";
+  if (want->sp != got->sp) return "SP";
+  if (want->pc != got->pc) return "PC";
+  if (want->ccr != got->ccr) return "CCR";
+  if (want->cycles != got->cycles) return "cycles";
+  if (want->state != got->state) return "SLP/WAI state";
+  for (int i = 0; i < IRAM_SIZE; i++) {
+    if (want->mem[i] != got->mem[i]) {
+      snprintf(what, sizeof(what), "memory at %04X", IRAM + i);
+      return what;
+    }
+  }
+  return NULL;
+}
+
+// --- Making the vectors ---
+
+static uint32_t rng = 0x6301;
+
+static uint32_t random32(void) {  // xorshift32, the same file everywhere
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+// Now and then a value at the edge of a flag
+static u_char random_byte(void) {
+  static const u_char edges[] = {0x00, 0x01, 0x09, 0x0F, 0x7F, 0x80, 0x99,
+                                 0xFF};
+  uint32_t r = random32();
+  return (r & 3) ? (u_char)(r >> 8) : edges[(r >> 8) % sizeof(edges)];
+}
+
+static u_short random_word(void) {
+  return (u_short)(random_byte() << 8 | random_byte());
+}
+
+static int opcode_defined(int op) {
+  return opcodetab[op].op_func != trap;
+}
+
+// Operands and X for 'op' that keep its memory accesses, 16-bit ones
+// included, in internal RAM. The mode follows from the opcode map.
+static void random_state(int op, struct state* s) {
+  int n = opcodetab[op].op_n_operands;
+  int hi = op >> 4;
+  int imm_dir = op == 0x71 || op == 0x72 || op == 0x75 || op == 0x7B;
+
+  for (int i = 0; i < IRAM_SIZE; i++) s->mem[i] = random_byte();
+  s->a = random_byte();
+  s->b = random_byte();
+  s->x = random_word();
+  s->sp = 0xC0 + random32() % 0x31;
+  s->pc = CODE;
+  s->ccr = random_byte();
+  s->state = RUNNING;
+  s->cycles = 0;
+
+  u_char* code = &s->mem[CODE - IRAM];
+  code[0] = (u_char)op;
+  if (hi == 0x9 || hi == 0xD || imm_dir) {  // dir, aim/oim/eim/tim
+    code[n] = 0x80 + random32() % 0x7F;
+  } else if (hi == 0x6 || hi == 0xA || hi == 0xE) {  // indexed
+    s->x = 0x80 + random32() % 0x40;
+    code[n] = random32() % 0x40;
+  } else if (hi == 0x7 || hi == 0xB || hi == 0xF) {  // ext
+    code[1] = 0x00;
+    code[2] = 0x80 + random32() % 0x7F;
+  }  // inh, imm and rel: any operand
+}
+
+// Which bytes 'before' reads and writes, by changing each in turn
+static void find_accesses(const struct state* before, struct vector* v) {
+  static const u_char flips[] = {0xFF, 0x01, 0x80};
+  struct state ref, changed, got;
+
+  step(hostio_run_reference, before, &ref);
+  for (int i = 0; i < IRAM_SIZE; i++) {
+    v->read[i] = v->wrote[i] = 0;
+    for (size_t f = 0; f < sizeof(flips); f++) {
+      changed = *before;
+      changed.mem[i] ^= flips[f];
+      step(hostio_run_reference, &changed, &got);
+      int wrote = got.mem[i] != changed.mem[i];
+      int same = same_regs(&got, &ref) && (!wrote || got.mem[i] == ref.mem[i]);
+      for (int j = 0; j < IRAM_SIZE && same; j++) {
+        if (j != i && got.mem[j] != ref.mem[j]) same = 0;
+      }
+      if (wrote) v->wrote[i] = 1;
+      if (!same) v->read[i] = 1;
+    }
+    if (ref.mem[i] != before->mem[i]) v->wrote[i] = 1;
+  }
+  v->before = *before;
+  v->after = ref;
+}
+
+static int make_vector(int op, struct vector* v) {
+  for (int retry = 0; retry < MAX_RETRIES; retry++) {
+    struct state before, want, got;
+    random_state(op, &before);
+    v->op = op;
+    find_accesses(&before, v);
+    // What is left of the state has to give the same result
+    vector_before(v, &before);
+    vector_after(v, &want);
+    step(hostio_run_reference, &before, &got);
+    if (!state_diff(&want, &got)) return 1;
+  }
+  return 0;
+}
+
+// --- The file ---
+
+// Runs of the bytes flagged, as addr:bytes
+static void print_mem(FILE* f, const u_char* mem, const u_char* flags) {
+  for (int i = 0; i < IRAM_SIZE; i++) {
+    if (!flags[i] || (i && flags[i - 1])) continue;
+    fprintf(f, " %04X:", IRAM + i);
+    for (int j = i; j < IRAM_SIZE && flags[j]; j++) fprintf(f, "%02X", mem[j]);
+  }
+}
+
+static int write_vectors(const char* path) {
+  FILE* f = fopen(path, "w");
+  if (!f) {
+    perror(path);
+    return 0;
+  }
+  fprintf(f,
+          "# HD6301 golden vectors: single instructions from random states, "
+          "as the\n"
+          "# reference engine (instr_exec) ran them. Made and read by "
+          "tests/host/src/vector_test.c.\n"
+          "#\n"
+          "# opcode  A B X SP CCR  memory read  >  A B X SP PC CCR cycles "
+          "state  memory written\n"
+          "#   the instruction is at %04X, internal RAM (0080-00FF) not "
+          "listed as read is 0\n"
+          "#   memory: runs of address:bytes, all in hex\n"
+          "#   state: run, or slp / wai after SLP / WAI\n"
+          "#   the trap and SWI vectors come from the IKBD ROM\n"
+          "version %d\n",
+          CODE, VECTORS_VERSION);
+  for (int i = 0; i < n_vectors; i++) {
+    const struct vector* v = &vectors[i];
+    const struct state* b = &v->before;
+    const struct state* a = &v->after;
+    fprintf(f, "%02X %02X %02X %04X %04X %02X", v->op, b->a, b->b, b->x, b->sp,
+            b->ccr | 0xC0);
+    print_mem(f, b->mem, v->read);
+    fprintf(f, " > %02X %02X %04X %04X %04X %02X %d %s", a->a, a->b, a->x,
+            a->sp, a->pc, a->ccr, a->cycles, state_name[a->state]);
+    print_mem(f, a->mem, v->wrote);
+    fprintf(f, "\n");
+  }
+  return !fclose(f);
+}
+
+static int generate(const char* path) {
+  for (int op = 0; op < 256; op++) {
+    int count = opcode_defined(op) ? PER_OPCODE : PER_UNDEFINED;
+    for (int i = 0; i < count; i++) {
+      if (!make_vector(op, &vectors[n_vectors])) {
+        printf("FAIL %02X (%s): no random state gives a vector\n", op,
+               hd6301_opcode_mnemonic(op));
+        failures++;
+        break;
+      }
+      n_vectors++;
+    }
+  }
+  if (!write_vectors(path)) failures++;
+  printf("%d vectors written to %s\n", n_vectors, path);
+  return !failures;
+}
+
+static int hex_digit(int c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+// Parses " addr:bytes" runs into mem and flags, up to anything else
+static const char* parse_mem(const char* p, u_char* mem, u_char* flags) {
+  unsigned addr;
+  int n;
+  while (sscanf(p, " %x:%n", &addr, &n) == 1 && n > 0) {
+    p += n;
+    for (; hex_digit(p[0]) >= 0 && hex_digit(p[1]) >= 0; p += 2, addr++) {
+      if (addr < IRAM || addr >= IRAM + IRAM_SIZE) return NULL;
+      mem[addr - IRAM] = (u_char)(hex_digit(p[0]) << 4 | hex_digit(p[1]));
+      flags[addr - IRAM] = 1;
+    }
+  }
+  return p;
+}
+
+static int parse_vector(const char* line, struct vector* v) {
+  unsigned op, ba, bb, bx, bsp, bccr, aa, ab, ax, asp, apc, accr;
+  char state[8];
+  int n;
+
+  memset(v, 0, sizeof(*v));
+  if (sscanf(line, "%x %x %x %x %x %x%n", &op, &ba, &bb, &bx, &bsp, &bccr,
+             &n) != 6) {
+    return 0;
+  }
+  const char* p = parse_mem(line + n, v->before.mem, v->read);
+  if (!p || sscanf(p, " > %x %x %x %x %x %x %d %7s%n", &aa, &ab, &ax, &asp,
+                   &apc, &accr, &v->after.cycles, state, &n) != 8) {
+    return 0;
+  }
+  p = parse_mem(p + n, v->after.mem, v->wrote);
+  if (!p || (*p && *p != '\n' && *p != '\r')) return 0;
+
+  v->op = (int)op;
+  v->before.a = ba;
+  v->before.b = bb;
+  v->before.x = bx;
+  v->before.sp = bsp;
+  v->before.pc = CODE;
+  v->before.ccr = bccr;
+  v->before.state = RUNNING;
+  v->after.a = aa;
+  v->after.b = ab;
+  v->after.x = ax;
+  v->after.sp = asp;
+  v->after.pc = apc;
+  v->after.ccr = accr;
+  v->after.state = -1;
+  for (int i = 0; i < 4; i++) {
+    if (!strcmp(state, state_name[i])) v->after.state = i;
+  }
+  return op < 256 && v->after.state >= RUNNING;
+}
+
+static int read_vectors(const char* path) {
+  static char line[1024];
+  static struct vector v;
+  int version = 0, lines = 0;
+  FILE* f = fopen(path, "r");
+
+  if (!f) {
+    perror(path);
+    return 0;
+  }
+  while (fgets(line, sizeof(line), f)) {
+    lines++;
+    if (line[0] == '#' || line[0] == '\n') continue;
+    if (!version) {
+      if (sscanf(line, "version %d", &version) != 1 ||
+          version != VECTORS_VERSION) {
+        CHECK(0, "%s: version %d, this test reads %d", path, version,
+              VECTORS_VERSION);
+        break;
+      }
+    } else if (n_vectors < MAX_VECTORS && parse_vector(line, &v)) {
+      vectors[n_vectors++] = v;
+    } else {
+      CHECK(0, "%s: can't read line %d", path, lines);
+      break;
+    }
+  }
+  fclose(f);
+  return version == VECTORS_VERSION && !failures;
+}
+
+// --- Checking ---
+
+static void check_engine(int e) {
+  int covered[256] = {0};
+  int failed = 0;
+
+  for (int i = 0; i < n_vectors; i++) {
+    const struct vector* v = &vectors[i];
+    struct state before, want, got;
+    vector_before(v, &before);
+    vector_after(v, &want);
+    step(hostio_engines[e].run, &before, &got);
+    covered[v->op]++;
+    const char* diff = state_diff(&want, &got);
+    if (diff && failed++ < 10) {
+      CHECK(0, "%s: vector %d, %02X (%s): %s differs",
+            hostio_engines[e].name, i, v->op, hd6301_opcode_mnemonic(v->op),
+            diff);
+      printf("  before A=%02X B=%02X X=%04X SP=%04X CCR=%02X\n", before.a,
+             before.b, before.x, before.sp, before.ccr);
+      printf("  want   A=%02X B=%02X X=%04X SP=%04X PC=%04X CCR=%02X %d "
+             "cycles %s\n",
+             want.a, want.b, want.x, want.sp, want.pc, want.ccr, want.cycles,
+             state_name[want.state]);
+      printf("  got    A=%02X B=%02X X=%04X SP=%04X PC=%04X CCR=%02X %d "
+             "cycles %s\n",
+             got.a, got.b, got.x, got.sp, got.pc, got.ccr, got.cycles,
+             state_name[got.state]);
+    } else if (diff) {
+      failures++;
+    }
+  }
+  for (int op = 0; op < 256; op++) {
+    CHECK(covered[op], "no vector for opcode %02X", op);
+  }
+  printf("%s: %d vectors, %d failed\n", hostio_engines[e].name, n_vectors,
+         failed);
+}
+
+int main(int argc, char** argv) {
+  int gen = argc == 3 && !strcmp(argv[1], "-g");
+  if (argc != 2 && !gen) {
+    printf("Usage: %s [-g] <vectors>\n", argv[0]);
+    return 2;
+  }
+  if (!hostio_boot()) {
+    printf("Failed to initialise HD6301\n");
+    return 1;
+  }
+  memcpy(boot_ram, ram, RAM_SIZE);
+  memcpy(boot_iram, iram, NIREGS);
+  if (gen) {
+    generate(argv[2]);
+  } else if (read_vectors(argv[1])) {
+    for (int e = 0; e < HOSTIO_ENGINES; e++) check_engine(e);
+  }
+  hostio_shutdown();
+
+  return test_result();
+}